@@ -0,0 +1,58 @@
+<#
+.SYNOPSIS
+    Replays representative CLI workloads against a PGO-instrumented winget.exe to collect training data.
+    Each invocation flushes a .pgc file next to the binary; relink with WingetPgoMode=Optimize afterward.
+.PARAMETER CliPath
+    Path to the instrumented winget.exe to train.
+.PARAMETER SourceUrl
+    URL of the REST source to exercise; defaults to the LocalhostWebServer test source.
+.PARAMETER SourceName
+    Name under which the training source is added and removed.
+#>
+
+param(
+    [Parameter(Mandatory=$true)]
+    [string]$CliPath,
+
+    [string]$SourceUrl = "https://localhost:5001/TestKit",
+
+    [string]$SourceName = "PgoTrainingSource"
+)
+
+if (-not (Test-Path $CliPath)) {
+    Write-Error "Instrumented CLI not found at $CliPath"
+    exit 1
+}
+
+# The workloads cover startup, source handling, search, metadata display, the installed
+# package correlation path, and an install; these are the call-dense paths worth training.
+# Training data quality, not command success, is what matters here, so failures are logged
+# but do not fail the run.
+$workloads = @(
+    "--info",
+    "--help",
+    "search --help",
+    "source remove $SourceName",
+    "source add $SourceName $SourceUrl",
+    "search AppInstallerTest -s $SourceName",
+    "search TestExeInstaller -s $SourceName --exact",
+    "search Installer -s $SourceName --count 10",
+    "show AppInstallerTest.TestExeInstaller -s $SourceName",
+    "show AppInstallerTest.TestExeInstaller -s $SourceName --versions",
+    "list",
+    "list Test",
+    "install AppInstallerTest.TestExeInstaller -s $SourceName --silent",
+    "upgrade",
+    "source remove $SourceName"
+)
+
+foreach ($workload in $workloads) {
+    Write-Host "PGO training: winget $workload"
+    $process = Start-Process -FilePath $CliPath -ArgumentList $workload -NoNewWindow -Wait -PassThru
+    Write-Host "  exit code: $($process.ExitCode)"
+}
+
+$pgcCount = (Get-ChildItem -Path (Split-Path $CliPath) -Filter *.pgc -ErrorAction SilentlyContinue | Measure-Object).Count
+Write-Host "PGO training complete; $pgcCount .pgc file(s) collected"
+
+exit 0
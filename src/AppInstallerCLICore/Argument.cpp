@@ -19,203 +19,148 @@ namespace AppInstaller::CLI
         {
             return std::any_of(argTypes.begin(), argTypes.end(), [&](Execution::Args::Type arg) { return args.Contains(arg); });
         }
-    }
 
-    ArgumentCommon ArgumentCommon::ForType(Execution::Args::Type type)
-    {
-        // A test ensures that all types are listed here
-        switch (type)
+        // The argument metadata, indexed by Execution::Args::Type.
+        // Keeping it as a compile time table means every lookup is a copy of static
+        // data rather than a rebuilt object; the static assert below and a test
+        // ensure that the table stays in sync with the enumeration.
+        constexpr ArgumentCommon s_argumentCommonTable[]
         {
-        // Args to specify where to get app
-        case Execution::Args::Type::Query:
-            return { type, "query"_liv, 'q', ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery };
-        case Execution::Args::Type::MultiQuery:
-            return { type, "query"_liv, 'q', ArgTypeCategory::PackageQuery };
-        case Execution::Args::Type::Manifest:
-            return { type, "manifest"_liv, 'm', ArgTypeCategory::Manifest };
-
-        // Query filtering criteria and query behavior
-        case Execution::Args::Type::Id:
-            return { type, "id"_liv, ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery };
-        case Execution::Args::Type::Name:
-            return { type, "name"_liv, ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery };
-        case Execution::Args::Type::Moniker:
-            return { type, "moniker"_liv, ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery };
-        case Execution::Args::Type::Tag:
-            return { type, "tag"_liv, ArgTypeCategory::PackageQuery };
-        case Execution::Args::Type::Command:
-            return { type, "command"_liv, "cmd"_liv, ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery };
-        case Execution::Args::Type::Source:
-            return { type, "source"_liv, 's', ArgTypeCategory::Source };
-        case Execution::Args::Type::Count:
-            return { type, "count"_liv, 'n', ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery };
-        case Execution::Args::Type::Exact:
-            return { type, "exact"_liv, 'e', ArgTypeCategory::PackageQuery };
-
-        // Manifest selection behavior after an app is found
-        case Execution::Args::Type::Version:
-            return { type, "version"_liv, 'v', ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery };
-        case Execution::Args::Type::Channel:
-            return { type, "channel"_liv, 'c', ArgTypeCategory::PackageQuery };
-
-        // Install behavior
-        case Execution::Args::Type::Interactive:
-            return { type, "interactive"_liv, 'i', ArgTypeCategory::InstallerBehavior | ArgTypeCategory::CopyFlagToSubContext };
-        case Execution::Args::Type::Silent:
-            return { type, "silent"_liv, 'h', ArgTypeCategory::InstallerBehavior | ArgTypeCategory::CopyFlagToSubContext };
-        case Execution::Args::Type::Locale:
-            return { type, "locale"_liv, ArgTypeCategory::InstallerSelection | ArgTypeCategory::CopyValueToSubContext };
-        case Execution::Args::Type::Log:
-            return { type, "log"_liv, 'o', ArgTypeCategory::InstallerSelection | ArgTypeCategory::SingleInstallerBehavior };
-        case Execution::Args::Type::CustomSwitches:
-            return { type, "custom"_liv, ArgTypeCategory::InstallerSelection | ArgTypeCategory::SingleInstallerBehavior };
-        case Execution::Args::Type::Override:
-            return { type, "override"_liv, ArgTypeCategory::InstallerSelection | ArgTypeCategory::SingleInstallerBehavior };
-        case Execution::Args::Type::InstallLocation:
-            return { type, "location"_liv, 'l', ArgTypeCategory::InstallerSelection | ArgTypeCategory::SingleInstallerBehavior };
-        case Execution::Args::Type::InstallScope:
-            return { type, "scope"_liv, ArgTypeCategory::InstallerSelection | ArgTypeCategory::CopyValueToSubContext };
-        case Execution::Args::Type::InstallArchitecture:
-            return { type, "architecture"_liv, 'a', ArgTypeCategory::InstallerSelection | ArgTypeCategory::CopyValueToSubContext };
-        case Execution::Args::Type::HashOverride:
-            return { type, "ignore-security-hash"_liv, ArgTypeCategory::InstallerBehavior | ArgTypeCategory::CopyFlagToSubContext };
-        case Execution::Args::Type::IgnoreLocalArchiveMalwareScan:
-            return { type, "ignore-local-archive-malware-scan"_liv, ArgTypeCategory::InstallerBehavior | ArgTypeCategory::CopyFlagToSubContext };
-        case Execution::Args::Type::AcceptPackageAgreements:
-            return { type, "accept-package-agreements"_liv, ArgTypeCategory::InstallerBehavior };
-        case Execution::Args::Type::Rename:
-            return { type, "rename"_liv, 'r' };
-        case Execution::Args::Type::NoUpgrade:
-            return { type, "no-upgrade"_liv, ArgTypeCategory::CopyFlagToSubContext };
-
-        // Uninstall behavior
-        case Execution::Args::Type::Purge:
-            return { type, "purge"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::PurgePreserve };
-        case Execution::Args::Type::Preserve:
-            return { type, "preserve"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::PurgePreserve };
-        case Execution::Args::Type::ProductCode:
-            return { type, "product-code"_liv, ArgTypeCategory::SinglePackageQuery };
-
-        //Source Command
-        case Execution::Args::Type::SourceName:
-            return { type, "name"_liv, 'n' };
-        case Execution::Args::Type::SourceType:
-            return { type, "type"_liv, 't' };
-        case Execution::Args::Type::SourceArg:
-            return { type, "arg"_liv, 'a' };
-        case Execution::Args::Type::ForceSourceReset:
-            return { type, "force"_liv };
-
-        //Hash Command
-        case Execution::Args::Type::HashFile:
-            return { type, "file"_liv, 'f' };
-        case Execution::Args::Type::Msix:
-            return { type, "msix"_liv, 'm' };
-
-        //Validate Command
-        case Execution::Args::Type::ValidateManifest:
-            return { type, "manifest"_liv };
-
-        // Complete Command
-        case Execution::Args::Type::Word:
-            return { type, "word"_liv };
-        case Execution::Args::Type::CommandLine:
-            return { type, "commandline"_liv };
-        case Execution::Args::Type::Position:
-            return { type, "position"_liv };
-
-        // Export Command
-        case Execution::Args::Type::OutputFile:
-            return { type, "output"_liv, 'o' };
-        case Execution::Args::Type::IncludeVersions:
-            return { type, "include-versions"_liv };
-
-        // Import Command
-        case Execution::Args::Type::ImportFile:
-            return { type, "import-file"_liv, 'i' };
-        case Execution::Args::Type::IgnoreUnavailable:
-            return { type, "ignore-unavailable"_liv };
-        case Execution::Args::Type::IgnoreVersions:
-            return { type, "ignore-versions"_liv };
-
-        // Setting Command
-        case Execution::Args::Type::AdminSettingEnable:
-            return { type, "enable"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::EnableDisable };
-        case Execution::Args::Type::AdminSettingDisable:
-            return { type, "disable"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::EnableDisable };
-
-        // Upgrade command
-        case Execution::Args::Type::All:
-            return { type, "all"_liv, 'r', "recurse"_liv, ArgTypeCategory::MultiplePackages };
-        case Execution::Args::Type::IncludeUnknown:
-            return { type, "include-unknown"_liv, 'u', "unknown"_liv };
-        case Execution::Args::Type::IncludePinned:
-            return { type, "include-pinned"_liv, "pinned"_liv, ArgTypeCategory::CopyFlagToSubContext };
-        case Execution::Args::Type::UninstallPrevious:
-            return { type, "uninstall-previous"_liv, ArgTypeCategory::InstallerBehavior | ArgTypeCategory::CopyFlagToSubContext };
-
-        // Show command
-        case Execution::Args::Type::ListVersions:
-            return { type, "versions"_liv };
-
-        // List command
-        case Execution::Args::Type::Upgrade:
-            return { type, "upgrade-available"_liv};
-
-
-        // Pin command
-        case Execution::Args::Type::GatedVersion:
-            return { type, "version"_liv, 'v', ArgTypeCategory::None, ArgTypeExclusiveSet::PinType };
-        case Execution::Args::Type::BlockingPin:
-            return { type, "blocking"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::PinType };
-        case Execution::Args::Type::PinInstalled:
-            return { type, "installed"_liv, ArgTypeCategory::None };
-
-        // Configuration commands
-        case Execution::Args::Type::ConfigurationFile:
-            return { type, "file"_liv, 'f' };
-        case Execution::Args::Type::ConfigurationAcceptWarning:
-            return { type, "accept-configuration-agreements"_liv };
-
-        // Common arguments
-        case Execution::Args::Type::NoVT:
-            return { type, "no-vt"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::ProgressBarOption };
-        case Execution::Args::Type::RetroStyle:
-            return { type, "retro"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::ProgressBarOption };
-        case Execution::Args::Type::RainbowStyle:
-            return { type, "rainbow"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::ProgressBarOption };
-        case Execution::Args::Type::Help:
-            return { type, "help"_liv, APPINSTALLER_CLI_HELP_ARGUMENT_TEXT_CHAR };
-        case Execution::Args::Type::Info:
-            return { type, "info"_liv };
-        case Execution::Args::Type::VerboseLogs:
-            return { type, "verbose-logs"_liv, "verbose"_liv };
-        case Execution::Args::Type::DisableInteractivity:
-            return { type, "disable-interactivity"_liv };
-        case Execution::Args::Type::Wait:
-            return { type, "wait"_liv };
-        case Execution::Args::Type::OpenLogs:
-            return { type, "open-logs"_liv, "logs"_liv };
-        case Execution::Args::Type::Force:
-            return { type, "force"_liv, ArgTypeCategory::CopyFlagToSubContext };
-
-        case Execution::Args::Type::DependencySource:
-            return { type, "dependency-source"_liv, ArgTypeCategory::Source };
-        case Execution::Args::Type::CustomHeader:
-            return { type, "header"_liv, ArgTypeCategory::Source };
-        case Execution::Args::Type::AcceptSourceAgreements:
-            return { type, "accept-source-agreements"_liv, ArgTypeCategory::Source };
-
-        case Execution::Args::Type::ToolVersion:
-            return { type, "version"_liv, 'v' };
-
-        // Used for demonstration purposes
-        case Execution::Args::Type::ExperimentalArg:
-                return { type, "arg"_liv };
+            // Args to specify where to get app
+            { Execution::Args::Type::Query, "query"_liv, 'q', ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery },
+            { Execution::Args::Type::MultiQuery, "query"_liv, 'q', ArgTypeCategory::PackageQuery },
+            { Execution::Args::Type::Manifest, "manifest"_liv, 'm', ArgTypeCategory::Manifest },
+
+            // Query filtering criteria and query behavior
+            { Execution::Args::Type::Id, "id"_liv, ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery },
+            { Execution::Args::Type::Name, "name"_liv, ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery },
+            { Execution::Args::Type::Moniker, "moniker"_liv, ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery },
+            { Execution::Args::Type::Tag, "tag"_liv, ArgTypeCategory::PackageQuery },
+            { Execution::Args::Type::Command, "command"_liv, "cmd"_liv, ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery },
+            { Execution::Args::Type::Source, "source"_liv, 's', ArgTypeCategory::Source },
+            { Execution::Args::Type::Count, "count"_liv, 'n', ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery },
+            { Execution::Args::Type::Exact, "exact"_liv, 'e', ArgTypeCategory::PackageQuery },
+
+            // Manifest selection behavior after an app is found
+            { Execution::Args::Type::Version, "version"_liv, 'v', ArgTypeCategory::PackageQuery | ArgTypeCategory::SinglePackageQuery },
+            { Execution::Args::Type::Channel, "channel"_liv, 'c', ArgTypeCategory::PackageQuery },
+
+            // Install behavior
+            { Execution::Args::Type::Interactive, "interactive"_liv, 'i', ArgTypeCategory::InstallerBehavior | ArgTypeCategory::CopyFlagToSubContext },
+            { Execution::Args::Type::Silent, "silent"_liv, 'h', ArgTypeCategory::InstallerBehavior | ArgTypeCategory::CopyFlagToSubContext },
+            { Execution::Args::Type::Locale, "locale"_liv, ArgTypeCategory::InstallerSelection | ArgTypeCategory::CopyValueToSubContext },
+            { Execution::Args::Type::Log, "log"_liv, 'o', ArgTypeCategory::InstallerSelection | ArgTypeCategory::SingleInstallerBehavior },
+            { Execution::Args::Type::CustomSwitches, "custom"_liv, ArgTypeCategory::InstallerSelection | ArgTypeCategory::SingleInstallerBehavior },
+            { Execution::Args::Type::Override, "override"_liv, ArgTypeCategory::InstallerSelection | ArgTypeCategory::SingleInstallerBehavior },
+            { Execution::Args::Type::InstallLocation, "location"_liv, 'l', ArgTypeCategory::InstallerSelection | ArgTypeCategory::SingleInstallerBehavior },
+            { Execution::Args::Type::InstallScope, "scope"_liv, ArgTypeCategory::InstallerSelection | ArgTypeCategory::CopyValueToSubContext },
+            { Execution::Args::Type::InstallArchitecture, "architecture"_liv, 'a', ArgTypeCategory::InstallerSelection | ArgTypeCategory::CopyValueToSubContext },
+            { Execution::Args::Type::HashOverride, "ignore-security-hash"_liv, ArgTypeCategory::InstallerBehavior | ArgTypeCategory::CopyFlagToSubContext },
+            { Execution::Args::Type::IgnoreLocalArchiveMalwareScan, "ignore-local-archive-malware-scan"_liv, ArgTypeCategory::InstallerBehavior | ArgTypeCategory::CopyFlagToSubContext },
+            { Execution::Args::Type::AcceptPackageAgreements, "accept-package-agreements"_liv, ArgTypeCategory::InstallerBehavior },
+            { Execution::Args::Type::Rename, "rename"_liv, 'r' },
+            { Execution::Args::Type::NoUpgrade, "no-upgrade"_liv, ArgTypeCategory::CopyFlagToSubContext },
+
+            // Uninstall behavior
+            { Execution::Args::Type::Purge, "purge"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::PurgePreserve },
+            { Execution::Args::Type::Preserve, "preserve"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::PurgePreserve },
+            { Execution::Args::Type::ProductCode, "product-code"_liv, ArgTypeCategory::SinglePackageQuery },
+
+            //Source Command
+            { Execution::Args::Type::SourceName, "name"_liv, 'n' },
+            { Execution::Args::Type::SourceType, "type"_liv, 't' },
+            { Execution::Args::Type::SourceArg, "arg"_liv, 'a' },
+            { Execution::Args::Type::ForceSourceReset, "force"_liv },
+
+            //Hash Command
+            { Execution::Args::Type::HashFile, "file"_liv, 'f' },
+            { Execution::Args::Type::Msix, "msix"_liv, 'm' },
+
+            //Validate Command
+            { Execution::Args::Type::ValidateManifest, "manifest"_liv },
+
+            // Complete Command
+            { Execution::Args::Type::Word, "word"_liv },
+            { Execution::Args::Type::CommandLine, "commandline"_liv },
+            { Execution::Args::Type::Position, "position"_liv },
+
+            // Export Command
+            { Execution::Args::Type::OutputFile, "output"_liv, 'o' },
+            { Execution::Args::Type::IncludeVersions, "include-versions"_liv },
+
+            // Import Command
+            { Execution::Args::Type::ImportFile, "import-file"_liv, 'i' },
+            { Execution::Args::Type::IgnoreUnavailable, "ignore-unavailable"_liv },
+            { Execution::Args::Type::IgnoreVersions, "ignore-versions"_liv },
+
+            // Setting Command
+            { Execution::Args::Type::AdminSettingEnable, "enable"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::EnableDisable },
+            { Execution::Args::Type::AdminSettingDisable, "disable"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::EnableDisable },
+
+            // Upgrade command
+            { Execution::Args::Type::All, "all"_liv, 'r', "recurse"_liv, ArgTypeCategory::MultiplePackages },
+            { Execution::Args::Type::IncludeUnknown, "include-unknown"_liv, 'u', "unknown"_liv },
+            { Execution::Args::Type::IncludePinned, "include-pinned"_liv, "pinned"_liv, ArgTypeCategory::CopyFlagToSubContext },
+            { Execution::Args::Type::UninstallPrevious, "uninstall-previous"_liv, ArgTypeCategory::InstallerBehavior | ArgTypeCategory::CopyFlagToSubContext },
+
+            // Show command
+            { Execution::Args::Type::ListVersions, "versions"_liv },
+
+            // List command
+            { Execution::Args::Type::Upgrade, "upgrade-available"_liv },
+
+            // Pin command
+            { Execution::Args::Type::GatedVersion, "version"_liv, 'v', ArgTypeCategory::None, ArgTypeExclusiveSet::PinType },
+            { Execution::Args::Type::BlockingPin, "blocking"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::PinType },
+            { Execution::Args::Type::PinInstalled, "installed"_liv, ArgTypeCategory::None },
+
+            // Configuration commands
+            { Execution::Args::Type::ConfigurationFile, "file"_liv, 'f' },
+            { Execution::Args::Type::ConfigurationAcceptWarning, "accept-configuration-agreements"_liv },
+
+            // Common arguments
+            { Execution::Args::Type::NoVT, "no-vt"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::ProgressBarOption },
+            { Execution::Args::Type::RetroStyle, "retro"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::ProgressBarOption },
+            { Execution::Args::Type::RainbowStyle, "rainbow"_liv, ArgTypeCategory::None, ArgTypeExclusiveSet::ProgressBarOption },
+            { Execution::Args::Type::Help, "help"_liv, APPINSTALLER_CLI_HELP_ARGUMENT_TEXT_CHAR },
+            { Execution::Args::Type::Info, "info"_liv },
+            { Execution::Args::Type::VerboseLogs, "verbose-logs"_liv, "verbose"_liv },
+            { Execution::Args::Type::DisableInteractivity, "disable-interactivity"_liv },
+            { Execution::Args::Type::Wait, "wait"_liv },
+            { Execution::Args::Type::OpenLogs, "open-logs"_liv, "logs"_liv },
+            { Execution::Args::Type::Force, "force"_liv, ArgTypeCategory::CopyFlagToSubContext },
+
+            { Execution::Args::Type::DependencySource, "dependency-source"_liv, ArgTypeCategory::Source },
+            { Execution::Args::Type::CustomHeader, "header"_liv, ArgTypeCategory::Source },
+            { Execution::Args::Type::AcceptSourceAgreements, "accept-source-agreements"_liv, ArgTypeCategory::Source },
+
+            { Execution::Args::Type::ToolVersion, "version"_liv, 'v' },
+
+            // Used for demonstration purposes
+            { Execution::Args::Type::ExperimentalArg, "arg"_liv },
+        };
+
+        constexpr bool ArgumentCommonTableIsInEnumOrder()
+        {
+            for (size_t i = 0; i < std::size(s_argumentCommonTable); ++i)
+            {
+                if (static_cast<size_t>(s_argumentCommonTable[i].Type) != i)
+                {
+                    return false;
+                }
+            }
 
-        default:
-            THROW_HR(E_UNEXPECTED);
+            return true;
         }
+
+        static_assert(std::size(s_argumentCommonTable) == static_cast<size_t>(Execution::Args::Type::Max), "The argument metadata table must cover every argument type");
+        static_assert(ArgumentCommonTableIsInEnumOrder(), "The argument metadata table must be in enumeration order");
+    }
+
+    ArgumentCommon ArgumentCommon::ForType(Execution::Args::Type type)
+    {
+        THROW_HR_IF(E_UNEXPECTED, type >= Execution::Args::Type::Max);
+        return s_argumentCommonTable[static_cast<size_t>(type)];
     }
 
     std::vector<ArgumentCommon> ArgumentCommon::GetFromExecArgs(const Execution::Args& execArgs)
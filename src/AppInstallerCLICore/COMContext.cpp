@@ -9,6 +9,9 @@ namespace AppInstaller::CLI::Execution
 {
     static constexpr std::string_view s_comLogFileNamePrefix = "WinGetCOM"sv;
 
+    // The minimum time between Progressing reports delivered to COM clients.
+    static constexpr std::chrono::milliseconds s_progressReportInterval{ 100 };
+
     NullStream::NullStream()
     {
         m_nullOut.reset(new std::ostream(&m_nullStreamBuf));
@@ -33,11 +36,35 @@ namespace AppInstaller::CLI::Execution
 
     void COMContext::BeginProgress()
     {
+        {
+            std::lock_guard<std::mutex> lock{ m_callbackLock };
+            m_lastProgressReport = {};
+            m_hasPendingProgress = false;
+        }
+
         FireCallbacks(ReportType::BeginProgress, 0, 0, ProgressType::None, m_executionStage);
     };
 
     void COMContext::OnProgress(uint64_t current, uint64_t maximum, ProgressType progressType)
     {
+        {
+            std::lock_guard<std::mutex> lock{ m_callbackLock };
+
+            auto now = std::chrono::steady_clock::now();
+            if (now - m_lastProgressReport < s_progressReportInterval)
+            {
+                // Coalesce; the next report past the interval or EndProgress delivers these values.
+                m_pendingProgressCurrent = current;
+                m_pendingProgressMaximum = maximum;
+                m_pendingProgressType = progressType;
+                m_hasPendingProgress = true;
+                return;
+            }
+
+            m_lastProgressReport = now;
+            m_hasPendingProgress = false;
+        }
+
         FireCallbacks(ReportType::Progressing, current, maximum, progressType, m_executionStage);
     }
 
@@ -48,6 +75,26 @@ namespace AppInstaller::CLI::Execution
 
     void COMContext::EndProgress(bool)
     {
+        bool hasPendingProgress = false;
+        uint64_t pendingCurrent = 0;
+        uint64_t pendingMaximum = 0;
+        ProgressType pendingType = ProgressType::None;
+
+        {
+            std::lock_guard<std::mutex> lock{ m_callbackLock };
+            hasPendingProgress = m_hasPendingProgress;
+            pendingCurrent = m_pendingProgressCurrent;
+            pendingMaximum = m_pendingProgressMaximum;
+            pendingType = m_pendingProgressType;
+            m_hasPendingProgress = false;
+        }
+
+        // Deliver any coalesced progress so that observers see the final values.
+        if (hasPendingProgress)
+        {
+            FireCallbacks(ReportType::Progressing, pendingCurrent, pendingMaximum, pendingType, m_executionStage);
+        }
+
         FireCallbacks(ReportType::EndProgress, 0, 0, ProgressType::None, m_executionStage);
     };
 
@@ -5,6 +5,8 @@
 #include "ExecutionContext.h"
 #include "Workflows/WorkflowBase.h"
 
+#include <chrono>
+
 namespace AppInstaller::CLI::Execution
 {
     enum class ReportType : uint32_t
@@ -81,5 +83,15 @@ namespace AppInstaller::CLI::Execution
         std::vector<ProgressCallBackFunction> m_comProgressCallbacks;
         std::wstring m_correlationData = L"";
         std::mutex m_callbackLock;
+
+        // Progressing reports are coalesced to an interval so that rapid progress (one
+        // report per downloaded buffer) does not turn into one cross-apartment call each;
+        // the latest coalesced values are delivered by the next report past the interval
+        // or by EndProgress. Begin/End/phase reports always fire.
+        std::chrono::steady_clock::time_point m_lastProgressReport{};
+        uint64_t m_pendingProgressCurrent = 0;
+        uint64_t m_pendingProgressMaximum = 0;
+        ProgressType m_pendingProgressType = ProgressType::None;
+        bool m_hasPendingProgress = false;
     };
 }
@@ -948,6 +948,13 @@ namespace AppInstaller::CLI
     {
         ExecuteWithoutLoggingSuccess(context, command.get());
 
+        // Complete any bookkeeping that the command deferred off its critical path.
+        Workflow::BackgroundBookkeeper::Instance().Drain();
+
+#if WINGET_CONTEXT_DATA_INSTRUMENTATION_ENABLED
+        Execution::Instrumentation::ReportDataAddCounts();
+#endif
+
         if (SUCCEEDED(context.GetTerminationHR()))
         {
             Logging::Telemetry().LogCommandSuccess(command->FullName());
@@ -110,6 +110,10 @@ namespace AppInstaller::CLI
         virtual void Complete(Execution::Context& context) const;
         virtual void Complete(Execution::Context& context, Execution::Args::Type valueType) const;
 
+        // Indicates whether executing this command requires the WinRT apartment to be initialized.
+        // Metadata only commands override this to skip the fixed activation cost at startup.
+        virtual bool RequiresWinRTInitialization() const { return true; }
+
         virtual void Execute(Execution::Context& context) const;
 
     protected:
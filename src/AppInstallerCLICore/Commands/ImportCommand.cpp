@@ -48,6 +48,7 @@ namespace AppInstaller::CLI
             Workflow::OpenSourcesForImport <<
             Workflow::OpenPredefinedSource(Repository::PredefinedSource::Installed) <<
             Workflow::GetSearchRequestsForImport <<
+            Workflow::EnsureImportFileValidated <<
             Workflow::SearchSubContextsForSingle() <<
             Workflow::ReportExecutionStage(Workflow::ExecutionStage::Execution) <<
             Workflow::InstallImportedPackages;
@@ -18,6 +18,9 @@ namespace AppInstaller::CLI
 
         Utility::LocIndView HelpLink() const override;
 
+        // Help, version and info output do not activate any WinRT class.
+        bool RequiresWinRTInitialization() const override { return false; }
+
         void Execute(Execution::Context& context) const override;
 
     protected:
@@ -17,6 +17,9 @@ namespace AppInstaller::CLI
 
         Utility::LocIndView HelpLink() const override;
 
+        // Settings manipulation is file based and does not activate any WinRT class.
+        bool RequiresWinRTInitialization() const override { return false; }
+
     protected:
         void ValidateArgumentsInternal(Execution::Args& execArgs) const override;
         void ExecuteInternal(Execution::Context& context) const override;
@@ -31,6 +34,9 @@ namespace AppInstaller::CLI
 
         Utility::LocIndView HelpLink() const override;
 
+        // Exporting settings is file based and does not activate any WinRT class.
+        bool RequiresWinRTInitialization() const override { return false; }
+
     protected:
         void ExecuteInternal(Execution::Context& context) const override;
     };
@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "CompletionIndex.h"
+#include <AppInstallerLogging.h>
+#include <AppInstallerRuntime.h>
+#include <AppInstallerSHA256.h>
+#include <AppInstallerStrings.h>
+
+namespace AppInstaller::CLI
+{
+    using namespace std::string_view_literals;
+
+    namespace
+    {
+        constexpr std::string_view s_CompletionIndex_Directory = "completionIndex"sv;
+
+        std::filesystem::path GetCompletionIndexPath(const Repository::SourceDetails& details)
+        {
+            return Runtime::GetPathTo(Runtime::PathName::LocalState) / s_CompletionIndex_Directory /
+                (Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(details.Identifier)) + ".txt");
+        }
+
+        // The index is stamped with the source's last update time; zero means the
+        // source gives no invalidation signal and cannot be indexed safely.
+        int64_t GetSourceStamp(const Repository::SourceDetails& details)
+        {
+            return std::chrono::duration_cast<std::chrono::seconds>(details.LastUpdateTime.time_since_epoch()).count();
+        }
+
+        // Sorts entries by their lowercase form so that a prefix lookup can binary search.
+        void SortAndRemoveDuplicates(std::vector<std::string>& entries)
+        {
+            std::sort(entries.begin(), entries.end(),
+                [](const std::string& a, const std::string& b) { return Utility::ToLower(a) < Utility::ToLower(b); });
+            entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+        }
+    }
+
+    std::optional<CompletionIndex> CompletionIndex::TryLoad(const Repository::SourceDetails& details) try
+    {
+        int64_t stamp = GetSourceStamp(details);
+        if (stamp == 0)
+        {
+            return std::nullopt;
+        }
+
+        std::ifstream stream{ GetCompletionIndexPath(details) };
+        if (!stream)
+        {
+            return std::nullopt;
+        }
+
+        std::string line;
+        if (!std::getline(stream, line) || line != std::to_string(stamp))
+        {
+            // The source has been updated since the index was built.
+            return std::nullopt;
+        }
+
+        CompletionIndex result;
+        while (std::getline(stream, line))
+        {
+            if (line.size() < 2 || line[1] != '\t')
+            {
+                continue;
+            }
+
+            if (line[0] == 'I')
+            {
+                result.m_ids.emplace_back(line.substr(2));
+            }
+            else if (line[0] == 'N')
+            {
+                result.m_names.emplace_back(line.substr(2));
+            }
+        }
+
+        return result;
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION();
+        return std::nullopt;
+    }
+
+    void CompletionIndex::Rebuild(Repository::Source& source, IProgressCallback& progress) try
+    {
+        const Repository::SourceDetails& details = source.GetDetails();
+        int64_t stamp = GetSourceStamp(details);
+        if (stamp == 0)
+        {
+            AICLI_LOG(CLI, Verbose, << "Source [" << details.Name << "] has no update time; not building a completion index");
+            return;
+        }
+
+        source.Open(progress);
+
+        // An empty request enumerates the source.
+        Repository::SearchResult everything = source.Search({});
+
+        std::vector<std::string> ids;
+        std::vector<std::string> names;
+        ids.reserve(everything.Matches.size());
+        names.reserve(everything.Matches.size());
+
+        for (const auto& match : everything.Matches)
+        {
+            if (!match.Package)
+            {
+                continue;
+            }
+
+            Utility::LocIndString id = match.Package->GetProperty(Repository::PackageProperty::Id);
+            if (!id.empty())
+            {
+                ids.emplace_back(id.get());
+            }
+
+            Utility::LocIndString name = match.Package->GetProperty(Repository::PackageProperty::Name);
+            if (!name.empty())
+            {
+                names.emplace_back(name.get());
+            }
+        }
+
+        SortAndRemoveDuplicates(ids);
+        SortAndRemoveDuplicates(names);
+
+        std::filesystem::path indexPath = GetCompletionIndexPath(details);
+        std::filesystem::create_directories(indexPath.parent_path());
+
+        std::ofstream stream{ indexPath, std::ofstream::trunc };
+        stream << stamp << '\n';
+        for (const std::string& id : ids)
+        {
+            stream << "I\t" << id << '\n';
+        }
+        for (const std::string& name : names)
+        {
+            stream << "N\t" << name << '\n';
+        }
+
+        AICLI_LOG(CLI, Info, << "Built completion index for source [" << details.Name << "] with " <<
+            ids.size() << " ids and " << names.size() << " names");
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION();
+        AICLI_LOG(CLI, Warning, << "Failed to build completion index; completion will search the source directly");
+    }
+
+    std::vector<std::string> CompletionIndex::FindPrefixMatches(Field field, std::string_view prefix, size_t limit) const
+    {
+        const std::vector<std::string>& entries = (field == Field::Id ? m_ids : m_names);
+        std::string lowerPrefix = Utility::ToLower(prefix);
+
+        auto itr = std::lower_bound(entries.begin(), entries.end(), lowerPrefix,
+            [](const std::string& entry, const std::string& value) { return Utility::ToLower(entry) < value; });
+
+        std::vector<std::string> result;
+        for (; itr != entries.end() && result.size() < limit; ++itr)
+        {
+            std::string lowerEntry = Utility::ToLower(*itr);
+            if (lowerEntry.compare(0, lowerPrefix.size(), lowerPrefix) != 0)
+            {
+                break;
+            }
+
+            result.emplace_back(*itr);
+        }
+
+        return result;
+    }
+}
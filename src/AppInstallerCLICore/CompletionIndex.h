@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <AppInstallerProgress.h>
+#include <winget/RepositorySource.h>
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AppInstaller::CLI
+{
+    // A precomputed completion index over the package identifiers and names of a source,
+    // rebuilt when the source updates and stamped with the source's last update time.
+    // Entries are kept sorted case insensitively so that a prefix lookup is a pair of
+    // binary searches rather than a search through the source itself.
+    struct CompletionIndex
+    {
+        // The field that an entry completes.
+        enum class Field
+        {
+            Id,
+            Name,
+        };
+
+        // Attempts to load the index for the given source.
+        // Returns an empty optional when the index is missing or was built
+        // against an older version of the source.
+        static std::optional<CompletionIndex> TryLoad(const Repository::SourceDetails& details);
+
+        // Opens the given source and builds and persists its index.
+        // Best effort; failures are logged and the existing index is left in place.
+        static void Rebuild(Repository::Source& source, IProgressCallback& progress);
+
+        // Returns the entries of the given field that start with the given prefix,
+        // compared case insensitively, up to limit values.
+        std::vector<std::string> FindPrefixMatches(Field field, std::string_view prefix, size_t limit) const;
+
+    private:
+        CompletionIndex() = default;
+
+        // Entries per field, sorted by their lowercase form.
+        std::vector<std::string> m_ids;
+        std::vector<std::string> m_names;
+    };
+}
@@ -168,7 +168,32 @@ namespace AppInstaller::CLI::Workflow::ConfigurationRemoting
 
     IConfigurationSetProcessorFactory CreateOutOfProcessFactory()
     {
-        return winrt::make<RemoteFactory>();
+        // Keep the remote factory (and with it, the server process) alive for reuse;
+        // spawning the server and establishing the connection costs seconds, while a set
+        // processor is requested for every set handled in this invocation.
+        static std::mutex s_pooledFactoryLock;
+        static IConfigurationSetProcessorFactory s_pooledFactory{ nullptr };
+
+        std::lock_guard<std::mutex> lock{ s_pooledFactoryLock };
+
+        if (s_pooledFactory)
+        {
+            try
+            {
+                // Any call that reaches the remote object will fail if the server has gone away.
+                s_pooledFactory.MinimumLevel();
+                AICLI_LOG(Config, Verbose, << "Reusing existing configuration processing connection");
+                return s_pooledFactory;
+            }
+            catch (...)
+            {
+                AICLI_LOG(Config, Verbose, << "Existing configuration remote server is no longer available; launching a new one");
+                s_pooledFactory = nullptr;
+            }
+        }
+
+        s_pooledFactory = winrt::make<RemoteFactory>();
+        return s_pooledFactory;
     }
 }
 
@@ -6,7 +6,9 @@
 
 namespace AppInstaller::CLI::Workflow::ConfigurationRemoting
 {
-    // Creates a factory in another process
+    // Creates a factory in another process.
+    // The factory connection is pooled; repeated calls within the process reuse the same
+    // server process for as long as it remains available.
     winrt::Microsoft::Management::Configuration::IConfigurationSetProcessorFactory CreateOutOfProcessFactory();
 }
 
@@ -15,16 +15,12 @@ namespace AppInstaller::CLI::Execution
         // Operation command queue used by install and uninstall commands.
         constexpr static std::string_view OperationCommandQueueName = "operation"sv;
 
-        // Callback function used by worker threads in the queue.
-        // context must be a pointer to a queue item.
+        // Callback function used by worker threads in the shared pool.
+        // context must be a pointer to the queue with pending work.
         void CALLBACK OrchestratorQueueWorkCallback(PTP_CALLBACK_INSTANCE, PVOID context, PTP_WORK)
         {
-            auto queueItem = reinterpret_cast<OrchestratorQueueItem*>(context);
-            auto queue = queueItem->GetCurrentQueue();
-            if (queue)
-            {
-                queue->RunItem(queueItem->GetId());
-            }
+            auto queue = reinterpret_cast<OrchestratorQueue*>(context);
+            queue->RunNextItem();
         }
 
         // Get command queue name based on command name.
@@ -51,7 +47,7 @@ namespace AppInstaller::CLI::Execution
         m_installingWriteableSource = Repository::Source(Repository::PredefinedSource::Installing);
         m_installingWriteableSource.Open(progress);
 
-        // Decide how many threads to use for each command.
+        // Decide how many items may run concurrently for each command.
         // We always allow only one install at a time.
         // For download, if we can find the number of supported concurrent threads,
         // use that as the maximum (up to 3); otherwise use a single thread.
@@ -60,13 +56,33 @@ namespace AppInstaller::CLI::Execution
         const UINT32 operationThreads = 1;
         const UINT32 downloadThreads = std::min(supportedConcurrentThreads ? supportedConcurrentThreads - 1 : 1, maxDownloadThreads);
 
+        // All queues share a single pool sized for the total concurrency, so that a
+        // thread not admitted by one queue's limit can run items from the others
+        // rather than sitting idle in a dedicated pool.
+        m_threadPool.reset(CreateThreadpool(nullptr));
+        THROW_LAST_ERROR_IF_NULL(m_threadPool);
+        m_threadPoolCleanupGroup.reset(CreateThreadpoolCleanupGroup());
+        THROW_LAST_ERROR_IF_NULL(m_threadPoolCleanupGroup);
+        InitializeThreadpoolEnvironment(&m_threadPoolCallbackEnviron);
+        SetThreadpoolCallbackPool(&m_threadPoolCallbackEnviron, m_threadPool.get());
+        SetThreadpoolCallbackCleanupGroup(&m_threadPoolCallbackEnviron, m_threadPoolCleanupGroup.get(), nullptr);
+
+        THROW_LAST_ERROR_IF(!SetThreadpoolThreadMinimum(m_threadPool.get(), 1));
+        SetThreadpoolThreadMaximum(m_threadPool.get(), downloadThreads + operationThreads);
+
         AddCommandQueue(COMDownloadCommand::CommandName, downloadThreads);
         AddCommandQueue(OperationCommandQueueName, operationThreads);
     }
 
+    ContextOrchestrator::~ContextOrchestrator()
+    {
+        // Wait for outstanding callbacks before the queues they reference are destroyed.
+        CloseThreadpoolCleanupGroupMembers(m_threadPoolCleanupGroup.get(), false, nullptr);
+    }
+
     void ContextOrchestrator::AddCommandQueue(std::string_view commandName, UINT32 allowedThreads)
     {
-        m_commandQueues.emplace(commandName, std::make_unique<OrchestratorQueue>(commandName, allowedThreads));
+        m_commandQueues.emplace(commandName, std::make_unique<OrchestratorQueue>(commandName, allowedThreads, &m_threadPoolCallbackEnviron));
     }
 
     _Requires_lock_held_(m_queueLock)
@@ -196,24 +212,9 @@ namespace AppInstaller::CLI::Execution
         }
     }
 
-    OrchestratorQueue::OrchestratorQueue(std::string_view commandName, UINT32 allowedThreads) :
-        m_commandName(commandName), m_allowedThreads(allowedThreads)
+    OrchestratorQueue::OrchestratorQueue(std::string_view commandName, UINT32 allowedThreads, PTP_CALLBACK_ENVIRON threadPoolCallbackEnviron) :
+        m_commandName(commandName), m_allowedThreads(allowedThreads), m_threadPoolCallbackEnviron(threadPoolCallbackEnviron)
     {
-        m_threadPool.reset(CreateThreadpool(nullptr));
-        THROW_LAST_ERROR_IF_NULL(m_threadPool);
-        m_threadPoolCleanupGroup.reset(CreateThreadpoolCleanupGroup());
-        THROW_LAST_ERROR_IF_NULL(m_threadPoolCleanupGroup);
-        InitializeThreadpoolEnvironment(&m_threadPoolCallbackEnviron);
-        SetThreadpoolCallbackPool(&m_threadPoolCallbackEnviron, m_threadPool.get());
-        SetThreadpoolCallbackCleanupGroup(&m_threadPoolCallbackEnviron, m_threadPoolCleanupGroup.get(), nullptr);
-
-        THROW_LAST_ERROR_IF(!SetThreadpoolThreadMinimum(m_threadPool.get(), 1));
-        SetThreadpoolThreadMaximum(m_threadPool.get(), m_allowedThreads);
-    }
-
-    OrchestratorQueue::~OrchestratorQueue()
-    {
-        CloseThreadpoolCleanupGroupMembers(m_threadPoolCleanupGroup.get(), false, nullptr);
     }
 
     void OrchestratorQueue::EnqueueAndRunItem(std::shared_ptr<OrchestratorQueueItem> item)
@@ -221,37 +222,69 @@ namespace AppInstaller::CLI::Execution
         EnqueueItem(item);
 
         item->SetCurrentQueue(this);
-        auto work = CreateThreadpoolWork(OrchestratorQueueWorkCallback, item.get(), &m_threadPoolCallbackEnviron);
+        SubmitNextPending();
+    }
+
+    void OrchestratorQueue::SubmitNextPending()
+    {
+        {
+            std::lock_guard<std::mutex> lockQueue{ m_queueLock };
+
+            if (m_runningThreads >= m_allowedThreads)
+            {
+                return;
+            }
+
+            // Cancelled items still need a thread to finalize their removal.
+            bool hasPendingWork = std::any_of(m_queueItems.begin(), m_queueItems.end(), [](const std::shared_ptr<OrchestratorQueueItem>& item) {
+                return item->GetState() == OrchestratorQueueItemState::Queued || item->GetState() == OrchestratorQueueItemState::Cancelled; });
+
+            if (!hasPendingWork)
+            {
+                return;
+            }
+
+            // Reserve the slot; the submitted callback releases it when it runs out of work.
+            m_runningThreads++;
+        }
+
+        auto work = CreateThreadpoolWork(OrchestratorQueueWorkCallback, this, m_threadPoolCallbackEnviron);
         SubmitThreadpoolWork(work);
     }
 
-    void OrchestratorQueue::RunItem(const OrchestratorQueueItemId& itemId)
+    void OrchestratorQueue::RunNextItem()
     {
-        try
+        for (;;)
         {
             std::shared_ptr<OrchestratorQueueItem> item;
             bool isCancelled = false;
 
-            // Try to find the item in the queue.
+            // Take the first pending item from the queue.
             {
                 std::lock_guard<std::mutex> lockQueue{ m_queueLock };
-                item = FindById(itemId);
 
-                if (!item)
+                for (const auto& queuedItem : m_queueItems)
                 {
-                    // Item should be in the queue; this shouldn't happen.
-                    return;
+                    if (queuedItem->GetState() == OrchestratorQueueItemState::Queued)
+                    {
+                        // Mark it as running so that it cannot be cancelled by other threads.
+                        queuedItem->SetState(OrchestratorQueueItemState::Running);
+                        item = queuedItem;
+                        break;
+                    }
+                    else if (queuedItem->GetState() == OrchestratorQueueItemState::Cancelled)
+                    {
+                        item = queuedItem;
+                        isCancelled = true;
+                        break;
+                    }
                 }
 
-                // Only run if the item is queued and not cancelled.
-                if (item->GetState() == OrchestratorQueueItemState::Queued)
-                {
-                    // Mark it as running so that it cannot be cancelled by other threads.
-                    item->SetState(OrchestratorQueueItemState::Running);
-                }
-                else if (item->GetState() == OrchestratorQueueItemState::Cancelled)
+                if (!item)
                 {
-                    isCancelled = true;
+                    // Nothing left to run; release the slot.
+                    m_runningThreads--;
+                    return;
                 }
             }
 
@@ -259,8 +292,28 @@ namespace AppInstaller::CLI::Execution
             {
                 // Do this separate from above block as the Remove function needs to manage the lock.
                 RemoveItemInState(*item, OrchestratorQueueItemState::Cancelled, true);
+
+                // Keep the slot and look for more work.
+                continue;
+            }
+
+            ExecuteItem(item);
+
+            {
+                std::lock_guard<std::mutex> lockQueue{ m_queueLock };
+                m_runningThreads--;
             }
 
+            // The completed item may have left pending work behind it.
+            SubmitNextPending();
+            return;
+        }
+    }
+
+    void OrchestratorQueue::ExecuteItem(const std::shared_ptr<OrchestratorQueueItem>& item)
+    {
+        try
+        {
             // Get the item's command and execute it.
             HRESULT exceptionHR = S_OK;
             try
@@ -277,6 +330,10 @@ namespace AppInstaller::CLI::Execution
             }
             WINGET_CATCH_STORE(exceptionHR, APPINSTALLER_CLI_ERROR_COMMAND_FAILED);
 
+            // Complete any bookkeeping that the command deferred before the item's
+            // completion is reported; the context must outlive the deferred work.
+            Workflow::BackgroundBookkeeper::Instance().Drain();
+
             if (FAILED(exceptionHR))
             {
                 // Set the termination hr directly from any exception that escaped so that the context always 
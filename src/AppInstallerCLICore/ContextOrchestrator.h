@@ -103,6 +103,7 @@ namespace AppInstaller::CLI::Execution
     struct ContextOrchestrator
     {
         ContextOrchestrator();
+        ~ContextOrchestrator();
         static ContextOrchestrator& Instance();
 
         void EnqueueAndRunItem(std::shared_ptr<OrchestratorQueueItem> queueItem);
@@ -121,17 +122,27 @@ namespace AppInstaller::CLI::Execution
         _Requires_lock_held_(m_queueLock)
         std::shared_ptr<OrchestratorQueueItem> FindById(const OrchestratorQueueItemId& queueItemId);
 
+        // Thread pool shared by all command queues, and associated objects.
+        // A single pool lets threads idled by one queue's concurrency limit pick up
+        // pending items from the other queues.
+        // See https://docs.microsoft.com/windows/win32/procthread/using-the-thread-pool-functions
+        TP_CALLBACK_ENVIRON m_threadPoolCallbackEnviron;
+        wil::unique_any<PTP_POOL, decltype(CloseThreadpool), CloseThreadpool> m_threadPool;
+        wil::unique_any<PTP_CLEANUP_GROUP, decltype(CloseThreadpoolCleanupGroup), CloseThreadpoolCleanupGroup> m_threadPoolCleanupGroup;
+
         Repository::Source m_installingWriteableSource;
         std::map<std::string, std::unique_ptr<OrchestratorQueue>> m_commandQueues;
     };
 
     // One of the queues used by the orchestrator.
     // All items in the queue execute the same command.
-    // The queue allows multiple items to run at the same time, up to a limit.
+    // The queue is an admission gate over the orchestrator's shared thread pool:
+    // it allows multiple items to run at the same time, up to a limit, and the
+    // limit is only enforced when an item actually starts executing, so pool
+    // threads not usable by this queue are free to run items from the others.
     struct OrchestratorQueue
     {
-        OrchestratorQueue(std::string_view commandName, UINT32 allowedThreads);
-        ~OrchestratorQueue();
+        OrchestratorQueue(std::string_view commandName, UINT32 allowedThreads, PTP_CALLBACK_ENVIRON threadPoolCallbackEnviron);
 
         // Name of the command this queue can execute
         std::string_view CommandName() const { return m_commandName; }
@@ -148,13 +159,19 @@ namespace AppInstaller::CLI::Execution
         _Requires_lock_held_(m_queueLock)
         std::shared_ptr<OrchestratorQueueItem> FindById(const OrchestratorQueueItemId& queueItemId);
 
-        // Runs a single item from the queue.
-        void RunItem(const OrchestratorQueueItemId& itemId);
+        // Runs the next pending item from the queue, if any.
+        void RunNextItem();
 
     private:
         // Enqueues an item.
         void EnqueueItem(std::shared_ptr<OrchestratorQueueItem> item);
 
+        // Submits a work item to the shared pool if there is pending work and spare capacity.
+        void SubmitNextPending();
+
+        // Executes the item's next command.
+        void ExecuteItem(const std::shared_ptr<OrchestratorQueueItem>& item);
+
         _Requires_lock_held_(m_queueLock)
         std::deque<std::shared_ptr<OrchestratorQueueItem>>::iterator FindIteratorById(const OrchestratorQueueItemId& comparisonQueueItemId);
 
@@ -163,15 +180,14 @@ namespace AppInstaller::CLI::Execution
         // Number of threads allowed to run items in this queue.
         const UINT32 m_allowedThreads;
 
-        // Thread pool for this queue, and associated objects.
-        // All work items will be added to the callback environment, and the cleanup group
-        // will manage their closing.
-        // See https://docs.microsoft.com/windows/win32/procthread/using-the-thread-pool-functions
-        TP_CALLBACK_ENVIRON m_threadPoolCallbackEnviron;
-        wil::unique_any<PTP_POOL, decltype(CloseThreadpool), CloseThreadpool> m_threadPool;
-        wil::unique_any<PTP_CLEANUP_GROUP, decltype(CloseThreadpoolCleanupGroup), CloseThreadpoolCleanupGroup> m_threadPoolCleanupGroup;
+        // Callback environment of the orchestrator's shared thread pool.
+        PTP_CALLBACK_ENVIRON m_threadPoolCallbackEnviron;
 
         std::mutex m_queueLock;
         std::deque<std::shared_ptr<OrchestratorQueueItem>> m_queueItems;
+
+        // Number of pool threads currently running items from this queue.
+        _Guarded_by_(m_queueLock)
+        UINT32 m_runningThreads = 0;
     };
 }
@@ -50,8 +50,6 @@ namespace AppInstaller::CLI
 
     int CoreMain(int argc, wchar_t const** argv) try
     {
-        init_apartment();
-
 #ifndef AICLI_DISABLE_TEST_HOOKS
         if (Settings::User().Get<Settings::Setting::EnableSelfInitiatedMinidump>())
         {
@@ -141,7 +139,22 @@ namespace AppInstaller::CLI
             return APPINSTALLER_CLI_ERROR_BLOCKED_BY_POLICY;
         }
 
-        return Execute(context, command);
+        // Apartment initialization is deferred until a command that activates WinRT is about
+        // to run, so that metadata only invocations (help, version, settings) skip its fixed
+        // cost entirely; scripts shelling out to winget in loops pay it on every invocation.
+        if (command->RequiresWinRTInitialization())
+        {
+            init_apartment();
+        }
+
+        int result = Execute(context, command);
+
+        // The command is done producing log data; flush it now so that process teardown
+        // has nothing left to write. Scripts invoking winget in a loop feel teardown
+        // latency on every iteration.
+        Logging::Log().BeginShutdown();
+
+        return result;
     }
     // End of the line exceptions that are not ever expected.
     // Telemetry cannot be reliable beyond this point, so don't let these happen.
@@ -113,6 +113,17 @@ namespace AppInstaller::CLI::Execution
 
     Context::~Context()
     {
+        // Ensure that any background manifest retrieval has finished before the
+        // thread globals its thread uses are destroyed.
+        if (Contains(Data::ManifestPrefetch))
+        {
+            const auto& prefetch = Get<Data::ManifestPrefetch>();
+            if (prefetch.Manifest.valid())
+            {
+                prefetch.Manifest.wait();
+            }
+        }
+
         if (m_disableCtrlHandlerOnExit)
         {
             EnableCtrlHandler(false);
@@ -122,15 +133,27 @@ namespace AppInstaller::CLI::Execution
     std::unique_ptr<Context> Context::CreateSubContext()
     {
         auto clone = std::make_unique<Context>(Reporter, m_threadGlobals);
-        clone->m_flags = m_flags;
-        clone->m_executingCommand = m_executingCommand;
+        InitializeSubContext(*clone);
+        return clone;
+    }
+
+    std::unique_ptr<Context> Context::CreateBufferedSubContext()
+    {
+        auto clone = std::make_unique<Context>(Reporter, m_threadGlobals, Execution::Reporter::clone_buffered_t{});
+        InitializeSubContext(*clone);
+        return clone;
+    }
+
+    void Context::InitializeSubContext(Context& subContext)
+    {
+        subContext.m_flags = m_flags;
+        subContext.m_executingCommand = m_executingCommand;
         // If the parent is hooked up to the CTRL signal, have the clone be as well
         if (m_disableCtrlHandlerOnExit)
         {
-            clone->EnableCtrlHandler();
+            subContext.EnableCtrlHandler();
         }
-        CopyArgsToSubContext(clone.get());
-        return clone;
+        CopyArgsToSubContext(&subContext);
     }
 
     void Context::CopyArgsToSubContext(Context* subContext)
@@ -243,4 +266,42 @@ namespace AppInstaller::CLI::Execution
         return (m_shouldExecuteWorkflowTask ? m_shouldExecuteWorkflowTask(task) : true);
     }
 #endif
+
+#if WINGET_CONTEXT_DATA_INSTRUMENTATION_ENABLED
+    namespace Instrumentation
+    {
+        namespace
+        {
+            struct DataAddCounts
+            {
+                std::atomic<uint64_t> Copies{};
+                std::atomic<uint64_t> Moves{};
+            };
+
+            // Process wide so that sub-contexts running on worker threads aggregate
+            // into the same report as the root context.
+            std::array<DataAddCounts, ToIntegral(Data::Max)> s_dataAddCounts{};
+        }
+
+        void RecordDataAdd(Data data, bool byMove)
+        {
+            DataAddCounts& counts = s_dataAddCounts[ToIntegral(data)];
+            (byMove ? counts.Moves : counts.Copies).fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void ReportDataAddCounts()
+        {
+            for (size_t i = 0; i < s_dataAddCounts.size(); ++i)
+            {
+                uint64_t copies = s_dataAddCounts[i].Copies.exchange(0, std::memory_order_relaxed);
+                uint64_t moves = s_dataAddCounts[i].Moves.exchange(0, std::memory_order_relaxed);
+
+                if (copies || moves)
+                {
+                    AICLI_LOG(CLI, Info, << "Context data " << i << ": " << copies << " copies, " << moves << " moves");
+                }
+            }
+        }
+    }
+#endif
 }
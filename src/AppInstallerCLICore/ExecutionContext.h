@@ -81,6 +81,11 @@ namespace AppInstaller::CLI::Execution
             Reporter(reporter, Execution::Reporter::clone_t{}),
             m_threadGlobals(threadGlobals, ThreadLocalStorage::WingetThreadGlobals::create_sub_thread_globals_t{}) {}
 
+        // Constructor for creating a sub-context whose reporter buffers its output.
+        Context(Execution::Reporter& reporter, ThreadLocalStorage::WingetThreadGlobals& threadGlobals, Execution::Reporter::clone_buffered_t) :
+            Reporter(reporter, Execution::Reporter::clone_buffered_t{}),
+            m_threadGlobals(threadGlobals, ThreadLocalStorage::WingetThreadGlobals::create_sub_thread_globals_t{}) {}
+
         virtual ~Context();
 
         // The path for console input/output for all functionality.
@@ -92,6 +97,65 @@ namespace AppInstaller::CLI::Execution
         // Creates a child of this context.
         virtual std::unique_ptr<Context> CreateSubContext();
 
+        // Creates a child of this context whose reporter captures output in a buffer instead
+        // of writing to the console, so the child can run on a background thread while the
+        // console is owned by another context. Once the background work has been joined,
+        // replay the captured text with Reporter::ReplayBufferedOutputTo.
+        virtual std::unique_ptr<Context> CreateBufferedSubContext();
+
+        // Data::Manifest is stored as a shared immutable handle (see its DataMapping);
+        // expose it to callers as the manifest itself and forward everything else to the base.
+        template <Data D>
+        decltype(auto) Get()
+        {
+            if constexpr (D == Data::Manifest)
+            {
+                return EnumBasedVariantMap<Data, details::DataMapping>::Get<D>().Get();
+            }
+            else
+            {
+                return (EnumBasedVariantMap<Data, details::DataMapping>::Get<D>());
+            }
+        }
+
+        template <Data D>
+        decltype(auto) Get() const
+        {
+            if constexpr (D == Data::Manifest)
+            {
+                return EnumBasedVariantMap<Data, details::DataMapping>::Get<D>().Get();
+            }
+            else
+            {
+                return (EnumBasedVariantMap<Data, details::DataMapping>::Get<D>());
+            }
+        }
+
+        // Gets the shared handle backing Data::Manifest, for handing the manifest to
+        // another context without copying it.
+        const Manifest::SharedManifest& GetManifestHandle() const
+        {
+            return EnumBasedVariantMap<Data, details::DataMapping>::Get<Data::Manifest>();
+        }
+
+#if WINGET_CONTEXT_DATA_INSTRUMENTATION_ENABLED
+        // Wraps the underlying Add to count whether each datum arrives by copy or by move;
+        // see WINGET_CONTEXT_DATA_INSTRUMENTATION_ENABLED in ExecutionContextData.h.
+        template <Data D>
+        void Add(typename details::DataMapping<D>::value_t&& v)
+        {
+            Instrumentation::RecordDataAdd(D, /* byMove */ true);
+            EnumBasedVariantMap<Data, details::DataMapping>::Add<D>(std::move(v));
+        }
+
+        template <Data D>
+        void Add(const typename details::DataMapping<D>::value_t& v)
+        {
+            Instrumentation::RecordDataAdd(D, /* byMove */ false);
+            EnumBasedVariantMap<Data, details::DataMapping>::Add<D>(v);
+        }
+#endif
+
         // Enables reception of CTRL signals.
         void EnableCtrlHandler(bool enabled = true);
 
@@ -158,6 +222,9 @@ namespace AppInstaller::CLI::Execution
         // Copies the args that are also needed in a sub-context. E.g., silent
         void CopyArgsToSubContext(Context* subContext);
 
+        // Copies the flags, executing command and args shared with every kind of sub-context.
+        void InitializeSubContext(Context& subContext);
+
         // Neither virtual functions nor member fields can be inside AICLI_DISABLE_TEST_HOOKS
         // or we could have ODR violations that lead to nasty bugs. So we will simply never
         // use this if AICLI_DISABLE_TEST_HOOKS is defined.
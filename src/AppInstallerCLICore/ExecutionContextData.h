@@ -18,6 +18,11 @@
 #include <variant>
 #include <vector>
 
+// Set to 1 to count how each context datum is added: by copy or by move.
+// The counts are process wide and are reported to the log at command completion,
+// making copy regressions in workflow composition visible without a profiler.
+#define WINGET_CONTEXT_DATA_INSTRUMENTATION_ENABLED 0
+
 namespace AppInstaller::Repository::Microsoft
 {
     struct PinningIndex;
@@ -56,8 +61,15 @@ namespace AppInstaller::CLI::Execution
         PackageSubContexts,
         // On import: Sources for the imported packages
         Sources,
+        // On import: the deferred schema validation outcome for the import file
+        ImportFileValidation,
+        // On import: hex hash of the import file contents, used to key the resume journal
+        ImportFileHash,
+        // On import: the resume journal key identifying the package request handled by a sub-context
+        ImportJournalKey,
+        // A background manifest retrieval started once a search resolves to a single package
+        ManifestPrefetch,
         ARPCorrelationData,
-        CorrelatedAppsAndFeaturesEntries,
         Dependencies,
         DependencySource,
         AllowedArchitectures,
@@ -112,7 +124,9 @@ namespace AppInstaller::CLI::Execution
         template <>
         struct DataMapping<Data::Manifest>
         {
-            using value_t = Manifest::Manifest;
+            // Stored as a shared handle so that contexts operating on the same package
+            // share the manifest instead of copying it; Context::Get unwraps it.
+            using value_t = Manifest::SharedManifest;
         };
 
         template <>
@@ -206,15 +220,33 @@ namespace AppInstaller::CLI::Execution
         };
 
         template <>
-        struct DataMapping<Data::ARPCorrelationData>
+        struct DataMapping<Data::ImportFileValidation>
         {
-            using value_t = Repository::Correlation::ARPCorrelationData;
+            using value_t = std::shared_future<PackagesJson::ParseResult>;
+        };
+
+        template <>
+        struct DataMapping<Data::ImportFileHash>
+        {
+            using value_t = std::string;
         };
 
         template <>
-        struct DataMapping<Data::CorrelatedAppsAndFeaturesEntries>
+        struct DataMapping<Data::ImportJournalKey>
         {
-            using value_t = std::vector<Manifest::AppsAndFeaturesEntry>;
+            using value_t = std::string;
+        };
+
+        template <>
+        struct DataMapping<Data::ManifestPrefetch>
+        {
+            using value_t = Workflow::ManifestPrefetch;
+        };
+
+        template <>
+        struct DataMapping<Data::ARPCorrelationData>
+        {
+            using value_t = Repository::Correlation::ARPCorrelationData;
         };
 
         template <>
@@ -265,4 +297,16 @@ namespace AppInstaller::CLI::Execution
             using value_t = ConfigurationContext;
         };
     }
+
+#if WINGET_CONTEXT_DATA_INSTRUMENTATION_ENABLED
+    namespace Instrumentation
+    {
+        // Records that the given datum was added to a context, by move or by copy.
+        void RecordDataAdd(Data data, bool byMove);
+
+        // Logs the per datum copy and move counts gathered so far and resets them.
+        // The reported values are the integral values of the Data enumerators.
+        void ReportDataAddCounts();
+    }
+#endif
 }
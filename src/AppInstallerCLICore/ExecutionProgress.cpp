@@ -252,7 +252,74 @@ namespace AppInstaller::CLI::Execution
         m_spinnerRunning = false;
     }
 
+    ProgressBar::~ProgressBar()
+    {
+        StopRender();
+    }
+
     void ProgressBar::ShowProgress(uint64_t current, uint64_t maximum, ProgressType type)
+    {
+        {
+            std::lock_guard<std::mutex> lock{ m_stateLock };
+            m_state.Current = current;
+            m_state.Maximum = maximum;
+            m_state.Type = type;
+            ++m_state.Sequence;
+        }
+
+        if (!m_renderJob.valid() && !m_renderRunning && !m_canceled)
+        {
+            m_renderRunning = true;
+            m_renderJob = std::async(std::launch::async, &ProgressBar::ShowProgressInternal, this);
+        }
+    }
+
+    ProgressBar::ProgressState ProgressBar::GetState()
+    {
+        std::lock_guard<std::mutex> lock{ m_stateLock };
+        return m_state;
+    }
+
+    void ProgressBar::StopRender()
+    {
+        if (!m_canceled && m_renderJob.valid() && m_renderRunning)
+        {
+            m_canceled = true;
+            m_renderJob.get();
+            m_renderJob = {};
+            m_canceled = false;
+        }
+    }
+
+    void ProgressBar::ShowProgressInternal()
+    {
+        uint64_t paintedSequence = 0;
+
+        // Keep painting until cancellation, then paint any state not yet shown so that the
+        // final values (typically 100%) always make it to the screen.
+        for (;;)
+        {
+            bool lastPass = m_canceled;
+
+            ProgressState state = GetState();
+            if (state.Sequence != paintedSequence)
+            {
+                RenderProgress(state.Current, state.Maximum, state.Type);
+                paintedSequence = state.Sequence;
+            }
+
+            if (lastPass)
+            {
+                break;
+            }
+
+            Sleep(100);
+        }
+
+        m_renderRunning = false;
+    }
+
+    void ProgressBar::RenderProgress(uint64_t current, uint64_t maximum, ProgressType type)
     {
         if (current < m_lastCurrent)
         {
@@ -275,6 +342,8 @@ namespace AppInstaller::CLI::Execution
 
     void ProgressBar::EndProgress(bool hideProgressWhenDone)
     {
+        StopRender();
+
         if (m_isVisible)
         {
             if (hideProgressWhenDone)
@@ -13,6 +13,7 @@
 #include <future>
 #include <istream>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -67,21 +68,49 @@ namespace AppInstaller::CLI::Execution
         void ShowSpinnerInternal();
     };
 
-    // Displays progress 
+    // Displays progress
     class ProgressBar : public details::ProgressVisualizerBase
     {
     public:
         ProgressBar(BaseStream& stream, bool enableVT) :
             details::ProgressVisualizerBase(stream, enableVT) {}
 
+        ~ProgressBar();
+
+        // Records the new progress state. A background thread paints the latest state at a
+        // fixed cadence, so frequent callbacks are coalesced and never wait on the console.
         void ShowProgress(uint64_t current, uint64_t maximum, ProgressType type);
 
         void EndProgress(bool hideProgressWhenDone);
 
     private:
+        // The most recently reported progress state.
+        struct ProgressState
+        {
+            uint64_t Current = 0;
+            uint64_t Maximum = 0;
+            ProgressType Type = ProgressType::None;
+            uint64_t Sequence = 0;
+        };
+
         std::atomic<bool> m_isVisible = false;
+        std::atomic<bool> m_canceled = false;
+        std::atomic<bool> m_renderRunning = false;
+        std::future<void> m_renderJob;
+        std::mutex m_stateLock;
+        ProgressState m_state;
         uint64_t m_lastCurrent = 0;
 
+        ProgressState GetState();
+
+        void StopRender();
+
+        // The background render loop.
+        void ShowProgressInternal();
+
+        // Paints the given state; only ever called from the render thread.
+        void RenderProgress(uint64_t current, uint64_t maximum, ProgressType type);
+
         void ShowProgressNoVT(uint64_t current, uint64_t maximum, ProgressType type);
 
         void ShowProgressWithVT(uint64_t current, uint64_t maximum, ProgressType type);
@@ -51,6 +51,31 @@ namespace AppInstaller::CLI::Execution
         }
     }
 
+    Reporter::Reporter(const Reporter& other, clone_buffered_t) :
+        m_bufferedOutput(std::make_unique<std::ostringstream>()),
+        m_out(std::make_shared<BaseStream>(*m_bufferedOutput, true, false)),
+        m_in(other.m_in)
+    {
+        // The spinner and progress bar are intentionally not constructed; repainting a
+        // progress control into a buffer would only capture garbage, and the background
+        // operation must not paint on the console while another thread owns it.
+        SetProgressSink(this);
+    }
+
+    void Reporter::ReplayBufferedOutputTo(Reporter& target)
+    {
+        if (m_bufferedOutput)
+        {
+            std::string captured = m_bufferedOutput->str();
+            m_bufferedOutput->str({});
+
+            if (!captured.empty())
+            {
+                *target.m_out << captured;
+            }
+        }
+    }
+
     OutputStream Reporter::GetOutputStream(Level level)
     {
         OutputStream result = GetBasicOutputStream();
@@ -16,6 +16,7 @@
 #include <memory>
 #include <optional>
 #include <ostream>
+#include <sstream>
 #include <string>
 
 
@@ -68,6 +69,14 @@ namespace AppInstaller::CLI::Execution
         struct clone_t {};
         Reporter(const Reporter& other, clone_t);
 
+        // Request a clone whose output is captured in an internal buffer rather than written
+        // to the other reporter's stream, so that it can be driven from a background thread
+        // without interleaving with the rendering done by the stream's owning thread.
+        // Progress is not displayed at all; the captured text can be written out with
+        // ReplayBufferedOutputTo once the background work has been joined.
+        struct clone_buffered_t {};
+        Reporter(const Reporter& other, clone_buffered_t);
+
         ~Reporter();
 
         // Get a stream for verbose output.
@@ -165,6 +174,10 @@ namespace AppInstaller::CLI::Execution
             m_progressSink = sink;
         }
 
+        // Writes the text captured by a reporter constructed with clone_buffered_t to the
+        // target reporter's stream, and clears the buffer. No-op for other reporters.
+        void ReplayBufferedOutputTo(Reporter& target);
+
     private:
         Reporter(std::shared_ptr<BaseStream> outStream, std::istream& inStream);
 
@@ -172,6 +185,9 @@ namespace AppInstaller::CLI::Execution
         OutputStream GetBasicOutputStream();
 
         Channel m_channel = Channel::Output;
+        // Holds the captured output for a clone_buffered_t reporter; m_out writes into it.
+        // Declared before m_out so that it is constructed first.
+        std::unique_ptr<std::ostringstream> m_bufferedOutput;
         std::shared_ptr<BaseStream> m_out;
         std::istream& m_in;
         std::optional<AppInstaller::Settings::VisualStyle> m_style;
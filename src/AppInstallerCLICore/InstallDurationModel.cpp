@@ -0,0 +1,196 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "InstallDurationModel.h"
+#include <AppInstallerRuntime.h>
+#include <AppInstallerStrings.h>
+
+#include <algorithm>
+
+namespace AppInstaller::CLI
+{
+    namespace
+    {
+        using namespace std::string_view_literals;
+
+        constexpr std::string_view s_DurationHistoryFileName = "durationHistory.txt"sv;
+        constexpr std::string_view s_DurationHistoryFormatVersion = "1"sv;
+
+        // The maximum number of entries retained; the least recently updated are dropped.
+        constexpr size_t s_DurationHistoryMaximumEntries = 500;
+
+        // The percentage weight that a new observation carries in the moving average.
+        constexpr int64_t s_DurationHistoryObservationWeight = 30;
+
+        std::string MakeDurationHistoryKey(std::string_view packageId, Manifest::InstallerTypeEnum installerType)
+        {
+            std::string result = Utility::FoldCase(packageId);
+            result += '|';
+            result += Manifest::InstallerTypeToString(installerType);
+            return result;
+        }
+
+        // The in-process view of the persisted duration history. Entries are kept in
+        // least recently updated order, so trimming drops the stalest packages first.
+        struct DurationHistoryStore
+        {
+            static DurationHistoryStore& Instance()
+            {
+                static DurationHistoryStore s_instance;
+                return s_instance;
+            }
+
+            std::optional<std::chrono::milliseconds> Get(const std::string& key)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                for (const auto& entry : m_entries)
+                {
+                    if (entry.Key == key)
+                    {
+                        return std::chrono::milliseconds{ entry.AverageMilliseconds };
+                    }
+                }
+
+                return {};
+            }
+
+            void Record(const std::string& key, std::chrono::milliseconds duration)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                Entry updated{ key, duration.count() };
+
+                auto itr = std::find_if(m_entries.begin(), m_entries.end(), [&](const Entry& entry) { return entry.Key == key; });
+                if (itr != m_entries.end())
+                {
+                    updated.AverageMilliseconds =
+                        (itr->AverageMilliseconds * (100 - s_DurationHistoryObservationWeight) + duration.count() * s_DurationHistoryObservationWeight) / 100;
+                    m_entries.erase(itr);
+                }
+
+                // The updated entry becomes the most recently used.
+                m_entries.emplace_back(std::move(updated));
+
+                if (m_entries.size() > s_DurationHistoryMaximumEntries)
+                {
+                    m_entries.erase(m_entries.begin(), m_entries.begin() + (m_entries.size() - s_DurationHistoryMaximumEntries));
+                }
+
+                Save();
+            }
+
+        private:
+            struct Entry
+            {
+                std::string Key;
+                int64_t AverageMilliseconds = 0;
+            };
+
+            DurationHistoryStore()
+            {
+                try
+                {
+                    Load();
+                }
+                catch (...)
+                {
+                    AICLI_LOG(CLI, Warning, << "Failed to load install duration history; starting empty.");
+                    m_entries.clear();
+                }
+            }
+
+            static std::filesystem::path GetFilePath()
+            {
+                return Runtime::GetPathTo(Runtime::PathName::LocalState) / s_DurationHistoryFileName;
+            }
+
+            void Load()
+            {
+                std::ifstream stream{ GetFilePath() };
+                if (!stream)
+                {
+                    return;
+                }
+
+                std::string line;
+                if (!std::getline(stream, line) || line != s_DurationHistoryFormatVersion)
+                {
+                    // Unknown format; drop the history rather than misreading it.
+                    return;
+                }
+
+                while (std::getline(stream, line))
+                {
+                    std::istringstream lineStream{ line };
+                    Entry entry;
+                    if (lineStream >> entry.AverageMilliseconds >> std::ws && std::getline(lineStream, entry.Key) && !entry.Key.empty())
+                    {
+                        m_entries.emplace_back(std::move(entry));
+                    }
+                }
+            }
+
+            void Save()
+            {
+                try
+                {
+                    std::ofstream stream{ GetFilePath(), std::ios::trunc };
+                    stream << s_DurationHistoryFormatVersion << '\n';
+
+                    for (const auto& entry : m_entries)
+                    {
+                        stream << entry.AverageMilliseconds << ' ' << entry.Key << '\n';
+                    }
+                }
+                catch (...)
+                {
+                    AICLI_LOG(CLI, Warning, << "Failed to save install duration history.");
+                }
+            }
+
+            std::mutex m_lock;
+            std::vector<Entry> m_entries;
+        };
+    }
+
+    std::optional<std::chrono::milliseconds> InstallDurationModel::GetExpectedDuration(std::string_view packageId, Manifest::InstallerTypeEnum installerType)
+    {
+        try
+        {
+            return DurationHistoryStore::Instance().Get(MakeDurationHistoryKey(packageId, installerType));
+        }
+        catch (...)
+        {
+            AICLI_LOG(CLI, Warning, << "Failed to get expected install duration.");
+            return {};
+        }
+    }
+
+    void InstallDurationModel::RecordObservedDuration(std::string_view packageId, Manifest::InstallerTypeEnum installerType, std::chrono::milliseconds duration)
+    {
+        try
+        {
+            AICLI_LOG(CLI, Verbose, << "Recording install duration of " << duration.count() << "ms for " << packageId);
+            DurationHistoryStore::Instance().Record(MakeDurationHistoryKey(packageId, installerType), duration);
+        }
+        catch (...)
+        {
+            AICLI_LOG(CLI, Warning, << "Failed to record install duration.");
+        }
+    }
+
+    std::chrono::milliseconds InstallDurationModel::EstimateTimeRemaining(std::chrono::milliseconds expected, std::chrono::milliseconds elapsed, std::optional<double> stageProgress)
+    {
+        if (stageProgress && *stageProgress > 0.0)
+        {
+            // Scale the expectation by the reported progress; when the stage runs
+            // longer than expected, fall back to extrapolating from the elapsed time.
+            auto remaining = std::chrono::milliseconds{ static_cast<int64_t>(expected.count() * (1.0 - *stageProgress)) };
+            auto extrapolated = std::chrono::milliseconds{ static_cast<int64_t>(elapsed.count() * (1.0 - *stageProgress) / *stageProgress) };
+            return elapsed < expected ? remaining : extrapolated;
+        }
+
+        return elapsed < expected ? expected - elapsed : std::chrono::milliseconds{ 0 };
+    }
+}
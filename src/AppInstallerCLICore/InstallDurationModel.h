@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <winget/ManifestCommon.h>
+
+#include <chrono>
+#include <optional>
+#include <string_view>
+
+namespace AppInstaller::CLI
+{
+    // A local history of observed install durations, keyed by package id and installer
+    // type, that turns a spinner wait into a time estimate. Observations are folded
+    // into an exponential moving average per key and persisted under the local state
+    // path, so estimates improve across invocations. The model is best effort; any
+    // failure to read or write the history simply results in no estimate.
+    struct InstallDurationModel
+    {
+        // Gets the expected duration for installing the given package, if the history
+        // holds an observation for it.
+        static std::optional<std::chrono::milliseconds> GetExpectedDuration(std::string_view packageId, Manifest::InstallerTypeEnum installerType);
+
+        // Records an observed successful install duration for the given package.
+        static void RecordObservedDuration(std::string_view packageId, Manifest::InstallerTypeEnum installerType, std::chrono::milliseconds duration);
+
+        // Converts the expected duration and current progress into a time remaining
+        // estimate. When stage progress is known it scales the expected duration;
+        // otherwise the elapsed time is subtracted, never going below zero.
+        static std::chrono::milliseconds EstimateTimeRemaining(std::chrono::milliseconds expected, std::chrono::milliseconds elapsed, std::optional<double> stageProgress = {});
+    };
+}
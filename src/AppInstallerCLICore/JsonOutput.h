@@ -0,0 +1,204 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace AppInstaller::CLI::Execution
+{
+    // Enables output of JSON data as a stream.
+    // Values are written to the underlying stream as they are produced, rather than
+    // being accumulated into a document model and serialized at the end; output thus
+    // begins immediately and memory use is independent of the document size.
+    // The caller drives the document structure; only enough state is kept to emit
+    // separators and to reject calls that would produce malformed JSON.
+    struct JsonOutput
+    {
+        JsonOutput(std::ostream& out) : m_out(out) {}
+
+        JsonOutput(const JsonOutput&) = delete;
+        JsonOutput& operator=(const JsonOutput&) = delete;
+
+        // Begins an object; either the document root or the next value in the current scope.
+        JsonOutput& BeginObject()
+        {
+            BeginValue();
+            m_out << '{';
+            m_scopes.push_back({ ScopeType::Object });
+            return *this;
+        }
+
+        JsonOutput& EndObject()
+        {
+            THROW_HR_IF(E_NOT_VALID_STATE, m_scopes.empty() || m_scopes.back().Type != ScopeType::Object || m_scopes.back().NamePending);
+            EndScope('}');
+            return *this;
+        }
+
+        // Begins an array; either the document root or the next value in the current scope.
+        JsonOutput& BeginArray()
+        {
+            BeginValue();
+            m_out << '[';
+            m_scopes.push_back({ ScopeType::Array });
+            return *this;
+        }
+
+        JsonOutput& EndArray()
+        {
+            THROW_HR_IF(E_NOT_VALID_STATE, m_scopes.empty() || m_scopes.back().Type != ScopeType::Array);
+            EndScope(']');
+            return *this;
+        }
+
+        // Writes the name of the next value in the current object.
+        JsonOutput& Name(std::string_view name)
+        {
+            THROW_HR_IF(E_NOT_VALID_STATE, m_scopes.empty() || m_scopes.back().Type != ScopeType::Object || m_scopes.back().NamePending);
+
+            if (m_scopes.back().ValueCount)
+            {
+                m_out << ',';
+            }
+
+            NewLine();
+            WriteString(name);
+            m_out << ": ";
+            m_scopes.back().NamePending = true;
+            return *this;
+        }
+
+        JsonOutput& Value(std::string_view value)
+        {
+            BeginValue();
+            WriteString(value);
+            return *this;
+        }
+
+        JsonOutput& Value(bool value)
+        {
+            BeginValue();
+            m_out << (value ? "true" : "false");
+            return *this;
+        }
+
+        JsonOutput& Value(int64_t value)
+        {
+            BeginValue();
+            m_out << value;
+            return *this;
+        }
+
+        // Completes the document, writing the trailing line break.
+        void Complete()
+        {
+            THROW_HR_IF(E_NOT_VALID_STATE, !m_scopes.empty() || !m_rootWritten);
+            m_out << '\n';
+        }
+
+    private:
+        enum class ScopeType
+        {
+            Object,
+            Array,
+        };
+
+        struct Scope
+        {
+            ScopeType Type;
+            size_t ValueCount = 0;
+            bool NamePending = false;
+        };
+
+        // Handles the bookkeeping common to all values: separators, indentation,
+        // and ensuring that the value is legal at the current position.
+        void BeginValue()
+        {
+            if (m_scopes.empty())
+            {
+                THROW_HR_IF(E_NOT_VALID_STATE, m_rootWritten);
+                m_rootWritten = true;
+                return;
+            }
+
+            Scope& scope = m_scopes.back();
+
+            if (scope.Type == ScopeType::Object)
+            {
+                THROW_HR_IF(E_NOT_VALID_STATE, !scope.NamePending);
+                scope.NamePending = false;
+            }
+            else
+            {
+                if (scope.ValueCount)
+                {
+                    m_out << ',';
+                }
+
+                NewLine();
+            }
+
+            ++scope.ValueCount;
+        }
+
+        void EndScope(char closer)
+        {
+            bool hadValues = m_scopes.back().ValueCount != 0;
+            m_scopes.pop_back();
+
+            if (hadValues)
+            {
+                NewLine();
+            }
+
+            m_out << closer;
+        }
+
+        void NewLine()
+        {
+            m_out << '\n';
+
+            for (size_t i = 0; i < m_scopes.size(); ++i)
+            {
+                m_out << '\t';
+            }
+        }
+
+        void WriteString(std::string_view value)
+        {
+            m_out << '"';
+
+            for (char c : value)
+            {
+                switch (c)
+                {
+                case '"': m_out << "\\\""; break;
+                case '\\': m_out << "\\\\"; break;
+                case '\b': m_out << "\\b"; break;
+                case '\f': m_out << "\\f"; break;
+                case '\n': m_out << "\\n"; break;
+                case '\r': m_out << "\\r"; break;
+                case '\t': m_out << "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        constexpr char hexChars[] = "0123456789abcdef";
+                        m_out << "\\u00" << hexChars[(c >> 4) & 0xF] << hexChars[c & 0xF];
+                    }
+                    else
+                    {
+                        m_out << c;
+                    }
+                    break;
+                }
+            }
+
+            m_out << '"';
+        }
+
+        std::ostream& m_out;
+        std::vector<Scope> m_scopes;
+        bool m_rootWritten = false;
+    };
+}
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "PackageCollection.h"
+#include "JsonOutput.h"
 
 #include <AppInstallerLogging.h>
 #include <AppInstallerRuntime.h>
@@ -244,7 +245,74 @@ namespace AppInstaller::CLI
             return root;
         }
 
-        ParseResult TryParseJson(const Json::Value& root)
+        void WriteJson(std::ostream& out, const PackageCollection& packages)
+        {
+            const auto& ss = StaticStrings::Instance();
+            Execution::JsonOutput json{ out };
+
+            json.BeginObject();
+            json.Name(ss.PackagesJson_WinGetVersion).Value(packages.ClientVersion);
+            // We only generate the latest schema
+            json.Name(ss.PackagesJson_Schema).Value(ss.PackagesJson_SchemaUri_v2_0);
+
+            std::stringstream currentTimeStream;
+            Utility::OutputTimePoint(currentTimeStream, std::chrono::system_clock::now(), true);
+            json.Name(ss.PackagesJson_CreationDate).Value(currentTimeStream.str());
+
+            json.Name(ss.PackagesJson_Sources).BeginArray();
+
+            for (const auto& source : packages.Sources)
+            {
+                json.BeginObject();
+
+                json.Name(ss.PackagesJson_Source_Details).BeginObject();
+                json.Name(ss.PackagesJson_Source_Name).Value(source.Details.Name);
+                json.Name(ss.PackagesJson_Source_Argument).Value(source.Details.Arg);
+                json.Name(ss.PackagesJson_Source_Identifier).Value(source.Details.Identifier);
+                json.Name(ss.PackagesJson_Source_Type).Value(source.Details.Type);
+                json.EndObject();
+
+                json.Name(ss.PackagesJson_Packages).BeginArray();
+
+                for (const auto& package : source.Packages)
+                {
+                    json.BeginObject();
+                    json.Name(ss.PackagesJson_Package_PackageIdentifier).Value(package.Id.get());
+
+                    // Only add version and channel if present.
+                    // Packages may not have a channel, or versions may not have been requested.
+                    const std::string& version = package.VersionAndChannel.GetVersion().ToString();
+                    if (!version.empty())
+                    {
+                        json.Name(ss.PackagesJson_Package_Version).Value(version);
+                    }
+
+                    const std::string& channel = package.VersionAndChannel.GetChannel().ToString();
+                    if (!channel.empty())
+                    {
+                        json.Name(ss.PackagesJson_Package_Channel).Value(channel);
+                    }
+
+                    if (package.Scope != Manifest::ScopeEnum::Unknown)
+                    {
+                        json.Name(ss.PackagesJson_Package_Scope).Value(Manifest::ScopeToString(package.Scope));
+                    }
+
+                    json.EndObject();
+                }
+
+                json.EndArray();
+                json.EndObject();
+            }
+
+            json.EndArray();
+            json.EndObject();
+            json.Complete();
+        }
+
+        // Resolves the compiled schema and parser for the schema declared by the document.
+        // Returns Success when both are resolved; MissingSchema or UnrecognizedSchema otherwise.
+        ParseResult::Type GetSchemaAndParser(const Json::Value& root, const valijson::Schema*& schema, std::unique_ptr<IPackageCollectionParser>& parser)
         {
             const auto& ss = StaticStrings::Instance();
 
@@ -252,40 +320,108 @@ namespace AppInstaller::CLI
             if (!(root.isObject() && root.isMember(ss.PackagesJson_Schema) && root[ss.PackagesJson_Schema].isString()))
             {
                 AICLI_LOG(CLI, Error, << "Import file is missing \"" << ss.PackagesJson_Schema << "\" property");
-                return ParseResult{ ParseResult::Type::MissingSchema };
+                return ParseResult::Type::MissingSchema;
             }
 
             const auto& schemaUri = root[ss.PackagesJson_Schema].asString();
-            Json::Value schemaJson;
-            std::unique_ptr<IPackageCollectionParser> parser;
             if (schemaUri == ss.PackagesJson_SchemaUri_v1_0)
             {
-                schemaJson = JsonSchema::LoadResourceAsSchemaDoc(MAKEINTRESOURCE(IDX_PACKAGES_SCHEMA_V1), MAKEINTRESOURCE(PACKAGESSCHEMA_RESOURCE_TYPE));
+                schema = &JsonSchema::GetCompiledSchema(schemaUri, []()
+                    {
+                        return JsonSchema::LoadResourceAsSchemaDoc(MAKEINTRESOURCE(IDX_PACKAGES_SCHEMA_V1), MAKEINTRESOURCE(PACKAGESSCHEMA_RESOURCE_TYPE));
+                    });
                 parser = std::make_unique<PackageCollectionParser_1_0>();
             }
             else if (schemaUri == ss.PackagesJson_SchemaUri_v2_0)
             {
-                schemaJson = JsonSchema::LoadResourceAsSchemaDoc(MAKEINTRESOURCE(IDX_PACKAGES_SCHEMA_V2), MAKEINTRESOURCE(PACKAGESSCHEMA_RESOURCE_TYPE));
+                schema = &JsonSchema::GetCompiledSchema(schemaUri, []()
+                    {
+                        return JsonSchema::LoadResourceAsSchemaDoc(MAKEINTRESOURCE(IDX_PACKAGES_SCHEMA_V2), MAKEINTRESOURCE(PACKAGESSCHEMA_RESOURCE_TYPE));
+                    });
                 parser = std::make_unique<PackageCollectionParser_2_0>();
             }
             else
             {
                 AICLI_LOG(CLI, Error, << "Unrecognized schema for import file: " << schemaUri);
-                return ParseResult{ ParseResult::Type::UnrecognizedSchema };
+                return ParseResult::Type::UnrecognizedSchema;
             }
 
-            // Validate the JSON against the schema.
-            valijson::Schema schema;
-            JsonSchema::PopulateSchema(schemaJson, schema);
+            return ParseResult::Type::Success;
+        }
 
+        // Validates the JSON against the schema, producing the corresponding result.
+        ParseResult ValidateAgainstSchema(const valijson::Schema& schema, const Json::Value& root)
+        {
             valijson::ValidationResults results;
             if (!JsonSchema::Validate(schema, root, results))
             {
                 return ParseResult{ ParseResult::Type::SchemaValidationFailed, JsonSchema::GetErrorStringFromResults(results) };
             }
 
+            return ParseResult{ ParseResult::Type::Success };
+        }
+
+        ParseResult TryParseJson(const Json::Value& root)
+        {
+            const valijson::Schema* schema = nullptr;
+            std::unique_ptr<IPackageCollectionParser> parser;
+            ParseResult::Type schemaResult = GetSchemaAndParser(root, schema, parser);
+            if (schemaResult != ParseResult::Type::Success)
+            {
+                return ParseResult{ schemaResult };
+            }
+
+            // Validate the JSON against the schema.
+            ParseResult validation = ValidateAgainstSchema(*schema, root);
+            if (validation.Result != ParseResult::Type::Success)
+            {
+                return validation;
+            }
+
             // Extract the data from the JSON.
             return ParseResult{ parser->Parse(root) };
         }
+
+        DeferredParseResult TryParseJsonWithDeferredValidation(Json::Value root)
+        {
+            DeferredParseResult result;
+
+            const valijson::Schema* schema = nullptr;
+            std::unique_ptr<IPackageCollectionParser> parser;
+            ParseResult::Type schemaResult = GetSchemaAndParser(root, schema, parser);
+            if (schemaResult != ParseResult::Type::Success)
+            {
+                result.Parsed = ParseResult{ schemaResult };
+                return result;
+            }
+
+            // Extract the data optimistically; validation runs in the background so that
+            // work on the packages can begin immediately. If the document is broken enough
+            // that extraction itself fails, fall back to validating it synchronously to
+            // surface the real errors.
+            try
+            {
+                result.Parsed = ParseResult{ parser->Parse(root) };
+            }
+            catch (...)
+            {
+                AICLI_LOG(CLI, Warning, << "Extracting packages from import file failed; validating synchronously");
+                result.Parsed = ValidateAgainstSchema(*schema, root);
+                if (result.Parsed.Result == ParseResult::Type::Success)
+                {
+                    // The document is valid but extraction failed; this is not a user error.
+                    throw;
+                }
+
+                return result;
+            }
+
+            result.Validation = std::async(std::launch::async, [schema, document = std::move(root)]()
+                {
+                    return ValidateAgainstSchema(*schema, document);
+                }).share();
+
+            return result;
+        }
     }
 }
\ No newline at end of file
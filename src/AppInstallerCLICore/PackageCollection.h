@@ -7,6 +7,7 @@
 
 #include <json/json.h>
 
+#include <future>
 #include <vector>
 
 namespace AppInstaller::CLI
@@ -73,7 +74,29 @@ namespace AppInstaller::CLI
         // Converts a collection of packages to its JSON representation for exporting.
         Json::Value CreateJson(const PackageCollection& packages);
 
+        // Writes the JSON representation of a collection of packages for exporting.
+        // Streams each package to the output as it is visited, rather than building
+        // the document in memory first.
+        void WriteJson(std::ostream& out, const PackageCollection& packages);
+
         // Tries to parse a JSON into a collection of packages.
         ParseResult TryParseJson(const Json::Value& root);
+
+        // The result of parsing an import file whose schema validation is still running.
+        struct DeferredParseResult
+        {
+            // The immediately available outcome; the packages are extracted optimistically
+            // when the declared schema is recognized.
+            ParseResult Parsed{ ParseResult::Type::Success };
+
+            // Reports the schema validation outcome; must be examined before acting
+            // irreversibly on the parsed data. Only valid when Parsed indicates success.
+            std::shared_future<ParseResult> Validation;
+        };
+
+        // Tries to parse a JSON into a collection of packages, running schema validation
+        // on a background thread so that work on the parsed packages can begin while the
+        // rest of the document is still being validated.
+        DeferredParseResult TryParseJsonWithDeferredValidation(Json::Value root);
     }
 }
\ No newline at end of file
@@ -401,7 +401,11 @@ namespace AppInstaller::CLI::Portable
 
         if (std::filesystem::exists(indexPath))
         {
-            PortableIndex portableIndex = PortableIndex::Open(indexPath.u8string(), SQLiteStorageBase::OpenDisposition::ReadWrite);
+            // Reading the expected state never writes; open read-only so that concurrent
+            // status checks (for example from the COM server) share read locks instead of
+            // queueing behind each other's write sessions. The mutation paths in
+            // ApplyDesiredState open their own ReadWrite sessions.
+            PortableIndex portableIndex = PortableIndex::Open(indexPath.u8string(), SQLiteStorageBase::OpenDisposition::Read);
             m_expectedEntries = portableIndex.GetAllPortableFiles();
         }
         else
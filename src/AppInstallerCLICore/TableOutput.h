@@ -31,6 +31,21 @@ namespace AppInstaller::CLI::Execution
             }
         }
 
+        // Switches to streamed rendering: the first sampleSize rows are buffered to
+        // estimate the column widths, then the buffer is emitted and every subsequent
+        // row is emitted as soon as it is produced. Rows that violate an estimated
+        // width are trimmed to it with a trailing ellipsis, the same handling that
+        // buffered rendering applies past its sizing buffer; a smaller sample thus
+        // trades width accuracy for time to first output.
+        // Must be called before the first row is output.
+        void EnableStreaming(size_t sampleSize)
+        {
+            THROW_HR_IF(E_NOT_VALID_STATE, !m_empty);
+            THROW_HR_IF(E_INVALIDARG, sampleSize == 0);
+            m_streaming = true;
+            m_sizingBuffer = sampleSize;
+        }
+
         void OutputLine(line_t&& line)
         {
             m_empty = false;
@@ -38,6 +53,13 @@ namespace AppInstaller::CLI::Execution
             if (m_buffer.size() < m_sizingBuffer)
             {
                 m_buffer.emplace_back(std::move(line));
+
+                // When streaming, emit the sample as soon as it is complete rather
+                // than waiting for the row after it.
+                if (m_streaming && m_buffer.size() == m_sizingBuffer)
+                {
+                    EvaluateAndFlushBuffer();
+                }
             }
             else
             {
@@ -73,6 +95,7 @@ namespace AppInstaller::CLI::Execution
         std::array<Column, FieldCount> m_columns;
         size_t m_sizingBuffer;
         std::vector<line_t> m_buffer;
+        bool m_streaming = false;
         bool m_bufferEvaluated = false;
         bool m_empty = true;
 
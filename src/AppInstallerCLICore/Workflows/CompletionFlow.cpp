@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "CompletionFlow.h"
+#include "CompletionIndex.h"
 
 namespace AppInstaller::CLI::Workflow
 {
@@ -22,6 +23,91 @@ namespace AppInstaller::CLI::Workflow
                 stream << value << std::endl;
             }
         }
+
+        // Maximum results returned from the precomputed completion indices;
+        // a shell showing more completions than this is not useful anyway.
+        constexpr size_t s_CompletionIndex_MaximumResults = 100;
+
+        // Attempts to answer the completion from the precomputed per source indices,
+        // avoiding opening any source. Returns true when the completion was handled.
+        // Falls back to the search path when any relevant source lacks a fresh index
+        // or when the indices produce nothing, since the search also covers fields
+        // (such as moniker) that the indices do not.
+        bool TryCompleteWithCompletionIndex(Execution::Context& context, Execution::Args::Type type)
+        {
+            const std::string& word = context.Get<Data::CompletionData>().Word();
+            if (word.empty())
+            {
+                return false;
+            }
+
+            std::vector<Repository::SourceDetails> sources;
+            for (auto& details : Repository::Source::GetCurrentSources())
+            {
+                if (!context.Args.Contains(Execution::Args::Type::Source) ||
+                    Utility::ICUCaseInsensitiveEquals(details.Name, context.Args.GetArg(Execution::Args::Type::Source)))
+                {
+                    sources.emplace_back(std::move(details));
+                }
+            }
+
+            if (sources.empty())
+            {
+                return false;
+            }
+
+            std::vector<CompletionIndex::Field> fields;
+            switch (type)
+            {
+            case Execution::Args::Type::Query:
+            case Execution::Args::Type::MultiQuery:
+                fields = { CompletionIndex::Field::Id, CompletionIndex::Field::Name };
+                break;
+            case Execution::Args::Type::Id:
+                fields = { CompletionIndex::Field::Id };
+                break;
+            case Execution::Args::Type::Name:
+                fields = { CompletionIndex::Field::Name };
+                break;
+            default:
+                return false;
+            }
+
+            std::set<std::string> results;
+
+            for (const auto& details : sources)
+            {
+                auto index = CompletionIndex::TryLoad(details);
+                if (!index)
+                {
+                    AICLI_LOG(CLI, Verbose, << "No fresh completion index for source [" << details.Name << "]; completing through search");
+                    return false;
+                }
+
+                for (CompletionIndex::Field field : fields)
+                {
+                    for (auto&& value : index->FindPrefixMatches(field, word, s_CompletionIndex_MaximumResults))
+                    {
+                        results.emplace(std::move(value));
+                    }
+                }
+            }
+
+            if (results.empty())
+            {
+                return false;
+            }
+
+            AICLI_LOG(CLI, Info, << "Completion answered from precomputed index [" << results.size() << " results]");
+
+            auto stream = context.Reporter.Completion();
+            for (const auto& value : results)
+            {
+                OutputCompletionString(stream, value);
+            }
+
+            return true;
+        }
     }
 
     void CompleteSourceName(Execution::Context& context)
@@ -103,6 +189,21 @@ namespace AppInstaller::CLI::Workflow
 
     void CompleteWithSingleSemanticsForValue::operator()(Execution::Context& context) const
     {
+        // The precomputed indices bound completion latency by avoiding the source open
+        // and search entirely; anything they cannot answer takes the search path below.
+        switch (m_type)
+        {
+        case Execution::Args::Type::Query:
+        case Execution::Args::Type::MultiQuery:
+        case Execution::Args::Type::Id:
+        case Execution::Args::Type::Name:
+            if (TryCompleteWithCompletionIndex(context, m_type))
+            {
+                return;
+            }
+            break;
+        }
+
         switch (m_type)
         {
         case Execution::Args::Type::Query:
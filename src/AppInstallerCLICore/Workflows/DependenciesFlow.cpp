@@ -17,6 +17,9 @@ namespace AppInstaller::CLI::Workflow
 {
     namespace
     {
+        // The maximum number of dependency source lookups that can be in flight at once.
+        constexpr size_t s_MaximumConcurrentDependencyLookups = 4;
+
         // Contains all the information needed to install a dependency package.
         struct DependencyPackageCandidate
         {
@@ -264,13 +267,16 @@ namespace AppInstaller::CLI::Workflow
 
         std::map<string_t, DependencyPackageCandidate> idToPackageMap;
         bool foundError = false;
-        DependencyGraph dependencyGraph(rootAsDependency, rootDependencies, 
-            [&](Dependency node)
+        std::mutex resultsLock;
+
+        auto evaluateDependencyNode = [&](Dependency node)
             {
                 DependencyNodeProcessor nodeProcessor(context);
 
                 auto result = nodeProcessor.EvaluateDependencies(node);
                 DependencyList list = nodeProcessor.GetDependencyList();
+
+                std::lock_guard<std::mutex> lock{ resultsLock };
                 foundError = foundError || (result == DependencyNodeProcessorResult::Error);
 
                 if (result == DependencyNodeProcessorResult::Success)
@@ -284,9 +290,106 @@ namespace AppInstaller::CLI::Workflow
                 };
 
                 return list;
-            });
+            };
+
+        DependencyGraph dependencyGraph(rootAsDependency, rootDependencies, evaluateDependencyNode);
+
+        // Evaluating a node is dominated by source lookups, so evaluate the pending nodes with a
+        // bounded set of workers, handing newly discovered dependencies to an idle worker as soon
+        // as the node that declared them has been evaluated rather than one lookup at a time.
+        // The source interfaces serialize access internally, the graph is only expanded under
+        // queueLock, and the node results are merged under resultsLock.
+        {
+            std::deque<Dependency> pendingNodes;
+            for (auto&& node : dependencyGraph.TakeNodesToEvaluate())
+            {
+                pendingNodes.push_back(std::move(node));
+            }
+
+            size_t threadCount = std::min<size_t>(s_MaximumConcurrentDependencyLookups, std::thread::hardware_concurrency());
+
+            if (threadCount < 2)
+            {
+                while (!pendingNodes.empty())
+                {
+                    Dependency node = std::move(pendingNodes.front());
+                    pendingNodes.pop_front();
+
+                    for (auto&& discovered : dependencyGraph.Expand(node, evaluateDependencyNode(node)))
+                    {
+                        pendingNodes.push_back(std::move(discovered));
+                    }
+                }
+            }
+            else
+            {
+                std::mutex queueLock;
+                std::condition_variable queueCV;
+                size_t nodesInFlight = 0;
+                std::vector<std::exception_ptr> exceptions;
+                std::vector<std::thread> threads;
+
+                for (size_t t = 0; t < threadCount; ++t)
+                {
+                    threads.emplace_back([&]()
+                        {
+                            auto previousThreadGlobals = context.SetForCurrentThread();
+
+                            std::unique_lock<std::mutex> lock{ queueLock };
+
+                            for (;;)
+                            {
+                                queueCV.wait(lock, [&]() { return !pendingNodes.empty() || nodesInFlight == 0; });
+
+                                if (pendingNodes.empty())
+                                {
+                                    // No pending work and nothing in flight that could discover more.
+                                    break;
+                                }
+
+                                Dependency node = std::move(pendingNodes.front());
+                                pendingNodes.pop_front();
+                                ++nodesInFlight;
+
+                                lock.unlock();
+
+                                try
+                                {
+                                    DependencyList list = evaluateDependencyNode(node);
+
+                                    lock.lock();
+
+                                    for (auto&& discovered : dependencyGraph.Expand(node, list))
+                                    {
+                                        pendingNodes.push_back(std::move(discovered));
+                                    }
+                                }
+                                catch (...)
+                                {
+                                    lock.lock();
+                                    exceptions.push_back(std::current_exception());
+                                    pendingNodes.clear();
+                                }
+
+                                --nodesInFlight;
+                                queueCV.notify_all();
+                            }
+                        });
+                }
+
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+
+                if (!exceptions.empty())
+                {
+                    std::rethrow_exception(exceptions.front());
+                }
+            }
+        }
 
-        dependencyGraph.BuildGraph();
+        dependencyGraph.CheckForLoopsAndGetOrder();
 
         if (foundError)
         {
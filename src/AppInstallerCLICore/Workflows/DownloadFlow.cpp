@@ -7,6 +7,7 @@
 #include <AppInstallerMsixInfo.h>
 #include <winget/AdminSettings.h>
 #include <AppInstallerDownloader.h>
+#include <algorithm>
 
 namespace AppInstaller::CLI::Workflow
 {
@@ -115,8 +116,7 @@ namespace AppInstaller::CLI::Workflow
             if (std::filesystem::exists(filePath))
             {
                 AICLI_LOG(CLI, Info, << "Found existing installer file at '" << filePath << "'. Verifying file hash.");
-                std::ifstream inStream{ filePath, std::ifstream::binary };
-                fileHash = SHA256::ComputeHash(inStream);
+                fileHash = SHA256::ComputeHashFromFile(filePath);
 
                 if (SHA256::AreEqual(expectedHash, fileHash))
                 {
@@ -129,6 +129,109 @@ namespace AppInstaller::CLI::Workflow
 
             return false;
         }
+
+        // The maximum total size of the installer cache; the least recently used
+        // entries are evicted once the cache grows beyond this bound.
+        constexpr uint64_t s_InstallerCacheMaximumSizeInBytes = 1ull << 30;
+
+        // Get the directory holding cached installer payloads, keyed by their SHA256 hash.
+        std::filesystem::path GetInstallerCacheDirectoryPath()
+        {
+            return Runtime::GetPathTo(Runtime::PathName::LocalState) / "installerCache";
+        }
+
+        // Removes the least recently used cache entries until the cache is within its size bound.
+        void PruneInstallerCache(const std::filesystem::path& cacheDirectory)
+        {
+            try
+            {
+                struct CacheEntry
+                {
+                    std::filesystem::path Path;
+                    uint64_t Size;
+                    std::filesystem::file_time_type LastWriteTime;
+                };
+
+                std::vector<CacheEntry> entries;
+                uint64_t totalSize = 0;
+
+                for (const auto& file : std::filesystem::directory_iterator{ cacheDirectory })
+                {
+                    if (file.is_regular_file())
+                    {
+                        entries.push_back({ file.path(), file.file_size(), file.last_write_time() });
+                        totalSize += entries.back().Size;
+                    }
+                }
+
+                if (totalSize <= s_InstallerCacheMaximumSizeInBytes)
+                {
+                    return;
+                }
+
+                std::sort(entries.begin(), entries.end(), [](const CacheEntry& a, const CacheEntry& b) { return a.LastWriteTime < b.LastWriteTime; });
+
+                for (const auto& entry : entries)
+                {
+                    if (totalSize <= s_InstallerCacheMaximumSizeInBytes)
+                    {
+                        break;
+                    }
+
+                    AICLI_LOG(CLI, Info, << "Evicting installer cache entry: " << entry.Path);
+                    RemoveInstallerFile(entry.Path);
+                    totalSize -= entry.Size;
+                }
+            }
+            catch (...)
+            {
+                AICLI_LOG(CLI, Warning, << "Failed to prune installer cache.");
+            }
+        }
+
+        // Attempts to restore a previously verified installer payload from the cache.
+        // Returns true and copies the payload to the given path if the cache holds a
+        // file whose contents match the expected hash; the cache is best effort, so
+        // any failure simply results in the normal download.
+        bool TryRestoreInstallerFromCache(const SHA256::HashBuffer& expectedHash, const std::filesystem::path& destinationPath, SHA256::HashBuffer& fileHash)
+        {
+            try
+            {
+                std::filesystem::path cacheFilePath = GetInstallerCacheDirectoryPath() / SHA256::ConvertToString(expectedHash);
+
+                if (!std::filesystem::exists(cacheFilePath))
+                {
+                    return false;
+                }
+
+                // Guard against the entry having been corrupted on disk.
+                fileHash = SHA256::ComputeHashFromFile(cacheFilePath);
+                if (!SHA256::AreEqual(expectedHash, fileHash))
+                {
+                    AICLI_LOG(CLI, Warning, << "Installer cache entry hash does not match its name. Removing: " << cacheFilePath);
+                    RemoveInstallerFile(cacheFilePath);
+                    return false;
+                }
+
+                std::filesystem::copy_file(cacheFilePath, destinationPath, std::filesystem::copy_options::overwrite_existing);
+
+                // Mark the entry as recently used for eviction purposes.
+                std::filesystem::last_write_time(cacheFilePath, std::filesystem::file_time_type::clock::now());
+
+                AICLI_LOG(CLI, Info, << "Restored installer from cache entry: " << cacheFilePath);
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                AICLI_LOG(CLI, Warning, << "Failed to restore installer from cache. Reason: " << e.what());
+                return false;
+            }
+            catch (...)
+            {
+                AICLI_LOG(CLI, Warning, << "Failed to restore installer from cache. Reason unknown.");
+                return false;
+            }
+        }
     }
 
     void DownloadInstaller(Execution::Context& context)
@@ -182,6 +285,7 @@ namespace AppInstaller::CLI::Workflow
         context <<
             VerifyInstallerHash <<
             UpdateInstallerFileMotwIfApplicable <<
+            CacheVerifiedInstaller <<
             RenameDownloadedInstaller;
     }
 
@@ -203,8 +307,14 @@ namespace AppInstaller::CLI::Workflow
             installerFilename = GetInstallerPostHashValidationFileName(context);
             if (!ExistingInstallerFileHasHashMatch(installer.Sha256, installerPath / installerFilename, fileHash))
             {
-                // No match
-                return;
+                // Not present in the download location; try restoring a previously
+                // verified payload from the installer cache.
+                installerFilename = GetInstallerPreHashValidationFileName(context);
+                if (!TryRestoreInstallerFromCache(installer.Sha256, installerPath / installerFilename, fileHash))
+                {
+                    // No match
+                    return;
+                }
             }
         }
 
@@ -318,10 +428,7 @@ namespace AppInstaller::CLI::Workflow
     {
         const auto& hashPair = context.Get<Execution::Data::HashPair>();
 
-        if (!std::equal(
-            hashPair.first.begin(),
-            hashPair.first.end(),
-            hashPair.second.begin()))
+        if (!SHA256::AreEqual(hashPair.first, hashPair.second))
         {
             bool overrideHashMismatch = context.Args.Contains(Execution::Args::Type::HashOverride);
 
@@ -400,6 +507,48 @@ namespace AppInstaller::CLI::Workflow
         }
     }
 
+    void CacheVerifiedInstaller(Execution::Context& context)
+    {
+        // Only cache payloads whose hash actually matched the manifest; an overridden
+        // mismatch must not become a cache hit for a later install.
+        if (!context.Contains(Execution::Data::InstallerPath) ||
+            !WI_IsFlagSet(context.GetFlags(), Execution::ContextFlag::InstallerHashMatched))
+        {
+            return;
+        }
+
+        try
+        {
+            const auto& installerPath = context.Get<Execution::Data::InstallerPath>();
+
+            std::filesystem::path cacheDirectory = GetInstallerCacheDirectoryPath();
+            std::filesystem::create_directories(cacheDirectory);
+
+            std::filesystem::path cacheFilePath = cacheDirectory / SHA256::ConvertToString(context.Get<Execution::Data::Installer>()->Sha256);
+
+            if (std::filesystem::exists(cacheFilePath))
+            {
+                // Already cached; just mark the entry as recently used.
+                std::filesystem::last_write_time(cacheFilePath, std::filesystem::file_time_type::clock::now());
+            }
+            else
+            {
+                std::filesystem::copy_file(installerPath, cacheFilePath);
+                AICLI_LOG(CLI, Info, << "Cached verified installer at: " << cacheFilePath);
+            }
+
+            PruneInstallerCache(cacheDirectory);
+        }
+        catch (const std::exception& e)
+        {
+            AICLI_LOG(CLI, Warning, << "Failed to cache verified installer. Reason: " << e.what());
+        }
+        catch (...)
+        {
+            AICLI_LOG(CLI, Warning, << "Failed to cache verified installer. Reason unknown.");
+        }
+    }
+
     void ReverifyInstallerHash(Execution::Context& context)
     {
         const auto& installer = context.Get<Execution::Data::Installer>().value();
@@ -408,8 +557,7 @@ namespace AppInstaller::CLI::Workflow
         {
             // Get the hash from the installer file
             const auto& installerPath = context.Get<Execution::Data::InstallerPath>();
-            std::ifstream inStream{ installerPath, std::ifstream::binary };
-            auto existingFileHash = SHA256::ComputeHash(inStream);
+            auto existingFileHash = SHA256::ComputeHashFromFile(installerPath);
             context.Add<Execution::Data::HashPair>(std::make_pair(installer.Sha256, existingFileHash));
         }
         else if (installer.EffectiveInstallerType() == InstallerTypeEnum::MSStore)
@@ -53,6 +53,13 @@ namespace AppInstaller::CLI::Workflow
     // Outputs: None
     void UpdateInstallerFileMotwIfApplicable(Execution::Context& context);
 
+    // Copies the verified installer into the installer cache so that a later install
+    // of the same payload can skip the download. Does nothing if the hash did not match.
+    // Required Args: None
+    // Inputs: Installer, InstallerPath?
+    // Outputs: None
+    void CacheVerifiedInstaller(Execution::Context& context);
+
     // This method appends appropriate extension to the downloaded installer.
     // ShellExecute uses file extension to launch the installer appropriately.
     // Required Args: None
@@ -6,8 +6,10 @@
 #include "UpdateFlow.h"
 #include "PackageCollection.h"
 #include "WorkflowBase.h"
+#include <AppInstallerSHA256.h>
 #include <winget/RepositorySearch.h>
 #include <winget/Runtime.h>
+#include <winget/Settings.h>
 
 namespace AppInstaller::CLI::Workflow
 {
@@ -15,6 +17,9 @@ namespace AppInstaller::CLI::Workflow
 
     namespace
     {
+        // The maximum number of export version selections that can be running at once.
+        constexpr size_t s_MaximumConcurrentExportEvaluations = 4;
+
         SourceDetails GetSourceDetails(const SourceDetails& source)
         {
             return source;
@@ -56,14 +61,16 @@ namespace AppInstaller::CLI::Workflow
         }
 
         // Gets the available version of an installed package.
-        // If requested, checks that the installed version is available and reports a warning if it is not.
+        // If requested, checks that the installed version is available and indicates when it is not.
         std::shared_ptr<IPackageVersion> GetAvailableVersionForInstalledPackage(
-            Execution::Context& context,
             std::shared_ptr<IPackage> package,
             Utility::LocIndView version,
             Utility::LocIndView channel,
-            bool checkVersion)
+            bool checkVersion,
+            bool& installedVersionNotAvailable)
         {
+            installedVersionNotAvailable = false;
+
             if (!checkVersion)
             {
                 return package->GetLatestAvailableVersion(PinBehavior::IgnorePins);
@@ -75,60 +82,237 @@ namespace AppInstaller::CLI::Workflow
                 availablePackageVersion = package->GetLatestAvailableVersion(PinBehavior::IgnorePins);
                 if (availablePackageVersion)
                 {
-                    // Warn installed version is not available.
+                    // Installed version is not available; the caller reports the warning.
                     AICLI_LOG(
                         CLI,
                         Info,
                         << "Installed package version is not available."
                         << " Package Id [" << availablePackageVersion->GetProperty(PackageVersionProperty::Id) << "], Version [" << version << "], Channel [" << channel << "]"
                         << ". Found Version [" << availablePackageVersion->GetProperty(PackageVersionProperty::Version) << "], Channel [" << availablePackageVersion->GetProperty(PackageVersionProperty::Version) << "]");
-                    context.Reporter.Warn() << Resource::String::InstalledPackageVersionNotAvailable(availablePackageVersion->GetProperty(PackageVersionProperty::Id), version, channel) << std::endl;
+                    installedVersionNotAvailable = true;
                 }
             }
 
             return availablePackageVersion;
         }
+
+        // The data gathered for a single installed package before it is added to the exported collection.
+        struct ExportPackageData
+        {
+            Utility::LocIndString InstalledName;
+            std::string Version;
+            std::string Channel;
+            bool IsAvailable = false;
+            bool InstalledVersionNotAvailable = false;
+            bool RequiresLicenseAgreement = false;
+            Utility::LocIndString Id;
+            SourceDetails Source;
+        };
+
+        // Import journal field names.
+        constexpr std::string_view s_ImportJournal_ImportFileHash = "importFileHash";
+        constexpr std::string_view s_ImportJournal_CompletedPackages = "completedPackages";
+
+        // Builds the journal key identifying a package request within an import file.
+        std::string GetImportJournalKey(const PackageCollection::Source& source, const PackageCollection::Package& package)
+        {
+            std::ostringstream key;
+            key << source.Details.Identifier << '|' << Utility::FoldCase(static_cast<std::string_view>(package.Id.get())) << '|' << package.VersionAndChannel.ToString();
+            return key.str();
+        }
+
+        // Reads the import journal, returning the completed package keys that it holds
+        // if it applies to the import file with the given hash.
+        std::vector<std::string> ReadImportJournal(const std::string& importFileHash)
+        {
+            std::vector<std::string> result;
+
+            try
+            {
+                Settings::Stream journalStream{ Settings::Stream::ImportJournal };
+                auto stream = journalStream.Get();
+                if (!stream)
+                {
+                    return result;
+                }
+
+                Json::Value root;
+                Json::CharReaderBuilder builder;
+                Json::String errors;
+                if (!Json::parseFromStream(builder, *stream, &root, &errors))
+                {
+                    AICLI_LOG(CLI, Warning, << "Failed to parse import journal: " << errors);
+                    return result;
+                }
+
+                if (root[std::string{ s_ImportJournal_ImportFileHash }].asString() != importFileHash)
+                {
+                    // The journal belongs to a different import file.
+                    return result;
+                }
+
+                for (const auto& entry : root[std::string{ s_ImportJournal_CompletedPackages }])
+                {
+                    if (entry.isString())
+                    {
+                        result.emplace_back(entry.asString());
+                    }
+                }
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+                result.clear();
+            }
+
+            return result;
+        }
+
+        // Writes the journal recording the packages completed so far for the import file.
+        void WriteImportJournal(const std::string& importFileHash, const std::vector<std::string>& completedKeys)
+        {
+            Json::Value root{ Json::ValueType::objectValue };
+            root[std::string{ s_ImportJournal_ImportFileHash }] = importFileHash;
+
+            Json::Value completed{ Json::ValueType::arrayValue };
+            for (const auto& key : completedKeys)
+            {
+                completed.append(key);
+            }
+            root[std::string{ s_ImportJournal_CompletedPackages }] = std::move(completed);
+
+            Json::StreamWriterBuilder writerBuilder;
+            writerBuilder.settings_["indentation"] = "";
+
+            Settings::Stream journalStream{ Settings::Stream::ImportJournal };
+            if (!journalStream.Set(Json::writeString(writerBuilder, root)))
+            {
+                AICLI_LOG(CLI, Warning, << "Failed to write import journal");
+            }
+        }
     }
 
     void SelectVersionsToExport(Execution::Context& context)
     {
         const auto& searchResult = context.Get<Execution::Data::SearchResult>();
         const bool includeVersions = context.Args.Contains(Execution::Args::Type::IncludeVersions);
+
+        // Gathers the export data for a single installed package.
+        auto getExportPackageData = [&](const auto& packageMatch)
+            {
+                ExportPackageData data;
+
+                auto installedPackageVersion = packageMatch.Package->GetInstalledVersion();
+                auto version = installedPackageVersion->GetProperty(PackageVersionProperty::Version);
+                auto channel = installedPackageVersion->GetProperty(PackageVersionProperty::Channel);
+                data.InstalledName = installedPackageVersion->GetProperty(PackageVersionProperty::Name);
+                data.Version = version.get();
+                data.Channel = channel.get();
+
+                // Find an available version of this package to determine its source.
+                auto availablePackageVersion = GetAvailableVersionForInstalledPackage(
+                    packageMatch.Package, Utility::LocIndView{ version }, Utility::LocIndView{ channel }, includeVersions, data.InstalledVersionNotAvailable);
+                if (availablePackageVersion)
+                {
+                    data.IsAvailable = true;
+                    data.Id = availablePackageVersion->GetProperty(PackageVersionProperty::Id);
+                    data.Source = availablePackageVersion->GetSource().GetDetails();
+                    data.RequiresLicenseAgreement = !availablePackageVersion->GetManifest().DefaultLocalization.Get<Manifest::Localization::Agreements>().empty();
+
+                    AICLI_LOG(CLI, Info,
+                        << "Installed package is available. Package Id [" << data.Id << "], Source [" << data.Source.Identifier << "]");
+                }
+                else
+                {
+                    AICLI_LOG(CLI, Warning, << "No available version of package [" << data.InstalledName << "] was found to export");
+                }
+
+                return data;
+            };
+
+        // The version selection is dominated by the per-package source lookups, so evaluate the
+        // packages with a bounded set of workers; the source interfaces serialize access
+        // internally. The results are reported and bucketed afterwards, in the original order.
+        std::vector<ExportPackageData> exportData(searchResult.Matches.size());
+
+        size_t threadCount = std::min<size_t>({ s_MaximumConcurrentExportEvaluations, exportData.size(), std::thread::hardware_concurrency() });
+        if (threadCount < 2)
+        {
+            for (size_t i = 0; i < exportData.size(); ++i)
+            {
+                exportData[i] = getExportPackageData(searchResult.Matches[i]);
+            }
+        }
+        else
+        {
+            std::vector<std::exception_ptr> exceptions(threadCount);
+            std::vector<std::thread> threads;
+
+            for (size_t t = 0; t < threadCount; ++t)
+            {
+                threads.emplace_back([&, t]()
+                    {
+                        auto previousThreadGlobals = context.SetForCurrentThread();
+
+                        try
+                        {
+                            for (size_t i = t; i < exportData.size(); i += threadCount)
+                            {
+                                exportData[i] = getExportPackageData(searchResult.Matches[i]);
+                            }
+                        }
+                        catch (...)
+                        {
+                            exceptions[t] = std::current_exception();
+                        }
+                    });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            for (const auto& exception : exceptions)
+            {
+                if (exception)
+                {
+                    std::rethrow_exception(exception);
+                }
+            }
+        }
+
         PackageCollection exportedPackages;
         exportedPackages.ClientVersion = Runtime::GetClientVersion().get();
         auto& exportedSources = exportedPackages.Sources;
-        for (const auto& packageMatch : searchResult.Matches)
-        {
-            auto installedPackageVersion = packageMatch.Package->GetInstalledVersion();
-            auto version = installedPackageVersion->GetProperty(PackageVersionProperty::Version);
-            auto channel = installedPackageVersion->GetProperty(PackageVersionProperty::Channel);
 
-            // Find an available version of this package to determine its source.
-            auto availablePackageVersion = GetAvailableVersionForInstalledPackage(context, packageMatch.Package, Utility::LocIndView{ version }, Utility::LocIndView{ channel }, includeVersions);
-            if (!availablePackageVersion)
+        for (const auto& data : exportData)
+        {
+            if (!data.IsAvailable)
             {
                 // Report package not found and move to next package.
-                AICLI_LOG(CLI, Warning, << "No available version of package [" << installedPackageVersion->GetProperty(PackageVersionProperty::Name) << "] was found to export");
-                context.Reporter.Warn() << Resource::String::InstalledPackageNotAvailable(installedPackageVersion->GetProperty(PackageVersionProperty::Name)) << std::endl;
+                context.Reporter.Warn() << Resource::String::InstalledPackageNotAvailable(data.InstalledName) << std::endl;
                 continue;
             }
 
-            const auto& sourceDetails = availablePackageVersion->GetSource().GetDetails();
-            AICLI_LOG(CLI, Info,
-                << "Installed package is available. Package Id [" << availablePackageVersion->GetProperty(PackageVersionProperty::Id) << "], Source [" << sourceDetails.Identifier << "]");
+            if (data.InstalledVersionNotAvailable)
+            {
+                // Warn installed version is not available.
+                context.Reporter.Warn() << Resource::String::InstalledPackageVersionNotAvailable(data.Id, Utility::LocIndView{ data.Version }, Utility::LocIndView{ data.Channel }) << std::endl;
+            }
 
-            if (!availablePackageVersion->GetManifest().DefaultLocalization.Get<Manifest::Localization::Agreements>().empty())
+            if (data.RequiresLicenseAgreement)
             {
                 // Report that the package requires accepting license terms
-                AICLI_LOG(CLI, Warning, << "Package [" << installedPackageVersion->GetProperty(PackageVersionProperty::Name) << "] requires license agreement to install");
-                context.Reporter.Warn() << Resource::String::ExportedPackageRequiresLicenseAgreement(installedPackageVersion->GetProperty(PackageVersionProperty::Name)) << std::endl;
+                AICLI_LOG(CLI, Warning, << "Package [" << data.InstalledName << "] requires license agreement to install");
+                context.Reporter.Warn() << Resource::String::ExportedPackageRequiresLicenseAgreement(data.InstalledName) << std::endl;
             }
 
             // Find the exported source for this package
-            auto sourceItr = FindSource(exportedSources, sourceDetails);
+            auto sourceItr = FindSource(exportedSources, data.Source);
             if (sourceItr == exportedSources.end())
             {
-                exportedSources.emplace_back(sourceDetails);
+                exportedSources.emplace_back(data.Source);
                 sourceItr = std::prev(exportedSources.end());
             }
 
@@ -136,14 +320,11 @@ namespace AppInstaller::CLI::Workflow
             // but take the exported version from the installed package if needed.
             if (includeVersions)
             {
-                sourceItr->Packages.emplace_back(
-                    availablePackageVersion->GetProperty(PackageVersionProperty::Id),
-                    version.get(),
-                    channel.get());
+                sourceItr->Packages.emplace_back(data.Id, data.Version, data.Channel);
             }
             else
             {
-                sourceItr->Packages.emplace_back(availablePackageVersion->GetProperty(PackageVersionProperty::Id));
+                sourceItr->Packages.emplace_back(data.Id);
             }
         }
 
@@ -152,48 +333,63 @@ namespace AppInstaller::CLI::Workflow
 
     void WriteImportFile(Execution::Context& context)
     {
-        auto packages = PackagesJson::CreateJson(context.Get<Execution::Data::PackageCollection>());
-
         std::filesystem::path outputFilePath{ context.Args.GetArg(Execution::Args::Type::OutputFile) };
         std::ofstream outputFileStream{ outputFilePath };
-        outputFileStream << packages;
+        PackagesJson::WriteJson(outputFileStream, context.Get<Execution::Data::PackageCollection>());
     }
 
     void ReadImportFile(Execution::Context& context)
     {
-        std::ifstream importFile(Utility::ConvertToUTF16(context.Args.GetArg(Execution::Args::Type::ImportFile)));
+        std::ifstream importFile(Utility::ConvertToUTF16(context.Args.GetArg(Execution::Args::Type::ImportFile)), std::ios::binary);
         THROW_LAST_ERROR_IF(importFile.fail());
 
+        // Hash the raw file bytes; the resume journal uses it to recognize a rerun of the same file.
+        std::string importFileContents{ std::istreambuf_iterator<char>{ importFile }, std::istreambuf_iterator<char>{} };
+        context.Add<Execution::Data::ImportFileHash>(Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(importFileContents)));
+
         Json::Value jsonRoot;
         Json::CharReaderBuilder builder;
         Json::String errors;
-        if (!Json::parseFromStream(builder, importFile, &jsonRoot, &errors))
+        std::istringstream importStream{ importFileContents };
+        if (!Json::parseFromStream(builder, importStream, &jsonRoot, &errors))
         {
             AICLI_LOG(CLI, Error, << "Failed to read JSON: " << errors);
             context.Reporter.Error() << Resource::String::InvalidJsonFile << std::endl;
             AICLI_TERMINATE_CONTEXT(APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
         }
 
-        PackagesJson::ParseResult parseResult = PackagesJson::TryParseJson(jsonRoot);
-        if (parseResult.Result != PackagesJson::ParseResult::Type::Success)
+        // Schema validation continues in the background; source resolution can begin
+        // immediately and EnsureImportFileValidated checks the outcome before installing.
+        PackagesJson::DeferredParseResult parseResult = PackagesJson::TryParseJsonWithDeferredValidation(std::move(jsonRoot));
+        if (parseResult.Parsed.Result != PackagesJson::ParseResult::Type::Success)
         {
             context.Reporter.Error() << Resource::String::InvalidJsonFile << std::endl;
-            if (parseResult.Result == PackagesJson::ParseResult::Type::MissingSchema ||
-                parseResult.Result == PackagesJson::ParseResult::Type::UnrecognizedSchema)
+            if (parseResult.Parsed.Result == PackagesJson::ParseResult::Type::MissingSchema ||
+                parseResult.Parsed.Result == PackagesJson::ParseResult::Type::UnrecognizedSchema)
             {
                 context.Reporter.Error() << Resource::String::ImportFileHasInvalidSchema << std::endl;
             }
-            else if (parseResult.Result == PackagesJson::ParseResult::Type::SchemaValidationFailed)
+            else if (parseResult.Parsed.Result == PackagesJson::ParseResult::Type::SchemaValidationFailed)
             {
-                context.Reporter.Error() << parseResult.Errors << std::endl;
+                context.Reporter.Error() << parseResult.Parsed.Errors << std::endl;
             }
 
             AICLI_TERMINATE_CONTEXT(APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
         }
 
-        PackageCollection& packages = parseResult.Packages;
+        context.Add<Execution::Data::ImportFileValidation>(std::move(parseResult.Validation));
+
+        PackageCollection& packages = parseResult.Parsed.Packages;
         if (packages.Sources.empty())
         {
+            // Either a genuinely empty collection or a file that does not conform to the
+            // schema; wait for the validation outcome to tell the two apart.
+            EnsureImportFileValidated(context);
+            if (context.IsTerminated())
+            {
+                return;
+            }
+
             AICLI_LOG(CLI, Warning, << "No packages to install");
             context.Reporter.Info() << Resource::String::NoPackagesFoundInImportFile << std::endl;
             AICLI_TERMINATE_CONTEXT(APPINSTALLER_CLI_ERROR_NO_APPLICATIONS_FOUND);
@@ -211,9 +407,59 @@ namespace AppInstaller::CLI::Workflow
             }
         }
 
+        // Drop the requests that a previously interrupted run of this same file already completed.
+        std::vector<std::string> completedKeys = ReadImportJournal(context.Get<Execution::Data::ImportFileHash>());
+        if (!completedKeys.empty())
+        {
+            size_t skippedCount = 0;
+            for (auto& source : packages.Sources)
+            {
+                auto removeItr = std::remove_if(source.Packages.begin(), source.Packages.end(),
+                    [&](const PackageCollection::Package& package)
+                    {
+                        return std::find(completedKeys.begin(), completedKeys.end(), GetImportJournalKey(source, package)) != completedKeys.end();
+                    });
+                skippedCount += static_cast<size_t>(std::distance(removeItr, source.Packages.end()));
+                source.Packages.erase(removeItr, source.Packages.end());
+            }
+
+            packages.Sources.erase(
+                std::remove_if(packages.Sources.begin(), packages.Sources.end(), [](const PackageCollection::Source& source) { return source.Packages.empty(); }),
+                packages.Sources.end());
+
+            if (skippedCount != 0)
+            {
+                AICLI_LOG(CLI, Info, << "Import journal matched; skipping " << skippedCount << " packages completed by a previous run");
+                context.Reporter.Info() << Resource::String::ImportResumeSkippingPackages(skippedCount) << std::endl;
+            }
+
+            if (packages.Sources.empty())
+            {
+                // Everything was installed by the previous run; nothing left to resume.
+                Settings::Stream{ Settings::Stream::ImportJournal }.Remove();
+                context.Reporter.Info() << Resource::String::ImportResumeAllPackagesInstalled << std::endl;
+                AICLI_TERMINATE_CONTEXT(S_OK);
+            }
+        }
+
         context.Add<Execution::Data::PackageCollection>(std::move(packages));
     }
 
+    void EnsureImportFileValidated(Execution::Context& context)
+    {
+        PackagesJson::ParseResult validation = context.Get<Execution::Data::ImportFileValidation>().get();
+        if (validation.Result != PackagesJson::ParseResult::Type::Success)
+        {
+            context.Reporter.Error() << Resource::String::InvalidJsonFile << std::endl;
+            if (validation.Result == PackagesJson::ParseResult::Type::SchemaValidationFailed)
+            {
+                context.Reporter.Error() << validation.Errors << std::endl;
+            }
+
+            AICLI_TERMINATE_CONTEXT(APPINSTALLER_CLI_ERROR_JSON_INVALID_FILE);
+        }
+    }
+
     void OpenSourcesForImport(Execution::Context& context)
     {
         auto availableSources = Repository::Source::GetCurrentSources();
@@ -277,6 +523,7 @@ namespace AppInstaller::CLI::Workflow
 
                 searchContext.Add<Execution::Data::Source>(source);
                 searchContext.Add<Execution::Data::SearchRequest>(std::move(searchRequest));
+                searchContext.Add<Execution::Data::ImportJournalKey>(GetImportJournalKey(requiredSource, packageRequest));
 
                 if (packageRequest.Scope != Manifest::ScopeEnum::Unknown)
                 {
@@ -305,10 +552,37 @@ namespace AppInstaller::CLI::Workflow
 
     void InstallImportedPackages(Execution::Context& context)
     {
+        // Seed the journal state with the entries from any previously interrupted run so that
+        // a second interruption does not lose them.
+        const std::string& importFileHash = context.Get<Execution::Data::ImportFileHash>();
+        std::vector<std::string> completedKeys = ReadImportJournal(importFileHash);
+
+        auto recordCompletedPackage = [&](Execution::Context& installContext)
+            {
+                try
+                {
+                    if (installContext.Contains(Execution::Data::ImportJournalKey))
+                    {
+                        completedKeys.emplace_back(installContext.Get<Execution::Data::ImportJournalKey>());
+                        WriteImportJournal(importFileHash, completedKeys);
+                    }
+                }
+                catch (...)
+                {
+                    // Failing to journal must not fail the install that just succeeded.
+                    LOG_CAUGHT_EXCEPTION();
+                }
+            };
+
         context << Workflow::InstallMultiplePackages(
-            Resource::String::ImportCommandReportDependencies, APPINSTALLER_CLI_ERROR_IMPORT_INSTALL_FAILED, {}, true, true);
+            Resource::String::ImportCommandReportDependencies, APPINSTALLER_CLI_ERROR_IMPORT_INSTALL_FAILED, {}, true, true, false, std::move(recordCompletedPackage));
 
-        if (context.GetTerminationHR() == APPINSTALLER_CLI_ERROR_IMPORT_INSTALL_FAILED)
+        if (!context.IsTerminated())
+        {
+            // The import ran to completion; the next run starts fresh.
+            Settings::Stream{ Settings::Stream::ImportJournal }.Remove();
+        }
+        else if (context.GetTerminationHR() == APPINSTALLER_CLI_ERROR_IMPORT_INSTALL_FAILED)
         {
             context.Reporter.Error() << Resource::String::ImportInstallFailed << std::endl;
         }
@@ -23,6 +23,12 @@ namespace AppInstaller::CLI::Workflow
     // Outputs: PackageCollection
     void ReadImportFile(Execution::Context& context);
 
+    // Waits for the deferred schema validation of the import file and fails if it did not pass.
+    // Required Args: None
+    // Inputs: ImportFileValidation
+    // Outputs: None
+    void EnsureImportFileValidated(Execution::Context& context);
+
     // Opens the sources specified in an import file
     // Required Args: None
     // Inputs: PackageCollection
@@ -15,6 +15,7 @@
 #include "WorkflowBase.h"
 #include "DependenciesFlow.h"
 #include "PromptFlow.h"
+#include "InstallDurationModel.h"
 #include <AppInstallerMsixInfo.h>
 #include <AppInstallerDeployment.h>
 #include <winget/ARPCorrelation.h>
@@ -395,6 +396,17 @@ namespace AppInstaller::CLI::Workflow
             }
         }
 
+        const auto& manifest = context.Get<Execution::Data::Manifest>();
+
+        auto expectedDuration = InstallDurationModel::GetExpectedDuration(manifest.Id, m_installerType);
+        if (expectedDuration && *expectedDuration >= std::chrono::seconds{ 5 })
+        {
+            context.Reporter.Info() << Resource::String::InstallExpectedDuration(
+                std::chrono::duration_cast<std::chrono::seconds>(*expectedDuration).count()) << std::endl;
+        }
+
+        auto executionStart = std::chrono::steady_clock::now();
+
         switch (m_installerType)
         {
         case InstallerTypeEnum::Exe:
@@ -443,6 +455,21 @@ namespace AppInstaller::CLI::Workflow
         default:
             THROW_HR(HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED));
         }
+
+        // Feed the duration model with successful executions only, so that fast
+        // failures do not drag the estimate down.
+        if (!context.IsTerminated() && context.Contains(Execution::Data::OperationReturnCode))
+        {
+            DWORD operationResult = context.Get<Execution::Data::OperationReturnCode>();
+            const auto& successCodes = context.Get<Execution::Data::Installer>()->InstallerSuccessCodes;
+            if (operationResult == 0 || std::find(successCodes.begin(), successCodes.end(), operationResult) != successCodes.end())
+            {
+                InstallDurationModel::RecordObservedDuration(
+                    manifest.Id,
+                    m_installerType,
+                    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - executionStart));
+            }
+        }
     }
 
     void EnsureRunningAsAdminForMachineScopeInstall(Execution::Context& context)
@@ -534,8 +561,7 @@ namespace AppInstaller::CLI::Workflow
             Workflow::ReportExecutionStage(ExecutionStage::Execution) <<
             Workflow::ExecuteInstaller <<
             Workflow::ReportExecutionStage(ExecutionStage::PostExecution) <<
-            Workflow::ReportARPChanges <<
-            Workflow::RecordInstall <<
+            Workflow::DeferPostInstallBookkeeping <<
             Workflow::RemoveInstaller << 
             Workflow::DisplayInstallationNotes;
     }
@@ -547,10 +573,70 @@ namespace AppInstaller::CLI::Workflow
             Workflow::ReportIdentityAndInstallationDisclaimer <<
             Workflow::ShowPromptsForSinglePackage(/* ensureAcceptance */ true) <<
             Workflow::GetDependenciesFromInstaller <<
-            Workflow::ReportDependencies(Resource::String::InstallAndUpgradeCommandsReportDependencies) <<
-            Workflow::EnableWindowsFeaturesDependencies <<
-            Workflow::ManagePackageDependencies(Resource::String::InstallAndUpgradeCommandsReportDependencies) <<
-            Workflow::DownloadInstaller;
+            Workflow::ReportDependencies(Resource::String::InstallAndUpgradeCommandsReportDependencies);
+
+        if (context.IsTerminated())
+        {
+            return;
+        }
+
+        // With no dependencies to handle, the concurrency below buys nothing and would only
+        // hide the download progress; run the flow inline on the calling thread instead.
+        if (!context.Contains(Execution::Data::Dependencies) || context.Get<Execution::Data::Dependencies>().Empty())
+        {
+            context <<
+                Workflow::EnableWindowsFeaturesDependencies <<
+                Workflow::ManagePackageDependencies(Resource::String::InstallAndUpgradeCommandsReportDependencies) <<
+                Workflow::DownloadInstaller;
+            return;
+        }
+
+        // The installer download does not depend on anything that the dependency handling
+        // produces, so it proceeds in the background while the dependencies are handled on
+        // the calling thread, where they can interact with the user and own the console;
+        // the download branch's output is buffered and shown once both branches are done.
+        std::vector<ConcurrentWorkflowBranch> branches(2);
+
+        branches[0].Execute = [](Execution::Context& branchContext)
+            {
+                branchContext <<
+                    Workflow::EnableWindowsFeaturesDependencies <<
+                    Workflow::ManagePackageDependencies(Resource::String::InstallAndUpgradeCommandsReportDependencies);
+            };
+
+        branches[1].Execute = [](Execution::Context& branchContext)
+            {
+                branchContext << Workflow::DownloadInstaller;
+            };
+
+        branches[1].SeedData = [](Execution::Context& parent, Execution::Context& branch)
+            {
+                branch.Add<Execution::Data::Manifest>(parent.GetManifestHandle());
+                branch.Add<Execution::Data::Installer>(parent.Get<Execution::Data::Installer>());
+                if (parent.Contains(Execution::Data::PackageVersion))
+                {
+                    branch.Add<Execution::Data::PackageVersion>(parent.Get<Execution::Data::PackageVersion>());
+                }
+            };
+
+        branches[1].CollectData = [](Execution::Context& parent, Execution::Context& branch)
+            {
+                // MSStore installers produce neither a file nor a hash.
+                if (branch.Contains(Execution::Data::InstallerPath))
+                {
+                    parent.Add<Execution::Data::InstallerPath>(branch.Get<Execution::Data::InstallerPath>());
+                }
+
+                if (branch.Contains(Execution::Data::HashPair))
+                {
+                    parent.Add<Execution::Data::HashPair>(branch.Get<Execution::Data::HashPair>());
+                }
+
+                // The hash and trust determinations made during the download drive later decisions.
+                parent.SetFlags(branch.GetFlags() & (Execution::ContextFlag::InstallerHashMatched | Execution::ContextFlag::InstallerTrusted));
+            };
+
+        context << Workflow::RunConcurrentBranches(std::move(branches));
     }
 
     void InstallSinglePackage(Execution::Context& context)
@@ -593,16 +679,69 @@ namespace AppInstaller::CLI::Workflow
         }
 
         bool allSucceeded = true;
-        size_t packagesCount = context.Get<Execution::Data::PackageSubContexts>().size();
-        size_t packagesProgress = 0;
+        auto& packageSubContexts = context.Get<Execution::Data::PackageSubContexts>();
+        size_t packagesCount = packageSubContexts.size();
+
+        // While one package's installer executes, the next package's installer is downloaded in
+        // the background. Only one download is ever in flight, which also bounds the disk space
+        // held by installers that have not yet been consumed to a single package. The download
+        // runs against a buffered sub context of the next package's context: the console belongs
+        // to the package being installed, so the background download must not paint progress or
+        // interleave its text with the foreground output.
+        std::thread prefetchThread;
+        std::unique_ptr<Execution::Context> prefetchContext;
+        size_t prefetchTarget = 0;
+        std::vector<bool> downloadCompleted(packagesCount, false);
+
+        auto joinPrefetch = [&](bool cancel)
+            {
+                if (prefetchThread.joinable())
+                {
+                    if (cancel || context.IsTerminated())
+                    {
+                        prefetchContext->Cancel(false, true);
+                    }
+
+                    prefetchThread.join();
+
+                    // No other package is rendering now; let the download's output catch up.
+                    prefetchContext->Reporter.ReplayBufferedOutputTo(context.Reporter);
+
+                    Execution::Context& targetContext = *packageSubContexts[prefetchTarget];
+                    if (prefetchContext->IsTerminated())
+                    {
+                        targetContext.SetTerminationHR(prefetchContext->GetTerminationHR());
+                    }
+                    else
+                    {
+                        // MSStore installers produce neither a file nor a hash.
+                        if (prefetchContext->Contains(Execution::Data::InstallerPath))
+                        {
+                            targetContext.Add<Execution::Data::InstallerPath>(prefetchContext->Get<Execution::Data::InstallerPath>());
+                        }
+
+                        if (prefetchContext->Contains(Execution::Data::HashPair))
+                        {
+                            targetContext.Add<Execution::Data::HashPair>(prefetchContext->Get<Execution::Data::HashPair>());
+                        }
 
-        for (auto& packageContext : context.Get<Execution::Data::PackageSubContexts>())
+                        // The hash and trust determinations made during the download drive later decisions.
+                        targetContext.SetFlags(prefetchContext->GetFlags() & (Execution::ContextFlag::InstallerHashMatched | Execution::ContextFlag::InstallerTrusted));
+                    }
+
+                    prefetchContext.reset();
+                }
+            };
+
+        for (size_t i = 0; i < packagesCount; ++i)
         {
-            packagesProgress++;
-            context.Reporter.Info() << '(' << packagesProgress << '/' << packagesCount << ") "_liv;
+            // Wait for this package's background download before touching its context.
+            joinPrefetch(false);
+
+            context.Reporter.Info() << '(' << (i + 1) << '/' << packagesCount << ") "_liv;
 
             // We want to do best effort to install all packages regardless of previous failures
-            Execution::Context& installContext = *packageContext;
+            Execution::Context& installContext = *packageSubContexts[i];
             auto previousThreadGlobals = installContext.SetForCurrentThread();
 
             installContext << Workflow::ReportIdentityAndInstallationDisclaimer;
@@ -614,15 +753,55 @@ namespace AppInstaller::CLI::Workflow
                 {
                     installContext << Workflow::ManagePackageDependencies(m_dependenciesReportMessage);
                 }
-                installContext <<
-                    Workflow::DownloadInstaller <<
-                    Workflow::InstallPackageInstaller;
+
+                // Start downloading the next package's installer while this one finishes.
+                if (i + 1 < packagesCount && !installContext.IsTerminated())
+                {
+                    Execution::Context& nextPackageContext = *packageSubContexts[i + 1];
+                    prefetchTarget = i + 1;
+                    downloadCompleted[i + 1] = true;
+
+                    prefetchContext = nextPackageContext.CreateBufferedSubContext();
+                    prefetchContext->Add<Execution::Data::Manifest>(nextPackageContext.GetManifestHandle());
+                    prefetchContext->Add<Execution::Data::Installer>(nextPackageContext.Get<Execution::Data::Installer>());
+                    if (nextPackageContext.Contains(Execution::Data::PackageVersion))
+                    {
+                        prefetchContext->Add<Execution::Data::PackageVersion>(nextPackageContext.Get<Execution::Data::PackageVersion>());
+                    }
+
+                    prefetchThread = std::thread([prefetchContext = prefetchContext.get()]()
+                        {
+                            auto previousThreadGlobals = prefetchContext->SetForCurrentThread();
+
+                            try
+                            {
+                                *prefetchContext << Workflow::DownloadInstaller;
+                            }
+                            catch (...)
+                            {
+                                prefetchContext->SetTerminationHR(Workflow::HandleException(*prefetchContext, std::current_exception()));
+                            }
+                        });
+                }
+
+                if (!downloadCompleted[i])
+                {
+                    installContext << Workflow::DownloadInstaller;
+                }
+
+                installContext << Workflow::InstallPackageInstaller;
             }
             catch (...)
             {
                 installContext.SetTerminationHR(Workflow::HandleException(installContext, std::current_exception()));
             }
 
+            // Let the caller record the completed package.
+            if (m_onPackageInstalled && !installContext.IsTerminated())
+            {
+                m_onPackageInstalled(installContext);
+            }
+
             installContext.Reporter.Info() << std::endl;
 
             if (installContext.IsTerminated())
@@ -631,6 +810,7 @@ namespace AppInstaller::CLI::Workflow
                 {
                     // This means that the subcontext being terminated is due to an overall abort
                     context.Reporter.Info() << Resource::String::Cancelled << std::endl;
+                    joinPrefetch(true);
                     return;
                 }
 
@@ -645,6 +825,9 @@ namespace AppInstaller::CLI::Workflow
             }
         }
 
+        // Only still running if the loop was left early; those packages will not install.
+        joinPrefetch(true);
+
         if (!allSucceeded)
         {
             AICLI_TERMINATE_CONTEXT(m_resultOnFailure);
@@ -665,144 +848,196 @@ namespace AppInstaller::CLI::Workflow
     }
     CATCH_LOG()
 
-    void ReportARPChanges(Execution::Context& context) try
+    namespace
     {
-        if (!context.Contains(Execution::Data::ARPCorrelationData))
+        // Everything that the post-install bookkeeping needs, owned outright so that the
+        // work can complete after the deferring context has been destroyed.
+        struct PostInstallBookkeepingData
         {
-            return;
-        }
+            AppInstaller::Manifest::Manifest Manifest;
+            std::optional<Repository::Correlation::ARPCorrelationData> CorrelationData;
+            std::shared_ptr<Repository::IPackageVersion> PackageVersion;
+            std::optional<ManifestInstaller> Installer;
+            Repository::IPackageVersion::Metadata InstalledMetadata;
+            std::string UserIntentArchitecture;
+            std::string UserIntentLocale;
+            bool IsUpdate = false;
+            ThreadLocalStorage::ThreadGlobals* CallerGlobals = nullptr;
+        };
 
-        const auto& manifest = context.Get<Execution::Data::Manifest>();
-        auto& arpCorrelationData = context.Get<Execution::Data::ARPCorrelationData>();
+        // Correlates the ARP snapshots and records the installation to the tracking
+        // catalog; runs on the background bookkeeping thread.
+        void RunPostInstallBookkeeping(PostInstallBookkeepingData data) try
+        {
+            std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+            if (data.CallerGlobals)
+            {
+                previousGlobals = data.CallerGlobals->SetForCurrentThread();
+            }
 
-        arpCorrelationData.CapturePostInstallSnapshot();
-        auto correlationResult = arpCorrelationData.CorrelateForNewlyInstalled(manifest);
+            if (data.CorrelationData)
+            {
+                auto correlationResult = data.CorrelationData->CorrelateForNewlyInstalled(data.Manifest);
 
-        // Store the ARP entry found to match the package to record it in the tracking catalog later
-        if (correlationResult.Package)
-        {
-            std::vector<AppsAndFeaturesEntry> entries;
+                // If we have determined an ARP entry matches the installed package,
+                // we set its product code in the manifest we record to ensure we can
+                // find it in the future.
+                // Note that this may overwrite existing information.
+                if (correlationResult.Package)
+                {
+                    std::vector<AppsAndFeaturesEntry> entries;
 
-            auto metadata = correlationResult.Package->GetMetadata();
+                    auto metadata = correlationResult.Package->GetMetadata();
 
-            AppsAndFeaturesEntry baseEntry;
+                    AppsAndFeaturesEntry baseEntry;
 
-            // Display name and publisher are also available as multi properties, but
-            // for ARP there will always be only 0 or 1 values.
-            baseEntry.DisplayName = correlationResult.Package->GetProperty(PackageVersionProperty::Name).get();
-            baseEntry.Publisher = correlationResult.Package->GetProperty(PackageVersionProperty::Publisher).get();
-            baseEntry.DisplayVersion = correlationResult.Package->GetProperty(PackageVersionProperty::Version).get();
-            baseEntry.InstallerType = Manifest::ConvertToInstallerTypeEnum(metadata[PackageVersionMetadata::InstalledType]);
+                    // Display name and publisher are also available as multi properties, but
+                    // for ARP there will always be only 0 or 1 values.
+                    baseEntry.DisplayName = correlationResult.Package->GetProperty(PackageVersionProperty::Name).get();
+                    baseEntry.Publisher = correlationResult.Package->GetProperty(PackageVersionProperty::Publisher).get();
+                    baseEntry.DisplayVersion = correlationResult.Package->GetProperty(PackageVersionProperty::Version).get();
+                    baseEntry.InstallerType = Manifest::ConvertToInstallerTypeEnum(metadata[PackageVersionMetadata::InstalledType]);
 
-            auto productCodes = correlationResult.Package->GetMultiProperty(PackageVersionMultiProperty::ProductCode);
-            for (auto&& productCode : productCodes)
-            {
-                AppsAndFeaturesEntry entry = baseEntry;
-                entry.ProductCode = std::move(productCode).get();
-                entries.push_back(std::move(entry));
+                    auto productCodes = correlationResult.Package->GetMultiProperty(PackageVersionMultiProperty::ProductCode);
+                    for (auto&& productCode : productCodes)
+                    {
+                        AppsAndFeaturesEntry entry = baseEntry;
+                        entry.ProductCode = std::move(productCode).get();
+                        entries.push_back(std::move(entry));
+                    }
+
+                    auto upgradeCodes = correlationResult.Package->GetMultiProperty(PackageVersionMultiProperty::UpgradeCode);
+                    for (auto&& upgradeCode : upgradeCodes)
+                    {
+                        AppsAndFeaturesEntry entry = baseEntry;
+                        entry.UpgradeCode= std::move(upgradeCode).get();
+                        entries.push_back(std::move(entry));
+                    }
+
+                    // Use a new Installer entry
+                    data.Manifest.Installers.emplace_back();
+                    data.Manifest.Installers.back().AppsAndFeaturesEntries = std::move(entries);
+                }
+
+                // We can only get the source identifier from an active source
+                std::string sourceIdentifier;
+                if (data.PackageVersion)
+                {
+                    sourceIdentifier = data.PackageVersion->GetProperty(PackageVersionProperty::SourceIdentifier);
+                }
+
+                IPackageVersion::Metadata arpEntryMetadata;
+                if (correlationResult.Package)
+                {
+                    arpEntryMetadata = correlationResult.Package->GetMetadata();
+                }
+
+                Logging::Telemetry().LogSuccessfulInstallARPChange(
+                    sourceIdentifier,
+                    data.Manifest.Id,
+                    data.Manifest.Version,
+                    data.Manifest.Channel,
+                    correlationResult.ChangesToARP,
+                    correlationResult.MatchesInARP,
+                    correlationResult.CountOfIntersectionOfChangesAndMatches,
+                    correlationResult.Package ? static_cast<std::string>(correlationResult.Package->GetProperty(PackageVersionProperty::Name)) : "",
+                    correlationResult.Package ? static_cast<std::string>(correlationResult.Package->GetProperty(PackageVersionProperty::Version)) : "",
+                    correlationResult.Package ? static_cast<std::string>(correlationResult.Package->GetProperty(PackageVersionProperty::Publisher)) : "",
+                    correlationResult.Package ? static_cast<std::string_view>(arpEntryMetadata[PackageVersionMetadata::InstalledLocale]) : ""
+                );
             }
 
-            auto upgradeCodes = correlationResult.Package->GetMultiProperty(PackageVersionMultiProperty::UpgradeCode);
-            for (auto&& upgradeCode : upgradeCodes)
+            // Local manifest installs won't have a package version, and tracking them doesn't provide much
+            // value currently. If we ever do use our own database as a primary source of packages that we
+            // maintain, this decision will probably have to be reconsidered.
+            if (!data.PackageVersion)
             {
-                AppsAndFeaturesEntry entry = baseEntry;
-                entry.UpgradeCode= std::move(upgradeCode).get();
-                entries.push_back(std::move(entry));
+                return;
             }
 
-            context.Add<Data::CorrelatedAppsAndFeaturesEntries>(std::move(entries));
-        }
+            auto trackingCatalog = data.PackageVersion->GetSource().GetTrackingCatalog();
 
-        // We can only get the source identifier from an active source
-        std::string sourceIdentifier;
-        if (context.Contains(Execution::Data::PackageVersion))
-        {
-            sourceIdentifier = context.Get<Execution::Data::PackageVersion>()->GetProperty(PackageVersionProperty::SourceIdentifier);
-        }
+            auto version = trackingCatalog.RecordInstall(
+                data.Manifest,
+                data.Installer.value(),
+                data.IsUpdate);
 
-        IPackageVersion::Metadata arpEntryMetadata;
-        if (correlationResult.Package)
-        {
-            arpEntryMetadata = correlationResult.Package->GetMetadata();
-        }
+            // Record user intent values. Command args takes precedence. Then previous user intent values.
+            if (!data.UserIntentArchitecture.empty())
+            {
+                version.SetMetadata(Repository::PackageVersionMetadata::UserIntentArchitecture, data.UserIntentArchitecture);
+            }
+            else
+            {
+                auto itr = data.InstalledMetadata.find(Repository::PackageVersionMetadata::UserIntentArchitecture);
+                if (itr != data.InstalledMetadata.end())
+                {
+                    version.SetMetadata(Repository::PackageVersionMetadata::UserIntentArchitecture, itr->second);
+                }
+            }
 
-        Logging::Telemetry().LogSuccessfulInstallARPChange(
-            sourceIdentifier,
-            manifest.Id,
-            manifest.Version,
-            manifest.Channel,
-            correlationResult.ChangesToARP,
-            correlationResult.MatchesInARP,
-            correlationResult.CountOfIntersectionOfChangesAndMatches,
-            correlationResult.Package ? static_cast<std::string>(correlationResult.Package->GetProperty(PackageVersionProperty::Name)) : "",
-            correlationResult.Package ? static_cast<std::string>(correlationResult.Package->GetProperty(PackageVersionProperty::Version)) : "",
-            correlationResult.Package ? static_cast<std::string>(correlationResult.Package->GetProperty(PackageVersionProperty::Publisher)) : "",
-            correlationResult.Package ? static_cast<std::string_view>(arpEntryMetadata[PackageVersionMetadata::InstalledLocale]) : ""
-        );
+            if (!data.UserIntentLocale.empty())
+            {
+                version.SetMetadata(Repository::PackageVersionMetadata::UserIntentLocale, data.UserIntentLocale);
+            }
+            else
+            {
+                auto itr = data.InstalledMetadata.find(Repository::PackageVersionMetadata::UserIntentLocale);
+                if (itr != data.InstalledMetadata.end())
+                {
+                    version.SetMetadata(Repository::PackageVersionMetadata::UserIntentLocale, itr->second);
+                }
+            }
+        }
+        CATCH_LOG()
     }
-    CATCH_LOG();
 
-    void RecordInstall(Context& context)
+    void DeferPostInstallBookkeeping(Execution::Context& context) try
     {
-        // Local manifest installs won't have a package version, and tracking them doesn't provide much
-        // value currently. If we ever do use our own database as a primary source of packages that we
-        // maintain, this decision will probably have to be reconsidered.
-        if (!context.Contains(Data::PackageVersion))
+        PostInstallBookkeepingData data;
+
+        // The post-install snapshot of ARP must be captured before another installer can
+        // run, so it stays on the calling thread; correlating it and recording the result
+        // produce no user-visible output and complete on the background worker, which is
+        // drained before the command's result is reported.
+        if (context.Contains(Execution::Data::ARPCorrelationData))
         {
-            return;
+            auto& arpCorrelationData = context.Get<Execution::Data::ARPCorrelationData>();
+            arpCorrelationData.CapturePostInstallSnapshot();
+            data.CorrelationData = std::move(arpCorrelationData);
         }
 
-        auto manifest = context.Get<Data::Manifest>();
+        data.Manifest = context.Get<Execution::Data::Manifest>();
+        data.Installer = context.Get<Execution::Data::Installer>();
+        data.IsUpdate = WI_IsFlagSet(context.GetFlags(), ContextFlag::InstallerExecutionUseUpdate);
 
-        // If we have determined an ARP entry matches the installed package,
-        // we set its product code in the manifest we record to ensure we can
-        // find it in the future.
-        // Note that this may overwrite existing information.
-        if (context.Contains(Data::CorrelatedAppsAndFeaturesEntries))
+        if (context.Contains(Execution::Data::PackageVersion))
         {
-            // Use a new Installer entry
-            manifest.Installers.emplace_back();
-            manifest.Installers.back().AppsAndFeaturesEntries = context.Get<Data::CorrelatedAppsAndFeaturesEntries>();
+            data.PackageVersion = context.Get<Execution::Data::PackageVersion>();
         }
 
-        auto trackingCatalog = context.Get<Data::PackageVersion>()->GetSource().GetTrackingCatalog();
-
-        auto version = trackingCatalog.RecordInstall(
-            manifest,
-            context.Get<Data::Installer>().value(),
-            WI_IsFlagSet(context.GetFlags(), ContextFlag::InstallerExecutionUseUpdate));
-
-        // Record user intent values. Command args takes precedence. Then previous user intent values.
-        Repository::IPackageVersion::Metadata installedMetadata;
-        if (context.Contains(Data::InstalledPackageVersion) && context.Get<Execution::Data::InstalledPackageVersion>())
+        if (context.Contains(Execution::Data::InstalledPackageVersion) && context.Get<Execution::Data::InstalledPackageVersion>())
         {
-            installedMetadata = context.Get<Data::InstalledPackageVersion>()->GetMetadata();
+            data.InstalledMetadata = context.Get<Execution::Data::InstalledPackageVersion>()->GetMetadata();
         }
 
         if (context.Args.Contains(Execution::Args::Type::InstallArchitecture))
         {
-            version.SetMetadata(Repository::PackageVersionMetadata::UserIntentArchitecture, context.Args.GetArg(Execution::Args::Type::InstallArchitecture));
-        }
-        else
-        {
-            auto itr = installedMetadata.find(Repository::PackageVersionMetadata::UserIntentArchitecture);
-            if (itr != installedMetadata.end())
-            {
-                version.SetMetadata(Repository::PackageVersionMetadata::UserIntentArchitecture, itr->second);
-            }
+            data.UserIntentArchitecture = context.Args.GetArg(Execution::Args::Type::InstallArchitecture);
         }
 
         if (context.Args.Contains(Execution::Args::Type::Locale))
         {
-            version.SetMetadata(Repository::PackageVersionMetadata::UserIntentLocale, context.Args.GetArg(Execution::Args::Type::Locale));
+            data.UserIntentLocale = context.Args.GetArg(Execution::Args::Type::Locale);
         }
-        else
-        {
-            auto itr = installedMetadata.find(Repository::PackageVersionMetadata::UserIntentLocale);
-            if (itr != installedMetadata.end())
+
+        data.CallerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+        BackgroundBookkeeper::Instance().Defer(
+            [data = std::move(data)]() mutable
             {
-                version.SetMetadata(Repository::PackageVersionMetadata::UserIntentLocale, itr->second);
-            }
-        }
+                RunPostInstallBookkeeping(std::move(data));
+            });
     }
+    CATCH_LOG()
 }
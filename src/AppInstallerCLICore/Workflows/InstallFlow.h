@@ -167,14 +167,16 @@ namespace AppInstaller::CLI::Workflow
             std::vector<HRESULT>&& ignorableInstallResults = {},
             bool ensurePackageAgreements = true,
             bool ignoreDependencies = false,
-            bool stopOnFailure = false) :
+            bool stopOnFailure = false,
+            std::function<void(Execution::Context&)> onPackageInstalled = {}) :
             WorkflowTask("InstallMultiplePackages"),
             m_dependenciesReportMessage(dependenciesReportMessage),
             m_resultOnFailure(resultOnFailure),
             m_ignorableInstallResults(std::move(ignorableInstallResults)),
             m_ignorePackageDependencies(ignoreDependencies),
             m_ensurePackageAgreements(ensurePackageAgreements),
-            m_stopOnFailure(stopOnFailure) {}
+            m_stopOnFailure(stopOnFailure),
+            m_onPackageInstalled(std::move(onPackageInstalled)) {}
 
         void operator()(Execution::Context& context) const override;
 
@@ -185,6 +187,8 @@ namespace AppInstaller::CLI::Workflow
         bool m_ignorePackageDependencies;
         bool m_ensurePackageAgreements;
         bool m_stopOnFailure;
+        // Invoked with each sub-context whose package installed successfully.
+        std::function<void(Execution::Context&)> m_onPackageInstalled;
     };
 
     // Stores the existing set of packages in ARP.
@@ -193,16 +197,11 @@ namespace AppInstaller::CLI::Workflow
     // Outputs: ARPSnapshot
     void SnapshotARPEntries(Execution::Context& context);
 
-    // Reports on the changes between the stored ARPSnapshot and the current values,
-    // and stores the product code of the ARP entry found for the package.
+    // Captures the post-install ARP snapshot on the calling thread, then defers the
+    // correlation, its telemetry, and the tracking catalog recording to the background
+    // bookkeeping worker, which is drained before the command's result is reported.
     // Required Args: None
-    // Inputs: ARPSnapshot?, Manifest, PackageVersion
-    // Outputs: CorrelatedAppsAndFeaturesEntries?
-    void ReportARPChanges(Execution::Context& context);
-
-    // Records the installation to the tracking catalog.
-    // Required Args: None
-    // Inputs: PackageVersion?, Manifest, Installer, CorrelatedAppsAndFeaturesEntries?
+    // Inputs: ARPCorrelationData?, Manifest, Installer, PackageVersion?, InstalledPackageVersion?
     // Outputs: None
-    void RecordInstall(Execution::Context& context);
+    void DeferPostInstallBookkeeping(Execution::Context& context);
 }
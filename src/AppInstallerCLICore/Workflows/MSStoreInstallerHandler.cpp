@@ -5,6 +5,8 @@
 #include <winget/ManifestCommon.h>
 #include <winget/Runtime.h>
 
+#include <condition_variable>
+
 namespace AppInstaller::CLI::Workflow
 {
     using namespace std::string_view_literals;
@@ -14,6 +16,54 @@ namespace AppInstaller::CLI::Workflow
 
     namespace
     {
+        // Consolidated status subscription for every in-flight install item. The single
+        // waiting workflow thread sleeps until the Store client reports a status change
+        // on any item, rather than each operation polling on a fixed interval thread.
+        struct MSStoreOperationWatcher
+        {
+            MSStoreOperationWatcher(const IVectorView<AppInstallItem>& installItems)
+            {
+                for (auto const& installItem : installItems)
+                {
+                    m_subscriptions.emplace_back(installItem, installItem.StatusChanged(
+                        [this](AppInstallItem const&, winrt::Windows::Foundation::IInspectable const&) { Notify(); }));
+                }
+            }
+
+            ~MSStoreOperationWatcher()
+            {
+                for (auto& [installItem, token] : m_subscriptions)
+                {
+                    installItem.StatusChanged(token);
+                }
+            }
+
+            // Wakes the waiting thread; also used when the operation is cancelled.
+            void Notify()
+            {
+                {
+                    std::lock_guard<std::mutex> lock{ m_mutex };
+                    m_wake = true;
+                }
+                m_cv.notify_all();
+            }
+
+            // Blocks until a status change (or notification) arrives. The Store client can
+            // restart mid-operation and drop events, so a periodic wake acts as a backstop.
+            void Wait()
+            {
+                std::unique_lock<std::mutex> lock{ m_mutex };
+                m_cv.wait_for(lock, std::chrono::seconds(2), [this]() { return m_wake; });
+                m_wake = false;
+            }
+
+        private:
+            std::vector<std::pair<AppInstallItem, winrt::event_token>> m_subscriptions;
+            std::mutex m_mutex;
+            std::condition_variable m_cv;
+            bool m_wake = false;
+        };
+
         HRESULT WaitForMSStoreOperation(Execution::Context& context, IVectorView<AppInstallItem>& installItems)
         {
             bool isSilentMode = context.Args.Contains(Execution::Args::Type::Silent);
@@ -35,6 +85,9 @@ namespace AppInstaller::CLI::Workflow
             context.Reporter.ExecuteWithProgress(
                 [&](IProgressCallback& progress)
                 {
+                    MSStoreOperationWatcher watcher{ installItems };
+                    auto cancellationWake = progress.SetCancellationFunction([&watcher]() { watcher.Notify(); });
+
                     // We are aggregating all AppInstallItem progresses into one.
                     // Averaging every progress for now until we have a better way to find overall progress.
                     uint64_t overallProgressMax = 100 * static_cast<uint64_t>(installItems.Size());
@@ -72,7 +125,7 @@ namespace AppInstaller::CLI::Workflow
                             }
                         }
 
-                        Sleep(100);
+                        watcher.Wait();
                     }
                 });
 
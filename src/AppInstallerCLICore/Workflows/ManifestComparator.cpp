@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "ManifestComparator.h"
 #include "WorkflowBase.h"
+#include <AppInstallerLanguageUtilities.h>
 #include <AppInstallerLogging.h>
 #include <winget/UserSettings.h>
 #include <winget/Runtime.h>
@@ -22,6 +23,53 @@ std::ostream& operator<<(std::ostream& out, const AppInstaller::Manifest::Manife
 
 namespace AppInstaller::CLI::Workflow
 {
+    namespace details
+    {
+        InstallerAttributes::Mask InstallerAttributes::ArchitectureBit(Utility::Architecture architecture)
+        {
+            // Unknown is -1; shift the enum range so that it occupies the first bit of the group.
+            return Mask{ 1 } << (ToIntegral(architecture) + 1);
+        }
+
+        InstallerAttributes::Mask InstallerAttributes::InstallerTypeBit(Manifest::InstallerTypeEnum installerType)
+        {
+            return Mask{ 1 } << (InstallerTypeShift + ToIntegral(installerType));
+        }
+
+        InstallerAttributes::Mask InstallerAttributes::ScopeBit(Manifest::ScopeEnum scope)
+        {
+            return Mask{ 1 } << (ScopeShift + ToIntegral(scope));
+        }
+
+        InstallerAttributes::Mask InstallerAttributes::Get(const Manifest::ManifestInstaller& installer)
+        {
+            Mask result = ArchitectureBit(installer.Arch);
+
+            // Filters accept an installer type through its ARP entries as well, so those types
+            // are part of the installer's attributes.
+            InstallerTypeEnum effectiveType = installer.EffectiveInstallerType();
+            result |= InstallerTypeBit(effectiveType);
+            for (const auto& entry : installer.AppsAndFeaturesEntries)
+            {
+                result |= InstallerTypeBit(entry.InstallerType);
+            }
+
+            if (DoesInstallerTypeIgnoreScopeFromManifest(effectiveType))
+            {
+                // A scope agnostic installer can be driven to any scope.
+                result |= ScopeGroup;
+            }
+            else
+            {
+                result |= ScopeBit(installer.Scope);
+            }
+
+            result |= installer.Locale.empty() ? NoLocale : HasLocale;
+
+            return result;
+        }
+    }
+
     namespace
     {
         struct PortableInstallFilter : public details::FilterField
@@ -71,12 +119,16 @@ namespace AppInstaller::CLI::Workflow
 
         struct MachineArchitectureComparator : public details::ComparisonField
         {
-            MachineArchitectureComparator() : details::ComparisonField("Machine Architecture") {}
+            MachineArchitectureComparator() : details::ComparisonField("Machine Architecture")
+            {
+                m_attributeAcceptance = details::AttributeAcceptance{ GetAcceptedArchitectureBits(Utility::GetApplicableArchitectures()), InapplicabilityFlags::MachineArchitecture };
+            }
 
             MachineArchitectureComparator(std::vector<Utility::Architecture> allowedArchitectures) :
                 details::ComparisonField("Machine Architecture"), m_allowedArchitectures(std::move(allowedArchitectures))
             {
                 AICLI_LOG(CLI, Verbose, << "Architecture Comparator created with allowed architectures: " << Utility::ConvertContainerToString(m_allowedArchitectures, Utility::ToString));
+                m_attributeAcceptance = details::AttributeAcceptance{ GetAcceptedArchitectureBits(m_allowedArchitectures), InapplicabilityFlags::MachineArchitecture };
             }
 
             static std::unique_ptr<MachineArchitectureComparator> Create(const Execution::Context& context, const Repository::IPackageVersion::Metadata& metadata)
@@ -221,6 +273,16 @@ namespace AppInstaller::CLI::Workflow
             }
 
         private:
+            static details::InstallerAttributes::Mask GetAcceptedArchitectureBits(const std::vector<Utility::Architecture>& architectures)
+            {
+                details::InstallerAttributes::Mask result = 0;
+                for (Utility::Architecture architecture : architectures)
+                {
+                    result |= details::InstallerAttributes::ArchitectureBit(architecture);
+                }
+                return result;
+            }
+
             int CheckAllowedArchitecture(Utility::Architecture architecture)
             {
                 if (m_allowedArchitectures.empty())
@@ -248,7 +310,22 @@ namespace AppInstaller::CLI::Workflow
         struct InstalledTypeComparator : public details::ComparisonField
         {
             InstalledTypeComparator(Manifest::InstallerTypeEnum installedType) :
-                details::ComparisonField("Installed Type"), m_installedType(installedType) {}
+                details::ComparisonField("Installed Type"), m_installedType(installedType)
+            {
+                // Accept every installer type that is compatible with the installed type.
+                details::InstallerAttributes::Mask accepted = 0;
+                for (auto installerType : {
+                    InstallerTypeEnum::Unknown, InstallerTypeEnum::Inno, InstallerTypeEnum::Wix, InstallerTypeEnum::Msi,
+                    InstallerTypeEnum::Nullsoft, InstallerTypeEnum::Zip, InstallerTypeEnum::Msix, InstallerTypeEnum::Exe,
+                    InstallerTypeEnum::Burn, InstallerTypeEnum::MSStore, InstallerTypeEnum::Portable })
+                {
+                    if (Manifest::IsInstallerTypeCompatible(installerType, m_installedType))
+                    {
+                        accepted |= details::InstallerAttributes::InstallerTypeBit(installerType);
+                    }
+                }
+                m_attributeAcceptance = details::AttributeAcceptance{ accepted, InapplicabilityFlags::InstalledType };
+            }
 
             static std::unique_ptr<InstalledTypeComparator> Create(const Repository::IPackageVersion::Metadata& installationMetadata)
             {
@@ -316,7 +393,14 @@ namespace AppInstaller::CLI::Workflow
         struct InstalledScopeFilter : public details::FilterField
         {
             InstalledScopeFilter(Manifest::ScopeEnum requirement) :
-                details::FilterField("Installed Scope"), m_requirement(requirement) {}
+                details::FilterField("Installed Scope"), m_requirement(requirement)
+            {
+                // Unknown scope is assumed to match the installed scope; scope agnostic installer
+                // types carry every scope bit and are thus always accepted.
+                m_attributeAcceptance = details::AttributeAcceptance{
+                    details::InstallerAttributes::ScopeBit(Manifest::ScopeEnum::Unknown) | details::InstallerAttributes::ScopeBit(m_requirement),
+                    InapplicabilityFlags::InstalledScope };
+            }
 
             static std::unique_ptr<InstalledScopeFilter> Create(const Repository::IPackageVersion::Metadata& installationMetadata)
             {
@@ -361,7 +445,18 @@ namespace AppInstaller::CLI::Workflow
         struct ScopeComparator : public details::ComparisonField
         {
             ScopeComparator(Manifest::ScopeEnum preference, Manifest::ScopeEnum requirement, bool allowUnknownInAdditionToRequired) :
-                details::ComparisonField("Scope"), m_preference(preference), m_requirement(requirement), m_allowUnknownInAdditionToRequired(allowUnknownInAdditionToRequired) {}
+                details::ComparisonField("Scope"), m_preference(preference), m_requirement(requirement), m_allowUnknownInAdditionToRequired(allowUnknownInAdditionToRequired)
+            {
+                if (m_requirement != Manifest::ScopeEnum::Unknown)
+                {
+                    details::InstallerAttributes::Mask accepted = details::InstallerAttributes::ScopeBit(m_requirement);
+                    if (m_allowUnknownInAdditionToRequired)
+                    {
+                        accepted |= details::InstallerAttributes::ScopeBit(Manifest::ScopeEnum::Unknown);
+                    }
+                    m_attributeAcceptance = details::AttributeAcceptance{ accepted, InapplicabilityFlags::Scope };
+                }
+            }
 
             static std::unique_ptr<ScopeComparator> Create(const Execution::Context& context)
             {
@@ -452,6 +547,16 @@ namespace AppInstaller::CLI::Workflow
                     << "Locale Comparator created with Required Locales: " << m_requirementAsString
                     << " , Preferred Locales: " << m_preferenceAsString
                     << " , IsInstalledLocale: " << m_isInstalledLocale);
+
+                if (!m_requirement.empty() &&
+                    std::none_of(m_requirement.begin(), m_requirement.end(), [](const std::string& locale) { return locale.empty(); }))
+                {
+                    // A required locale can never score a perfect match against an installer that
+                    // declares no locale, so such installers can be rejected on attributes alone.
+                    m_attributeAcceptance = details::AttributeAcceptance{
+                        details::InstallerAttributes::HasLocale,
+                        m_isInstalledLocale ? InapplicabilityFlags::InstalledLocale : InapplicabilityFlags::Locale };
+                }
             }
 
             static std::unique_ptr<LocaleComparator> Create(const Execution::Args& args, const Repository::IPackageVersion::Metadata& metadata)
@@ -696,9 +801,20 @@ namespace AppInstaller::CLI::Workflow
     InapplicabilityFlags ManifestComparator::IsApplicable(const Manifest::ManifestInstaller& installer)
     {
         InapplicabilityFlags inapplicabilityResult = InapplicabilityFlags::None;
+        details::InstallerAttributes::Mask attributes = details::InstallerAttributes::Get(installer);
 
         for (const auto& filter : m_filters)
         {
+            // When a filter's acceptance summary has no overlap with the installer's attribute
+            // bits, the filter is known to reject the installer and does not need to be invoked.
+            const auto& acceptance = filter->GetAttributeAcceptance();
+            if (acceptance && !acceptance->Accepts(attributes))
+            {
+                AICLI_LOG(CLI, Info, << "Installer " << installer << " not applicable: " << filter->ExplainInapplicable(installer));
+                WI_SetAllFlags(inapplicabilityResult, acceptance->Flag);
+                continue;
+            }
+
             auto inapplicability = filter->IsApplicable(installer);
             if (inapplicability != InapplicabilityFlags::None)
             {
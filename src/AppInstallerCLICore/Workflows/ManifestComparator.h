@@ -7,6 +7,7 @@
 #include <winget/RepositorySearch.h>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -32,6 +33,47 @@ namespace AppInstaller::CLI::Workflow
 
     namespace details
     {
+        // A packed encoding of the installer attributes that filters commonly test:
+        // architecture, installer type, scope, and whether a locale is declared.
+        // Each attribute occupies its own group of bits, with every installer having at least
+        // one bit set per group, so that a filter whose accepted set has no overlap with an
+        // installer's bits is known to reject it without being invoked.
+        struct InstallerAttributes
+        {
+            using Mask = uint32_t;
+
+            // One bit per Utility::Architecture value; Unknown (-1) occupies the first bit.
+            static constexpr Mask ArchitectureGroup = 0x3F;
+            // One bit per Manifest::InstallerTypeEnum value.
+            static constexpr int InstallerTypeShift = 6;
+            static constexpr Mask InstallerTypeGroup = 0x7FF << InstallerTypeShift;
+            // One bit per Manifest::ScopeEnum value.
+            static constexpr int ScopeShift = 17;
+            static constexpr Mask ScopeGroup = 0x7 << ScopeShift;
+            // Whether the installer declares a locale.
+            static constexpr Mask NoLocale = 0x1 << 20;
+            static constexpr Mask HasLocale = 0x1 << 21;
+            static constexpr Mask LocaleGroup = NoLocale | HasLocale;
+
+            static Mask ArchitectureBit(Utility::Architecture architecture);
+            static Mask InstallerTypeBit(Manifest::InstallerTypeEnum installerType);
+            static Mask ScopeBit(Manifest::ScopeEnum scope);
+
+            // Computes the attribute bits for an installer.
+            static Mask Get(const Manifest::ManifestInstaller& installer);
+        };
+
+        // The attribute bits that a filter accepts, enabling a bitwise pre-check that rejects
+        // installers without invoking the filter. A summary must be exact for rejection: no
+        // overlap with the accepted bits must guarantee that IsApplicable would return the flag.
+        struct AttributeAcceptance
+        {
+            InstallerAttributes::Mask Accepted = 0;
+            InapplicabilityFlags Flag = InapplicabilityFlags::None;
+
+            bool Accepts(InstallerAttributes::Mask attributes) const { return (attributes & Accepted) != 0; }
+        };
+
         // An interface for defining new filters based on user inputs.
         struct FilterField
         {
@@ -48,6 +90,14 @@ namespace AppInstaller::CLI::Workflow
             // Will only be called when IsApplicable returns false.
             virtual std::string ExplainInapplicable(const Manifest::ManifestInstaller& installer) = 0;
 
+            // Gets the filter's attribute acceptance summary, if it has one.
+            const std::optional<AttributeAcceptance>& GetAttributeAcceptance() const { return m_attributeAcceptance; }
+
+        protected:
+            // Filters whose rejection can be decided from installer attributes alone set this
+            // to enable the bitwise pre-check in ManifestComparator::IsApplicable.
+            std::optional<AttributeAcceptance> m_attributeAcceptance;
+
         private:
             std::string_view m_name;
         };
@@ -13,6 +13,9 @@ namespace AppInstaller::CLI::Workflow
 {
     namespace
     {
+        // The maximum number of query resolutions that can be running at once.
+        constexpr size_t s_MaximumConcurrentQueryResolutions = 4;
+
         Utility::LocIndString GetPackageStringFromSearchRequest(const SearchRequest& searchRequest)
         {
             if (searchRequest.Query)
@@ -38,6 +41,11 @@ namespace AppInstaller::CLI::Workflow
     {
         std::vector<std::unique_ptr<Execution::Context>> packageSubContexts;
         auto& source = context.Get<Execution::Data::Source>();
+
+        // Every sub context receives the same copied arguments, so the argument derived
+        // portion of the search request is compiled once and reused for each query.
+        std::optional<CompiledSearchRequest> compiledRequest;
+
         for (const auto& query : *context.Args.GetArgs(Execution::Args::Type::MultiQuery))
         {
 
@@ -49,8 +57,13 @@ namespace AppInstaller::CLI::Workflow
             searchContext.Args.AddArg(Execution::Args::Type::Query, query);
 
             AICLI_LOG(CLI, Info, << "Creating search query for package [" << query << "]");
-            searchContext << GetSearchRequestForSingle;
+            if (!compiledRequest)
+            {
+                MatchType matchType = searchContext.Args.Contains(Execution::Args::Type::Exact) ? MatchType::Exact : MatchType::CaseInsensitive;
+                compiledRequest.emplace(searchContext.Args, matchType);
+            }
 
+            searchContext.Add<Execution::Data::SearchRequest>(compiledRequest->CreateForQuery(query));
 
             packageSubContexts.emplace_back(std::move(searchContextPtr));
         }
@@ -60,29 +73,88 @@ namespace AppInstaller::CLI::Workflow
 
     void SearchSubContextsForSingle::operator()(Execution::Context& context) const
     {
-        std::vector<std::unique_ptr<Execution::Context>> packageSubContexts;
-        bool foundAll = true;
+        auto& searchSubContexts = context.Get<Execution::Data::PackageSubContexts>();
+
+        // Resolves a single query against the shared source and selects its package.
+        auto resolveQuery = [this](Execution::Context& searchContext)
+            {
+                auto previousThreadGlobals = searchContext.SetForCurrentThread();
+
+                const SearchRequest& searchRequest = searchContext.Get<Execution::Data::SearchRequest>();
+                searchContext.Add<Execution::Data::SearchResult>(searchContext.Get<Execution::Data::Source>().Search(searchRequest));
 
-        for (auto& searchContextPtr : context.Get<Execution::Data::PackageSubContexts>())
+                switch (m_operationType)
+                {
+                case OperationType::Install:
+                case OperationType::Upgrade:
+                    searchContext << Workflow::SelectSinglePackageVersionForInstallOrUpgrade(m_operationType);
+                    break;
+                case OperationType::Uninstall:
+                    searchContext <<
+                        Workflow::HandleSearchResultFailures <<
+                        Workflow::EnsureOneMatchFromSearchResult(m_operationType);
+                    break;
+                default:
+                    THROW_HR(E_UNEXPECTED);
+                }
+            };
+
+        // Resolving a query is dominated by the source search, so resolve the queries with a
+        // bounded set of workers sharing the already opened source; the source interfaces
+        // serialize access internally. Each query writes only to its own sub context, and the
+        // failures are reported afterwards in query order.
+        size_t threadCount = std::min<size_t>({ s_MaximumConcurrentQueryResolutions, searchSubContexts.size(), std::thread::hardware_concurrency() });
+        if (threadCount < 2)
         {
-            auto& searchContext = *searchContextPtr;
-            SearchRequest searchRequest = searchContext.Get<Execution::Data::SearchRequest>();
-            searchContext.Add<Execution::Data::SearchResult>(searchContext.Get<Execution::Data::Source>().Search(searchRequest));
+            for (auto& searchContextPtr : searchSubContexts)
+            {
+                resolveQuery(*searchContextPtr);
+            }
+        }
+        else
+        {
+            std::vector<std::exception_ptr> exceptions(threadCount);
+            std::vector<std::thread> threads;
 
-            switch (m_operationType)
+            for (size_t t = 0; t < threadCount; ++t)
             {
-            case OperationType::Install:
-            case OperationType::Upgrade:
-                searchContext << Workflow::SelectSinglePackageVersionForInstallOrUpgrade(m_operationType);
-                break;
-            case OperationType::Uninstall:
-                searchContext <<
-                    Workflow::HandleSearchResultFailures <<
-                    Workflow::EnsureOneMatchFromSearchResult(m_operationType);
-                break;
-            default:
-                THROW_HR(E_UNEXPECTED);
+                threads.emplace_back([&, t]()
+                    {
+                        try
+                        {
+                            for (size_t i = t; i < searchSubContexts.size(); i += threadCount)
+                            {
+                                resolveQuery(*searchSubContexts[i]);
+                            }
+                        }
+                        catch (...)
+                        {
+                            exceptions[t] = std::current_exception();
+                        }
+                    });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            for (const auto& exception : exceptions)
+            {
+                if (exception)
+                {
+                    std::rethrow_exception(exception);
+                }
             }
+        }
+
+        std::vector<std::unique_ptr<Execution::Context>> packageSubContexts;
+        bool foundAll = true;
+
+        for (auto& searchContextPtr : searchSubContexts)
+        {
+            auto& searchContext = *searchContextPtr;
+            const SearchRequest& searchRequest = searchContext.Get<Execution::Data::SearchRequest>();
 
             if (searchContext.IsTerminated())
             {
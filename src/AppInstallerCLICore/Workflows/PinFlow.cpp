@@ -180,12 +180,16 @@ namespace AppInstaller::CLI::Workflow
 
         if (!pinsToAddOrUpdate.empty())
         {
-            for (const auto& pin : pinsToAddOrUpdate)
+            // Group the writes so that pinning many packages pays a single commit.
+            auto batch = pinningIndex->BeginWriteBatch();
 
+            for (const auto& pin : pinsToAddOrUpdate)
             {
                 pinningIndex->AddOrUpdatePin(pin);
             }
 
+            batch.Commit();
+
             context.Reporter.Info() << Resource::String::PinAdded << std::endl;
         }
     }
@@ -203,11 +207,19 @@ namespace AppInstaller::CLI::Workflow
         // So, we remove pins from all sources unless one was provided.
         auto packageVersionKeys = package->GetAvailableVersionKeys();
 
-        for (const auto& pin : pins)
+        if (!pins.empty())
         {
-            AICLI_LOG(CLI, Info, << "Removing Pin " << pin.GetKey().ToString());
-            pinningIndex->RemovePin(pin.GetKey());
-            pinExists = true;
+            // Group the writes so that removing many pins pays a single commit.
+            auto batch = pinningIndex->BeginWriteBatch();
+
+            for (const auto& pin : pins)
+            {
+                AICLI_LOG(CLI, Info, << "Removing Pin " << pin.GetKey().ToString());
+                pinningIndex->RemovePin(pin.GetKey());
+                pinExists = true;
+            }
+
+            batch.Commit();
         }
 
         if (!pinExists)
@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 #include "pch.h"
+#include "CompletionIndex.h"
 #include "Resources.h"
 #include "SourceFlow.h"
 #include "PromptFlow.h"
@@ -193,12 +194,114 @@ namespace AppInstaller::CLI::Workflow
         }
 
         const std::vector<Repository::SourceDetails>& sources = context.Get<Data::SourceList>();
-        for (const auto& sd : sources)
+
+        if (sources.size() <= 1)
         {
-            Repository::Source source{ sd.Name };
-            context.Reporter.Info() << Resource::String::SourceUpdateOne(Utility::LocIndView{ sd.Name }) << std::endl;
-            auto updateFunction = [&](IProgressCallback& progress)->std::vector<Repository::SourceDetails> { return source.Update(progress); };
-            if (!context.Reporter.ExecuteWithProgress(updateFunction).empty())
+            for (const auto& sd : sources)
+            {
+                Repository::Source source{ sd.Name };
+                context.Reporter.Info() << Resource::String::SourceUpdateOne(Utility::LocIndView{ sd.Name }) << std::endl;
+                auto updateFunction = [&](IProgressCallback& progress)->std::vector<Repository::SourceDetails>
+                {
+                    auto updateResult = source.Update(progress);
+                    if (updateResult.empty())
+                    {
+                        // Refresh the completion index while the updated data is hot.
+                        CompletionIndex::Rebuild(source, progress);
+                    }
+                    return updateResult;
+                };
+                if (!context.Reporter.ExecuteWithProgress(updateFunction).empty())
+                {
+                    context.Reporter.Info() << Resource::String::Cancelled << std::endl;
+                }
+                else
+                {
+                    context.Reporter.Info() << Resource::String::Done << std::endl;
+                }
+            }
+
+            return;
+        }
+
+        // With multiple sources, update them concurrently so that the elapsed time is that of
+        // the slowest source rather than the sum. Each worker reports through its own progress
+        // callback; the shared channel shows sources completed and fans cancellation out to
+        // every worker.
+        struct UpdateOutcome
+        {
+            std::vector<Repository::SourceDetails> UpdateResult;
+            std::exception_ptr Exception;
+        };
+
+        auto updateAllFunction = [&](IProgressCallback& progress) -> std::vector<UpdateOutcome>
+        {
+            std::vector<ProgressCallback> workerCallbacks(sources.size());
+            auto cancellationRemoval = progress.SetCancellationFunction([&]()
+                {
+                    for (auto& callback : workerCallbacks)
+                    {
+                        callback.Cancel();
+                    }
+                });
+
+            std::vector<UpdateOutcome> outcomes(sources.size());
+            std::atomic<uint64_t> sourcesCompleted{ 0 };
+            ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+            auto updateSingleSource = [&](size_t index)
+            {
+                std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                if (callerGlobals)
+                {
+                    previousGlobals = callerGlobals->SetForCurrentThread();
+                }
+
+                try
+                {
+                    Repository::Source source{ sources[index].Name };
+                    outcomes[index].UpdateResult = source.Update(workerCallbacks[index]);
+                    if (outcomes[index].UpdateResult.empty())
+                    {
+                        // Refresh the completion index while the updated data is hot.
+                        CompletionIndex::Rebuild(source, workerCallbacks[index]);
+                    }
+                }
+                catch (...)
+                {
+                    outcomes[index].Exception = std::current_exception();
+                }
+
+                progress.OnProgress(++sourcesCompleted, sources.size(), ProgressType::Percent);
+            };
+
+            std::vector<std::thread> workers;
+            workers.reserve(sources.size());
+            for (size_t i = 0; i < sources.size(); ++i)
+            {
+                workers.emplace_back(updateSingleSource, i);
+            }
+
+            for (std::thread& worker : workers)
+            {
+                worker.join();
+            }
+
+            return outcomes;
+        };
+
+        std::vector<UpdateOutcome> outcomes = context.Reporter.ExecuteWithProgress(updateAllFunction);
+
+        for (size_t i = 0; i < sources.size(); ++i)
+        {
+            context.Reporter.Info() << Resource::String::SourceUpdateOne(Utility::LocIndView{ sources[i].Name }) << std::endl;
+
+            if (outcomes[i].Exception)
+            {
+                std::rethrow_exception(outcomes[i].Exception);
+            }
+
+            if (!outcomes[i].UpdateResult.empty())
             {
                 context.Reporter.Info() << Resource::String::Cancelled << std::endl;
             }
@@ -56,19 +56,54 @@ namespace AppInstaller::CLI::Workflow
 
             std::vector<Item> Items;
         };
+
+        // Collects the correlated sources for the given package into the per source records,
+        // so that each source's tracking catalog can be opened once for a whole batch.
+        void CollectCorrelatedSources(
+            const std::shared_ptr<IPackage>& package,
+            std::map<std::string, std::pair<Source, std::vector<Utility::LocIndString>>>& recordsBySource)
+        {
+            UninstallCorrelatedSources correlatedSources;
+
+            correlatedSources.AddIfRemoteAndNotPresent(package->GetInstalledVersion());
+
+            for (const auto& versionKey : package->GetAvailableVersionKeys())
+            {
+                correlatedSources.AddIfRemoteAndNotPresent(package->GetAvailableVersion(versionKey));
+            }
+
+            for (auto& item : correlatedSources.Items)
+            {
+                auto itr = recordsBySource.find(item.SourceIdentifier);
+                if (itr == recordsBySource.end())
+                {
+                    itr = recordsBySource.emplace(item.SourceIdentifier, std::make_pair(std::move(item.FromSource), std::vector<Utility::LocIndString>{})).first;
+                }
+
+                itr->second.second.emplace_back(std::move(item.Identifier));
+            }
+        }
+
+        // The uninstall steps for a single package, without the tracking catalog recording;
+        // the batched flow performs that once for all packages after the loop.
+        void UninstallSinglePackageWithoutRecord(Execution::Context& context)
+        {
+            context <<
+                Workflow::GetInstalledPackageVersion <<
+                Workflow::EnsureSupportForUninstall <<
+                Workflow::GetUninstallInfo <<
+                Workflow::GetDependenciesInfoForUninstall <<
+                Workflow::ReportDependencies(Resource::String::UninstallCommandReportDependencies) <<
+                Workflow::ReportExecutionStage(ExecutionStage::Execution) <<
+                Workflow::ExecuteUninstaller <<
+                Workflow::ReportExecutionStage(ExecutionStage::PostExecution);
+        }
     }
 
     void UninstallSinglePackage(Execution::Context& context)
     {
         context <<
-            Workflow::GetInstalledPackageVersion <<
-            Workflow::EnsureSupportForUninstall <<
-            Workflow::GetUninstallInfo <<
-            Workflow::GetDependenciesInfoForUninstall <<
-            Workflow::ReportDependencies(Resource::String::UninstallCommandReportDependencies) <<
-            Workflow::ReportExecutionStage(ExecutionStage::Execution) <<
-            Workflow::ExecuteUninstaller <<
-            Workflow::ReportExecutionStage(ExecutionStage::PostExecution) <<
+            UninstallSinglePackageWithoutRecord <<
             Workflow::RecordUninstall;
     }
 
@@ -78,6 +113,11 @@ namespace AppInstaller::CLI::Workflow
         size_t packagesCount = context.Get<Execution::Data::PackageSubContexts>().size();
         size_t packagesProgress = 0;
 
+        // The tracking catalog recording is deferred and batched across the packages;
+        // correlated sources repeat heavily within a batch, and this opens each source's
+        // tracking catalog once rather than once per package.
+        std::map<std::string, std::pair<Source, std::vector<Utility::LocIndString>>> recordsBySource;
+
         for (auto& packageContext : context.Get<Execution::Data::PackageSubContexts>())
         {
             packagesProgress++;
@@ -92,7 +132,12 @@ namespace AppInstaller::CLI::Workflow
             {
                 uninstallContext <<
                     Workflow::ReportPackageIdentity <<
-                    Workflow::UninstallSinglePackage;
+                    UninstallSinglePackageWithoutRecord;
+
+                if (!uninstallContext.IsTerminated())
+                {
+                    CollectCorrelatedSources(uninstallContext.Get<Execution::Data::Package>(), recordsBySource);
+                }
             }
             catch (...)
             {
@@ -114,6 +159,15 @@ namespace AppInstaller::CLI::Workflow
             }
         }
 
+        for (auto& [sourceIdentifier, record] : recordsBySource)
+        {
+            auto trackingCatalog = record.first.GetTrackingCatalog();
+            for (const auto& identifier : record.second)
+            {
+                trackingCatalog.RecordUninstall(identifier);
+            }
+        }
+
         if (!allSucceeded)
         {
             AICLI_TERMINATE_CONTEXT(APPINSTALLER_CLI_ERROR_MULTIPLE_UNINSTALL_FAILED);
@@ -307,23 +361,17 @@ namespace AppInstaller::CLI::Workflow
     void RecordUninstall(Context& context)
     {
         // In order to report an uninstall to every correlated tracking catalog, we first need to find them all.
-        auto package = context.Get<Data::Package>();
-        UninstallCorrelatedSources correlatedSources;
-
-        // Start with the installed version
-        correlatedSources.AddIfRemoteAndNotPresent(package->GetInstalledVersion());
-
-        // Then look through all available versions
-        for (const auto& versionKey : package->GetAvailableVersionKeys())
-        {
-            correlatedSources.AddIfRemoteAndNotPresent(package->GetAvailableVersion(versionKey));
-        }
+        std::map<std::string, std::pair<Source, std::vector<Utility::LocIndString>>> recordsBySource;
+        CollectCorrelatedSources(context.Get<Data::Package>(), recordsBySource);
 
-        // Finally record the uninstall for each found value
-        for (const auto& item : correlatedSources.Items)
+        // Then record the uninstall for each found value
+        for (auto& [sourceIdentifier, record] : recordsBySource)
         {
-            auto trackingCatalog = item.FromSource.GetTrackingCatalog();
-            trackingCatalog.RecordUninstall(item.Identifier);
+            auto trackingCatalog = record.first.GetTrackingCatalog();
+            for (const auto& identifier : record.second)
+            {
+                trackingCatalog.RecordUninstall(identifier);
+            }
         }
     }
 
@@ -36,6 +36,68 @@ namespace AppInstaller::CLI::Workflow
 
             packageSubContexts.emplace_back(std::move(packageContext));
         }
+
+        // The maximum number of packages whose update applicability is evaluated at once.
+        constexpr size_t s_MaximumConcurrentUpdateEvaluations = 4;
+
+        // The outcome of evaluating a single installed package for an applicable update.
+        enum class UpdateApplicabilityResult
+        {
+            NotApplicable,
+            SkippedUnknownVersion,
+            SkippedRequireExplicit,
+            Applicable,
+        };
+
+        // Evaluates whether the matched package has an applicable update, selecting the
+        // version and installer into the given update context data when it does.
+        UpdateApplicabilityResult EvaluateUpdateApplicability(Execution::Context& updateContext, const ResultMatch& match, bool includeUnknown)
+        {
+            auto previousThreadGlobals = updateContext.SetForCurrentThread();
+            auto installedVersion = match.Package->GetInstalledVersion();
+
+            updateContext.Add<Execution::Data::Package>(match.Package);
+
+            // Filter out packages with unknown installed versions
+            if (includeUnknown)
+            {
+                updateContext.Args.AddArg(Execution::Args::Type::IncludeUnknown);
+            }
+            else if (Utility::Version(installedVersion->GetProperty(PackageVersionProperty::Version)).IsUnknown())
+            {
+                // we don't know what the package's version is and the user didn't ask to upgrade it anyway.
+                AICLI_LOG(CLI, Info, << "Skipping " << match.Package->GetProperty(PackageProperty::Id) << " as it has unknown installed version");
+                return UpdateApplicabilityResult::SkippedUnknownVersion;
+            }
+
+            updateContext <<
+                Workflow::GetInstalledPackageVersion <<
+                Workflow::ReportExecutionStage(ExecutionStage::Discovery) <<
+                SelectLatestApplicableVersion(false);
+
+            if (updateContext.GetTerminationHR() == APPINSTALLER_CLI_ERROR_UPDATE_NOT_APPLICABLE)
+            {
+                return UpdateApplicabilityResult::NotApplicable;
+            }
+
+            // Filter out packages that require explicit upgrade.
+            // User-defined pins are handled when selecting the version to use.
+            auto installedMetadata = updateContext.Get<Execution::Data::InstalledPackageVersion>()->GetMetadata();
+            auto pinnedState = ConvertToPinTypeEnum(installedMetadata[PackageVersionMetadata::PinnedState]);
+            if (pinnedState == PinType::PinnedByManifest)
+            {
+                // Note that for packages pinned by the manifest
+                // this does not consider whether the update to be installed has
+                // RequireExplicitUpgrade. While this has the downside of not working with
+                // packages installed from another source, it ensures consistency with the
+                // list of available updates (there we don't have the selected installer)
+                // and at most we will update each package like this once.
+                AICLI_LOG(CLI, Info, << "Skipping " << match.Package->GetProperty(PackageProperty::Id) << " as it requires explicit upgrade");
+                return UpdateApplicabilityResult::SkippedRequireExplicit;
+            }
+
+            return UpdateApplicabilityResult::Applicable;
+        }
     }
 
     void SelectLatestApplicableVersion::operator()(Execution::Context& context) const
@@ -207,59 +269,83 @@ namespace AppInstaller::CLI::Workflow
         int packagesWithUnknownVersionSkipped = 0;
         int packagesThatRequireExplicitSkipped = 0;
 
-        for (const auto& match : matches)
+        const bool includeUnknown = context.Args.Contains(Execution::Args::Type::IncludeUnknown);
+
+        // We want to do best effort to update all applicable updates regardless on previous update failure.
+        // Selecting the latest applicable version is read-only source work and dominates the time before
+        // the first install starts, so evaluate the packages with a bounded set of workers. The results
+        // are merged in match order so that the resulting sub contexts remain deterministic.
+        std::vector<std::unique_ptr<Execution::Context>> updateContexts;
+        updateContexts.reserve(matches.size());
+        for (size_t i = 0; i < matches.size(); ++i)
         {
-            // We want to do best effort to update all applicable updates regardless on previous update failure
-            auto updateContextPtr = context.CreateSubContext();
-            Execution::Context& updateContext = *updateContextPtr;
-            auto previousThreadGlobals = updateContext.SetForCurrentThread();
-            auto installedVersion = match.Package->GetInstalledVersion();
+            updateContexts.emplace_back(context.CreateSubContext());
+        }
 
-            updateContext.Add<Execution::Data::Package>(match.Package);
+        std::vector<UpdateApplicabilityResult> results(matches.size(), UpdateApplicabilityResult::NotApplicable);
 
-            // Filter out packages with unknown installed versions
-            if (context.Args.Contains(Execution::Args::Type::IncludeUnknown))
+        size_t threadCount = std::min<size_t>({ s_MaximumConcurrentUpdateEvaluations, matches.size(), std::thread::hardware_concurrency() });
+        if (threadCount < 2)
+        {
+            for (size_t i = 0; i < matches.size(); ++i)
             {
-                updateContext.Args.AddArg(Execution::Args::Type::IncludeUnknown);
+                results[i] = EvaluateUpdateApplicability(*updateContexts[i], matches[i], includeUnknown);
             }
-            else if (Utility::Version(installedVersion->GetProperty(PackageVersionProperty::Version)).IsUnknown())
+        }
+        else
+        {
+            std::vector<std::exception_ptr> exceptions(threadCount);
+            std::vector<std::thread> threads;
+
+            for (size_t t = 0; t < threadCount; ++t)
             {
-                // we don't know what the package's version is and the user didn't ask to upgrade it anyway.
-                AICLI_LOG(CLI, Info, << "Skipping " << match.Package->GetProperty(PackageProperty::Id) << " as it has unknown installed version");
-                ++packagesWithUnknownVersionSkipped;
-                continue;
+                threads.emplace_back([&, t]()
+                    {
+                        try
+                        {
+                            for (size_t i = t; i < matches.size(); i += threadCount)
+                            {
+                                results[i] = EvaluateUpdateApplicability(*updateContexts[i], matches[i], includeUnknown);
+                            }
+                        }
+                        catch (...)
+                        {
+                            exceptions[t] = std::current_exception();
+                        }
+                    });
             }
 
-            updateContext <<
-                Workflow::GetInstalledPackageVersion <<
-                Workflow::ReportExecutionStage(ExecutionStage::Discovery) <<
-                SelectLatestApplicableVersion(false);
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
 
-            if (updateContext.GetTerminationHR() == APPINSTALLER_CLI_ERROR_UPDATE_NOT_APPLICABLE)
+            for (const auto& exception : exceptions)
             {
-                continue;
+                if (exception)
+                {
+                    std::rethrow_exception(exception);
+                }
             }
+        }
 
-            // Filter out packages that require explicit upgrade.
-            // User-defined pins are handled when selecting the version to use.
-            auto installedMetadata = updateContext.Get<Execution::Data::InstalledPackageVersion>()->GetMetadata();
-            auto pinnedState = ConvertToPinTypeEnum(installedMetadata[PackageVersionMetadata::PinnedState]);
-            if (pinnedState == PinType::PinnedByManifest)
+        for (size_t i = 0; i < matches.size(); ++i)
+        {
+            switch (results[i])
             {
-                // Note that for packages pinned by the manifest
-                // this does not consider whether the update to be installed has
-                // RequireExplicitUpgrade. While this has the downside of not working with
-                // packages installed from another source, it ensures consistency with the
-                // list of available updates (there we don't have the selected installer)
-                // and at most we will update each package like this once.
-                AICLI_LOG(CLI, Info, << "Skipping " << match.Package->GetProperty(PackageProperty::Id) << " as it requires explicit upgrade");
+            case UpdateApplicabilityResult::SkippedUnknownVersion:
+                ++packagesWithUnknownVersionSkipped;
+                break;
+            case UpdateApplicabilityResult::SkippedRequireExplicit:
                 ++packagesThatRequireExplicitSkipped;
-                continue;
+                break;
+            case UpdateApplicabilityResult::Applicable:
+                updateAllFoundUpdate = true;
+                AddToPackageSubContextsIfNotPresent(packageSubContexts, std::move(updateContexts[i]));
+                break;
+            case UpdateApplicabilityResult::NotApplicable:
+                break;
             }
-
-            updateAllFoundUpdate = true;
-
-            AddToPackageSubContextsIfNotPresent(packageSubContexts, std::move(updateContextPtr));
         }
 
         if (updateAllFoundUpdate)
@@ -138,10 +138,8 @@ namespace AppInstaller::CLI::Workflow
             return source;
         }
 
-        void SearchSourceApplyFilters(Execution::Context& context, SearchRequest& searchRequest, MatchType matchType)
+        void SearchSourceApplyFilters(const Execution::Args& args, SearchRequest& searchRequest, MatchType matchType)
         {
-            const auto& args = context.Args;
-
             if (args.Contains(Execution::Args::Type::Id))
             {
                 searchRequest.Filters.emplace_back(PackageMatchFilter(PackageMatchField::Id, matchType, args.GetArg(Execution::Args::Type::Id)));
@@ -307,6 +305,167 @@ namespace AppInstaller::CLI::Workflow
         return E_UNEXPECTED;
     }
 
+    void RunConcurrentBranches::operator()(Execution::Context& context) const
+    {
+        THROW_HR_IF(E_INVALIDARG, m_branches.empty());
+
+        // Every branch after the first runs against its own sub context so that concurrent
+        // branches never touch the parent context's data. The sub contexts buffer their
+        // output: the console has no synchronization, so only the branch on the calling
+        // thread may render while the others run.
+        std::vector<std::unique_ptr<Execution::Context>> subContexts;
+        for (size_t i = 1; i < m_branches.size(); ++i)
+        {
+            auto subContext = context.CreateBufferedSubContext();
+            if (m_branches[i].SeedData)
+            {
+                m_branches[i].SeedData(context, *subContext);
+            }
+            subContexts.emplace_back(std::move(subContext));
+        }
+
+        std::vector<std::exception_ptr> exceptions(subContexts.size());
+        std::vector<std::thread> threads;
+
+        for (size_t i = 0; i < subContexts.size(); ++i)
+        {
+            threads.emplace_back([&, i]()
+                {
+                    Execution::Context& branchContext = *subContexts[i];
+                    auto previousThreadGlobals = branchContext.SetForCurrentThread();
+
+                    try
+                    {
+                        m_branches[i + 1].Execute(branchContext);
+                    }
+                    catch (...)
+                    {
+                        exceptions[i] = std::current_exception();
+                    }
+                });
+        }
+
+        // The first branch owns the calling thread, and with it any interaction with the user.
+        std::exception_ptr primaryException;
+        try
+        {
+            m_branches[0].Execute(context);
+        }
+        catch (...)
+        {
+            primaryException = std::current_exception();
+        }
+
+        // If the first branch failed there is no point in letting the others run to completion.
+        if (primaryException || context.IsTerminated())
+        {
+            for (auto& subContext : subContexts)
+            {
+                subContext->Cancel(false, true);
+            }
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        // With every branch joined, write out what each one would have printed, in branch
+        // order; it lands after the first branch's output instead of interleaved with it.
+        for (auto& subContext : subContexts)
+        {
+            subContext->Reporter.ReplayBufferedOutputTo(context.Reporter);
+        }
+
+        if (primaryException)
+        {
+            std::rethrow_exception(primaryException);
+        }
+
+        for (const auto& exception : exceptions)
+        {
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+        }
+
+        if (context.IsTerminated())
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < subContexts.size(); ++i)
+        {
+            Execution::Context& branchContext = *subContexts[i];
+            if (branchContext.IsTerminated())
+            {
+                AICLI_TERMINATE_CONTEXT(branchContext.GetTerminationHR());
+            }
+
+            if (m_branches[i + 1].CollectData)
+            {
+                m_branches[i + 1].CollectData(context, branchContext);
+            }
+        }
+    }
+
+    BackgroundBookkeeper& BackgroundBookkeeper::Instance()
+    {
+        // Intentionally leaked; the worker thread parks on the signal between jobs and
+        // must never observe destroyed synchronization objects during process exit.
+        static BackgroundBookkeeper* s_instance = new BackgroundBookkeeper();
+        return *s_instance;
+    }
+
+    void BackgroundBookkeeper::Defer(std::function<void()>&& work)
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+
+        if (!m_workerStarted)
+        {
+            std::thread([this]() { RunWorker(); }).detach();
+            m_workerStarted = true;
+        }
+
+        m_queue.emplace_back(std::move(work));
+        m_signal.notify_all();
+    }
+
+    void BackgroundBookkeeper::Drain()
+    {
+        std::unique_lock<std::mutex> lock{ m_lock };
+        m_signal.wait(lock, [this]() { return m_queue.empty() && !m_busy; });
+    }
+
+    void BackgroundBookkeeper::RunWorker()
+    {
+        std::unique_lock<std::mutex> lock{ m_lock };
+
+        for (;;)
+        {
+            m_signal.wait(lock, [this]() { return !m_queue.empty(); });
+
+            std::function<void()> work = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_busy = true;
+            lock.unlock();
+
+            try
+            {
+                work();
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+            }
+
+            lock.lock();
+            m_busy = false;
+            m_signal.notify_all();
+        }
+    }
+
     void OpenSource::operator()(Execution::Context& context) const
     {
         std::string_view sourceName;
@@ -461,7 +620,7 @@ namespace AppInstaller::CLI::Workflow
             searchRequest.Query.emplace(RequestMatch(matchType, args.GetArg(Execution::Args::Type::Query)));
         }
 
-        SearchSourceApplyFilters(context, searchRequest, matchType);
+        SearchSourceApplyFilters(context.Args, searchRequest, matchType);
 
         Logging::Telemetry().LogSearchRequest(
             "many",
@@ -477,6 +636,35 @@ namespace AppInstaller::CLI::Workflow
         context.Add<Execution::Data::SearchResult>(context.Get<Execution::Data::Source>().Search(searchRequest));
     }
 
+    CompiledSearchRequest::CompiledSearchRequest(const Execution::Args& args, MatchType matchType) :
+        m_matchType(matchType)
+    {
+        SearchRequest argsRequest;
+        SearchSourceApplyFilters(args, argsRequest, matchType);
+        m_filters = std::move(argsRequest.Filters);
+        m_maximumResults = argsRequest.MaximumResults;
+    }
+
+    SearchRequest CompiledSearchRequest::CreateForQuery(std::string_view query) const
+    {
+        SearchRequest searchRequest;
+
+        if (!query.empty())
+        {
+            // Regardless of match type, always use an exact match for the system reference strings.
+            searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::PackageFamilyName, MatchType::Exact, query));
+            searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::ProductCode, MatchType::Exact, query));
+            searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Id, m_matchType, query));
+            searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Name, m_matchType, query));
+            searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Moniker, m_matchType, query));
+        }
+
+        searchRequest.Filters = m_filters;
+        searchRequest.MaximumResults = m_maximumResults;
+
+        return searchRequest;
+    }
+
     void GetSearchRequestForSingle(Execution::Context& context)
     {
         const auto& args = context.Args;
@@ -487,23 +675,9 @@ namespace AppInstaller::CLI::Workflow
             matchType = MatchType::Exact;
         }
 
-        SearchRequest searchRequest;
         // Note: MultiQuery when we need search for single is handled with one sub-context per query.
-        if (args.Contains(Execution::Args::Type::Query))
-        {
-            std::string_view query = args.GetArg(Execution::Args::Type::Query);
-
-            // Regardless of match type, always use an exact match for the system reference strings.
-            searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::PackageFamilyName, MatchType::Exact, query));
-            searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::ProductCode, MatchType::Exact, query));
-            searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Id, matchType, query));
-            searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Name, matchType, query));
-            searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Moniker, matchType, query));
-        }
-
-        SearchSourceApplyFilters(context, searchRequest, matchType);
-
-        context.Add<Execution::Data::SearchRequest>(std::move(searchRequest));
+        CompiledSearchRequest compiledRequest{ args, matchType };
+        context.Add<Execution::Data::SearchRequest>(compiledRequest.CreateForQuery(args.GetArg(Execution::Args::Type::Query)));
     }
 
     void SearchSourceForSingle(Execution::Context& context)
@@ -537,7 +711,7 @@ namespace AppInstaller::CLI::Workflow
         std::string_view query = context.Get<Execution::Data::CompletionData>().Word();
         searchRequest.Query.emplace(RequestMatch(matchType, query));
 
-        SearchSourceApplyFilters(context, searchRequest, matchType);
+        SearchSourceApplyFilters(context.Args, searchRequest, matchType);
 
         context.Add<Execution::Data::SearchResult>(context.Get<Execution::Data::Source>().Search(searchRequest));
     }
@@ -552,7 +726,7 @@ namespace AppInstaller::CLI::Workflow
         searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Name, matchType, query));
         searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Moniker, matchType, query));
 
-        SearchSourceApplyFilters(context, searchRequest, matchType);
+        SearchSourceApplyFilters(context.Args, searchRequest, matchType);
 
         context.Add<Execution::Data::SearchResult>(context.Get<Execution::Data::Source>().Search(searchRequest));
     }
@@ -565,7 +739,7 @@ namespace AppInstaller::CLI::Workflow
         searchRequest.Inclusions.emplace_back(PackageMatchFilter(m_field, MatchType::StartsWith, word));
 
         // If filters are provided, be generous with the search no matter the intended result.
-        SearchSourceApplyFilters(context, searchRequest, MatchType::Substring);
+        SearchSourceApplyFilters(context.Args, searchRequest, MatchType::Substring);
 
         context.Add<Execution::Data::SearchResult>(context.Get<Execution::Data::Source>().Search(searchRequest));
     }
@@ -584,16 +758,29 @@ namespace AppInstaller::CLI::Workflow
                 Resource::String::SearchSource
             });
 
+        // Producing each row reads several properties from the source; stream the
+        // table so that the first results are visible while the rest are produced.
+        table.EnableStreaming(10);
+
+        std::vector<PackageVersionProperty> displayProperties{ PackageVersionProperty::Name, PackageVersionProperty::Id, PackageVersionProperty::Version };
+        if (sourceIsComposite)
+        {
+            displayProperties.push_back(PackageVersionProperty::SourceName);
+        }
+
         for (size_t i = 0; i < searchResult.Matches.size(); ++i)
         {
             auto latestVersion = searchResult.Matches[i].Package->GetLatestAvailableVersion(PinBehavior::IgnorePins);
 
+            // Extract the row's columns in one call per version rather than one per cell.
+            auto properties = latestVersion->GetProperties(displayProperties);
+
             table.OutputLine({
-                latestVersion->GetProperty(PackageVersionProperty::Name),
-                latestVersion->GetProperty(PackageVersionProperty::Id),
-                latestVersion->GetProperty(PackageVersionProperty::Version),
+                std::move(properties[0]),
+                std::move(properties[1]),
+                std::move(properties[2]),
                 GetMatchCriteriaDescriptor(searchResult.Matches[i]),
-                sourceIsComposite ? static_cast<std::string>(latestVersion->GetProperty(PackageVersionProperty::SourceName)) : ""s
+                sourceIsComposite ? static_cast<std::string>(properties[3]) : ""s
                 });
         }
 
@@ -759,11 +946,14 @@ namespace AppInstaller::CLI::Workflow
 
             if (installedVersion)
             {
+                // Extract the row's installed columns in one call rather than one per cell.
+                auto installedProperties = installedVersion->GetProperties({ PackageVersionProperty::Name, PackageVersionProperty::Version });
+
                 auto latestVersion = match.Package->GetLatestAvailableVersion(pinBehavior);
                 bool updateAvailable = match.Package->IsUpdateAvailable(pinBehavior);
                 bool updateIsPinned = false;
 
-                if (m_onlyShowUpgrades && !context.Args.Contains(Execution::Args::Type::IncludeUnknown) && Utility::Version(installedVersion->GetProperty(PackageVersionProperty::Version)).IsUnknown() && updateAvailable)
+                if (m_onlyShowUpgrades && !context.Args.Contains(Execution::Args::Type::IncludeUnknown) && Utility::Version(installedProperties[1]).IsUnknown() && updateAvailable)
                 {
                     // We are only showing upgrades, and the user did not request to include packages with unknown versions.
                     ++packagesWithUnknownVersionSkipped;
@@ -801,22 +991,26 @@ namespace AppInstaller::CLI::Workflow
                     if (latestVersion)
                     {
                         // Always show the source for correlated packages
-                        sourceName = latestVersion->GetProperty(PackageVersionProperty::SourceName);
-
                         if (updateAvailable)
                         {
-                            availableVersion = latestVersion->GetProperty(PackageVersionProperty::Version);
+                            auto latestProperties = latestVersion->GetProperties({ PackageVersionProperty::SourceName, PackageVersionProperty::Version });
+                            sourceName = std::move(latestProperties[0]);
+                            availableVersion = std::move(latestProperties[1]);
                             availableUpgradesCount++;
                         }
+                        else
+                        {
+                            sourceName = latestVersion->GetProperty(PackageVersionProperty::SourceName);
+                        }
                     }
 
                     // Output using the local PackageName instead of the name in the manifest, to prevent confusion for packages that add multiple
                     // Add/Remove Programs entries.
                     // TODO: De-duplicate this list, and only show (by default) one entry per matched package.
                     InstalledPackagesTableLine line(
-                         installedVersion->GetProperty(PackageVersionProperty::Name),
+                         std::move(installedProperties[0]),
                          match.Package->GetProperty(PackageProperty::Id),
-                         installedVersion->GetProperty(PackageVersionProperty::Version),
+                         std::move(installedProperties[1]),
                          availableVersion,
                          shouldShowSource ? sourceName : Utility::LocIndString()
                     );
@@ -949,6 +1143,30 @@ namespace AppInstaller::CLI::Workflow
             Logging::Telemetry().LogAppFound(package->GetProperty(PackageProperty::Name), package->GetProperty(PackageProperty::Id));
 
             context.Add<Execution::Data::Package>(std::move(package));
+
+            // Begin retrieving the manifest in the background so that it overlaps the
+            // steps that run between match selection and the manifest being needed.
+            // The other operation types never retrieve an available manifest.
+            if (m_operationType == OperationType::Install ||
+                m_operationType == OperationType::Show ||
+                m_operationType == OperationType::Upgrade)
+            {
+                PackageVersionKey key("", context.Args.GetArg(Execution::Args::Type::Version), context.Args.GetArg(Execution::Args::Type::Channel));
+                std::shared_ptr<IPackageVersion> version = context.Get<Execution::Data::Package>()->GetAvailableVersion(key);
+
+                if (version)
+                {
+                    ManifestPrefetch prefetch;
+                    prefetch.Version = version;
+                    prefetch.Manifest = std::async(std::launch::async, [version, &threadGlobals = context.GetThreadGlobals()]()
+                        {
+                            auto previousThreadGlobals = threadGlobals.SetForCurrentThread();
+                            return version->GetManifest();
+                        }).share();
+
+                    context.Add<Execution::Data::ManifestPrefetch>(std::move(prefetch));
+                }
+            }
         }
     }
 
@@ -1024,7 +1242,32 @@ namespace AppInstaller::CLI::Workflow
         std::optional<Manifest::Manifest> manifest;
         if (requestedVersion)
         {
-            manifest = requestedVersion->GetManifest();
+            // Use the manifest retrieval started in the background after match selection
+            // if it targeted the version being requested here.
+            if (context.Contains(Execution::Data::ManifestPrefetch))
+            {
+                const auto& prefetch = context.Get<Execution::Data::ManifestPrefetch>();
+
+                if (prefetch.Version &&
+                    prefetch.Version->GetProperty(PackageVersionProperty::Version) == requestedVersion->GetProperty(PackageVersionProperty::Version) &&
+                    prefetch.Version->GetProperty(PackageVersionProperty::Channel) == requestedVersion->GetProperty(PackageVersionProperty::Channel) &&
+                    prefetch.Version->GetProperty(PackageVersionProperty::SourceName) == requestedVersion->GetProperty(PackageVersionProperty::SourceName))
+                {
+                    try
+                    {
+                        manifest = prefetch.Manifest.get();
+                    }
+                    catch (...)
+                    {
+                        AICLI_LOG(CLI, Warning, << "Background manifest retrieval failed; retrieving synchronously");
+                    }
+                }
+            }
+
+            if (!manifest)
+            {
+                manifest = requestedVersion->GetManifest();
+            }
         }
 
         if (!manifest)
@@ -1281,7 +1524,23 @@ AppInstaller::CLI::Execution::Context& operator<<(AppInstaller::CLI::Execution::
         if (context.ShouldExecuteWorkflowTask(task))
 #endif
         {
+            AppInstaller::Logging::TraceActivityScope taskSpan{ task.GetName(), task.GetFunctionAddress() };
+
+#if WINGET_MEMORY_ACCOUNTING_ENABLED
+            int64_t usageBefore = AppInstaller::MemoryAccounting::GetCurrentUsage();
+            AppInstaller::MemoryAccounting::ResetHighWaterMark();
+#endif
+
             task(context);
+
+#if WINGET_MEMORY_ACCOUNTING_ENABLED
+            // Report what the task left allocated and the peak it drove the process to while
+            // running. The counters are process wide, so with concurrent workflow threads a
+            // task's numbers include allocations made by whatever else ran alongside it.
+            AICLI_LOG(CLI, Info, << "Task memory [" << (task.GetName().empty() ? "<anonymous>" : task.GetName()) << "]: current " <<
+                usageBefore << " -> " << AppInstaller::MemoryAccounting::GetCurrentUsage() << " bytes; peak " <<
+                AppInstaller::MemoryAccounting::GetHighWaterMark() << " bytes");
+#endif
         }
     }
     return context;
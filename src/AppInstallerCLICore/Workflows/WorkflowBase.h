@@ -7,8 +7,15 @@
 #include <winget/RepositorySearch.h>
 #include <winget/RepositorySource.h>
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <vector>
 
 
 namespace AppInstaller::CLI::Execution
@@ -30,6 +37,18 @@ namespace AppInstaller::CLI::Workflow
         PostExecution = 5000,
     };
 
+    // A manifest retrieval running in the background.
+    // Started once a search resolves to a single package so that the retrieval
+    // overlaps the steps that run before the manifest is needed.
+    struct ManifestPrefetch
+    {
+        // The version whose manifest is being retrieved.
+        std::shared_ptr<Repository::IPackageVersion> Version;
+
+        // The manifest; get() rethrows any retrieval failure.
+        std::shared_future<Manifest::Manifest> Manifest;
+    };
+
     enum class OperationType
     {
         Completion,
@@ -65,6 +84,10 @@ namespace AppInstaller::CLI::Workflow
 
         const std::string& GetName() const { return m_name; }
 
+        // The function executed by the task, if any; enables symbol resolution of
+        // trace spans for tasks that have no name.
+        const void* GetFunctionAddress() const { return m_isFunc ? reinterpret_cast<const void*>(m_func) : nullptr; }
+
     private:
         bool m_isFunc = false;
         Func m_func = nullptr;
@@ -77,6 +100,72 @@ namespace AppInstaller::CLI::Workflow
     // Helper to report exceptions and return the HRESULT.
     HRESULT HandleException(Execution::Context& context, std::exception_ptr exception);
 
+    // A branch of workflow tasks that can run concurrently with other branches.
+    struct ConcurrentWorkflowBranch
+    {
+        // Runs the branch's tasks against the given context.
+        std::function<void(Execution::Context&)> Execute;
+
+        // Copies the data that the branch needs from the parent context into the branch's sub context.
+        // Not invoked for the first branch, which runs directly against the parent context.
+        std::function<void(Execution::Context& parent, Execution::Context& branch)> SeedData;
+
+        // Copies the data that the branch produced from its sub context back into the parent context.
+        // Invoked on the calling thread after every branch has completed, in branch order.
+        // Not invoked for the first branch, nor once a preceding branch has terminated the parent.
+        std::function<void(Execution::Context& parent, Execution::Context& branch)> CollectData;
+    };
+
+    // Runs independent branches of workflow tasks concurrently; chains that do not use this
+    // remain strictly sequential. The first branch runs on the calling thread against the given
+    // context and is the only branch that may interact with the user or render to the console.
+    // Every other branch runs on its own thread against a sub context whose output is buffered
+    // and replayed, in branch order, once every branch has been joined; such branches show no
+    // progress. Branches exchange data with the parent context only through SeedData and
+    // CollectData. Termination of any branch terminates the parent context.
+    // Required Args: None
+    // Inputs: Whatever the branches require
+    // Outputs: Whatever the branches produce
+    struct RunConcurrentBranches : public WorkflowTask
+    {
+        RunConcurrentBranches(std::vector<ConcurrentWorkflowBranch> branches) :
+            WorkflowTask("RunConcurrentBranches"), m_branches(std::move(branches)) {}
+
+        void operator()(Execution::Context& context) const override;
+
+    private:
+        std::vector<ConcurrentWorkflowBranch> m_branches;
+    };
+
+    // Runs bookkeeping work that produces no user-visible output off the command's
+    // critical path. Work runs in order on a single background thread; Drain blocks
+    // until everything deferred so far has completed and must be called before the
+    // command's result is reported, while the context that deferred the work is still
+    // alive. Deferred work must own every piece of data that it touches, since it may
+    // run after the deferring context has been destroyed.
+    struct BackgroundBookkeeper
+    {
+        // Gets the process wide instance.
+        static BackgroundBookkeeper& Instance();
+
+        // Queues work for the background thread.
+        void Defer(std::function<void()>&& work);
+
+        // Waits for all currently deferred work to complete.
+        void Drain();
+
+    private:
+        BackgroundBookkeeper() = default;
+
+        void RunWorker();
+
+        std::mutex m_lock;
+        std::condition_variable m_signal;
+        std::deque<std::function<void()>> m_queue;
+        bool m_workerStarted = false;
+        bool m_busy = false;
+    };
+
     // Creates the source object.
     // Required Args: None
     // Inputs: None
@@ -146,6 +235,25 @@ namespace AppInstaller::CLI::Workflow
     // Outputs: SearchResult
     void SearchSourceForMany(Execution::Context& context);
 
+    // The search request for locating a single package, compiled once from the
+    // command line arguments. Tasks that issue one search per item (multi query)
+    // stamp out each per item request from the compiled form instead of re-reading
+    // and re-validating the arguments on every iteration.
+    struct CompiledSearchRequest
+    {
+        // Compiles the argument derived filters; matchType applies to the fields
+        // that are not system reference strings.
+        CompiledSearchRequest(const Execution::Args& args, Repository::MatchType matchType);
+
+        // Creates a request for the given query; an empty query adds no inclusions.
+        Repository::SearchRequest CreateForQuery(std::string_view query) const;
+
+    private:
+        Repository::MatchType m_matchType;
+        std::vector<Repository::PackageMatchFilter> m_filters;
+        size_t m_maximumResults = 0;
+    };
+
     // Creates a search request object with the semantics of targeting a single package.
     // Required Args: None
     // Inputs: Query, search filters (Id, Name, etc.)
@@ -0,0 +1,157 @@
+﻿// -----------------------------------------------------------------------------
+// <copyright file="OrchestratorLoadInterop.cs" company="Microsoft Corporation">
+//     Copyright (c) Microsoft Corporation. Licensed under the MIT License.
+// </copyright>
+// -----------------------------------------------------------------------------
+
+namespace AppInstallerCLIE2ETests.Interop
+{
+    using System;
+    using System.Collections.Concurrent;
+    using System.Diagnostics;
+    using System.Linq;
+    using System.Threading.Tasks;
+    using Microsoft.Management.Deployment;
+    using Microsoft.Management.Deployment.Projection;
+    using NUnit.Framework;
+
+    /// <summary>
+    /// Load and soak harness for the COM server orchestrator queue. Drives concurrent
+    /// operations against the LocalhostWebServer hosted test source and reports latency
+    /// percentiles, so server side queueing changes can be compared between runs.
+    /// Marked explicit so it only runs when selected; locally via the LoadTest category
+    /// or test name, and in the pipeline from a dedicated stage.
+    /// Only the out of process fixture is driven, since the in process path bypasses the
+    /// orchestrator queue entirely.
+    /// </summary>
+    [TestFixtureSource(typeof(InstanceInitializersSource), nameof(InstanceInitializersSource.OutOfProcess), Category = nameof(InstanceInitializersSource.OutOfProcess))]
+    [Category("LoadTest")]
+    [Explicit("Load harness; measures throughput and latency rather than a single behavior.")]
+    public class OrchestratorLoadInterop : BaseInterop
+    {
+        private const int FindWorkerCount = 8;
+        private const int FindOperationsPerWorker = 25;
+        private const int InstallCycleCount = 5;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="OrchestratorLoadInterop"/> class.
+        /// </summary>
+        /// <param name="initializer">Initializer.</param>
+        public OrchestratorLoadInterop(IInstanceInitializer initializer)
+            : base(initializer)
+        {
+        }
+
+        /// <summary>
+        /// Drives concurrent FindPackages calls from independent clients and reports latency percentiles.
+        /// </summary>
+        /// <returns>A <see cref="Task"/> representing the asynchronous unit test.</returns>
+        [Test]
+        public async Task ConcurrentFindPackagesThroughput()
+        {
+            var latencies = new ConcurrentBag<double>();
+            var overall = Stopwatch.StartNew();
+
+            var workers = Enumerable.Range(0, FindWorkerCount).Select(_ => Task.Run(() =>
+            {
+                // Each worker acts as an independent client with its own objects,
+                // so the calls do not serialize on a shared proxy.
+                var packageManager = this.TestFactory.CreatePackageManager();
+                var testSource = packageManager.GetPackageCatalogByName(Constants.TestSourceName);
+
+                for (int i = 0; i < FindOperationsPerWorker; i++)
+                {
+                    var stopwatch = Stopwatch.StartNew();
+                    var searchResult = this.FindAllPackages(testSource, PackageMatchField.Name, PackageFieldMatchOption.Equals, "TestExeInstaller");
+                    stopwatch.Stop();
+
+                    Assert.AreNotEqual(0, searchResult.Count);
+                    latencies.Add(stopwatch.Elapsed.TotalMilliseconds);
+                }
+            }));
+
+            await Task.WhenAll(workers.ToArray());
+            overall.Stop();
+
+            ReportLatencies($"FindPackages x{FindWorkerCount} workers", latencies.ToArray(), overall.Elapsed.TotalSeconds);
+        }
+
+        /// <summary>
+        /// Runs repeated install and uninstall cycles through the orchestrator queue and
+        /// reports per operation latency percentiles.
+        /// </summary>
+        /// <returns>A <see cref="Task"/> representing the asynchronous unit test.</returns>
+        [Test]
+        public async Task InstallUninstallSoak()
+        {
+            var packageManager = this.TestFactory.CreatePackageManager();
+
+            // A composite catalog is needed to see the installed version for uninstall.
+            var options = this.TestFactory.CreateCreateCompositePackageCatalogOptions();
+            var testSource = packageManager.GetPackageCatalogByName(Constants.TestSourceName);
+            Assert.NotNull(testSource, $"{Constants.TestSourceName} cannot be null");
+            options.Catalogs.Add(testSource);
+            options.CompositeSearchBehavior = CompositeSearchBehavior.AllCatalogs;
+            var compositeSource = packageManager.CreateCompositePackageCatalog(options);
+
+            var installLatencies = new ConcurrentBag<double>();
+            var uninstallLatencies = new ConcurrentBag<double>();
+            var overall = Stopwatch.StartNew();
+
+            for (int cycle = 0; cycle < InstallCycleCount; cycle++)
+            {
+                string installDir = TestCommon.GetRandomTestDir();
+                var searchResult = this.FindOnePackage(compositeSource, PackageMatchField.Id, PackageFieldMatchOption.Equals, Constants.ExeInstallerPackageId);
+
+                var installOptions = this.TestFactory.CreateInstallOptions();
+                installOptions.PackageInstallMode = PackageInstallMode.Silent;
+                installOptions.PreferredInstallLocation = installDir;
+                installOptions.AcceptPackageAgreements = true;
+
+                var stopwatch = Stopwatch.StartNew();
+                var installResult = await packageManager.InstallPackageAsync(searchResult.CatalogPackage, installOptions);
+                stopwatch.Stop();
+
+                Assert.AreEqual(InstallResultStatus.Ok, installResult.Status, $"Install failed in cycle {cycle}");
+                installLatencies.Add(stopwatch.Elapsed.TotalMilliseconds);
+
+                // Find again so the installed version is present for uninstall.
+                searchResult = this.FindOnePackage(compositeSource, PackageMatchField.Id, PackageFieldMatchOption.Equals, Constants.ExeInstallerPackageId);
+                Assert.NotNull(searchResult.CatalogPackage.InstalledVersion);
+
+                stopwatch.Restart();
+                var uninstallResult = await packageManager.UninstallPackageAsync(searchResult.CatalogPackage, this.TestFactory.CreateUninstallOptions());
+                stopwatch.Stop();
+
+                Assert.AreEqual(UninstallResultStatus.Ok, uninstallResult.Status, $"Uninstall failed in cycle {cycle}");
+                uninstallLatencies.Add(stopwatch.Elapsed.TotalMilliseconds);
+
+                Assert.True(TestCommon.VerifyTestExeUninstalled(installDir));
+            }
+
+            overall.Stop();
+
+            ReportLatencies($"InstallPackageAsync x{InstallCycleCount} cycles", installLatencies.ToArray(), overall.Elapsed.TotalSeconds);
+            ReportLatencies($"UninstallPackageAsync x{InstallCycleCount} cycles", uninstallLatencies.ToArray(), overall.Elapsed.TotalSeconds);
+        }
+
+        private static void ReportLatencies(string name, double[] latencies, double totalSeconds)
+        {
+            Array.Sort(latencies);
+
+            TestContext.Out.WriteLine(
+                $"{name}: {latencies.Length} operations in {totalSeconds:F1}s ({latencies.Length / totalSeconds:F1} op/s); " +
+                $"latency ms min {latencies[0]:F1} " +
+                $"p50 {Percentile(latencies, 50):F1} " +
+                $"p90 {Percentile(latencies, 90):F1} " +
+                $"p99 {Percentile(latencies, 99):F1} " +
+                $"max {latencies[latencies.Length - 1]:F1}");
+        }
+
+        private static double Percentile(double[] sortedLatencies, int percentile)
+        {
+            int index = (int)Math.Ceiling((percentile / 100.0) * sortedLatencies.Length) - 1;
+            return sortedLatencies[Math.Max(0, Math.Min(index, sortedLatencies.Length - 1))];
+        }
+    }
+}
@@ -0,0 +1,179 @@
+﻿// -----------------------------------------------------------------------------
+// <copyright file="PerformanceScenarios.cs" company="Microsoft Corporation">
+//     Copyright (c) Microsoft Corporation. Licensed under the MIT License.
+// </copyright>
+// -----------------------------------------------------------------------------
+
+namespace AppInstallerCLIE2ETests
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using System.IO;
+    using Newtonsoft.Json.Linq;
+    using NUnit.Framework;
+
+    /// <summary>
+    /// Timed end to end scenarios run against the LocalhostWebServer hosted test source,
+    /// gated against the recorded baselines in TestData\PerformanceBaselines.json.
+    /// Each scenario records its wall time and asserts that it stays within the baseline
+    /// times the tolerance factor, so a multi hundred millisecond regression fails the run
+    /// instead of landing silently. All timings are also written as JSON so runs can be
+    /// compared and baselines re-recorded. Marked explicit so the suite only runs when
+    /// selected; locally via the Performance category, and in the pipeline from the
+    /// opt-in perf gate leg.
+    /// </summary>
+    [Category("Performance")]
+    [Explicit("Perf gate; measures scenario wall time rather than a single behavior.")]
+    public class PerformanceScenarios : BaseCommand
+    {
+        private const int WarmIterations = 5;
+
+        private readonly Dictionary<string, double> timingsMs = new Dictionary<string, double>();
+
+        private JObject baselines;
+        private double toleranceFactor;
+
+        /// <summary>
+        /// Loads the recorded baselines and the optional tolerance override.
+        /// </summary>
+        [OneTimeSetUp]
+        public void LoadBaselines()
+        {
+            this.baselines = JObject.Parse(File.ReadAllText(TestCommon.GetTestDataFile("PerformanceBaselines.json")));
+            this.toleranceFactor = (double)this.baselines["toleranceFactor"];
+
+            // Agent pools differ; a run can widen the gate without editing the recorded baselines.
+            string toleranceOverride = Environment.GetEnvironmentVariable("WINGET_E2E_PERF_TOLERANCE");
+            if (!string.IsNullOrEmpty(toleranceOverride))
+            {
+                this.toleranceFactor = double.Parse(toleranceOverride);
+            }
+        }
+
+        /// <summary>
+        /// Writes every recorded timing as machine readable JSON; to the test output, and to
+        /// PerformanceScenarios.json in the temp directory (override with WINGET_E2E_PERF_RESULTS)
+        /// for publishing as a pipeline artifact.
+        /// </summary>
+        [OneTimeTearDown]
+        public void WriteTimings()
+        {
+            var results = new JObject();
+            foreach (var timing in this.timingsMs)
+            {
+                results[timing.Key] = new JObject
+                {
+                    ["elapsedMs"] = Math.Round(timing.Value, 1),
+                    ["baselineMs"] = this.baselines["baselinesMs"][timing.Key],
+                };
+            }
+
+            string json = results.ToString();
+            TestContext.Out.WriteLine(json);
+
+            string resultsPath = Environment.GetEnvironmentVariable("WINGET_E2E_PERF_RESULTS");
+            if (string.IsNullOrEmpty(resultsPath))
+            {
+                resultsPath = Path.Combine(Path.GetTempPath(), "PerformanceScenarios.json");
+            }
+
+            File.WriteAllText(resultsPath, json);
+        }
+
+        /// <summary>
+        /// Times an exact search. The first run lands on a freshly reset source, so it pays the
+        /// source open and index load costs (cold); the following runs reuse the on disk state
+        /// and are reported as the median of several iterations (warm).
+        /// </summary>
+        [Test]
+        public void SearchColdAndWarm()
+        {
+            // Re-add the source so that the first search is deterministically cold.
+            this.ResetTestSource();
+            this.RecordAndGate("SearchCold", this.TimeCommand("search", $"--exact {Constants.ExeInstallerPackageId}"));
+
+            var warmRuns = new List<double>();
+            for (int i = 0; i < WarmIterations; i++)
+            {
+                warmRuns.Add(this.TimeCommand("search", $"--exact {Constants.ExeInstallerPackageId}"));
+            }
+
+            this.RecordAndGate("SearchWarm", Median(warmRuns));
+        }
+
+        /// <summary>
+        /// Times a small silent install; the exe test installer covers download, hash
+        /// verification and the direct process launch path.
+        /// </summary>
+        [Test]
+        public void InstallSmall()
+        {
+            var installDir = TestCommon.GetRandomTestDir();
+            this.RecordAndGate("InstallSmall", this.TimeCommand("install", $"{Constants.ExeInstallerPackageId} --silent -l {installDir}"));
+            Assert.True(TestCommon.VerifyTestExeInstalledAndCleanup(installDir));
+        }
+
+        /// <summary>
+        /// Times a larger silent install; the msi test installer additionally runs through
+        /// Windows Installer, the slowest of the pinned fixtures.
+        /// </summary>
+        [Test]
+        public void InstallLarge()
+        {
+            var installDir = TestCommon.GetRandomTestDir();
+            this.RecordAndGate("InstallLarge", this.TimeCommand("install", $"{Constants.MsiInstallerPackageId} --silent -l {installDir}", 120000));
+            Assert.True(TestCommon.VerifyTestMsiInstalledAndCleanup(installDir));
+        }
+
+        /// <summary>
+        /// Times upgrade --all with two upgradable packages installed, covering installed
+        /// source correlation across every installed package plus the sequential installs.
+        /// </summary>
+        [Test]
+        public void UpgradeAllWithInstalledPackages()
+        {
+            var result = TestCommon.RunAICLICommand("install", $"{Constants.ExeInstallerPackageId} -v 1.0.0.0");
+            Assert.AreEqual(Constants.ErrorCode.S_OK, result.ExitCode);
+            result = TestCommon.RunAICLICommand("install", "AppInstallerTest.TestPortableExe -v 1.0.0.0");
+            Assert.AreEqual(Constants.ErrorCode.S_OK, result.ExitCode);
+
+            try
+            {
+                this.RecordAndGate("UpgradeAll", this.TimeCommand("upgrade", "--all --silent", 180000));
+            }
+            finally
+            {
+                TestCommon.RunAICLICommand("uninstall", Constants.ExeInstallerPackageId);
+                TestCommon.RunAICLICommand("uninstall", "AppInstallerTest.TestPortableExe");
+            }
+        }
+
+        private static double Median(List<double> values)
+        {
+            values.Sort();
+            return values[values.Count / 2];
+        }
+
+        private double TimeCommand(string command, string parameters, int timeOut = 60000)
+        {
+            var stopwatch = Stopwatch.StartNew();
+            var result = TestCommon.RunAICLICommand(command, parameters, timeOut: timeOut);
+            stopwatch.Stop();
+
+            Assert.AreEqual(Constants.ErrorCode.S_OK, result.ExitCode, $"'{command} {parameters}' failed; the timing is not usable");
+            return stopwatch.Elapsed.TotalMilliseconds;
+        }
+
+        private void RecordAndGate(string scenario, double elapsedMs)
+        {
+            this.timingsMs[scenario] = elapsedMs;
+
+            double baselineMs = (double)this.baselines["baselinesMs"][scenario];
+            double budgetMs = baselineMs * this.toleranceFactor;
+            TestContext.Out.WriteLine($"{scenario}: {elapsedMs:F1}ms (baseline {baselineMs:F0}ms, budget {budgetMs:F0}ms)");
+
+            Assert.LessOrEqual(elapsedMs, budgetMs, $"{scenario} regressed past its recorded baseline; if the change in cost is intended, re-record TestData\\PerformanceBaselines.json");
+        }
+    }
+}
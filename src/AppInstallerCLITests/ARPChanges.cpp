@@ -233,7 +233,8 @@ TEST_CASE("ARPChanges_MSIX_Ignored", "[ARPChanges][workflow]")
 
     REQUIRE(!context.Contains(Data::ARPCorrelationData));
 
-    context << ReportARPChanges;
+    context << DeferPostInstallBookkeeping;
+    BackgroundBookkeeper::Instance().Drain();
 
     REQUIRE(!context.Logger->WasLogSuccessfulInstallARPChangeCalled);
 }
@@ -281,7 +282,8 @@ TEST_CASE("ARPChanges_NoChange_NoMatch", "[ARPChanges][workflow]")
     context << SnapshotARPEntries;
     REQUIRE(context.Contains(Data::ARPCorrelationData));
 
-    context << ReportARPChanges;
+    context << DeferPostInstallBookkeeping;
+    BackgroundBookkeeper::Instance().Drain();
     context.ExpectEvent(0, 0, 0);
 }
 
@@ -295,7 +297,8 @@ TEST_CASE("ARPChanges_NoChange_SingleMatch", "[ARPChanges][workflow]")
 
     context.AddMatchResult("MatchId1", "MatchName1", "MatchPublisher1", "MatchVersion1");
 
-    context << ReportARPChanges;
+    context << DeferPostInstallBookkeeping;
+    BackgroundBookkeeper::Instance().Drain();
     context.ExpectEvent(0, 1, 0, context.MatchResult.Matches[0].Package.get());
 }
 
@@ -310,7 +313,8 @@ TEST_CASE("ARPChanges_NoChange_MultiMatch", "[ARPChanges][workflow]")
     context.AddMatchResult("MatchId1", "MatchName1", "MatchPublisher1", "MatchVersion1");
     context.AddMatchResult("MatchId2", "MatchName2", "MatchPublisher2", "MatchVersion2");
 
-    context << ReportARPChanges;
+    context << DeferPostInstallBookkeeping;
+    BackgroundBookkeeper::Instance().Drain();
     context.ExpectEvent(0, 2, 0);
 }
 
@@ -324,7 +328,8 @@ TEST_CASE("ARPChanges_SingleChange_NoMatch", "[ARPChanges][workflow]")
 
     context.AddEverythingResult("EverythingId1", "EverythingName1", "EverythingPublisher1", "EverythingVersion1");
 
-    context << ReportARPChanges;
+    context << DeferPostInstallBookkeeping;
+    BackgroundBookkeeper::Instance().Drain();
     context.ExpectEvent(1, 0, 0);
 }
 
@@ -339,7 +344,8 @@ TEST_CASE("ARPChanges_SingleChange_SingleMatch", "[ARPChanges][workflow]")
     context.AddEverythingResult("EverythingId1", "EverythingName1", "EverythingPublisher1", "EverythingVersion1");
     context.AddMatchResult("MatchId1", "MatchName1", "MatchPublisher1", "MatchVersion1");
 
-    context << ReportARPChanges;
+    context << DeferPostInstallBookkeeping;
+    BackgroundBookkeeper::Instance().Drain();
     context.ExpectEvent(1, 1, 0, context.MatchResult.Matches.back().Package.get());
 }
 
@@ -355,7 +361,8 @@ TEST_CASE("ARPChanges_SingleChange_MultiMatch", "[ARPChanges][workflow]")
     context.AddMatchResult("MatchId1", "MatchName1", "MatchPublisher1", "MatchVersion1");
     context.MatchResult.Matches.emplace_back(context.EverythingResult.Matches.back());
 
-    context << ReportARPChanges;
+    context << DeferPostInstallBookkeeping;
+    BackgroundBookkeeper::Instance().Drain();
     context.ExpectEvent(1, 2, 1, context.EverythingResult.Matches.back().Package.get());
 }
 
@@ -370,7 +377,8 @@ TEST_CASE("ARPChanges_MultiChange_NoMatch", "[ARPChanges][workflow]")
     context.AddEverythingResult("EverythingId1", "EverythingName1", "EverythingPublisher1", "EverythingVersion1");
     context.AddEverythingResult("EverythingId2", "EverythingName2", "EverythingPublisher2", "EverythingVersion2");
 
-    context << ReportARPChanges;
+    context << DeferPostInstallBookkeeping;
+    BackgroundBookkeeper::Instance().Drain();
     context.ExpectEvent(2, 0, 0);
 }
 
@@ -386,7 +394,8 @@ TEST_CASE("ARPChanges_MultiChange_SingleMatch_NoOverlap", "[ARPChanges][workflow
     context.AddEverythingResult("EverythingId2", "EverythingName2", "EverythingPublisher2", "EverythingVersion2");
     context.AddMatchResult("MatchId1", "MatchName1", "MatchPublisher1", "MatchVersion1");
 
-    context << ReportARPChanges;
+    context << DeferPostInstallBookkeeping;
+    BackgroundBookkeeper::Instance().Drain();
     context.ExpectEvent(2, 1, 0, context.MatchResult.Matches.back().Package.get());
 }
 
@@ -402,7 +411,8 @@ TEST_CASE("ARPChanges_MultiChange_SingleMatch_Overlap", "[ARPChanges][workflow]"
     context.AddEverythingResult("EverythingId2", "EverythingName2", "EverythingPublisher2", "EverythingVersion2");
     context.MatchResult.Matches.emplace_back(context.EverythingResult.Matches.back());
 
-    context << ReportARPChanges;
+    context << DeferPostInstallBookkeeping;
+    BackgroundBookkeeper::Instance().Drain();
     context.ExpectEvent(2, 1, 1, context.MatchResult.Matches.back().Package.get());
 }
 
@@ -419,7 +429,8 @@ TEST_CASE("ARPChanges_MultiChange_MultiMatch_NoOverlap", "[ARPChanges][workflow]
     context.AddMatchResult("MatchId1", "MatchName1", "MatchPublisher1", "MatchVersion1");
     context.AddMatchResult("MatchId2", "MatchName2", "MatchPublisher2", "MatchVersion2");
 
-    context << ReportARPChanges;
+    context << DeferPostInstallBookkeeping;
+    BackgroundBookkeeper::Instance().Drain();
     context.ExpectEvent(2, 2, 0);
 }
 
@@ -436,7 +447,8 @@ TEST_CASE("ARPChanges_MultiChange_MultiMatch_SingleOverlap", "[ARPChanges][workf
     context.AddMatchResult("MatchId1", "MatchName1", "MatchPublisher1", "MatchVersion1");
     context.MatchResult.Matches.emplace_back(context.EverythingResult.Matches.back());
 
-    context << ReportARPChanges;
+    context << DeferPostInstallBookkeeping;
+    BackgroundBookkeeper::Instance().Drain();
     context.ExpectEvent(2, 2, 1, context.MatchResult.Matches.back().Package.get());
 }
 
@@ -453,6 +465,7 @@ TEST_CASE("ARPChanges_MultiChange_MultiMatch_MultiOverlap", "[ARPChanges][workfl
     context.AddEverythingResult("EverythingId2", "EverythingName2", "EverythingPublisher2", "EverythingVersion2");
     context.MatchResult.Matches.emplace_back(context.EverythingResult.Matches.back());
 
-    context << ReportARPChanges;
+    context << DeferPostInstallBookkeeping;
+    BackgroundBookkeeper::Instance().Drain();
     context.ExpectEvent(2, 2, 2);
 }
@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TestCommon.h"
+#include "TestIndexCorpus.h"
+#include <AppInstallerStrings.h>
+#include <AppInstallerVersions.h>
+#include <winget/ManifestYamlParser.h>
+#include <CompositeSource.h>
+#include <Microsoft/SQLiteIndex.h>
+#include <Microsoft/SQLiteIndexSource.h>
+
+using namespace std::string_view_literals;
+using namespace TestCommon;
+using namespace AppInstaller;
+using namespace AppInstaller::Repository;
+using namespace AppInstaller::Repository::Microsoft;
+using namespace AppInstaller::Utility;
+
+// Benchmarks for hot paths in manifest and repository processing.
+// They are hidden from the normal test run; invoke them explicitly with:
+//      AppInstallerCLITests.exe [benchmark]
+namespace
+{
+    // The number of packages generated into the shared benchmark index.
+    constexpr size_t s_BenchmarkIndexPackageCount = 10'000;
+
+    // The number of packages treated as installed by the composite search benchmark.
+    constexpr size_t s_BenchmarkInstalledPackageCount = 100;
+
+    Manifest::Manifest MakeBenchmarkManifest(size_t number, std::string version = "1.0.0")
+    {
+        Manifest::Manifest result;
+        std::string publisher = "BenchmarkPublisher" + std::to_string(number);
+        result.Id = publisher + ".Package";
+        result.Version = std::move(version);
+        result.Moniker = "benchmark" + std::to_string(number);
+        result.DefaultLocalization.Add<Manifest::Localization::PackageName>("Benchmark Package " + std::to_string(number));
+        result.DefaultLocalization.Add<Manifest::Localization::Publisher>(publisher);
+        result.DefaultLocalization.Add<Manifest::Localization::Tags>({ "benchmark" });
+        result.Installers.push_back({});
+        return result;
+    }
+
+    SQLiteIndex CreateBenchmarkIndex(size_t packageCount)
+    {
+        SQLiteIndex index = SQLiteIndex::CreateNew(SQLITE_MEMORY_DB_CONNECTION_TARGET);
+
+        for (size_t i = 0; i < packageCount; ++i)
+        {
+            Manifest::Manifest manifest = MakeBenchmarkManifest(i);
+            index.AddManifest(manifest, "benchmark/" + std::to_string(i) + ".yaml");
+        }
+
+        return index;
+    }
+
+    // Populating the index dominates the suite's run time, so the searches share one.
+    SQLiteIndex& GetBenchmarkIndex()
+    {
+        static SQLiteIndex s_index = CreateBenchmarkIndex(s_BenchmarkIndexPackageCount);
+        return s_index;
+    }
+}
+
+TEST_CASE("Benchmark_FoldCase", "[.][benchmark]")
+{
+    std::string input = "The QUICK brown FOX jumps OVER the LAZY dog 0123456789";
+
+    BENCHMARK("FoldCase")
+    {
+        return FoldCase(std::string_view{ input });
+    };
+}
+
+TEST_CASE("Benchmark_VersionCompare", "[.][benchmark]")
+{
+    BENCHMARK("Construct")
+    {
+        return Version{ "1.2.3.4-beta5" };
+    };
+
+    Version lower{ "1.2.3.4" };
+    Version higher{ "1.2.3.5" };
+
+    BENCHMARK("Compare")
+    {
+        return lower < higher;
+    };
+}
+
+TEST_CASE("Benchmark_ManifestParse", "[.][benchmark]")
+{
+    TestDataFile manifestFile{ "InstallFlowTest_Exe.yaml" };
+
+    BENCHMARK("CreateFromPath")
+    {
+        return Manifest::YamlParser::CreateFromPath(manifestFile);
+    };
+}
+
+TEST_CASE("Benchmark_SQLiteIndexSearch", "[.][benchmark]")
+{
+    SQLiteIndex& index = GetBenchmarkIndex();
+
+    SearchRequest exactRequest;
+    exactRequest.Filters.emplace_back(PackageMatchField::Id, MatchType::Exact, "BenchmarkPublisher5000.Package");
+
+    BENCHMARK("Exact id filter")
+    {
+        return index.Search(exactRequest);
+    };
+
+    SearchRequest substringRequest;
+    substringRequest.Query = RequestMatch(MatchType::Substring, "Benchmark Package 1234");
+
+    BENCHMARK("Substring query")
+    {
+        return index.Search(substringRequest);
+    };
+}
+
+TEST_CASE("Benchmark_CorpusIndexSearch", "[.][benchmark]")
+{
+    IndexCorpusOptions options;
+    options.PackageCount = 100'000;
+
+    // A catalog-shaped index at community catalog scale; generation dominates the
+    // suite's run time, so the searches share one.
+    static SQLiteIndex s_corpusIndex = GenerateIndexCorpus(options, SQLITE_MEMORY_DB_CONNECTION_TARGET);
+
+    SearchRequest exactRequest;
+    exactRequest.Filters.emplace_back(PackageMatchField::Id, MatchType::Exact, GenerateCorpusPackage(options, options.PackageCount / 2).Versions[0].Id);
+
+    BENCHMARK("Exact id filter at catalog scale")
+    {
+        return s_corpusIndex.Search(exactRequest);
+    };
+
+    SearchRequest substringRequest;
+    substringRequest.Query = RequestMatch(MatchType::Substring, "Swift Editor");
+
+    BENCHMARK("Substring query at catalog scale")
+    {
+        return s_corpusIndex.Search(substringRequest);
+    };
+}
+
+TEST_CASE("Benchmark_CompositeSourceSearch", "[.][benchmark]")
+{
+    auto installed = std::make_shared<SQLiteIndexSource>(
+        SourceDetails{}, CreateBenchmarkIndex(s_BenchmarkInstalledPackageCount), Synchronization::CrossProcessReaderWriteLock{}, true);
+    auto available = std::make_shared<SQLiteIndexSource>(
+        SourceDetails{}, CreateBenchmarkIndex(s_BenchmarkIndexPackageCount));
+
+    CompositeSource composite{ "*Benchmarks" };
+    composite.SetInstalledSource(Source{ installed }, CompositeSearchBehavior::Installed);
+    composite.AddAvailableSource(Source{ available });
+
+    SearchRequest request;
+
+    BENCHMARK("Correlate installed against available")
+    {
+        return composite.Search(request);
+    };
+}
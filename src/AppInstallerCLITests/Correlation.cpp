@@ -304,3 +304,31 @@ TEST_CASE("Correlation_ChosenHeuristicIsGood", "[correlation]")
     auto results = EvaluateDataSetWithHeuristic(dataSet, algorithm, /* reportErrors */ true);
     ReportAndEvaluateResults(results, dataSet);
 }
+
+TEST_CASE("Correlation_PrecomputedNormalizationMetadata", "[correlation]")
+{
+    // Entries carrying persisted normalization keys must score the same as entries
+    // that are normalized on the fly.
+    WordsEditDistanceMatchConfidenceAlgorithm algorithm;
+
+    Manifest manifest;
+    manifest.DefaultLocalization.Add<Localization::PackageName>("Awesome App");
+    manifest.DefaultLocalization.Add<Localization::Publisher>("Contoso Corporation");
+    manifest.Localizations.push_back(manifest.DefaultLocalization);
+    algorithm.Init(manifest);
+
+    Manifest arpManifest;
+    arpManifest.DefaultLocalization.Add<Localization::PackageName>("Awesome App 1.2");
+    arpManifest.DefaultLocalization.Add<Localization::Publisher>("Contoso Corporation");
+    arpManifest.Localizations.push_back(arpManifest.DefaultLocalization);
+
+    ARPEntry plainEntry{ TestPackage::Make(arpManifest, TestPackage::MetadataMap{}), false };
+
+    NameNormalizer normalizer{ NormalizationVersion::InitialPreserveWhiteSpace };
+    TestPackage::MetadataMap metadata;
+    metadata[PackageVersionMetadata::NormalizedName] = normalizer.NormalizeName("Awesome App 1.2").Name();
+    metadata[PackageVersionMetadata::NormalizedPublisher] = normalizer.NormalizePublisher("Contoso Corporation");
+    ARPEntry precomputedEntry{ TestPackage::Make(arpManifest, std::move(metadata)), false };
+
+    REQUIRE(algorithm.ComputeConfidence(precomputedEntry) == algorithm.ComputeConfidence(plainEntry));
+}
@@ -59,6 +59,56 @@ TEST_CASE("DependencyGraph_BFirst", "[dependencyGraph][dependencies]")
     REQUIRE(installationOrder.at(2).Id() == "NeedsToInstallBFirst");
 }
 
+TEST_CASE("DependencyGraph_CallerDrivenExpansion", "[dependencyGraph][dependencies]")
+{
+    TestCommon::TempFile installResultPath("TestExeInstalled.txt");
+    std::vector<Dependency> installationOrder;
+
+    const auto& manifest = CreateFakeManifestWithDependencies("NeedsToInstallBFirst");
+    const auto& installers = manifest.Installers;
+    const Dependency& rootAsDependency = Dependency(DependencyType::Package, manifest.Id);
+    DependencyList rootDependencies;
+    std::for_each(installers.begin(), installers.end(), [&](ManifestInstaller installer) { rootDependencies.Add(installer.Dependencies); });
+
+    auto getDependencies = [&](Dependency)
+        {
+            DependencyList dependencyList;
+            auto dependencyManifest = CreateFakeManifestWithDependencies(manifest.Id);
+
+            for (auto installer : dependencyManifest.Installers)
+            {
+                dependencyList.Add(installer.Dependencies);
+            }
+
+            return dependencyList;
+        };
+
+    DependencyGraph graph(rootAsDependency, rootDependencies, getDependencies);
+
+    // Drive the expansion the way a caller evaluating nodes itself would.
+    std::vector<Dependency> toCheck = graph.TakeNodesToEvaluate();
+    while (!toCheck.empty())
+    {
+        Dependency node = std::move(toCheck.back());
+        toCheck.pop_back();
+
+        for (auto&& discovered : graph.Expand(node, getDependencies(node)))
+        {
+            toCheck.push_back(std::move(discovered));
+        }
+    }
+
+    graph.CheckForLoopsAndGetOrder();
+
+    REQUIRE(!graph.HasLoop());
+    installationOrder = graph.GetInstallationOrder();
+
+    REQUIRE(installationOrder.size() == 3);
+    REQUIRE(installationOrder.at(0).Id() == "C");
+    REQUIRE(installationOrder.at(1).Id() == "B");
+    REQUIRE(installationOrder.at(2).Id() == "NeedsToInstallBFirst");
+}
+
 TEST_CASE("DependencyGraph_InStackNoLoop", "[dependencyGraph][dependencies]")
 {
     TestCommon::TempFile installResultPath("TestExeInstalled.txt");
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "TestCommon.h"
+#include "AppInstallerBufferPool.h"
 #include "AppInstallerDownloader.h"
 #include "AppInstallerSHA256.h"
 
@@ -68,3 +69,19 @@ TEST_CASE("DownloadInvalidUrl", "[Downloader]")
 
     REQUIRE_THROWS(Download("blargle-flargle-fluff", tempFile.GetPath(), DownloadType::Installer, callback, true));
 }
+
+TEST_CASE("BufferPool_RecyclesAllocations", "[BufferPool]")
+{
+    uint8_t* initialData = nullptr;
+
+    {
+        PooledBuffer buffer = AcquireBufferFromPool(100 << 10);
+        REQUIRE(buffer);
+        REQUIRE(buffer.size() >= static_cast<size_t>(100 << 10));
+        initialData = buffer.get();
+    }
+
+    // The released allocation is handed back out for a request in the same size class.
+    PooledBuffer recycled = AcquireBufferFromPool(100 << 10);
+    REQUIRE(recycled.get() == initialData);
+}
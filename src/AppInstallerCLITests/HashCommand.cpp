@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "TestCommon.h"
 #include "Commands/HashCommand.h"
+#include <AppInstallerSHA256.h>
 
 using namespace std::string_literals;
 using namespace TestCommon;
@@ -20,4 +21,27 @@ TEST_CASE("HashCommandWithTestMsix", "[Sha256Hash]")
 
     REQUIRE(hashOutput.str().find("Sha256: 6a2d3683fa19bf00e58e07d1313d20a5f5735ebbd6a999d33381d28740ee07ea") != std::string::npos);
     REQUIRE(hashOutput.str().find("SignatureSha256: 138781c3e6f635240353f3d14d1d57bdcb89413e49be63b375e6a5d7b93b0d07") != std::string::npos);
+}
+
+TEST_CASE("ComputeHashFromFile_PipelinedMatchesStream", "[Sha256Hash]")
+{
+    using namespace AppInstaller::Utility;
+
+    // Large enough to engage the pipelined path, and not a whole number of chunks.
+    TempFile largeFile{ "largeHashInput"s, ".bin"s };
+    {
+        std::ofstream stream{ largeFile.GetPath(), std::ofstream::binary };
+        std::string pattern = "0123456789abcdef";
+        for (size_t written = 0; written < (5 << 20) + 12345; written += pattern.size())
+        {
+            stream << pattern;
+        }
+    }
+
+    auto fromFile = SHA256::ComputeHashFromFile(largeFile.GetPath());
+
+    std::ifstream stream{ largeFile.GetPath(), std::ifstream::binary };
+    auto fromStream = SHA256::ComputeHash(stream);
+
+    REQUIRE(SHA256::AreEqual(fromFile, fromStream));
 }
\ No newline at end of file
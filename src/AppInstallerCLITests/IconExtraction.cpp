@@ -2,7 +2,9 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "TestCommon.h"
+#include "TestHooks.h"
 #include <winget/IconExtraction.h>
+#include <AppInstallerSHA256.h>
 #include <AppInstallerStrings.h>
 
 using namespace AppInstaller::Repository;
@@ -15,4 +17,24 @@ TEST_CASE("ExtractIconFromBinaryFile", "IconExtraction")
     auto expected = AppInstaller::Utility::ReadEntireStreamAsByteArray(expectedIconFile);
 
     REQUIRE(expected == extracted);
+}
+
+TEST_CASE("ExtractIconFromArpEntryAsync", "IconExtraction")
+{
+    std::vector<ExtractedIconInfo> testIcons;
+    ExtractedIconInfo iconInfo;
+    iconInfo.IconContent = AppInstaller::Utility::SHA256::ConvertToBytes("d2a45116709136462ee7a1c42f0e75f0efa258fe959b1504dc8ea4573451b700");
+    iconInfo.IconSha256 = AppInstaller::Utility::SHA256::ConvertToBytes("d2a45116709136462ee7a1c42f0e75f0efa258fe959b1504dc8ea4573451b759");
+    iconInfo.IconFileType = AppInstaller::Manifest::IconFileTypeEnum::Ico;
+    iconInfo.IconResolution = AppInstaller::Manifest::IconResolutionEnum::Custom;
+    iconInfo.IconTheme = AppInstaller::Manifest::IconThemeEnum::Default;
+    testIcons.emplace_back(iconInfo);
+
+    TestHook::SetExtractIconFromArpEntryResult_Override iconsOverride{ testIcons };
+
+    auto extracted = ExtractIconFromArpEntryAsync("TestProductCode").get();
+
+    REQUIRE(extracted.size() == 1);
+    REQUIRE(extracted[0].IconContent == iconInfo.IconContent);
+    REQUIRE(extracted[0].IconSha256 == iconInfo.IconSha256);
 }
\ No newline at end of file
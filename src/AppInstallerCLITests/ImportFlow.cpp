@@ -2,8 +2,10 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "WorkflowCommon.h"
+#include "TestSettings.h"
 #include <Commands/ImportCommand.h>
 #include <Workflows/ImportExportFlow.h>
+#include <AppInstallerSHA256.h>
 
 using namespace TestCommon;
 using namespace AppInstaller::CLI;
@@ -298,3 +300,38 @@ TEST_CASE("ImportFlow_LicenseAgreement_NotAccepted", "[ImportFlow][workflow]")
     // Command should have failed
     REQUIRE_TERMINATED_WITH(context, APPINSTALLER_CLI_ERROR_PACKAGE_AGREEMENTS_NOT_ACCEPTED);
 }
+
+TEST_CASE("ImportFlow_ResumeSkipsCompletedPackages", "[ImportFlow][workflow]")
+{
+    TestCommon::TempFile exeInstallResultPath("TestExeInstalled.txt");
+    TestCommon::TempFile msixInstallResultPath("TestMsixInstalled.txt");
+
+    TestDataFile importFile("ImportFile-Good.json");
+
+    // Journal the exe package as completed by a previous run of this same file.
+    std::ifstream importFileStream{ importFile.GetPath(), std::ios::binary };
+    std::string importFileContents{ std::istreambuf_iterator<char>{ importFileStream }, std::istreambuf_iterator<char>{} };
+    std::string importFileHash = AppInstaller::Utility::SHA256::ConvertToString(AppInstaller::Utility::SHA256::ComputeHash(importFileContents));
+    TestCommon::SetSetting(AppInstaller::Settings::Stream::ImportJournal,
+        "{\"importFileHash\":\"" + importFileHash + "\",\"completedPackages\":[\"*TestSource|appinstallerclitest.testexeinstaller|2.0.0.0\"]}");
+
+    std::ostringstream importOutput;
+    TestContext context{ importOutput, std::cin };
+    auto previousThreadGlobals = context.SetForCurrentThread();
+    OverrideForImportSource(context);
+    OverrideForMSIX(context);
+    OverrideForShellExecute(context);
+    context.Args.AddArg(Execution::Args::Type::ImportFile, importFile.GetPath().string());
+
+    ImportCommand importCommand({});
+    importCommand.Execute(context);
+    INFO(importOutput.str());
+
+    // Only the msix should have been installed; the exe was journaled as completed.
+    REQUIRE(!std::filesystem::exists(exeInstallResultPath.GetPath()));
+    REQUIRE(std::filesystem::exists(msixInstallResultPath.GetPath()));
+    REQUIRE(importOutput.str().find(Resource::LocString(Resource::String::ImportResumeSkippingPackages(1)).get()) != std::string::npos);
+
+    // A run that completes clears the journal.
+    REQUIRE(!AppInstaller::Settings::Stream{ AppInstaller::Settings::Stream::ImportJournal }.Get());
+}
@@ -738,3 +738,46 @@ TEST_CASE("ManifestComparator_Scope_AllowUnknown", "[manifest_comparator]")
         REQUIRE(inapplicabilities.size() == 0);
     }
 }
+
+TEST_CASE("ManifestComparator_InstallerAttributes", "[manifest_comparator]")
+{
+    using InstallerAttributes = AppInstaller::CLI::Workflow::details::InstallerAttributes;
+
+    Manifest manifest;
+    AddInstaller(manifest, Architecture::X64, InstallerTypeEnum::Exe, ScopeEnum::User, {}, "en-US");
+
+    InstallerAttributes::Mask attributes = InstallerAttributes::Get(manifest.Installers[0]);
+
+    // Every attribute group must be populated so that acceptance checks can rely on bit overlap.
+    REQUIRE((attributes & InstallerAttributes::ArchitectureGroup) == InstallerAttributes::ArchitectureBit(Architecture::X64));
+    REQUIRE((attributes & InstallerAttributes::InstallerTypeGroup) == InstallerAttributes::InstallerTypeBit(InstallerTypeEnum::Exe));
+    REQUIRE((attributes & InstallerAttributes::ScopeGroup) == InstallerAttributes::ScopeBit(ScopeEnum::User));
+    REQUIRE((attributes & InstallerAttributes::LocaleGroup) == InstallerAttributes::HasLocale);
+
+    SECTION("ARP entry types are included")
+    {
+        AppsAndFeaturesEntry entry;
+        entry.InstallerType = InstallerTypeEnum::Burn;
+        manifest.Installers[0].AppsAndFeaturesEntries.emplace_back(std::move(entry));
+
+        attributes = InstallerAttributes::Get(manifest.Installers[0]);
+        REQUIRE((attributes & InstallerAttributes::InstallerTypeBit(InstallerTypeEnum::Exe)) != 0);
+        REQUIRE((attributes & InstallerAttributes::InstallerTypeBit(InstallerTypeEnum::Burn)) != 0);
+    }
+    SECTION("Scope agnostic installer type carries every scope bit")
+    {
+        Manifest portableManifest;
+        AddInstaller(portableManifest, Architecture::X64, InstallerTypeEnum::Portable, ScopeEnum::User);
+
+        attributes = InstallerAttributes::Get(portableManifest.Installers[0]);
+        REQUIRE((attributes & InstallerAttributes::ScopeGroup) == InstallerAttributes::ScopeGroup);
+    }
+    SECTION("Missing locale")
+    {
+        Manifest noLocaleManifest;
+        AddInstaller(noLocaleManifest, Architecture::X64, InstallerTypeEnum::Exe);
+
+        attributes = InstallerAttributes::Get(noLocaleManifest.Installers[0]);
+        REQUIRE((attributes & InstallerAttributes::LocaleGroup) == InstallerAttributes::NoLocale);
+    }
+}
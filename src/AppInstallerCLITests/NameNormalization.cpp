@@ -153,4 +153,27 @@ TEST_CASE("NameNorm_GetNormalizedName_GetNormalizedFields", "[name_norm]")
     REQUIRE(normalizedName2.GetNormalizedName(NormalizationField::None) == "Name");
     REQUIRE(normalizedName2.GetNormalizedName(NormalizationField::Architecture) == "Name");
     REQUIRE(normalizedName2.GetNormalizedFields() == NormalizationField::None);
-}
\ No newline at end of file
+}
+
+TEST_CASE("NameNorm_NormalizeBatch", "[name_norm]")
+{
+    NameNormalizer normer(NormalizationVersion::Initial);
+
+    // Use enough entries to exercise the parallel partitioning path.
+    std::vector<std::pair<std::string, std::string>> inputs;
+    for (size_t i = 0; i < 64; ++i)
+    {
+        inputs.emplace_back("Nifty Keen Product " + std::to_string(i) + " (x86)", "Nifty Corporation");
+    }
+
+    std::vector<NormalizedName> results = normer.NormalizeBatch(inputs);
+    REQUIRE(results.size() == inputs.size());
+
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        NormalizedName expected = normer.Normalize(inputs[i].first, inputs[i].second);
+        REQUIRE(results[i].Name() == expected.Name());
+        REQUIRE(results[i].Publisher() == expected.Publisher());
+        REQUIRE(results[i].Architecture() == expected.Architecture());
+    }
+}
@@ -186,6 +186,30 @@ TEST_CASE("PackageCollection_Write_MultipleSources", "[PackageCollection]")
     ValidateJsonWithCollection(PackagesJson::CreateJson(pc), pc);
 }
 
+TEST_CASE("PackageCollection_WriteJson_Streamed", "[PackageCollection]")
+{
+    PackageCollection::Source source;
+    source.Details.Name = "Test \"quoted\" source";
+    source.Details.Arg = "https://aka.ms/winget";
+    source.Details.Type = "Microsoft.PreIndexed.Package";
+    source.Details.Identifier = "TestSourceId";
+
+    source.Packages.emplace_back(LocIndString{ "test.package1"sv }, Version{ "1.0.1" }, Channel{ "" });
+    source.Packages.emplace_back(LocIndString{ "test.package2"sv }, Version{ "2" }, Channel{ "Public" });
+
+    PackageCollection pc
+    {
+        "0.1.2.3",
+        std::vector<PackageCollection::Source>{ source }
+    };
+
+    std::stringstream stream;
+    PackagesJson::WriteJson(stream, pc);
+
+    // The streamed output must parse back to the same document the DOM writer produces.
+    ValidateJsonWithCollection(ParseJsonString(stream.str()), pc);
+}
+
 TEST_CASE("PackageCollection_Read_SingleSource_1_0", "[PackageCollection]")
 {
     auto json = ParseJsonString(R"(
@@ -218,6 +218,22 @@ TEST_CASE("ARPHelper_GetBoolValue_FortyTwo", "[arphelper][list]")
     REQUIRE(helper.GetBoolValue(key, valueName));
 }
 
+TEST_CASE("ARPHelper_GetBoolValue_Snapshot", "[arphelper][list]")
+{
+    auto root = RegCreateVolatileTestRoot();
+    Registry::Key key(root.get());
+    std::wstring valueName = L"TestValueName";
+    std::wstring otherName = L"OtherValueName";
+
+    SetRegistryValue(root.get(), valueName, 1);
+
+    ARPHelper helper;
+    Registry::ValueSnapshot values = key.SnapshotValues();
+
+    REQUIRE(helper.GetBoolValue(values, valueName));
+    REQUIRE_FALSE(helper.GetBoolValue(values, otherName));
+}
+
 TEST_CASE("ARPHelper_DetermineVersion_DisplayVersion", "[arphelper][list]")
 {
     auto root = RegCreateVolatileTestRoot();
@@ -385,6 +401,37 @@ TEST_CASE("ARPHelper_PopulateIndexFromKey_Two", "[arphelper][list]")
     VerifyEntryAgainstIndex(index, result.Matches[0].first, entry2);
 }
 
+TEST_CASE("ARPHelper_PopulateIndexFromARPEntry", "[arphelper][list]")
+{
+    auto root = RegCreateVolatileTestRoot();
+    Registry::Key key(root.get());
+
+    ARPHelper helper;
+
+    ARPEntry entry("SingleEntry");
+    entry.DisplayName = "Test Name";
+    entry.DisplayVersion = "1.2";
+
+    AddARPEntryToKey(root.get(), helper, entry);
+    AddARPEntryToKey(root.get(), helper, { "SystemComponentEntry", "A", "0.1", true });
+
+    auto index = SQLiteIndex::CreateNew(SQLITE_MEMORY_DB_CONNECTION_TARGET);
+    NameNormalizer normalizer{ NormalizationVersion::InitialPreserveWhiteSpace };
+
+    REQUIRE(helper.PopulateIndexFromARPEntry(index, key.SubKey(entry.EntryName).value(), entry.EntryName, s_TestScope, "TestArchitecture", {}, normalizer));
+
+    // Entries that the full population would skip are also not added individually.
+    REQUIRE_FALSE(helper.PopulateIndexFromARPEntry(index, key.SubKey("SystemComponentEntry"sv).value(), "SystemComponentEntry", s_TestScope, "TestArchitecture", {}, normalizer));
+
+    // Populating the same entry again is a duplicate and is not added.
+    REQUIRE_FALSE(helper.PopulateIndexFromARPEntry(index, key.SubKey(entry.EntryName).value(), entry.EntryName, s_TestScope, "TestArchitecture", {}, normalizer));
+
+    auto result = index.Search({});
+
+    REQUIRE(result.Matches.size() == 1);
+    VerifyEntryAgainstIndex(index, result.Matches[0].first, entry);
+}
+
 TEST_CASE("PredefinedInstalledSource_Create", "[installed][list]")
 {
     auto source = CreatePredefinedInstalledSource();
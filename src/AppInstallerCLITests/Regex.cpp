@@ -38,6 +38,27 @@ TEST_CASE("Regex_Construction", "[regex]")
     REQUIRE(!moved.IsMatch(L"b"));
 }
 
+TEST_CASE("Regex_CreateCached", "[regex]")
+{
+    Expression lowerVowels = Expression::CreateCached("(a|e|i|o|u)");
+    REQUIRE(lowerVowels);
+
+    REQUIRE(lowerVowels.IsMatch(L"a"));
+    REQUIRE(!lowerVowels.IsMatch(L"b"));
+
+    // A second request for the same pattern produces an independently usable expression
+    Expression again = Expression::CreateCached("(a|e|i|o|u)");
+    REQUIRE(again);
+
+    REQUIRE(again.IsMatch(L"e"));
+    REQUIRE(lowerVowels.IsMatch(L"a"));
+
+    // Options are part of the cache key
+    Expression caseless = Expression::CreateCached("(a|e|i|o|u)", Options::CaseInsensitive);
+    REQUIRE(caseless.IsMatch(L"A"));
+    REQUIRE(!lowerVowels.IsMatch(L"A"));
+}
+
 TEST_CASE("Regex_IsMatch", "[regex]")
 {
     Expression ArchitectureX32{ R"((X32|X86)(?=\P{Nd}|$)(?:\sEDITION)?)", Options::CaseInsensitive };
@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "TestCommon.h"
 #include "TestRestRequestHandler.h"
+#include "TestSettings.h"
 #include <Rest/RestClient.h>
 #include <Rest/Schema/IRestClient.h>
 #include <AppInstallerVersions.h>
@@ -211,3 +212,37 @@ TEST_CASE("RestClientCreate_1.1_Success", "[RestSource]")
     REQUIRE(information.UnsupportedPackageMatchFields.size() == 1);
     REQUIRE(information.UnsupportedPackageMatchFields.at(0) == "Moniker");
 }
+
+TEST_CASE("RestClientCreate_InformationCache", "[RestSource]")
+{
+    TestCommon::RemoveSetting(AppInstaller::Settings::Stream::RestSourceInformationCache);
+
+    utility::string_t sample = _XPLATSTR(
+        R"delimiter({
+            "Data" : {
+              "SourceIdentifier": "CachedSource",
+              "ServerSupportedVersions": [
+                "1.0.0"]
+        }})delimiter");
+
+    {
+        HttpClientHelper helper{ GetTestRestRequestHandler(web::http::status_codes::OK, sample) };
+        RestClient client = RestClient::Create(utility::conversions::to_utf8string(TestRestUri), {}, {}, std::move(helper), true);
+        REQUIRE(client.GetSourceIdentifier() == "CachedSource");
+    }
+
+    {
+        // The cached information response must be used; a server failure proves the endpoint was not probed.
+        HttpClientHelper helper{ GetTestRestRequestHandler(web::http::status_codes::NotFound) };
+        RestClient client = RestClient::Create(utility::conversions::to_utf8string(TestRestUri), {}, {}, std::move(helper), true);
+        REQUIRE(client.GetSourceIdentifier() == "CachedSource");
+    }
+
+    {
+        // A custom header bypasses the cache and probes the endpoint.
+        HttpClientHelper helper{ GetTestRestRequestHandler(web::http::status_codes::NotFound) };
+        REQUIRE_THROWS(RestClient::Create(utility::conversions::to_utf8string(TestRestUri), std::string{ "custom header" }, {}, std::move(helper), true));
+    }
+
+    TestCommon::RemoveSetting(AppInstaller::Settings::Stream::RestSourceInformationCache);
+}
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "TestCommon.h"
+#include "TestIndexCorpus.h"
 #include <SQLiteWrapper.h>
 #include <PackageDependenciesValidation.h>
 #include <ArpVersionValidation.h>
@@ -20,6 +21,7 @@
 #include <Microsoft/Schema/1_0/CommandsTable.h>
 #include <Microsoft/Schema/1_0/SearchResultsTable.h>
 #include <Microsoft/Schema/1_4/DependenciesTable.h>
+#include <Microsoft/Schema/MetadataTable.h>
 
 using namespace std::string_literals;
 using namespace std::string_view_literals;
@@ -388,6 +390,14 @@ TEST_CASE("SQLiteIndexCreateLatestAndReopen", "[sqliteindex]")
         Schema::Version versionRead = index.GetVersion();
         REQUIRE(versionRead == versionCreated);
     }
+
+    // Reopen the index for memory-mapped read
+    {
+        INFO("Trying with ReadMapped");
+        SQLiteIndex index = SQLiteIndex::Open(tempFile, SQLiteStorageBase::OpenDisposition::ReadMapped);
+        Schema::Version versionRead = index.GetVersion();
+        REQUIRE(versionRead == versionCreated);
+    }
 }
 
 TEST_CASE("SQLiteIndexCreateAndAddManifest", "[sqliteindex]")
@@ -401,6 +411,67 @@ TEST_CASE("SQLiteIndexCreateAndAddManifest", "[sqliteindex]")
     SQLiteIndex index = SimpleTestSetup(tempFile, manifest, Schema::Version::Latest());
 }
 
+TEST_CASE("SQLiteIndexCreateAndAddManifestsBatch", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SQLiteIndex index = CreateTestIndex(tempFile);
+
+    // Deliberately not in id order; the batch add sorts internally but the returned
+    // ids must still correspond to the input order.
+    std::vector<SQLiteIndex::ManifestAndPath> manifests;
+    for (size_t i = 3; i > 0; --i)
+    {
+        SQLiteIndex::ManifestAndPath entry;
+        CreateFakeManifest(entry.Manifest, "Test"s + std::to_string(i - 1));
+        entry.RelativePath = GetPathFromManifest(entry.Manifest);
+        manifests.emplace_back(std::move(entry));
+    }
+
+    std::vector<SQLiteIndex::IdType> ids = index.AddManifests(manifests);
+    REQUIRE(ids.size() == manifests.size());
+
+    // All of the manifests should be present and resolvable by id.
+    for (size_t i = 0; i < manifests.size(); ++i)
+    {
+        auto idString = index.GetPropertyByManifestId(ids[i], PackageVersionProperty::Id);
+        REQUIRE(idString.has_value());
+        REQUIRE(idString.value() == manifests[i].Manifest.Id);
+    }
+}
+
+TEST_CASE("SQLiteIndexWriteBatch", "[sqliteindex]")
+{
+    SQLiteIndex index = CreateTestIndex(SQLITE_MEMORY_DB_CONNECTION_TARGET);
+
+    Manifest abandoned;
+    CreateFakeManifest(abandoned, "Abandoned");
+
+    {
+        // A batch destroyed without Commit rolls back everything written within it.
+        auto batch = index.BeginWriteBatch();
+        index.AddManifest(abandoned, GetPathFromManifest(abandoned));
+    }
+
+    REQUIRE_FALSE(index.GetManifestIdByManifest(abandoned).has_value());
+
+    Manifest first;
+    CreateFakeManifest(first, "First");
+    Manifest second;
+    CreateFakeManifest(second, "Second");
+
+    {
+        auto batch = index.BeginWriteBatch();
+        index.AddManifest(first, GetPathFromManifest(first));
+        index.AddManifest(second, GetPathFromManifest(second));
+        batch.Commit();
+    }
+
+    REQUIRE(index.GetManifestIdByManifest(first).has_value());
+    REQUIRE(index.GetManifestIdByManifest(second).has_value());
+}
+
 TEST_CASE("SQLiteIndexCreateAndAddManifestFile", "[sqliteindex]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -571,6 +642,46 @@ TEST_CASE("SQLiteIndex_AddUpdateRemoveManifestWithDependencies_EmptyManifestVers
     index.RemoveManifest(manifest);
 }
 
+TEST_CASE("SQLiteIndex_GetDependencyClosure", "[sqliteindex][V1_4]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Manifest levelOneManifest, levelTwoManifest, levelThreeManifest;
+    SQLiteIndex index = SimpleTestSetup(tempFile, levelThreeManifest, Schema::Version::Latest());
+
+    CreateFakeManifest(levelTwoManifest, "LevelTwoManifest");
+    levelTwoManifest.Installers[0].Dependencies.Add(Dependency(DependencyType::Package, levelThreeManifest.Id, "1.0.0"));
+    index.AddManifest(levelTwoManifest, GetPathFromManifest(levelTwoManifest));
+
+    CreateFakeManifest(levelOneManifest, "LevelOneManifest");
+    levelOneManifest.Installers[0].Dependencies.Add(Dependency(DependencyType::Package, levelTwoManifest.Id, "1.0.0"));
+    index.AddManifest(levelOneManifest, GetPathFromManifest(levelOneManifest));
+
+    auto levelOneRowId = index.GetManifestIdByManifest(levelOneManifest);
+    auto levelTwoRowId = index.GetManifestIdByManifest(levelTwoManifest);
+    auto levelThreeRowId = index.GetManifestIdByManifest(levelThreeManifest);
+    REQUIRE(levelOneRowId);
+    REQUIRE(levelTwoRowId);
+    REQUIRE(levelThreeRowId);
+
+    auto closure = index.GetDependencyClosureByManifestRowIds({ levelOneRowId.value() });
+
+    // All three levels are in the closure; the leaf is present with no dependencies.
+    REQUIRE(closure.size() == 3);
+    REQUIRE(closure[levelOneRowId.value()].size() == 1);
+    REQUIRE(closure[levelOneRowId.value()][0].PackageId == levelTwoManifest.Id);
+    REQUIRE(closure[levelOneRowId.value()][0].MinVersion == "1.0.0");
+    REQUIRE(closure[levelTwoRowId.value()].size() == 1);
+    REQUIRE(closure[levelTwoRowId.value()][0].PackageId == levelThreeManifest.Id);
+    REQUIRE(closure[levelThreeRowId.value()].empty());
+
+    // Seeding from the middle of the chain returns only what is reachable from there.
+    auto partialClosure = index.GetDependencyClosureByManifestRowIds({ levelTwoRowId.value() });
+    REQUIRE(partialClosure.size() == 2);
+    REQUIRE(partialClosure.find(levelOneRowId.value()) == partialClosure.end());
+}
+
 TEST_CASE("SQLiteIndex_DependenciesTable_CheckConsistency", "[sqliteindex][V1_4]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -1042,6 +1153,64 @@ TEST_CASE("SQLiteIndex_RemoveManifest_EnsureConsistentRowId", "[sqliteindex]")
     REQUIRE(manifest2Path == index.GetPropertyByManifestId(manifest2RowId, PackageVersionProperty::RelativePath));
 }
 
+TEST_CASE("SQLiteIndex_GetPropertiesByManifestIds", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Manifest manifest1;
+    CreateFakeManifest(manifest1, "Test1");
+    Manifest manifest2;
+    CreateFakeManifest(manifest2, "Test2", "2.0.0");
+
+    SQLiteIndex index = CreateTestIndex(tempFile);
+
+    index.AddManifest(manifest1, GetPathFromManifest(manifest1));
+    index.AddManifest(manifest2, GetPathFromManifest(manifest2));
+
+    TestPrepareForRead(index);
+
+    auto manifest1RowId = index.GetManifestIdByManifest(manifest1);
+    auto manifest2RowId = index.GetManifestIdByManifest(manifest2);
+    REQUIRE(manifest1RowId);
+    REQUIRE(manifest2RowId);
+
+    std::vector<SQLiteIndex::IdType> manifestIds{ manifest1RowId.value(), manifest2RowId.value() };
+    std::vector<PackageVersionProperty> properties
+    {
+        PackageVersionProperty::Id,
+        PackageVersionProperty::Name,
+        PackageVersionProperty::Version,
+        PackageVersionProperty::Channel,
+        PackageVersionProperty::RelativePath,
+    };
+
+    auto result = index.GetPropertiesByManifestIds(manifestIds, properties);
+
+    // Every value must match what the single property retrieval produces.
+    REQUIRE(result.size() == properties.size());
+
+    for (size_t propertyIndex = 0; propertyIndex < properties.size(); ++propertyIndex)
+    {
+        REQUIRE(result[propertyIndex].size() == manifestIds.size());
+
+        for (size_t idIndex = 0; idIndex < manifestIds.size(); ++idIndex)
+        {
+            REQUIRE(result[propertyIndex][idIndex] == index.GetPropertyByManifestId(manifestIds[idIndex], properties[propertyIndex]));
+        }
+    }
+
+    // A manifest id that is not present produces no values.
+    auto missingResult = index.GetPropertiesByManifestIds({ manifest2RowId.value() + 42 }, properties);
+
+    REQUIRE(missingResult.size() == properties.size());
+    for (const auto& column : missingResult)
+    {
+        REQUIRE(column.size() == 1);
+        REQUIRE(!column[0]);
+    }
+}
+
 TEST_CASE("SQLiteIndex_RemoveManifestFile", "[sqliteindex][V1_0]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -2068,6 +2237,288 @@ TEST_CASE("SQLiteIndex_Search_ExactBeforeSubstring", "[sqliteindex]")
     REQUIRE(GetIdStringById(index, results.Matches[1].first) == "Id2");
 }
 
+TEST_CASE("SQLiteIndex_Search_TrigramSubstring", "[sqliteindex][V1_7]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SQLiteIndex index = SearchTestSetup(tempFile, {
+        { "Maker.Widget", "Widget Editor", "widget", "Version", "Channel", { "editing" }, { "Command" }, "Path1" },
+        { "Maker.Gadget", "Gadget Viewer", "gadget", "Version", "Channel", { "viewing" }, { "Command" }, "Path2" },
+        }, Schema::Version::Latest());
+
+    REQUIRE(index.GetVersion() == Schema::Version{ 1, 9 });
+
+    {
+        SearchRequest request;
+        request.Filters.emplace_back(PackageMatchField::Name, MatchType::Substring, "idget");
+
+        auto results = index.Search(request);
+        REQUIRE(results.Matches.size() == 1);
+        REQUIRE(GetIdStringById(index, results.Matches[0].first) == "Maker.Widget");
+    }
+
+    {
+        SearchRequest request;
+        request.Filters.emplace_back(PackageMatchField::Tag, MatchType::Substring, "iewi");
+
+        auto results = index.Search(request);
+        REQUIRE(results.Matches.size() == 1);
+        REQUIRE(GetIdStringById(index, results.Matches[0].first) == "Maker.Gadget");
+    }
+
+    {
+        SearchRequest request;
+        request.Filters.emplace_back(PackageMatchField::Id, MatchType::CaseInsensitive, "maker.widget");
+
+        auto results = index.Search(request);
+        REQUIRE(results.Matches.size() == 1);
+        REQUIRE(GetIdStringById(index, results.Matches[0].first) == "Maker.Widget");
+    }
+
+    {
+        SearchRequest request;
+        request.Filters.emplace_back(PackageMatchField::Id, MatchType::Substring, "Maker");
+
+        auto results = index.Search(request);
+        REQUIRE(results.Matches.size() == 2);
+    }
+
+    REQUIRE(index.CheckConsistency(true));
+}
+
+TEST_CASE("SQLiteIndex_TrigramsRemovedWithManifest", "[sqliteindex][V1_7]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Manifest manifest;
+    SQLiteIndex index = SimpleTestSetup(tempFile, manifest, Schema::Version::Latest());
+
+    index.RemoveManifest(manifest);
+
+    SearchRequest request;
+    request.Filters.emplace_back(PackageMatchField::Moniker, MatchType::Substring, "stmonik");
+
+    auto results = index.Search(request);
+    REQUIRE(results.Matches.empty());
+
+    REQUIRE(index.CheckConsistency(true));
+}
+
+TEST_CASE("SQLiteIndex_ChangeJournal", "[sqliteindex][V1_8]")
+{
+    using ChangeType = Schema::ISQLiteIndex::ChangeType;
+
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Manifest manifest;
+    SQLiteIndex index = SimpleTestSetup(tempFile, manifest, Schema::Version::Latest());
+
+    REQUIRE(index.GetVersion() == Schema::Version{ 1, 9 });
+
+    auto relativePath = GetPathFromManifest(manifest);
+
+    // Update with indexed changes
+    manifest.Moniker = "testmoniker2";
+    REQUIRE(index.UpdateManifest(manifest, relativePath));
+
+    // Update with no changes should not be journaled
+    REQUIRE(!index.UpdateManifest(manifest, relativePath));
+
+    index.RemoveManifest(manifest);
+
+    auto changes = index.GetChangesSince(0);
+    REQUIRE(changes.size() == 3);
+
+    REQUIRE(changes[0].Change == ChangeType::Add);
+    REQUIRE(changes[1].Change == ChangeType::Update);
+    REQUIRE(changes[2].Change == ChangeType::Remove);
+
+    for (const auto& entry : changes)
+    {
+        REQUIRE(entry.Id == manifest.Id);
+        REQUIRE(entry.Version == manifest.Version);
+        REQUIRE(entry.Channel == manifest.Channel);
+    }
+
+    REQUIRE(changes[0].Sequence < changes[1].Sequence);
+    REQUIRE(changes[1].Sequence < changes[2].Sequence);
+
+    // Resuming from a previously seen sequence number only returns the later entries
+    auto delta = index.GetChangesSince(changes[1].Sequence);
+    REQUIRE(delta.size() == 1);
+    REQUIRE(delta[0].Sequence == changes[2].Sequence);
+    REQUIRE(delta[0].Change == ChangeType::Remove);
+
+    REQUIRE(index.CheckConsistency(true));
+}
+
+TEST_CASE("SQLiteIndex_ValueInterning_RemoveAndReadd", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SQLiteIndex index = CreateTestIndex(tempFile, Schema::Version::Latest());
+
+    Manifest manifest1;
+    CreateFakeManifest(manifest1, "First");
+    index.AddManifest(manifest1, GetPathFromManifest(manifest1));
+
+    // Shares tags, moniker and commands with the first manifest, exercising the interned ids.
+    Manifest manifest2;
+    CreateFakeManifest(manifest2, "Second");
+    index.AddManifest(manifest2, GetPathFromManifest(manifest2));
+
+    // The first removal keeps the shared values alive; the second deletes them,
+    // which must drop the interned ids as well.
+    index.RemoveManifest(manifest1);
+    index.RemoveManifest(manifest2);
+
+    // Re-adding must insert fresh value rows rather than reusing stale ids.
+    index.AddManifest(manifest1, GetPathFromManifest(manifest1));
+
+    REQUIRE(index.CheckConsistency(true));
+
+    SearchRequest request;
+    request.Filters.emplace_back(PackageMatchField::Tag, MatchType::Exact, "t1");
+
+    auto results = index.Search(request);
+    REQUIRE(results.Matches.size() == 1);
+}
+
+TEST_CASE("SQLiteIndex_LatestVersionPointer", "[sqliteindex][V1_8]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SQLiteIndex index = CreateTestIndex(tempFile, Schema::Version::Latest());
+
+    Manifest manifest1;
+    CreateFakeManifest(manifest1, "Test", "1.0.0");
+    index.AddManifest(manifest1, GetPathFromManifest(manifest1));
+
+    Manifest manifest3;
+    CreateFakeManifest(manifest3, "Test", "3.0.0");
+    index.AddManifest(manifest3, GetPathFromManifest(manifest3));
+
+    // Adding an older version must not move the pointer back.
+    Manifest manifest2;
+    CreateFakeManifest(manifest2, "Test", "2.0.0");
+    index.AddManifest(manifest2, GetPathFromManifest(manifest2));
+
+    SearchRequest request;
+    request.Filters.emplace_back(PackageMatchField::Id, MatchType::Exact, manifest1.Id);
+
+    auto results = index.Search(request);
+    REQUIRE(results.Matches.size() == 1);
+    auto packageRowId = results.Matches[0].first;
+
+    auto latest = index.GetManifestIdByKey(packageRowId, {}, manifest1.Channel);
+    REQUIRE(latest.has_value());
+    REQUIRE(latest == index.GetManifestIdByManifest(manifest3));
+
+    // Removing the latest version must fall back to the next highest.
+    index.RemoveManifest(manifest3);
+
+    latest = index.GetManifestIdByKey(packageRowId, {}, manifest1.Channel);
+    REQUIRE(latest.has_value());
+    REQUIRE(latest == index.GetManifestIdByManifest(manifest2));
+
+    // Removing a non-latest version must not disturb the pointer.
+    index.RemoveManifest(manifest1);
+
+    latest = index.GetManifestIdByKey(packageRowId, {}, manifest2.Channel);
+    REQUIRE(latest.has_value());
+    REQUIRE(latest == index.GetManifestIdByManifest(manifest2));
+
+    REQUIRE(index.CheckConsistency(true));
+}
+
+TEST_CASE("SQLiteIndex_ChangeJournal_NotPresentInOlderSchema", "[sqliteindex][V1_8]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    Manifest manifest;
+    SQLiteIndex index = SimpleTestSetup(tempFile, manifest, Schema::Version{ 1, 7 });
+
+    REQUIRE(index.GetChangesSince(0).empty());
+}
+
+TEST_CASE("SQLiteIndex_InternedStrings_SharedAcrossTables", "[sqliteindex][V1_9]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SQLiteIndex index = CreateTestIndex(tempFile, Schema::Version::Latest());
+
+    // The moniker deliberately matches the version, putting the same string in two tables.
+    Manifest manifest;
+    CreateFakeManifest(manifest, "Test");
+    manifest.Moniker = manifest.Version;
+    index.AddManifest(manifest, GetPathFromManifest(manifest));
+
+    {
+        Connection connection = Connection::Create(tempFile, Connection::OpenDisposition::ReadOnly);
+
+        Statement count = Statement::Create(connection, "select count(*) from strings where string = ?");
+        count.Bind(1, manifest.Version);
+        REQUIRE(count.Step());
+        REQUIRE(count.GetColumn<int>(0) == 1);
+    }
+
+    // The views resolve the shared string for both properties.
+    auto manifestId = index.GetManifestIdByManifest(manifest);
+    REQUIRE(manifestId.has_value());
+    REQUIRE(index.GetPropertyByManifestId(manifestId.value(), PackageVersionProperty::Version) == manifest.Version);
+
+    SearchRequest request;
+    request.Filters.emplace_back(PackageMatchField::Moniker, MatchType::Exact, manifest.Moniker);
+
+    auto results = index.Search(request);
+    REQUIRE(results.Matches.size() == 1);
+
+    REQUIRE(index.CheckConsistency(true));
+}
+
+TEST_CASE("SQLiteIndex_InternedStrings_PrunedOnPackaging", "[sqliteindex][V1_9]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SQLiteIndex index = CreateTestIndex(tempFile, Schema::Version::Latest());
+
+    Manifest manifest1;
+    CreateFakeManifest(manifest1, "First");
+    index.AddManifest(manifest1, GetPathFromManifest(manifest1));
+
+    Manifest manifest2;
+    CreateFakeManifest(manifest2, "Second");
+    index.AddManifest(manifest2, GetPathFromManifest(manifest2));
+
+    // Removing the manifest orphans its strings; packaging prunes them.
+    index.RemoveManifest(manifest1);
+    index.PrepareForPackaging();
+
+    {
+        Connection connection = Connection::Create(tempFile, Connection::OpenDisposition::ReadOnly);
+
+        Statement count = Statement::Create(connection, "select count(*) from strings where string like '%First%'");
+        REQUIRE(count.Step());
+        REQUIRE(count.GetColumn<int>(0) == 0);
+    }
+
+    // The views keep serving reads after the lookup indices are dropped.
+    SearchRequest request;
+    request.Filters.emplace_back(PackageMatchField::Id, MatchType::Exact, manifest2.Id);
+
+    auto results = index.Search(request);
+    REQUIRE(results.Matches.size() == 1);
+    REQUIRE(GetIdStringById(index, results.Matches[0].first) == manifest2.Id);
+}
+
 TEST_CASE("SQLiteIndex_Search_SingleFilter", "[sqliteindex]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -2142,6 +2593,38 @@ TEST_CASE("SQLiteIndex_Search_QueryAndFilter", "[sqliteindex]")
     REQUIRE(result == "Id2");
 }
 
+TEST_CASE("SQLiteIndex_Search_FilterOnUnsupportedField", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    std::string testName = "Name";
+    std::string testPublisher = "Publisher";
+
+    SQLiteIndex index = SearchTestSetup(tempFile, {
+        { "Id1", testName, testPublisher, "Moniker", "Version", "Channel", { "Tag" }, { "Command" }, "Path1", {}, { "PC1" } },
+        });
+
+    Schema::Version testVersion = TestPrepareForRead(index);
+
+    SearchRequest request;
+    request.Query = RequestMatch(MatchType::Substring, "Id");
+    request.Filters.emplace_back(PackageMatchFilter(PackageMatchField::NormalizedNameAndPublisher, MatchType::Exact, testName, testPublisher));
+
+    auto results = index.Search(request);
+
+    if (AreNormalizedNameAndPublisherSupported(index, testVersion))
+    {
+        REQUIRE(results.Matches.size() == 1);
+    }
+    else
+    {
+        // A filter on a field that this version cannot match is an AND term that matches
+        // nothing; it must empty the results rather than pass everything through.
+        REQUIRE(results.Matches.empty());
+    }
+}
+
 TEST_CASE("SQLiteIndex_Search_QueryAndMultipleFilters", "[sqliteindex]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -3187,3 +3670,98 @@ TEST_CASE("SQLiteIndex_CheckConsistency_FindEmbeddedNull", "[sqliteindex]")
 
     REQUIRE(!index.CheckConsistency(true));
 }
+
+TEST_CASE("SQLiteIndex_IntegrityMarker", "[sqliteindex]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    {
+        SQLiteIndex index = SQLiteIndex::CreateNew(tempFile, Schema::Version::Latest());
+
+        // While a write session is open, the unclean shutdown marker is set.
+        Connection connection = Connection::Create(tempFile, Connection::OpenDisposition::ReadOnly);
+        REQUIRE(Schema::MetadataTable::TryGetNamedValue<int64_t>(connection, Schema::s_MetadataValueName_IntegrityMarker).value_or(0) == 1);
+    }
+
+    {
+        // A clean close clears the marker.
+        Connection connection = Connection::Create(tempFile, Connection::OpenDisposition::ReadOnly);
+        REQUIRE(Schema::MetadataTable::TryGetNamedValue<int64_t>(connection, Schema::s_MetadataValueName_IntegrityMarker).value_or(0) == 0);
+    }
+
+    {
+        // Simulate a crashed session by leaving the marker set.
+        Connection connection = Connection::Create(tempFile, Connection::OpenDisposition::ReadWrite);
+        Schema::MetadataTable::SetNamedValue(connection, Schema::s_MetadataValueName_IntegrityMarker, int64_t{ 1 });
+    }
+
+    {
+        // The next write open verifies the intact database and succeeds.
+        SQLiteIndex index = SQLiteIndex::Open(tempFile, SQLiteStorageBase::OpenDisposition::ReadWrite);
+        REQUIRE(index.VerifyStructuralIntegrity());
+    }
+}
+
+TEST_CASE("SQLiteIndex_CorpusGeneration_Deterministic", "[sqliteindex]")
+{
+    TestCommon::IndexCorpusOptions options;
+    options.PackageCount = 50;
+    options.Seed = 123;
+
+    options.ThreadCount = 1;
+    SQLiteIndex serial = TestCommon::GenerateIndexCorpus(options, SQLITE_MEMORY_DB_CONNECTION_TARGET);
+
+    options.ThreadCount = 4;
+    SQLiteIndex parallel = TestCommon::GenerateIndexCorpus(options, SQLITE_MEMORY_DB_CONNECTION_TARGET);
+
+    SearchRequest request;
+    auto serialResults = serial.Search(request);
+    auto parallelResults = parallel.Search(request);
+
+    REQUIRE(serialResults.Matches.size() == options.PackageCount);
+    REQUIRE(parallelResults.Matches.size() == options.PackageCount);
+
+    auto getSortedIds = [](const SQLiteIndex& index, const SearchResult& results)
+    {
+        std::vector<std::string> ids;
+        for (const auto& match : results.Matches)
+        {
+            ids.emplace_back(GetIdStringById(index, match.first));
+        }
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+
+    REQUIRE(getSortedIds(serial, serialResults) == getSortedIds(parallel, parallelResults));
+}
+
+TEST_CASE("SQLiteIndex_CorpusGeneration_PackageShape", "[sqliteindex]")
+{
+    TestCommon::IndexCorpusOptions options;
+    options.PackageCount = 20;
+    options.Seed = 7;
+    options.MaximumVersionCount = 3;
+
+    for (size_t ordinal = 0; ordinal < options.PackageCount; ++ordinal)
+    {
+        TestCommon::CorpusPackage package = TestCommon::GenerateCorpusPackage(options, ordinal);
+        REQUIRE(!package.Versions.empty());
+        REQUIRE(package.Versions.size() <= options.MaximumVersionCount);
+
+        for (const auto& manifest : package.Versions)
+        {
+            // Every version of a package carries the same identity.
+            REQUIRE(manifest.Id == package.Versions[0].Id);
+            REQUIRE(!manifest.Version.empty());
+            REQUIRE(!manifest.DefaultLocalization.Get<Localization::PackageName>().empty());
+            REQUIRE(manifest.Localizations.size() <= options.Locales.size());
+        }
+
+        // The same (options, ordinal) always produces the same content.
+        TestCommon::CorpusPackage again = TestCommon::GenerateCorpusPackage(options, ordinal);
+        REQUIRE(again.Versions.size() == package.Versions.size());
+        REQUIRE(again.Versions[0].Id == package.Versions[0].Id);
+        REQUIRE(again.Versions[0].Version == package.Versions[0].Version);
+    }
+}
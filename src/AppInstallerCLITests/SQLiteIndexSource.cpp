@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "TestCommon.h"
 #include <Microsoft/SQLiteIndexSource.h>
+#include <Microsoft/Schema/MetadataTable.h>
 #include <winget/ManifestYamlParser.h>
 
 using namespace std::string_literals;
@@ -194,3 +195,46 @@ TEST_CASE("SQLiteIndexSource_IsSame", "[sqliteindexsource]")
 
     REQUIRE(result1.Matches[0].Package->IsSame(result2.Matches[0].Package.get()));
 }
+
+TEST_CASE("SQLiteIndexSource_TryUpdateIndex", "[sqliteindexsource]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    SourceDetails details;
+    Manifest manifest;
+    std::string relativePath;
+    std::shared_ptr<SQLiteIndexSource> source = SimpleTestSetup(tempFile, details, manifest, relativePath);
+
+    // Nothing has changed, so there is nothing to swap in.
+    REQUIRE(!source->TryUpdateIndex());
+
+    // Simulate a source update replacing the backing file with newer data.
+    Manifest updatedManifest = manifest;
+    updatedManifest.Id = "Updated.Package";
+
+    {
+        SQLiteIndex update = SQLiteIndex::Open(tempFile, SQLiteStorageBase::OpenDisposition::ReadWrite);
+        update.AddManifest(updatedManifest, "updated.yaml");
+    }
+
+    {
+        // The write time has second granularity; move it forward to make the new
+        // generation unambiguously newer than the one the source opened.
+        Connection connection = Connection::Create(tempFile, Connection::OpenDisposition::ReadWrite);
+        Schema::MetadataTable::SetNamedValue(connection, Schema::s_MetadataValueName_LastWriteTime,
+            Schema::MetadataTable::GetNamedValue<int64_t>(connection, Schema::s_MetadataValueName_LastWriteTime) + 10);
+    }
+
+    REQUIRE(source->TryUpdateIndex());
+
+    // The same source object now serves the updated data.
+    SearchRequest request;
+    request.Query = RequestMatch(MatchType::Exact, updatedManifest.Id);
+
+    auto results = source->Search(request);
+    REQUIRE(results.Matches.size() == 1);
+
+    // The swapped-in generation is now current.
+    REQUIRE(!source->TryUpdateIndex());
+}
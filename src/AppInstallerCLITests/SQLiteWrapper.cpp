@@ -261,6 +261,24 @@ TEST_CASE("SQLiteWrapperSavepointReuse", "[sqlitewrapper]")
     }
 }
 
+TEST_CASE("SQLiteWrapper_StatementInstrumentation", "[sqlitewrapper]")
+{
+    Connection connection = Connection::Create(SQLITE_MEMORY_DB_CONNECTION_TARGET, Connection::OpenDisposition::Create);
+
+    CreateSimpleTestTable(connection);
+
+    int firstVal = 1;
+    std::string secondVal = "test";
+
+    InsertIntoSimpleTestTable(connection, firstVal, secondVal);
+
+    // A zero threshold makes every statement a slow query, exercising the plan logging.
+    EnableStatementInstrumentation(std::chrono::milliseconds{ 0 });
+    auto disable = wil::scope_exit([]() { DisableStatementInstrumentation(); });
+
+    SelectFromSimpleTestTableOnlyOneRow(connection, firstVal, secondVal);
+}
+
 TEST_CASE("SQLiteWrapper_EscapeStringForLike", "[sqlitewrapper]")
 {
     std::string escape(EscapeCharForLike);
@@ -300,6 +318,37 @@ TEST_CASE("SQLiteWrapper_BindWithEmbeddedNull", "[sqlitewrapper]")
     REQUIRE_THROWS_HR(InsertIntoSimpleTestTable(connection, firstVal, secondVal), APPINSTALLER_CLI_ERROR_BIND_WITH_EMBEDDED_NULL);
 }
 
+TEST_CASE("SQLiteWrapper_ColumnViews", "[sqlitewrapper]")
+{
+    Connection connection = Connection::Create(SQLITE_MEMORY_DB_CONNECTION_TARGET, Connection::OpenDisposition::Create);
+
+    Statement create = Statement::Create(connection, "CREATE TABLE [viewtest]([text] TEXT, [data] BLOB)");
+    create.Execute();
+
+    std::string textVal = "view test value";
+    blob_t blobVal = { 1, 2, 3, 0, 5 };
+
+    Statement insert = Statement::Create(connection, "INSERT INTO [viewtest] VALUES (?, ?)");
+    insert.Bind(1, textVal);
+    insert.Bind(2, blobVal);
+    insert.Execute();
+
+    Statement select = Statement::Create(connection, "SELECT [text], [data] FROM [viewtest]");
+    REQUIRE(select.Step());
+
+    REQUIRE(textVal == select.GetColumnView(0));
+
+    blob_view_t blobView = select.GetColumnBlobView(1);
+    REQUIRE(blobVal == blob_t(blobView.begin(), blobView.end()));
+
+    // The views match what the copying accessors produce for the same row.
+    REQUIRE(select.GetColumn<std::string>(0) == select.GetColumnView(0));
+    REQUIRE(select.GetColumn<blob_t>(1).size() == select.GetColumnBlobView(1).size());
+
+    REQUIRE_FALSE(select.Step());
+    REQUIRE_THROWS_HR(select.GetColumnView(0), E_BOUNDS);
+}
+
 TEST_CASE("SQLiteWrapper_PrepareFailure", "[sqlitewrapper]")
 {
     Connection connection = Connection::Create(SQLITE_MEMORY_DB_CONNECTION_TARGET, Connection::OpenDisposition::Create);
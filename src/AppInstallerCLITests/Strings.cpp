@@ -21,8 +21,22 @@ TEST_CASE("UTF8Length", "[strings]")
     REQUIRE(UTF8Length("\xf0\x9d\x85\xa0\xf0\x9d\x85\xa0") == 2); // [8th note][8th note]
 }
 
+TEST_CASE("ConvertUTF16AndUTF8", "[strings]")
+{
+    // Covers both the ASCII fast path and the full conversion fallback.
+    REQUIRE(ConvertToUTF16("") == L"");
+    REQUIRE(ConvertToUTF8(L"") == "");
+    REQUIRE(ConvertToUTF16("Package.Identifier-1.0+ascii") == L"Package.Identifier-1.0+ascii");
+    REQUIRE(ConvertToUTF8(L"Package.Identifier-1.0+ascii") == "Package.Identifier-1.0+ascii");
+    REQUIRE(ConvertToUTF16("K\xC3\xA4se") == L"K\xE4se"); // "Käse"
+    REQUIRE(ConvertToUTF8(L"K\xE4se") == "K\xC3\xA4se");
+    REQUIRE(ConvertToUTF8(ConvertToUTF16("\xf0\x9f\xa6\x86")) == "\xf0\x9f\xa6\x86"); // [duck emoji]
+    REQUIRE(TryConvertToUTF16("mixed ascii K\xC3\xA4se").value() == L"mixed ascii K\xE4se");
+    REQUIRE(TryConvertToUTF16("plain ascii").value() == L"plain ascii");
+}
+
 TEST_CASE("UTF8Substring", "[strings]")
-{    
+{
     REQUIRE(UTF8Substring("", 0, 0) == "");
     REQUIRE(UTF8Substring("abcd", 0, 4) == "abcd");
     REQUIRE(UTF8Substring("abcd", 0, 5) == "abcd");
@@ -138,6 +152,13 @@ TEST_CASE("FoldCase", "[strings]")
     REQUIRE(FoldCase("foldcase"sv) == FoldCase("FOLDCASE"sv));
     REQUIRE(FoldCase(u8"f\xF6ldcase"sv) == FoldCase(u8"F\xD6LDCASE"sv));
     REQUIRE(FoldCase(u8"foldc\x430se"sv) == FoldCase(u8"FOLDC\x410SE"sv));
+
+    // The ASCII fast path must produce plain lowercase, including past the vector width.
+    REQUIRE(FoldCase("FoldCase123!"sv) == "foldcase123!");
+    REQUIRE(FoldCase("ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"sv) == "abcdefghijklmnopqrstuvwxyz0123456789");
+
+    // Mixed ASCII and non-ASCII takes the ICU path and must still agree.
+    REQUIRE(FoldCase(u8"Mixed.F\xD6LDCASE"sv) == FoldCase(u8"mixed.f\xF6ldcase"sv));
 }
 
 TEST_CASE("ExpandEnvironmentVariables", "[strings]")
@@ -224,6 +245,10 @@ TEST_CASE("HexStrings", "[strings]")
 
     REQUIRE(value == ConvertToHexString(buffer));
     REQUIRE(std::equal(buffer.begin(), buffer.end(), ParseFromHexString(value).begin()));
+
+    // Both digit cases parse to the same bytes
+    std::string upperValue = "000102030405060708090A0B0C0D0E0F";
+    REQUIRE(std::equal(buffer.begin(), buffer.end(), ParseFromHexString(upperValue).begin()));
 }
 
 TEST_CASE("Join", "[strings]")
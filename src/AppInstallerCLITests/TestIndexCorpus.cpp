@@ -0,0 +1,157 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TestIndexCorpus.h"
+
+#include <algorithm>
+#include <random>
+#include <thread>
+
+using namespace AppInstaller;
+using namespace AppInstaller::Repository::Microsoft;
+
+namespace TestCommon
+{
+    namespace
+    {
+        using namespace std::string_view_literals;
+
+        // The tags drawn from when generating manifests; weighted toward the
+        // categories that dominate the community catalog.
+        constexpr std::string_view s_CorpusTagPool[] =
+        {
+            "utility"sv, "developer-tools"sv, "productivity"sv, "multimedia"sv,
+            "games"sv, "security"sv, "networking"sv, "education"sv,
+            "photo"sv, "video"sv, "audio"sv, "cli"sv,
+            "editor"sv, "browser"sv, "database"sv, "terminal"sv,
+        };
+
+        // The words combined to form package names.
+        constexpr std::string_view s_CorpusNameWords[] =
+        {
+            "Swift"sv, "Rapid"sv, "Quiet"sv, "Bright"sv, "Open"sv, "Free"sv, "Super"sv, "Micro"sv,
+            "Editor"sv, "Viewer"sv, "Manager"sv, "Studio"sv, "Player"sv, "Console"sv, "Monitor"sv, "Toolkit"sv,
+        };
+
+        // Draws the number of versions for a package; weighted heavily toward a
+        // single version with a tail out to the maximum.
+        size_t DrawVersionCount(std::mt19937& gen, size_t maximum)
+        {
+            std::uniform_int_distribution<size_t> percent{ 0, 99 };
+            if (percent(gen) < 70 || maximum <= 1)
+            {
+                return 1;
+            }
+
+            std::uniform_int_distribution<size_t> tail{ 2, maximum };
+            return tail(gen);
+        }
+    }
+
+    CorpusPackage GenerateCorpusPackage(const IndexCorpusOptions& options, size_t packageOrdinal)
+    {
+        // Each package gets its own deterministic stream so that neither generation
+        // order nor the thread count can affect the content.
+        std::mt19937 gen{ options.Seed ^ (0x9E3779B9u * (static_cast<uint32_t>(packageOrdinal) + 1)) };
+
+        // Reuse publishers across packages, as the community catalog does.
+        size_t publisherPoolSize = std::max<size_t>(1, options.PackageCount / 4);
+        std::uniform_int_distribution<size_t> publisherDraw{ 0, publisherPoolSize - 1 };
+        std::string publisher = "CorpusPublisher" + std::to_string(publisherDraw(gen));
+
+        std::uniform_int_distribution<size_t> wordDraw{ 0, std::size(s_CorpusNameWords) - 1 };
+        std::string name;
+        name.append(s_CorpusNameWords[wordDraw(gen)]).append(1, ' ').append(s_CorpusNameWords[wordDraw(gen)]).append(1, ' ').append(std::to_string(packageOrdinal));
+
+        std::vector<Manifest::string_t> tags;
+        std::uniform_int_distribution<size_t> tagCountDraw{ 0, options.MaximumTagCount };
+        std::sample(std::begin(s_CorpusTagPool), std::end(s_CorpusTagPool), std::back_inserter(tags),
+            std::min(tagCountDraw(gen), std::size(s_CorpusTagPool)), gen);
+
+        // Locales are attached to roughly a third of the packages.
+        std::uniform_int_distribution<size_t> percent{ 0, 99 };
+        size_t localeCount = 0;
+        if (!options.Locales.empty() && percent(gen) < 33)
+        {
+            std::uniform_int_distribution<size_t> localeCountDraw{ 1, options.Locales.size() };
+            localeCount = localeCountDraw(gen);
+        }
+
+        std::uniform_int_distribution<size_t> versionPartDraw{ 0, 9 };
+        size_t major = versionPartDraw(gen) + 1;
+        size_t minor = versionPartDraw(gen);
+
+        CorpusPackage result;
+        size_t versionCount = DrawVersionCount(gen, options.MaximumVersionCount);
+
+        for (size_t versionOrdinal = 0; versionOrdinal < versionCount; ++versionOrdinal)
+        {
+            Manifest::Manifest manifest;
+            manifest.Id = publisher + ".Package" + std::to_string(packageOrdinal);
+            manifest.Version = std::to_string(major) + '.' + std::to_string(minor + versionOrdinal) + ".0";
+            manifest.Moniker = "corpus" + std::to_string(packageOrdinal);
+            manifest.DefaultLocalization.Add<Manifest::Localization::PackageName>(name);
+            manifest.DefaultLocalization.Add<Manifest::Localization::Publisher>(publisher);
+            manifest.DefaultLocalization.Add<Manifest::Localization::Tags>(tags);
+
+            for (size_t localeOrdinal = 0; localeOrdinal < localeCount; ++localeOrdinal)
+            {
+                Manifest::ManifestLocalization localization;
+                localization.Locale = options.Locales[localeOrdinal];
+                localization.Add<Manifest::Localization::PackageName>(name + " (" + options.Locales[localeOrdinal] + ")");
+                manifest.Localizations.emplace_back(std::move(localization));
+            }
+
+            manifest.Installers.push_back({});
+            result.Versions.emplace_back(std::move(manifest));
+        }
+
+        return result;
+    }
+
+    SQLiteIndex GenerateIndexCorpus(const IndexCorpusOptions& options, const std::string& filePath)
+    {
+        std::vector<CorpusPackage> packages(options.PackageCount);
+
+        // The manifests are synthesized in parallel; inserting them happens on this
+        // thread since the index has a single connection.
+        size_t threadCount = options.ThreadCount != 0 ? options.ThreadCount : std::thread::hardware_concurrency();
+        threadCount = std::max<size_t>(1, std::min(threadCount, options.PackageCount));
+
+        std::atomic_size_t nextOrdinal{ 0 };
+        auto generate = [&]()
+        {
+            for (size_t ordinal = nextOrdinal++; ordinal < packages.size(); ordinal = nextOrdinal++)
+            {
+                packages[ordinal] = GenerateCorpusPackage(options, ordinal);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < threadCount; ++i)
+        {
+            threads.emplace_back(generate);
+        }
+
+        generate();
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        std::vector<SQLiteIndex::ManifestAndPath> manifests;
+        for (auto& package : packages)
+        {
+            for (auto& manifest : package.Versions)
+            {
+                std::filesystem::path relativePath = "corpus/" + manifest.Id + '/' + manifest.Version + ".yaml";
+                manifests.emplace_back(SQLiteIndex::ManifestAndPath{ std::move(manifest), std::move(relativePath) });
+            }
+        }
+
+        SQLiteIndex index = SQLiteIndex::CreateNew(filePath);
+        index.AddManifests(manifests);
+        return index;
+    }
+}
@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <winget/Manifest.h>
+#include <Microsoft/SQLiteIndex.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TestCommon
+{
+    // Parameters controlling a synthesized index corpus.
+    // The same options always produce the same corpus, regardless of thread count.
+    struct IndexCorpusOptions
+    {
+        // The number of distinct packages to generate.
+        size_t PackageCount = 1000;
+
+        // The seed for all generated content.
+        uint32_t Seed = 1;
+
+        // The upper bound on the number of versions per package; the drawn count is
+        // weighted heavily toward a single version, as in the community catalog.
+        size_t MaximumVersionCount = 5;
+
+        // The upper bound on the number of tags per manifest.
+        size_t MaximumTagCount = 8;
+
+        // The locales that manifests may carry beyond the default localization.
+        std::vector<std::string> Locales = { "en-GB", "fr-FR", "de-DE", "zh-CN" };
+
+        // The number of generation threads; zero uses the hardware concurrency.
+        size_t ThreadCount = 0;
+    };
+
+    // The generated manifests for a single package, one per version.
+    struct CorpusPackage
+    {
+        std::vector<AppInstaller::Manifest::Manifest> Versions;
+    };
+
+    // Synthesizes the package at the given ordinal; deterministic in (options, ordinal).
+    CorpusPackage GenerateCorpusPackage(const IndexCorpusOptions& options, size_t packageOrdinal);
+
+    // Synthesizes the full corpus, generating the manifests in parallel, and inserts
+    // it into a newly created index at the given file path (which may be the memory
+    // connection target).
+    AppInstaller::Repository::Microsoft::SQLiteIndex GenerateIndexCorpus(const IndexCorpusOptions& options, const std::string& filePath);
+}
@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "TestCommon.h"
 #include "TestSettings.h"
+#include <winget/AdminSettings.h>
 #include <winget/Settings.h>
 
 using namespace AppInstaller::Settings;
@@ -25,16 +26,28 @@ namespace TestCommon
                 std::filesystem::remove(settingsBackupPath);
             }
         }
+
+        // The admin settings values are cached process wide; when a test manipulates the
+        // stream directly, the snapshot has to be dropped for the change to be visible.
+        void ResetCachesForSetting(const AppInstaller::Settings::StreamDefinition& stream)
+        {
+            if (stream.Name == Stream::AdminSettings.Name)
+            {
+                ResetAdminSettingsCache();
+            }
+        }
     }
 
     void SetSetting(const AppInstaller::Settings::StreamDefinition& stream, std::string_view value)
     {
         REQUIRE(Stream{ stream }.Set(value));
+        ResetCachesForSetting(stream);
     }
 
     void RemoveSetting(const AppInstaller::Settings::StreamDefinition& stream)
     {
         Stream{ stream }.Remove();
+        ResetCachesForSetting(stream);
     }
 
     std::filesystem::path GetPathTo(const AppInstaller::Settings::StreamDefinition& stream)
@@ -547,3 +547,46 @@ TEST_CASE("SettingsInstallScope", "[settings]")
         REQUIRE(userSettingTest.Get<Setting::InstallScopeRequirement>() == AppInstaller::Manifest::ScopeEnum::Machine);
     }
 }
+
+TEST_CASE("SettingsCache", "[settings]")
+{
+    auto again = DeleteUserSettingsFiles();
+    RemoveSetting(Stream::UserSettingsCache);
+
+    std::string_view json = R"({ "visual": { "progressBar": "retro" }, "installBehavior": { "preferences": { "locale": [ "en-US", "fr-FR" ] } } })";
+    SetSetting(Stream::PrimaryUserSettings, json);
+
+    // The first load parses the file and writes the cache.
+    {
+        UserSettingsTest firstLoad;
+        REQUIRE(firstLoad.GetType() == UserSettingsType::Standard);
+        REQUIRE(!firstLoad.LoadedFromCache());
+        REQUIRE(firstLoad.Get<Setting::ProgressBarVisualStyle>() == VisualStyle::Retro);
+    }
+
+    // A second load of the unchanged file comes from the cache with the same values.
+    UserSettingsTest secondLoad;
+    REQUIRE(secondLoad.GetType() == UserSettingsType::Standard);
+    REQUIRE(secondLoad.LoadedFromCache());
+    REQUIRE(secondLoad.Get<Setting::ProgressBarVisualStyle>() == VisualStyle::Retro);
+    std::vector<std::string> expectedLocales = { "en-US", "fr-FR" };
+    REQUIRE(secondLoad.Get<Setting::InstallLocalePreference>() == expectedLocales);
+    REQUIRE(secondLoad.GetWarnings().size() == 0);
+
+    // Changing the file invalidates the cache.
+    SetSetting(Stream::PrimaryUserSettings, R"({ "visual": { "progressBar": "rainbow" } })");
+    UserSettingsTest thirdLoad;
+    REQUIRE(!thirdLoad.LoadedFromCache());
+    REQUIRE(thirdLoad.Get<Setting::ProgressBarVisualStyle>() == VisualStyle::Rainbow);
+
+    // A load that produces warnings is not cached, so the warnings appear on every load.
+    SetSetting(Stream::PrimaryUserSettings, R"({ "visual": { "progressBar": "fake" } })");
+    {
+        UserSettingsTest warningLoad;
+        REQUIRE(warningLoad.GetWarnings().size() == 1);
+    }
+
+    UserSettingsTest warningReload;
+    REQUIRE(!warningReload.LoadedFromCache());
+    REQUIRE(warningReload.GetWarnings().size() == 1);
+}
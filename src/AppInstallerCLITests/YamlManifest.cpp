@@ -1216,3 +1216,19 @@ TEST_CASE("YamlParserTypes", "[YAML]")
     auto localTag = document["LocalTag"];
     CHECK(localTag.GetTagType() == Node::TagType::Unknown);
 }
+
+TEST_CASE("YamlScalarSpans", "[YAML]")
+{
+    Node copied;
+
+    {
+        auto document = AppInstaller::YAML::Load(std::string_view{ "Key: Value\nNumber: 42\nQuoted: 'true'" });
+        CHECK(document["Key"].as<std::string_view>() == "Value");
+        CHECK(document["Number"].as<int64_t>() == 42);
+        CHECK(document["Quoted"].as<std::string>() == "true");
+        copied = document["Key"];
+    }
+
+    // A copied node shares ownership of the scalar storage with the tree it came from.
+    CHECK(copied.as<std::string_view>() == "Value");
+}
@@ -11,6 +11,7 @@
 #include <Msi.h>
 #include <KnownFolders.h>
 
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch.hpp>
 
 #include <json/json.h>
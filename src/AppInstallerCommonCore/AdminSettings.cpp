@@ -50,7 +50,7 @@ namespace AppInstaller::Settings
 
             void SetAdminSetting(AdminSetting setting, bool enabled);
 
-            bool GetAdminSettingBoolValue(AdminSetting setting) const;
+            const AdminSettingValues& GetValues() const { return m_settingValues; }
 
         private:
             void LoadAdminSettings();
@@ -60,6 +60,38 @@ namespace AppInstaller::Settings
             AdminSettingValues m_settingValues;
         };
 
+        // How long a snapshot of the values is served before the stream is consulted again,
+        // to bound staleness when another process changes the admin settings.
+        constexpr auto s_AdminSettingsRefreshInterval = std::chrono::seconds{ 5 };
+
+        std::mutex s_adminSettingsLock;
+        std::optional<AdminSettingValues> s_adminSettingsValues;
+        std::chrono::steady_clock::time_point s_adminSettingsExpiration{};
+
+        // Gets a process wide snapshot of the values, so that repeated queries do not
+        // reread and verify the settings stream each time.
+        AdminSettingValues GetCachedAdminSettingValues()
+        {
+            std::lock_guard<std::mutex> lock{ s_adminSettingsLock };
+
+            auto now = std::chrono::steady_clock::now();
+            if (!s_adminSettingsValues.has_value() || now >= s_adminSettingsExpiration)
+            {
+                AdminSettingsInternal adminSettingsInternal;
+                s_adminSettingsValues = adminSettingsInternal.GetValues();
+                s_adminSettingsExpiration = now + s_AdminSettingsRefreshInterval;
+            }
+
+            return s_adminSettingsValues.value();
+        }
+
+        // Drops the snapshot; the next query reloads from the stream.
+        void InvalidateCachedAdminSettingValues()
+        {
+            std::lock_guard<std::mutex> lock{ s_adminSettingsLock };
+            s_adminSettingsValues.reset();
+        }
+
         AdminSettingsInternal::AdminSettingsInternal() : m_settingStream(Stream::AdminSettings)
         {
             LoadAdminSettings();
@@ -99,23 +131,6 @@ namespace AppInstaller::Settings
             THROW_HR_MSG(E_UNEXPECTED, "Too many attempts at SaveAdminSettings");
         }
 
-        bool AdminSettingsInternal::GetAdminSettingBoolValue(AdminSetting setting) const
-        {
-            switch (setting)
-            {
-            case AdminSetting::LocalManifestFiles:
-                return m_settingValues.LocalManifestFiles;
-            case AdminSetting::BypassCertificatePinningForMicrosoftStore:
-                return m_settingValues.BypassCertificatePinningForMicrosoftStore;
-            case AdminSetting::InstallerHashOverride:
-                return m_settingValues.InstallerHashOverride;
-            case AdminSetting::LocalArchiveMalwareScanOverride:
-                return m_settingValues.LocalArchiveMalwareScanOverride;
-            default:
-                return false;
-            }
-        }
-
         void AdminSettingsInternal::LoadAdminSettings()
         {
             auto stream = m_settingStream.Get();
@@ -238,6 +253,7 @@ namespace AppInstaller::Settings
 
         AdminSettingsInternal adminSettingsInternal;
         adminSettingsInternal.SetAdminSetting(setting, true);
+        InvalidateCachedAdminSettingValues();
         return true;
     }
 
@@ -251,6 +267,7 @@ namespace AppInstaller::Settings
 
         AdminSettingsInternal adminSettingsInternal;
         adminSettingsInternal.SetAdminSetting(setting, false);
+        InvalidateCachedAdminSettingValues();
         return true;
     }
 
@@ -264,9 +281,28 @@ namespace AppInstaller::Settings
             return policyState == PolicyState::Enabled;
         }
 
-        AdminSettingsInternal adminSettingsInternal;
-        return adminSettingsInternal.GetAdminSettingBoolValue(setting);
+        AdminSettingValues values = GetCachedAdminSettingValues();
+        switch (setting)
+        {
+        case AdminSetting::LocalManifestFiles:
+            return values.LocalManifestFiles;
+        case AdminSetting::BypassCertificatePinningForMicrosoftStore:
+            return values.BypassCertificatePinningForMicrosoftStore;
+        case AdminSetting::InstallerHashOverride:
+            return values.InstallerHashOverride;
+        case AdminSetting::LocalArchiveMalwareScanOverride:
+            return values.LocalArchiveMalwareScanOverride;
+        default:
+            return false;
+        }
+    }
+
+#ifndef AICLI_DISABLE_TEST_HOOKS
+    void ResetAdminSettingsCache()
+    {
+        InvalidateCachedAdminSettingValues();
     }
+#endif
 
     std::vector<AdminSetting> GetAllAdminSettings()
     {
@@ -873,6 +873,45 @@ namespace AppInstaller::Logging
         }
     }
 
+    TraceActivityScope::TraceActivityScope(std::string_view name, const void* function)
+    {
+        if (g_IsTelemetryProviderEnabled)
+        {
+            m_active = true;
+            m_name = name;
+            std::ignore = CoCreateGuid(&m_activityId);
+
+            std::string_view nameView = m_name;
+            TraceLoggingWriteActivity(
+                g_hTraceProvider,
+                "WorkflowTaskStart",
+                &m_activityId,
+                Telemetry().GetActivityId(),
+                TraceLoggingOpcode(EVENT_TRACE_TYPE_START),
+                AICLI_TraceLoggingStringView(nameView, "Task"),
+                TraceLoggingPointer(function, "Function"),
+                TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance),
+                TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES));
+        }
+    }
+
+    TraceActivityScope::~TraceActivityScope()
+    {
+        if (m_active)
+        {
+            std::string_view nameView = m_name;
+            TraceLoggingWriteActivity(
+                g_hTraceProvider,
+                "WorkflowTaskStop",
+                &m_activityId,
+                nullptr,
+                TraceLoggingOpcode(EVENT_TRACE_TYPE_STOP),
+                AICLI_TraceLoggingStringView(nameView, "Task"),
+                TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance),
+                TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES));
+        }
+    }
+
 #ifndef AICLI_DISABLE_TEST_HOOKS
     // Replace this test hook with context telemetry when it gets moved over
     void TestHook_SetTelemetryOverride(std::shared_ptr<TelemetryTraceLogger> ttl)
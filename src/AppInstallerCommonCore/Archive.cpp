@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 #include "pch.h"
+#include "Public/AppInstallerLogging.h"
 #include "Public/winget/Archive.h"
 
 // TODO: Move include statement to pch.h and resolve build errors
@@ -14,15 +15,47 @@ namespace AppInstaller::Archive
     using unique_pidlist_absolute = wil::unique_any<PIDLIST_ABSOLUTE, decltype(&::CoTaskMemFree), ::CoTaskMemFree>;
     using unique_lpitemidlist = wil::unique_any<LPITEMIDLIST, decltype(&::CoTaskMemFree), ::CoTaskMemFree>;
 
-    HRESULT TryExtractArchive(const std::filesystem::path& archivePath, const std::filesystem::path& destPath)
+    namespace
     {
-        wil::com_ptr<IFileOperation> pFileOperation;
-        RETURN_IF_FAILED(CoCreateInstance(CLSID_FileOperation, NULL, CLSCTX_ALL, IID_PPV_ARGS(&pFileOperation)));
-        RETURN_IF_FAILED(pFileOperation->SetOperationFlags(FOF_NO_UI));
+        // The minimum number of top level entries per worker; the shell pays a
+        // per-operation setup cost that dominates when the shares get too small.
+        constexpr size_t s_ExtractMinimumEntriesPerWorker = 4;
+
+        // The maximum number of concurrent extraction workers.
+        constexpr size_t s_ExtractMaximumWorkers = 4;
+
+        // Extracts the given top level entries of the archive to the destination.
+        // Each caller works against its own binding of the archive, so multiple
+        // workers can run against disjoint sets of entries concurrently.
+        HRESULT ExtractEntries(const std::filesystem::path& archivePath, const std::filesystem::path& destPath, const std::vector<LPITEMIDLIST>& entries)
+        {
+            wil::com_ptr<IFileOperation> pFileOperation;
+            RETURN_IF_FAILED(CoCreateInstance(CLSID_FileOperation, NULL, CLSCTX_ALL, IID_PPV_ARGS(&pFileOperation)));
+            RETURN_IF_FAILED(pFileOperation->SetOperationFlags(FOF_NO_UI));
+
+            wil::com_ptr<IShellItem> pShellItemTo;
+            RETURN_IF_FAILED(SHCreateItemFromParsingName(destPath.c_str(), NULL, IID_PPV_ARGS(&pShellItemTo)));
 
-        wil::com_ptr<IShellItem> pShellItemTo;
-        RETURN_IF_FAILED(SHCreateItemFromParsingName(destPath.c_str(), NULL, IID_PPV_ARGS(&pShellItemTo)));
+            unique_pidlist_absolute pidlFull;
+            RETURN_IF_FAILED(SHParseDisplayName(archivePath.c_str(), NULL, &pidlFull, 0, NULL));
+
+            wil::com_ptr<IShellFolder> pArchiveShellFolder;
+            RETURN_IF_FAILED(SHBindToObject(NULL, pidlFull.get(), NULL, IID_PPV_ARGS(&pArchiveShellFolder)));
+
+            for (LPITEMIDLIST entry : entries)
+            {
+                wil::com_ptr<IShellItem> pShellItemFrom;
+                RETURN_IF_FAILED(SHCreateItemWithParent(pidlFull.get(), pArchiveShellFolder.get(), entry, IID_PPV_ARGS(&pShellItemFrom)));
+                RETURN_IF_FAILED(pFileOperation->CopyItem(pShellItemFrom.get(), pShellItemTo.get(), NULL, NULL));
+            }
+
+            RETURN_IF_FAILED(pFileOperation->PerformOperations());
+            return S_OK;
+        }
+    }
 
+    HRESULT TryExtractArchive(const std::filesystem::path& archivePath, const std::filesystem::path& destPath)
+    {
         unique_pidlist_absolute pidlFull;
         RETURN_IF_FAILED(SHParseDisplayName(archivePath.c_str(), NULL, &pidlFull, 0, NULL));
 
@@ -32,20 +65,75 @@ namespace AppInstaller::Archive
         wil::com_ptr<IEnumIDList> pEnumIdList;
         RETURN_IF_FAILED(pArchiveShellFolder->EnumObjects(nullptr, SHCONTF_FOLDERS | SHCONTF_NONFOLDERS, &pEnumIdList));
 
+        // Enumerate the top level entries up front so the extraction work can be partitioned.
+        std::vector<unique_lpitemidlist> children;
         unique_lpitemidlist pidlChild;
         ULONG nFetched;
         while (pEnumIdList->Next(1, wil::out_param_ptr<LPITEMIDLIST*>(pidlChild), &nFetched) == S_OK && nFetched == 1)
         {
-            wil::com_ptr<IShellItem> pShellItemFrom;
             STRRET strFolderName;
             WCHAR szFolderName[MAX_PATH];
             RETURN_IF_FAILED(pArchiveShellFolder->GetDisplayNameOf(pidlChild.get(), SHGDN_INFOLDER | SHGDN_FORPARSING, &strFolderName));
             RETURN_IF_FAILED(StrRetToBuf(&strFolderName, pidlChild.get(), szFolderName, MAX_PATH));
-            RETURN_IF_FAILED(SHCreateItemWithParent(pidlFull.get(), pArchiveShellFolder.get(), pidlChild.get(), IID_PPV_ARGS(&pShellItemFrom)));
-            RETURN_IF_FAILED(pFileOperation->CopyItem(pShellItemFrom.get(), pShellItemTo.get(), NULL, NULL));
+            children.emplace_back(std::move(pidlChild));
+        }
+
+        size_t workerCount = std::min<size_t>(
+            { s_ExtractMaximumWorkers, std::thread::hardware_concurrency(), children.size() / s_ExtractMinimumEntriesPerWorker });
+
+        if (workerCount < 2)
+        {
+            std::vector<LPITEMIDLIST> entries;
+            entries.reserve(children.size());
+
+            for (const auto& child : children)
+            {
+                entries.emplace_back(child.get());
+            }
+
+            return ExtractEntries(archivePath, destPath, entries);
+        }
+
+        AICLI_LOG(Core, Info, << "Extracting " << children.size() << " top level archive entries using " << workerCount << " workers");
+
+        // Partition the entries round robin across the workers; ownership stays with this thread.
+        std::vector<std::vector<LPITEMIDLIST>> shares(workerCount);
+        for (size_t i = 0; i < children.size(); ++i)
+        {
+            shares[i % workerCount].emplace_back(children[i].get());
+        }
+
+        // The shell objects require an apartment, so each worker initializes its own STA,
+        // following the same arrangement as the attachment execution service usage.
+        std::vector<HRESULT> results(workerCount, S_OK);
+        std::vector<std::thread> threads;
+        threads.reserve(workerCount);
+
+        for (size_t t = 0; t < workerCount; ++t)
+        {
+            threads.emplace_back([&, t]()
+                {
+                    results[t] = CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED);
+                    if (FAILED(results[t]))
+                    {
+                        return;
+                    }
+
+                    results[t] = ExtractEntries(archivePath, destPath, shares[t]);
+                    CoUninitialize();
+                });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (HRESULT result : results)
+        {
+            RETURN_IF_FAILED(result);
         }
 
-        RETURN_IF_FAILED(pFileOperation->PerformOperations());
         return S_OK;
     }
 
@@ -68,12 +156,30 @@ namespace AppInstaller::Archive
         }
 #endif
 
-        std::ifstream instream{ zipPath, std::ios::in | std::ios::binary };
-        std::vector<uint8_t> data{ { std::istreambuf_iterator<char>{ instream } }, std::istreambuf_iterator<char>{} };
+        // Map the archive rather than copying it into a buffer; the scan directly follows the
+        // download, so the pages are typically still in the file cache and the scan makes no
+        // additional pass over the payload (nor a payload sized allocation).
+        wil::unique_handle file{ CreateFileW(zipPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+        THROW_LAST_ERROR_IF(!file);
+
+        LARGE_INTEGER fileSize{};
+        THROW_IF_WIN32_BOOL_FALSE(GetFileSizeEx(file.get(), &fileSize));
 
-        uint8_t* buffer = &data[0];
         uint64_t flag = 0;
-        int scanResult = pure_zip(buffer, data.size(), flag);
+
+        if (fileSize.QuadPart == 0)
+        {
+            uint8_t empty{};
+            return pure_zip(&empty, 0, flag) == 0;
+        }
+
+        wil::unique_handle mapping{ CreateFileMappingW(file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr) };
+        THROW_LAST_ERROR_IF(!mapping);
+
+        wil::unique_mapview_ptr<uint8_t> view{ reinterpret_cast<uint8_t*>(MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, 0)) };
+        THROW_LAST_ERROR_IF(!view);
+
+        int scanResult = pure_zip(view.get(), static_cast<size_t>(fileSize.QuadPart), flag);
 
         return scanResult == 0;
     }
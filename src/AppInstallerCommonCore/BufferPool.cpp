@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Public/AppInstallerBufferPool.h"
+
+#include <array>
+
+namespace AppInstaller::Utility
+{
+    namespace
+    {
+        // Buffers are pooled in power of two size classes within this range;
+        // requests outside of it are served by plain allocations.
+        constexpr size_t s_BufferPool_MinimumClassSize = 4 << 10; // 4KB
+        constexpr size_t s_BufferPool_ClassCount = 11;            // 4KB through 4MB
+        // Free buffers retained per size class; enough for the concurrent streaming
+        // paths without pinning a meaningful amount of memory at idle.
+        constexpr size_t s_BufferPool_MaximumFreePerClass = 4;
+
+        // The process wide pool behind AcquireBufferFromPool.
+        struct SizeClassedBufferPool
+        {
+            static SizeClassedBufferPool& Instance()
+            {
+                static SizeClassedBufferPool instance;
+                return instance;
+            }
+
+            // Returns the index of the smallest size class that fits the given size,
+            // or nullopt when the size is above the largest pooled class.
+            static std::optional<size_t> GetClassIndex(size_t size)
+            {
+                size_t classSize = s_BufferPool_MinimumClassSize;
+                for (size_t i = 0; i < s_BufferPool_ClassCount; ++i, classSize <<= 1)
+                {
+                    if (size <= classSize)
+                    {
+                        return i;
+                    }
+                }
+
+                return std::nullopt;
+            }
+
+            static size_t GetClassSize(size_t classIndex)
+            {
+                return s_BufferPool_MinimumClassSize << classIndex;
+            }
+
+            // Takes a free buffer of the given class, or null when none is pooled.
+            std::unique_ptr<uint8_t[]> Acquire(size_t classIndex)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+                auto& freeBuffers = m_freeBuffers[classIndex];
+                if (freeBuffers.empty())
+                {
+                    return {};
+                }
+
+                std::unique_ptr<uint8_t[]> result = std::move(freeBuffers.back());
+                freeBuffers.pop_back();
+                return result;
+            }
+
+            // Returns an allocation to the pool, dropping it when its size class
+            // is already at capacity or it is not a pooled size.
+            void Release(std::unique_ptr<uint8_t[]>&& data, size_t capacity)
+            {
+                auto classIndex = GetClassIndex(capacity);
+                if (!classIndex || GetClassSize(classIndex.value()) != capacity)
+                {
+                    return;
+                }
+
+                std::lock_guard<std::mutex> lock{ m_lock };
+                auto& freeBuffers = m_freeBuffers[classIndex.value()];
+                if (freeBuffers.size() < s_BufferPool_MaximumFreePerClass)
+                {
+                    freeBuffers.emplace_back(std::move(data));
+                }
+            }
+
+        private:
+            SizeClassedBufferPool() = default;
+
+            std::mutex m_lock;
+            std::array<std::vector<std::unique_ptr<uint8_t[]>>, s_BufferPool_ClassCount> m_freeBuffers;
+        };
+    }
+
+    PooledBuffer::~PooledBuffer()
+    {
+        if (m_data)
+        {
+            SizeClassedBufferPool::Instance().Release(std::move(m_data), m_capacity);
+        }
+    }
+
+    PooledBuffer AcquireBufferFromPool(size_t minimumSize)
+    {
+        PooledBuffer result;
+
+        auto classIndex = SizeClassedBufferPool::GetClassIndex(minimumSize);
+        if (classIndex)
+        {
+            result.m_capacity = SizeClassedBufferPool::GetClassSize(classIndex.value());
+            result.m_data = SizeClassedBufferPool::Instance().Acquire(classIndex.value());
+        }
+        else
+        {
+            result.m_capacity = minimumSize;
+        }
+
+        if (!result.m_data)
+        {
+            result.m_data = std::make_unique<uint8_t[]>(result.m_capacity);
+        }
+
+        return result;
+    }
+}
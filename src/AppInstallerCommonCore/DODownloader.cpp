@@ -141,6 +141,11 @@ namespace AppInstaller::Utility
                 SetProperty(DODownloadProperty_ForegroundPriority, foregroundPriority);
             }
 
+            void CostPolicy(DODownloadCostPolicy costPolicy)
+            {
+                SetProperty(DODownloadProperty_CostPolicy, static_cast<uint32_t>(costPolicy));
+            }
+
             void BlockingMode(bool blockingMode)
             {
                 SetProperty(DODownloadProperty_BlockingMode, blockingMode);
@@ -156,9 +161,8 @@ namespace AppInstaller::Utility
                 SetUnknownProperty(DODownloadProperty_StreamInterface, streamInterface);
             }
 
-            // Properties that may be interesting for future use:
+            // Other properties that may be interesting for future use:
             // https://docs.microsoft.com/en-us/windows/win32/delivery_optimization/deliveryoptimizationdownloadtypes/ne-deliveryoptimizationdownloadtypes-dodownloadproperty
-            //  - DODownloadProperty_CostPolicy :: Allow user to specify how to behave on metered networks
 
             void Start()
             {
@@ -338,6 +342,31 @@ namespace AppInstaller::Utility
         };
     }
 
+    namespace
+    {
+        // Maps the settings value to the Delivery Optimization client's enumeration.
+        DODownloadCostPolicy ConvertCostPolicy(Settings::DOCostPolicy costPolicy)
+        {
+            switch (costPolicy)
+            {
+            case Settings::DOCostPolicy::Always:
+                return DODownloadCostPolicy_Always;
+            case Settings::DOCostPolicy::Unrestricted:
+                return DODownloadCostPolicy_Unrestricted;
+            case Settings::DOCostPolicy::Standard:
+                return DODownloadCostPolicy_Standard;
+            case Settings::DOCostPolicy::NoRoaming:
+                return DODownloadCostPolicy_NoRoaming;
+            case Settings::DOCostPolicy::NoSurcharge:
+                return DODownloadCostPolicy_NoSurcharge;
+            case Settings::DOCostPolicy::NoCellular:
+                return DODownloadCostPolicy_NoCellular;
+            default:
+                THROW_HR(E_UNEXPECTED);
+            }
+        }
+    }
+
     // Debugging tip:
     // From an elevated PowerShell, run:
     // > Get-DeliveryOptimizationLog | Set-Content doLogs.txt
@@ -360,10 +389,18 @@ namespace AppInstaller::Utility
         THROW_IF_FAILED(DeliveryOptimization::DODownloadStatusCallback::Create(progress, &callback));
 
         download.Uri(url);
-        download.ForegroundPriority(true);
+        // Foreground priority favors this download's speed; fleets maximizing peer and
+        // cache server usage can set it to false to let downloads run as background work.
+        download.ForegroundPriority(Settings::User().Get<Settings::Setting::NetworkDOForegroundPriority>());
         download.LocalPath(dest);
         download.CallbackInterface(callback.get());
 
+        Settings::DOCostPolicy costPolicy = Settings::User().Get<Settings::Setting::NetworkDOCostPolicy>();
+        if (costPolicy != Settings::DOCostPolicy::Default)
+        {
+            download.CostPolicy(ConvertCostPolicy(costPolicy));
+        }
+
         if (info)
         {
             if (!info->DisplayName.empty())
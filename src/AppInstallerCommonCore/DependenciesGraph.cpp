@@ -26,9 +26,9 @@ namespace AppInstaller::Manifest
         m_toCheck = std::vector<Dependency>();
     }
 
-    void DependencyGraph::BuildGraph()
+    std::vector<Dependency> DependencyGraph::TakeNodesToEvaluate()
     {
-        if (!m_rootDependencyEvaluated) 
+        if (!m_rootDependencyEvaluated)
         {
             const DependencyList& rootDependencies = getDependencies(m_root);
             rootDependencies.ApplyToType(DependencyType::Package, [&](Dependency dependency)
@@ -40,26 +40,39 @@ namespace AppInstaller::Manifest
             m_rootDependencyEvaluated = true;
         }
 
-        if (m_toCheck.empty())
-        {
-            return;
-        }
+        std::vector<Dependency> result = std::move(m_toCheck);
+        m_toCheck.clear();
+        return result;
+    }
 
-        for (unsigned int i = 0; i < m_toCheck.size(); ++i)
-        {
-            auto node = m_toCheck.at(i);
+    std::vector<Dependency> DependencyGraph::Expand(const Dependency& node, const DependencyList& dependencies)
+    {
+        std::vector<Dependency> newNodes;
 
-            const auto& nodeDependencies = getDependencies(node);
-            nodeDependencies.ApplyToType(DependencyType::Package, [&](Dependency dependency)
+        dependencies.ApplyToType(DependencyType::Package, [&](Dependency dependency)
+            {
+                if (!HasNode(dependency))
                 {
-                    if (!HasNode(dependency))
-                    {
-                        m_toCheck.push_back(dependency);
-                        AddNode(dependency);
-                    }
+                    newNodes.push_back(dependency);
+                    AddNode(dependency);
+                }
 
-                    AddAdjacent(node, dependency);
-                });
+                AddAdjacent(node, dependency);
+            });
+
+        return newNodes;
+    }
+
+    void DependencyGraph::BuildGraph()
+    {
+        std::vector<Dependency> toCheck = TakeNodesToEvaluate();
+
+        for (size_t i = 0; i < toCheck.size(); ++i)
+        {
+            // Copy the node; Expand can grow the vector and invalidate references.
+            Dependency node = toCheck[i];
+            std::vector<Dependency> newNodes = Expand(node, getDependencies(node));
+            std::move(newNodes.begin(), newNodes.end(), std::back_inserter(toCheck));
         }
 
         CheckForLoopsAndGetOrder();
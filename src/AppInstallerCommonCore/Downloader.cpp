@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "pch.h"
+#include "Public/AppInstallerBufferPool.h"
 #include "Public/AppInstallerErrors.h"
 #include "Public/AppInstallerRuntime.h"
 #include "Public/AppInstallerDownloader.h"
@@ -20,6 +21,599 @@ using namespace AppInstaller::Filesystem;
 
 namespace AppInstaller::Utility
 {
+    namespace
+    {
+        // Minimum size at which a download is split into parallel range requests.
+        constexpr LONGLONG s_SegmentedDownload_MinimumFileSize = 128ll << 20; // 128MB
+        // Size of each ranged request.
+        constexpr LONGLONG s_SegmentedDownload_SegmentSize = 16ll << 20; // 16MB
+        // Number of concurrent connections used for ranged requests.
+        constexpr size_t s_SegmentedDownload_Connections = 4;
+        // Maximum number of segments ahead of the writer that may be buffered in memory.
+        constexpr LONGLONG s_SegmentedDownload_MaximumBufferedSegments = 8;
+
+        // Adaptive sizing for the single connection read loops. Reads start small so that
+        // small transfers and slow links never hold more memory than they can use; a stream
+        // that keeps delivering full buffers doubles the size until the maximum, which a
+        // fast link reaches within the first megabyte or so of the transfer.
+        constexpr DWORD s_Download_InitialBufferSize = 64 * 1024;
+        constexpr DWORD s_Download_MaximumBufferSize = 4 * 1024 * 1024;
+        // Number of consecutive full reads required before the buffer grows.
+        constexpr DWORD s_Download_GrowthFullReads = 2;
+
+        // Computes the download hash on its own thread, consuming completed buffers from a
+        // bounded ring queue so that network reads never stall behind BCrypt hashing.
+        // Buffers are recycled back to the producer to avoid allocation churn.
+        struct HashingPipeline
+        {
+            HashingPipeline() : m_thread(&HashingPipeline::Run, this) {}
+
+            ~HashingPipeline()
+            {
+                {
+                    std::lock_guard<std::mutex> lockScope(m_lock);
+                    m_done = true;
+                }
+                m_signal.notify_all();
+
+                if (m_thread.joinable())
+                {
+                    m_thread.join();
+                }
+            }
+
+            // Queues the first size bytes of the buffer for hashing, taking ownership of it.
+            // Blocks if the ring is full.
+            void Add(PooledBuffer&& buffer, DWORD size)
+            {
+                {
+                    std::unique_lock<std::mutex> lockScope(m_lock);
+                    m_signal.wait(lockScope, [&]() { return m_count < QueueCapacity; });
+
+                    m_ring[m_tail] = { std::move(buffer), size };
+                    m_tail = (m_tail + 1) % QueueCapacity;
+                    m_count++;
+                }
+                m_signal.notify_all();
+            }
+
+            // Gets a recycled buffer of at least bufferSize bytes if one is available,
+            // or acquires one from the pool. Buffers recycled from before the read
+            // buffer grew may be too small; those are simply dropped back to the pool.
+            PooledBuffer GetBuffer(size_t bufferSize)
+            {
+                {
+                    std::lock_guard<std::mutex> lockScope(m_lock);
+                    while (!m_freeBuffers.empty())
+                    {
+                        PooledBuffer result = std::move(m_freeBuffers.back());
+                        m_freeBuffers.pop_back();
+                        if (result.size() >= bufferSize)
+                        {
+                            return result;
+                        }
+                    }
+                }
+
+                return AcquireBufferFromPool(bufferSize);
+            }
+
+            // Waits for all queued buffers to be hashed and returns the hash.
+            std::vector<BYTE> Get()
+            {
+                {
+                    std::lock_guard<std::mutex> lockScope(m_lock);
+                    m_done = true;
+                }
+                m_signal.notify_all();
+                m_thread.join();
+
+                if (m_exception)
+                {
+                    std::rethrow_exception(m_exception);
+                }
+
+                return m_hashEngine.Get();
+            }
+
+        private:
+            static constexpr size_t QueueCapacity = 8;
+
+            struct Entry
+            {
+                PooledBuffer Buffer;
+                DWORD Size = 0;
+            };
+
+            void Run()
+            {
+                for (;;)
+                {
+                    Entry entry;
+
+                    {
+                        std::unique_lock<std::mutex> lockScope(m_lock);
+                        m_signal.wait(lockScope, [&]() { return m_count > 0 || m_done; });
+
+                        if (m_count == 0)
+                        {
+                            break;
+                        }
+
+                        entry = std::move(m_ring[m_head]);
+                        m_head = (m_head + 1) % QueueCapacity;
+                        m_count--;
+                    }
+                    m_signal.notify_all();
+
+                    if (!m_exception)
+                    {
+                        try
+                        {
+                            m_hashEngine.Add(entry.Buffer.get(), entry.Size);
+                        }
+                        catch (...)
+                        {
+                            // Keep draining so the producer is never blocked; Get() rethrows.
+                            m_exception = std::current_exception();
+                        }
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lockScope(m_lock);
+                        m_freeBuffers.emplace_back(std::move(entry.Buffer));
+                    }
+                }
+            }
+
+            std::mutex m_lock;
+            std::condition_variable m_signal;
+            Entry m_ring[QueueCapacity];
+            size_t m_head = 0;
+            size_t m_tail = 0;
+            size_t m_count = 0;
+            bool m_done = false;
+            std::vector<PooledBuffer> m_freeBuffers;
+            SHA256 m_hashEngine;
+            std::exception_ptr m_exception;
+            std::thread m_thread;
+        };
+
+        // Maximum number of idle WinINet sessions kept for reuse.
+        constexpr size_t s_InternetSessionPool_MaximumIdleSessions = 4;
+
+        // Hands out WinINet sessions for reuse across downloads. WinINet caches the proxy
+        // decision (including WPAD auto-detection, which can cost hundreds of milliseconds
+        // on proxied networks) per session and resolved host names process wide, so reuse
+        // makes those costs one-time rather than per download. A cancellation closes the
+        // session that the download is using to abort its blocked calls, so a cancelled
+        // download's session simply never comes back to the pool.
+        struct InternetSessionPool
+        {
+            static InternetSessionPool& Instance()
+            {
+                static InternetSessionPool s_instance;
+                return s_instance;
+            }
+
+            wil::unique_hinternet Acquire()
+            {
+                {
+                    std::lock_guard<std::mutex> lockScope(m_lock);
+                    if (!m_idleSessions.empty())
+                    {
+                        wil::unique_hinternet result = std::move(m_idleSessions.back());
+                        m_idleSessions.pop_back();
+                        return result;
+                    }
+                }
+
+                auto agentWide = Utility::ConvertToUTF16(Runtime::GetDefaultUserAgent().get());
+                wil::unique_hinternet session(InternetOpen(
+                    agentWide.c_str(),
+                    INTERNET_OPEN_TYPE_PRECONFIG,
+                    NULL,
+                    NULL,
+                    0));
+                THROW_LAST_ERROR_IF_NULL_MSG(session, "InternetOpen() failed.");
+                return session;
+            }
+
+            void Return(wil::unique_hinternet&& session)
+            {
+                std::lock_guard<std::mutex> lockScope(m_lock);
+                if (m_idleSessions.size() < s_InternetSessionPool_MaximumIdleSessions)
+                {
+                    m_idleSessions.emplace_back(std::move(session));
+                }
+            }
+
+        private:
+            InternetSessionPool() = default;
+
+            std::mutex m_lock;
+            std::vector<wil::unique_hinternet> m_idleSessions;
+        };
+
+        // Holds a pooled session for the duration of a download, returning it to the pool
+        // on destruction unless cancellation closed it.
+        struct PooledInternetSession
+        {
+            PooledInternetSession() : m_session(InternetSessionPool::Instance().Acquire()) {}
+
+            ~PooledInternetSession()
+            {
+                if (m_session)
+                {
+                    InternetSessionPool::Instance().Return(std::move(m_session));
+                }
+            }
+
+            HINTERNET get() const { return m_session.get(); }
+
+            // Closes the session; used by cancellation to abort calls blocked on it.
+            void reset() { m_session.reset(); }
+
+        private:
+            wil::unique_hinternet m_session;
+        };
+
+        // Determines whether the server has advertised support for byte range requests.
+        bool ServerAcceptsByteRanges(HINTERNET urlFile)
+        {
+            wchar_t acceptRanges[64] = {};
+            DWORD cbAcceptRanges = sizeof(acceptRanges);
+            return HttpQueryInfo(urlFile, HTTP_QUERY_ACCEPT_RANGES, acceptRanges, &cbAcceptRanges, nullptr) &&
+                _wcsicmp(acceptRanges, L"bytes") == 0;
+        }
+
+        // The sidecar file that records the validator of a partial download, placed next to it.
+        std::filesystem::path GetResumeInfoPath(const std::filesystem::path& dest)
+        {
+            std::filesystem::path result = dest;
+            result += L".resume";
+            return result;
+        }
+
+        // Gets the validator (ETag, or Last-Modified when absent) of the response.
+        // Returns empty if the server provides neither, in which case a partial
+        // download cannot be safely resumed.
+        std::wstring GetResponseValidator(HINTERNET urlFile)
+        {
+            wchar_t validator[256] = {};
+            DWORD cbValidator = sizeof(validator);
+
+            if (HttpQueryInfo(urlFile, HTTP_QUERY_ETAG, validator, &cbValidator, nullptr))
+            {
+                return { validator };
+            }
+
+            cbValidator = sizeof(validator);
+            if (HttpQueryInfo(urlFile, HTTP_QUERY_LAST_MODIFIED, validator, &cbValidator, nullptr))
+            {
+                return { validator };
+            }
+
+            return {};
+        }
+
+        // Gets the validator of the partial download at the given path, if one can be resumed.
+        std::optional<std::wstring> ReadResumeValidator(const std::filesystem::path& dest)
+        {
+            std::filesystem::path infoPath = GetResumeInfoPath(dest);
+            if (!std::filesystem::exists(infoPath) || !std::filesystem::exists(dest) || std::filesystem::file_size(dest) == 0)
+            {
+                return std::nullopt;
+            }
+
+            std::ifstream stream{ infoPath, std::ifstream::binary };
+            std::string contents{ std::istreambuf_iterator<char>{ stream }, std::istreambuf_iterator<char>{} };
+            if (contents.empty())
+            {
+                return std::nullopt;
+            }
+
+            return Utility::ConvertToUTF16(contents);
+        }
+
+        void WriteResumeValidator(const std::filesystem::path& dest, const std::wstring& validator)
+        {
+            std::ofstream stream{ GetResumeInfoPath(dest), std::ofstream::binary | std::ofstream::trunc };
+            stream << Utility::ConvertToUTF8(validator);
+        }
+
+        void RemoveResumeInfo(const std::filesystem::path& dest)
+        {
+            std::filesystem::remove(GetResumeInfoPath(dest));
+        }
+
+        // Minimum transfer size for which the destination file is preallocated.
+        constexpr LONGLONG s_Preallocation_MinimumFileSize = 16LL << 20;
+
+        // Preallocates the destination file to its final size so that a large download lands
+        // in contiguous runs instead of growing the file one write at a time, and opens it
+        // with the sequential scan hint. The handle is held for the duration of the download;
+        // the file system reclaims any allocation beyond the written length when the last
+        // handle closes, so a failed download does not leave a bloated partial file behind.
+        // Best effort: preallocation failing never fails the download.
+        struct PreallocatedDownloadFile
+        {
+            PreallocatedDownloadFile(const std::filesystem::path& path, LONGLONG size)
+            {
+                if (size < s_Preallocation_MinimumFileSize)
+                {
+                    return;
+                }
+
+                m_file.reset(CreateFileW(
+                    path.c_str(),
+                    GENERIC_WRITE,
+                    FILE_SHARE_READ | FILE_SHARE_WRITE,
+                    nullptr,
+                    OPEN_EXISTING,
+                    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                    nullptr));
+                if (!m_file)
+                {
+                    LOG_LAST_ERROR_MSG("Failed to open download file for preallocation");
+                    return;
+                }
+
+                FILE_ALLOCATION_INFO allocationInfo{};
+                allocationInfo.AllocationSize.QuadPart = size;
+                LOG_IF_WIN32_BOOL_FALSE(SetFileInformationByHandle(m_file.get(), FileAllocationInfo, &allocationInfo, sizeof(allocationInfo)));
+            }
+
+        private:
+            wil::unique_hfile m_file;
+        };
+
+        // Downloads a single segment into the given buffer, whose size determines the range.
+        // Returns false if the download was cancelled before the segment completed.
+        bool DownloadSegment(HINTERNET session, const std::wstring& urlWide, LONGLONG begin, std::vector<BYTE>& buffer, IProgressCallback& progress)
+        {
+            std::wostringstream rangeStream;
+            rangeStream << L"Range: bytes=" << begin << L'-' << (begin + static_cast<LONGLONG>(buffer.size()) - 1);
+            std::wstring rangeHeader = rangeStream.str();
+
+            wil::unique_hinternet segmentFile(InternetOpenUrl(
+                session,
+                urlWide.c_str(),
+                rangeHeader.c_str(),
+                static_cast<DWORD>(rangeHeader.size()),
+                INTERNET_FLAG_IGNORE_REDIRECT_TO_HTTPS | INTERNET_FLAG_NO_CACHE_WRITE,
+                0));
+            if (!segmentFile)
+            {
+                // A cancellation closes the session, which fails every call derived from it.
+                if (progress.IsCancelled())
+                {
+                    return false;
+                }
+
+                THROW_LAST_ERROR_MSG("InternetOpenUrl() failed for segment.");
+            }
+
+            DWORD requestStatus = 0;
+            DWORD cbRequestStatus = sizeof(requestStatus);
+
+            if (!HttpQueryInfo(segmentFile.get(),
+                HTTP_QUERY_STATUS_CODE | HTTP_QUERY_FLAG_NUMBER,
+                &requestStatus,
+                &cbRequestStatus,
+                nullptr))
+            {
+                if (progress.IsCancelled())
+                {
+                    return false;
+                }
+
+                THROW_LAST_ERROR_MSG("Query segment request status failed.");
+            }
+
+            // Anything other than partial content means the server did not honor the range,
+            // and continuing would interleave full responses into the output.
+            if (requestStatus != HTTP_STATUS_PARTIAL_CONTENT)
+            {
+                AICLI_LOG(Core, Error, << "Segment request failed. Returned status: " << requestStatus);
+                THROW_HR_MSG(MAKE_HRESULT(SEVERITY_ERROR, FACILITY_HTTP, requestStatus), "Segment request status is not partial content.");
+            }
+
+            size_t bytesRead = 0;
+
+            while (bytesRead < buffer.size())
+            {
+                if (progress.IsCancelled())
+                {
+                    return false;
+                }
+
+                DWORD chunkRead = 0;
+                if (!InternetReadFile(
+                    segmentFile.get(),
+                    buffer.data() + bytesRead,
+                    static_cast<DWORD>(buffer.size() - bytesRead),
+                    &chunkRead))
+                {
+                    if (progress.IsCancelled())
+                    {
+                        return false;
+                    }
+
+                    THROW_LAST_ERROR_MSG("InternetReadFile() failed for segment.");
+                }
+
+                THROW_HR_IF(APPINSTALLER_CLI_ERROR_DOWNLOAD_SIZE_MISMATCH, chunkRead == 0);
+                bytesRead += chunkRead;
+            }
+
+            return true;
+        }
+
+        // Downloads the file using parallel range requests.
+        // Worker threads each pull the next segment index and download it into a buffer;
+        // the calling thread writes completed segments to the stream in order, which keeps
+        // hash computation and progress reporting identical to the single connection path.
+        std::optional<std::vector<BYTE>> WinINetDownloadSegmented(
+            HINTERNET session,
+            const std::wstring& urlWide,
+            LONGLONG contentLength,
+            std::ostream& dest,
+            IProgressCallback& progress,
+            bool computeHash)
+        {
+            const LONGLONG totalSegments = (contentLength + s_SegmentedDownload_SegmentSize - 1) / s_SegmentedDownload_SegmentSize;
+            const size_t connections = static_cast<size_t>(std::min<LONGLONG>(static_cast<LONGLONG>(s_SegmentedDownload_Connections), totalSegments));
+
+            AICLI_LOG(Core, Info, << "Downloading " << contentLength << " bytes as " << totalSegments << " segments over " << connections << " connections");
+
+            std::mutex lock;
+            std::condition_variable signal;
+            std::vector<std::optional<std::vector<BYTE>>> segments(static_cast<size_t>(totalSegments));
+            LONGLONG nextSegment = 0;
+            LONGLONG nextToWrite = 0;
+            size_t activeWorkers = connections;
+            bool stopped = false;
+            std::vector<std::exception_ptr> exceptions(connections);
+
+            auto worker = [&](size_t workerIndex)
+            {
+                try
+                {
+                    for (;;)
+                    {
+                        LONGLONG segment = 0;
+
+                        {
+                            std::unique_lock<std::mutex> lockScope(lock);
+                            // Limit the segments held in memory ahead of the writer.
+                            signal.wait(lockScope, [&]() {
+                                return stopped || nextSegment >= totalSegments || nextSegment < nextToWrite + s_SegmentedDownload_MaximumBufferedSegments; });
+
+                            if (stopped || nextSegment >= totalSegments || progress.IsCancelled())
+                            {
+                                break;
+                            }
+
+                            segment = nextSegment++;
+                        }
+
+                        LONGLONG begin = segment * s_SegmentedDownload_SegmentSize;
+                        std::vector<BYTE> buffer(static_cast<size_t>(std::min(s_SegmentedDownload_SegmentSize, contentLength - begin)));
+
+                        if (!DownloadSegment(session, urlWide, begin, buffer, progress))
+                        {
+                            break;
+                        }
+
+                        {
+                            std::lock_guard<std::mutex> lockScope(lock);
+                            segments[static_cast<size_t>(segment)] = std::move(buffer);
+                        }
+                        signal.notify_all();
+                    }
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lockScope(lock);
+                    stopped = true;
+                    exceptions[workerIndex] = std::current_exception();
+                }
+
+                {
+                    std::lock_guard<std::mutex> lockScope(lock);
+                    activeWorkers--;
+                }
+                signal.notify_all();
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(connections);
+            for (size_t i = 0; i < connections; ++i)
+            {
+                threads.emplace_back(worker, i);
+            }
+
+            SHA256 hashEngine;
+            LONGLONG bytesWritten = 0;
+
+            while (nextToWrite < totalSegments)
+            {
+                if (progress.IsCancelled())
+                {
+                    std::lock_guard<std::mutex> lockScope(lock);
+                    stopped = true;
+                    signal.notify_all();
+                    break;
+                }
+
+                std::vector<BYTE> segmentData;
+
+                {
+                    std::unique_lock<std::mutex> lockScope(lock);
+                    signal.wait(lockScope, [&]() {
+                        return stopped || activeWorkers == 0 || segments[static_cast<size_t>(nextToWrite)].has_value(); });
+
+                    if (!segments[static_cast<size_t>(nextToWrite)].has_value())
+                    {
+                        // A worker failed or the download was cancelled before this segment arrived.
+                        break;
+                    }
+
+                    segmentData = std::move(segments[static_cast<size_t>(nextToWrite)]).value();
+                    segments[static_cast<size_t>(nextToWrite)].reset();
+                    nextToWrite++;
+                }
+                signal.notify_all();
+
+                if (computeHash)
+                {
+                    hashEngine.Add(segmentData.data(), segmentData.size());
+                }
+
+                dest.write((char*)segmentData.data(), segmentData.size());
+                bytesWritten += static_cast<LONGLONG>(segmentData.size());
+                progress.OnProgress(bytesWritten, contentLength, ProgressType::Bytes);
+            }
+
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            // A cancellation closes the session out from under the workers, so any
+            // failures they recorded are side effects of it; report the cancellation.
+            if (progress.IsCancelled())
+            {
+                AICLI_LOG(Core, Info, << "Download cancelled.");
+                return {};
+            }
+
+            for (const std::exception_ptr& exception : exceptions)
+            {
+                if (exception)
+                {
+                    std::rethrow_exception(exception);
+                }
+            }
+
+            dest.flush();
+
+            THROW_HR_IF(APPINSTALLER_CLI_ERROR_DOWNLOAD_SIZE_MISMATCH, bytesWritten != contentLength);
+
+            std::vector<BYTE> result;
+            if (computeHash)
+            {
+                result = hashEngine.Get();
+                AICLI_LOG(Core, Info, << "Download hash: " << SHA256::ConvertToString(result));
+            }
+
+            AICLI_LOG(Core, Info, << "Download completed.");
+
+            return result;
+        }
+    }
+
     std::optional<std::vector<BYTE>> WinINetDownloadToStream(
         const std::string& url,
         std::ostream& dest,
@@ -32,14 +626,13 @@ namespace AppInstaller::Utility
 
         AICLI_LOG(Core, Info, << "WinINet downloading from url: " << url);
 
-        auto agentWide = Utility::ConvertToUTF16(Runtime::GetDefaultUserAgent().get());
-        wil::unique_hinternet session(InternetOpen(
-            agentWide.c_str(),
-            INTERNET_OPEN_TYPE_PRECONFIG,
-            NULL,
-            NULL,
-            0));
-        THROW_LAST_ERROR_IF_NULL_MSG(session, "InternetOpen() failed.");
+        PooledInternetSession session;
+
+        // Closing the session handle aborts any WinINet call blocked on a derived
+        // handle, so a cancellation takes effect immediately rather than at the next
+        // buffer boundary. Every failure below must therefore check for cancellation
+        // before treating it as an error.
+        auto cancellationFunction = progress.SetCancellationFunction([&session]() { session.reset(); });
 
         auto urlWide = Utility::ConvertToUTF16(url);
         wil::unique_hinternet urlFile(InternetOpenUrl(
@@ -49,17 +642,35 @@ namespace AppInstaller::Utility
             0,
             INTERNET_FLAG_IGNORE_REDIRECT_TO_HTTPS, // This allows http->https redirection
             0));
-        THROW_LAST_ERROR_IF_NULL_MSG(urlFile, "InternetOpenUrl() failed.");
+        if (!urlFile)
+        {
+            if (progress.IsCancelled())
+            {
+                AICLI_LOG(Core, Info, << "Download cancelled.");
+                return {};
+            }
+
+            THROW_LAST_ERROR_MSG("InternetOpenUrl() failed.");
+        }
 
         // Check http return status
         DWORD requestStatus = 0;
         DWORD cbRequestStatus = sizeof(requestStatus);
 
-        THROW_LAST_ERROR_IF_MSG(!HttpQueryInfo(urlFile.get(),
+        if (!HttpQueryInfo(urlFile.get(),
             HTTP_QUERY_STATUS_CODE | HTTP_QUERY_FLAG_NUMBER,
             &requestStatus,
             &cbRequestStatus,
-            nullptr), "Query download request status failed.");
+            nullptr))
+        {
+            if (progress.IsCancelled())
+            {
+                AICLI_LOG(Core, Info, << "Download cancelled.");
+                return {};
+            }
+
+            THROW_LAST_ERROR_MSG("Query download request status failed.");
+        }
 
         if (requestStatus != HTTP_STATUS_OK)
         {
@@ -81,11 +692,27 @@ namespace AppInstaller::Utility
             nullptr);
         AICLI_LOG(Core, Verbose, << "Download size: " << contentLength);
 
-        // Setup hash engine
-        SHA256 hashEngine;
+        // Large files run well below line rate on a single connection over high
+        // bandwidth-delay-product links; use parallel range requests when the server
+        // supports them.
+        if (contentLength >= s_SegmentedDownload_MinimumFileSize && ServerAcceptsByteRanges(urlFile.get()))
+        {
+            // Abandon the probe request; each segment opens its own connection.
+            urlFile.reset();
+            return WinINetDownloadSegmented(session.get(), urlWide, contentLength, dest, progress, computeHash);
+        }
+
+        // Setup hash engine on its own thread; hashing a completed buffer overlaps with
+        // reading the next one, so the network is never stalled behind BCrypt.
+        std::optional<HashingPipeline> hashPipeline;
+        if (computeHash)
+        {
+            hashPipeline.emplace();
+        }
 
-        const int bufferSize = 1024 * 1024; // 1MB
-        auto buffer = std::make_unique<BYTE[]>(bufferSize);
+        DWORD bufferSize = s_Download_InitialBufferSize;
+        DWORD consecutiveFullReads = 0;
+        PooledBuffer buffer = AcquireBufferFromPool(bufferSize);
 
         BOOL readSuccess = true;
         DWORD bytesRead = 0;
@@ -101,15 +728,43 @@ namespace AppInstaller::Utility
 
             readSuccess = InternetReadFile(urlFile.get(), buffer.get(), bufferSize, &bytesRead);
 
-            THROW_LAST_ERROR_IF_MSG(!readSuccess, "InternetReadFile() failed.");
-
-            if (computeHash)
+            if (!readSuccess)
             {
-                hashEngine.Add(buffer.get(), bytesRead);
+                if (progress.IsCancelled())
+                {
+                    AICLI_LOG(Core, Info, << "Download cancelled.");
+                    return {};
+                }
+
+                THROW_LAST_ERROR_MSG("InternetReadFile() failed.");
             }
 
             dest.write((char*)buffer.get(), bytesRead);
 
+            // The stream is outpacing the buffer when every read fills it; grow until the cap.
+            if (bytesRead == bufferSize && bufferSize < s_Download_MaximumBufferSize)
+            {
+                if (++consecutiveFullReads >= s_Download_GrowthFullReads)
+                {
+                    bufferSize = std::min(bufferSize * 2, s_Download_MaximumBufferSize);
+                    consecutiveFullReads = 0;
+                }
+            }
+            else
+            {
+                consecutiveFullReads = 0;
+            }
+
+            if (computeHash && bytesRead != 0)
+            {
+                hashPipeline->Add(std::move(buffer), bytesRead);
+                buffer = hashPipeline->GetBuffer(bufferSize);
+            }
+            else if (buffer.size() < bufferSize)
+            {
+                buffer = AcquireBufferFromPool(bufferSize);
+            }
+
             bytesDownloaded += bytesRead;
 
             if (bytesRead != 0)
@@ -130,7 +785,7 @@ namespace AppInstaller::Utility
         std::vector<BYTE> result;
         if (computeHash)
         {
-            result = hashEngine.Get();
+            result = hashPipeline->Get();
             AICLI_LOG(Core, Info, << "Download hash: " << SHA256::ConvertToString(result));
         }
 
@@ -141,6 +796,259 @@ namespace AppInstaller::Utility
         return result;
     }
 
+    // Downloads to the given file path, resuming a previous partial download when possible.
+    // The validator of the response is persisted next to the partial file; a retry requests
+    // the remainder with a Range header qualified by If-Range, so an unchanged resource
+    // continues where the connection dropped while a changed one is transparently restarted
+    // from the beginning. The hash engine cannot checkpoint its state across processes, so
+    // on resume the bytes already on disk are fed back through it at disk speed, which is
+    // still far cheaper than downloading them again.
+    std::optional<std::vector<BYTE>> WinINetDownloadToFile(
+        const std::string& url,
+        const std::filesystem::path& dest,
+        IProgressCallback& progress,
+        bool computeHash)
+    {
+        AICLI_LOG(Core, Info, << "WinINet downloading from url: " << url);
+
+        PooledInternetSession session;
+
+        // Closing the session handle aborts any WinINet call blocked on a derived
+        // handle, making cancellation immediate; failures below must check for
+        // cancellation before being treated as errors.
+        auto cancellationFunction = progress.SetCancellationFunction([&session]() { session.reset(); });
+
+        std::optional<std::wstring> resumeValidator = ReadResumeValidator(dest);
+        LONGLONG resumeOffset = resumeValidator ? static_cast<LONGLONG>(std::filesystem::file_size(dest)) : 0;
+
+        std::wstring headers;
+        if (resumeOffset)
+        {
+            AICLI_LOG(Core, Info, << "Found partial download of " << resumeOffset << " bytes; attempting resume");
+            std::wostringstream headerStream;
+            headerStream << L"Range: bytes=" << resumeOffset << L"-\r\nIf-Range: " << resumeValidator.value();
+            headers = headerStream.str();
+        }
+
+        auto urlWide = Utility::ConvertToUTF16(url);
+        wil::unique_hinternet urlFile(InternetOpenUrl(
+            session.get(),
+            urlWide.c_str(),
+            headers.empty() ? NULL : headers.c_str(),
+            static_cast<DWORD>(headers.size()),
+            INTERNET_FLAG_IGNORE_REDIRECT_TO_HTTPS, // This allows http->https redirection
+            0));
+        if (!urlFile)
+        {
+            if (progress.IsCancelled())
+            {
+                AICLI_LOG(Core, Info, << "Download cancelled.");
+                return {};
+            }
+
+            THROW_LAST_ERROR_MSG("InternetOpenUrl() failed.");
+        }
+
+        DWORD requestStatus = 0;
+        DWORD cbRequestStatus = sizeof(requestStatus);
+
+        if (!HttpQueryInfo(urlFile.get(),
+            HTTP_QUERY_STATUS_CODE | HTTP_QUERY_FLAG_NUMBER,
+            &requestStatus,
+            &cbRequestStatus,
+            nullptr))
+        {
+            if (progress.IsCancelled())
+            {
+                AICLI_LOG(Core, Info, << "Download cancelled.");
+                return {};
+            }
+
+            THROW_LAST_ERROR_MSG("Query download request status failed.");
+        }
+
+        // If-Range downgrades a stale or unsupported range request to a full response,
+        // so OK here simply means the download starts over.
+        bool resuming = (resumeOffset != 0 && requestStatus == HTTP_STATUS_PARTIAL_CONTENT);
+
+        if (requestStatus != HTTP_STATUS_OK && !resuming)
+        {
+            AICLI_LOG(Core, Error, << "Download request failed. Returned status: " << requestStatus);
+            THROW_HR_MSG(MAKE_HRESULT(SEVERITY_ERROR, FACILITY_HTTP, requestStatus), "Download request status is not success.");
+        }
+
+        // Get content length. Don't fail the download if failed.
+        LONGLONG contentLength = 0;
+        DWORD cbContentLength = sizeof(contentLength);
+
+        HttpQueryInfo(
+            urlFile.get(),
+            HTTP_QUERY_CONTENT_LENGTH | HTTP_QUERY_FLAG_NUMBER64,
+            &contentLength,
+            &cbContentLength,
+            nullptr);
+
+        if (!resuming)
+        {
+            resumeOffset = 0;
+
+            // Recreate the target so that the mark of the web is applied before any
+            // content arrives, and record the validator for a potential later resume.
+            std::filesystem::remove(dest);
+            std::ofstream emptyDestFile(dest);
+            emptyDestFile.close();
+            ApplyMotwIfApplicable(dest, URLZONE_INTERNET);
+
+            std::wstring validator = GetResponseValidator(urlFile.get());
+            if (!validator.empty())
+            {
+                WriteResumeValidator(dest, validator);
+            }
+            else
+            {
+                RemoveResumeInfo(dest);
+            }
+
+            // Large files run well below line rate on a single connection; use parallel
+            // range requests when the server supports them, as the stream path does.
+            if (contentLength >= s_SegmentedDownload_MinimumFileSize && ServerAcceptsByteRanges(urlFile.get()))
+            {
+                urlFile.reset();
+
+                PreallocatedDownloadFile preallocation{ dest, contentLength };
+                std::ofstream outfile(dest, std::ofstream::binary | std::ofstream::app);
+                auto result = WinINetDownloadSegmented(session.get(), urlWide, contentLength, outfile, progress, computeHash);
+                if (result)
+                {
+                    RemoveResumeInfo(dest);
+                }
+                return result;
+            }
+        }
+
+        const LONGLONG totalLength = (contentLength > 0 ? contentLength + resumeOffset : 0);
+        AICLI_LOG(Core, Verbose, << "Download size: " << totalLength << (resuming ? " (resuming)" : ""));
+
+        PreallocatedDownloadFile preallocation{ dest, totalLength };
+
+        std::optional<HashingPipeline> hashPipeline;
+        if (computeHash)
+        {
+            hashPipeline.emplace();
+        }
+
+        DWORD bufferSize = s_Download_InitialBufferSize;
+        DWORD consecutiveFullReads = 0;
+        PooledBuffer buffer = AcquireBufferFromPool(bufferSize);
+
+        if (computeHash && resuming)
+        {
+            // Replay the bytes already on disk through the hash engine; the disk delivers
+            // full buffers immediately, so start at the cap rather than ramping up.
+            bufferSize = s_Download_MaximumBufferSize;
+            buffer = AcquireBufferFromPool(bufferSize);
+
+            std::ifstream existing{ dest, std::ifstream::binary };
+            while (existing)
+            {
+                existing.read(reinterpret_cast<char*>(buffer.get()), bufferSize);
+                std::streamsize read = existing.gcount();
+                if (read <= 0)
+                {
+                    break;
+                }
+
+                hashPipeline->Add(std::move(buffer), static_cast<DWORD>(read));
+                buffer = hashPipeline->GetBuffer(bufferSize);
+            }
+        }
+
+        std::ofstream outfile(dest, std::ofstream::binary | std::ofstream::app);
+
+        BOOL readSuccess = true;
+        DWORD bytesRead = 0;
+        LONGLONG bytesDownloaded = resumeOffset;
+
+        do
+        {
+            if (progress.IsCancelled())
+            {
+                AICLI_LOG(Core, Info, << "Download cancelled.");
+                outfile.flush();
+                return {};
+            }
+
+            readSuccess = InternetReadFile(urlFile.get(), buffer.get(), bufferSize, &bytesRead);
+
+            if (!readSuccess)
+            {
+                if (progress.IsCancelled())
+                {
+                    AICLI_LOG(Core, Info, << "Download cancelled.");
+                    outfile.flush();
+                    return {};
+                }
+
+                THROW_LAST_ERROR_MSG("InternetReadFile() failed.");
+            }
+
+            outfile.write(reinterpret_cast<char*>(buffer.get()), bytesRead);
+
+            // The stream is outpacing the buffer when every read fills it; grow until the cap.
+            if (bytesRead == bufferSize && bufferSize < s_Download_MaximumBufferSize)
+            {
+                if (++consecutiveFullReads >= s_Download_GrowthFullReads)
+                {
+                    bufferSize = std::min(bufferSize * 2, s_Download_MaximumBufferSize);
+                    consecutiveFullReads = 0;
+                }
+            }
+            else
+            {
+                consecutiveFullReads = 0;
+            }
+
+            if (computeHash && bytesRead != 0)
+            {
+                hashPipeline->Add(std::move(buffer), bytesRead);
+                buffer = hashPipeline->GetBuffer(bufferSize);
+            }
+            else if (buffer.size() < bufferSize)
+            {
+                buffer = AcquireBufferFromPool(bufferSize);
+            }
+
+            bytesDownloaded += bytesRead;
+
+            if (bytesRead != 0)
+            {
+                progress.OnProgress(bytesDownloaded, totalLength, ProgressType::Bytes);
+            }
+
+        } while (bytesRead != 0);
+
+        outfile.flush();
+
+        // Check download size matches if content length is provided in response header
+        if (contentLength > 0)
+        {
+            THROW_HR_IF(APPINSTALLER_CLI_ERROR_DOWNLOAD_SIZE_MISMATCH, bytesDownloaded - resumeOffset != contentLength);
+        }
+
+        RemoveResumeInfo(dest);
+
+        std::vector<BYTE> result;
+        if (computeHash)
+        {
+            result = hashPipeline->Get();
+            AICLI_LOG(Core, Info, << "Download hash: " << SHA256::ConvertToString(result));
+        }
+
+        AICLI_LOG(Core, Info, << "Download completed.");
+
+        return result;
+    }
+
     std::optional<std::vector<BYTE>> DownloadToStream(
         const std::string& url,
         std::ostream& dest,
@@ -189,6 +1097,8 @@ namespace AppInstaller::Utility
                     {
                         ApplyMotwIfApplicable(dest, URLZONE_INTERNET);
                     }
+                    // Any resume information from an earlier WinINet attempt is now stale.
+                    RemoveResumeInfo(dest);
                     return result;
                 }
                 catch (const wil::ResultException& re)
@@ -210,21 +1120,16 @@ namespace AppInstaller::Utility
 
                 // If we reach this point, we are intending to fall through to WinINet.
                 // Remove any file that may have been placed in the target location.
+                // DO managed the partial content itself, so it cannot be resumed here.
                 if (std::filesystem::exists(dest))
                 {
                     std::filesystem::remove(dest);
                 }
+                RemoveResumeInfo(dest);
             }
         }
 
-        std::ofstream emptyDestFile(dest);
-        emptyDestFile.close();
-        ApplyMotwIfApplicable(dest, URLZONE_INTERNET);
-
-        // Use std::ofstream::app to append to previous empty file so that it will not
-        // create a new file and clear motw.
-        std::ofstream outfile(dest, std::ofstream::binary | std::ofstream::app);
-        return WinINetDownloadToStream(url, outfile, progress, computeHash);
+        return WinINetDownloadToFile(url, dest, progress, computeHash);
     }
 
     using namespace std::string_view_literals;
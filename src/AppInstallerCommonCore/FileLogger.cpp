@@ -17,6 +17,9 @@ namespace AppInstaller::Logging
     static constexpr std::string_view s_fileLoggerDefaultFilePrefix = "WinGet"sv;
     static constexpr std::string_view s_fileLoggerDefaultFileExt = ".log"sv;
 
+    // The maximum number of records waiting for the writer thread before logging callers block.
+    static constexpr size_t s_fileLoggerMaximumQueueLength = 2048;
+
     FileLogger::FileLogger() : FileLogger(s_fileLoggerDefaultFilePrefix) {}
 
     FileLogger::FileLogger(const std::filesystem::path& filePath)
@@ -24,6 +27,7 @@ namespace AppInstaller::Logging
         m_name = GetNameForPath(filePath);
         m_filePath = filePath;
         OpenFileLoggerStream();
+        m_writerThread = std::thread(&FileLogger::WriterThread, this);
     }
 
     FileLogger::FileLogger(const std::string_view fileNamePrefix)
@@ -32,10 +36,29 @@ namespace AppInstaller::Logging
         m_filePath = Runtime::GetPathTo(Runtime::PathName::DefaultLogLocation);
         m_filePath /= fileNamePrefix.data() + ('-' + Utility::GetCurrentTimeForFilename() + s_fileLoggerDefaultFileExt.data());
         OpenFileLoggerStream();
+        m_writerThread = std::thread(&FileLogger::WriterThread, this);
     }
 
     FileLogger::~FileLogger()
     {
+        {
+            std::lock_guard<std::mutex> lock{ m_queueLock };
+            m_stopping = true;
+        }
+        m_queueCondition.notify_all();
+
+        if (m_writerThread.joinable())
+        {
+            m_writerThread.join();
+        }
+
+        // If BeginShutdown already stopped the writer thread, records logged after
+        // that point are still queued; write them here.
+        for (const std::string& record : m_queue)
+        {
+            m_stream << record << '\n';
+        }
+
         m_stream.flush();
     }
 
@@ -62,10 +85,11 @@ namespace AppInstaller::Logging
 
     void FileLogger::Write(Channel channel, Level, std::string_view message) noexcept try
     {
-        // Send to a string first to create a single block to write to a file.
+        // Format on the calling thread so the record carries the caller's timestamp;
+        // the file I/O itself happens on the writer thread.
         std::stringstream strstr;
         strstr << std::chrono::system_clock::now() << " [" << std::setw(GetMaxChannelNameLength()) << std::left << std::setfill(' ') << GetChannelName(channel) << "] " << message;
-        m_stream << strstr.str() << std::endl;
+        EnqueueRecord(strstr.str());
     }
     catch (...)
     {
@@ -74,7 +98,74 @@ namespace AppInstaller::Logging
 
     void FileLogger::WriteDirect(Channel, Level, std::string_view message) noexcept try
     {
-        m_stream << message << std::endl;
+        EnqueueRecord(std::string{ message });
+    }
+    catch (...)
+    {
+        // Just eat any exceptions here; better than losing logs
+    }
+
+    void FileLogger::BeginShutdown() noexcept try
+    {
+        // Stop the writer thread now; it drains the queue and flushes before exiting,
+        // so the destructor at process teardown finds the file already written.
+        // The thread is joined by the destructor as usual.
+        {
+            std::lock_guard<std::mutex> lock{ m_queueLock };
+            m_stopping = true;
+        }
+        m_queueCondition.notify_all();
+    }
+    catch (...)
+    {
+        // Just eat any exceptions here; better than losing logs
+    }
+
+    void FileLogger::EnqueueRecord(std::string&& record)
+    {
+        {
+            std::unique_lock<std::mutex> lock{ m_queueLock };
+
+            // Block rather than drop records if the writer has fallen this far behind.
+            // The capacity check is waived during shutdown so the caller cannot wait forever.
+            m_queueCondition.wait(lock, [this]() { return m_stopping || m_queue.size() < s_fileLoggerMaximumQueueLength; });
+
+            m_queue.emplace_back(std::move(record));
+        }
+
+        m_queueCondition.notify_all();
+    }
+
+    void FileLogger::WriterThread() try
+    {
+        std::deque<std::string> writeBatch;
+
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock{ m_queueLock };
+                m_queueCondition.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+
+                if (m_queue.empty())
+                {
+                    // Stopping and fully drained.
+                    return;
+                }
+
+                // Take the entire queue so that file writes happen outside of the lock.
+                m_queue.swap(writeBatch);
+            }
+
+            m_queueCondition.notify_all();
+
+            for (const std::string& record : writeBatch)
+            {
+                m_stream << record << '\n';
+            }
+
+            writeBatch.clear();
+            m_stream.flush();
+        }
     }
     catch (...)
     {
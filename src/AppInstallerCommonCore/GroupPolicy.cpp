@@ -10,17 +10,83 @@ namespace AppInstaller::Settings
 {
     namespace
     {
+        constexpr std::string_view s_PoliciesKeyPath = "Software\\Policies\\Microsoft\\Windows\\AppInstaller"sv;
+
+        // How often the registry is checked for policy changes.
+        constexpr auto s_PolicyStampCheckInterval = std::chrono::seconds{ 1 };
+
+        // Gets a stamp for the current policy state from the registry write times of the
+        // policies key and of the sub-keys that hold list policies; any policy change
+        // moves one of them forward.
+        int64_t GetPolicyStamp(const Registry::Key& key)
+        {
+            if (!key)
+            {
+                return 0;
+            }
+
+            try
+            {
+                int64_t result = key.LastWriteTime();
+
+                for (const auto& subKeyName : { details::ValuePolicyMapping<ValuePolicy::AdditionalSources>::KeyName, details::ValuePolicyMapping<ValuePolicy::AllowedSources>::KeyName })
+                {
+                    auto subKey = key.SubKey(subKeyName);
+                    if (subKey)
+                    {
+                        result = std::max(result, subKey->LastWriteTime());
+                    }
+                }
+
+                return result;
+            }
+            catch (...)
+            {
+                AICLI_LOG(Core, Warning, << "Failed to get the policy registry stamp");
+                return 0;
+            }
+        }
+
         const GroupPolicy& InstanceInternal(std::optional<GroupPolicy*> overridePolicy = {})
         {
-            const static GroupPolicy s_groupPolicy{ Registry::Key::OpenIfExists(HKEY_LOCAL_MACHINE, "Software\\Policies\\Microsoft\\Windows\\AppInstaller") };
+            // Keep every snapshot alive so that references handed out before a policy change
+            // remain valid; policy changes are rare enough that the cost does not matter.
+            static std::vector<std::unique_ptr<GroupPolicy>> s_snapshots;
+            static int64_t s_snapshotStamp = 0;
+            static std::chrono::steady_clock::time_point s_nextStampCheck{};
             static GroupPolicy* s_override = nullptr;
+            static std::mutex s_lock;
+
+            std::lock_guard<std::mutex> lock{ s_lock };
 
             if (overridePolicy.has_value())
             {
                 s_override = overridePolicy.value();
             }
 
-            return (s_override ? *s_override : s_groupPolicy);
+            if (s_override)
+            {
+                return *s_override;
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            if (s_snapshots.empty() || now >= s_nextStampCheck)
+            {
+                Registry::Key key = Registry::Key::OpenIfExists(HKEY_LOCAL_MACHINE, s_PoliciesKeyPath);
+                int64_t stamp = GetPolicyStamp(key);
+
+                // Unchanged policy state costs only the write time reads above.
+                if (s_snapshots.empty() || stamp != s_snapshotStamp)
+                {
+                    AICLI_LOG(Core, Info, << (s_snapshots.empty() ? "Loading Group Policy state" : "Group Policy state changed; reloading"));
+                    s_snapshots.emplace_back(std::make_unique<GroupPolicy>(key));
+                    s_snapshotStamp = stamp;
+                }
+
+                s_nextStampCheck = now + s_PolicyStampCheckInterval;
+            }
+
+            return *s_snapshots.back();
         }
 
         std::optional<Registry::Value> GetRegistryValueObject(const Registry::Key& key, const std::string_view valueName)
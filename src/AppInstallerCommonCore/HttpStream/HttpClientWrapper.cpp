@@ -144,9 +144,6 @@ namespace AppInstaller::Utility::HttpStream
         const UINT32 requestedSizeInBytes,
         const InputStreamOptions& options)
     {
-        std::vector<byte> byteArray(requestedSizeInBytes);
-        IBuffer buffer = CryptographicBuffer::CreateFromByteArray(byteArray);
-
         co_return co_await SendHttpRequestAsync(startPosition, requestedSizeInBytes);
     }
 }
\ No newline at end of file
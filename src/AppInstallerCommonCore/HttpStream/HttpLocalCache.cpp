@@ -27,9 +27,24 @@ namespace AppInstaller::Utility::HttpStream
         std::vector<ULONG64> unsatisfiablePages;
         FindCachePages(requestedPosition, requestedSize, allPages, unsatisfiablePages);
 
+        // Grow the read-ahead window while the consumer is reading sequentially, so that a scan
+        // through the package (the central directory walk or extracting the index) is satisfied
+        // by a few large requests instead of one request per page. A seek resets the window.
+        if (requestedPosition != m_nextSequentialPosition)
+        {
+            m_readAheadPages = 0U;
+        }
+        else if (!unsatisfiablePages.empty())
+        {
+            m_readAheadPages = std::min(std::max(m_readAheadPages * 2U, 1U), MAX_READ_AHEAD_PAGES);
+        }
+
+        winrt::check_hresult(ULong64Add(requestedPosition, requestedSize, &m_nextSequentialPosition));
+
         // download the missing pages
         co_await DownloadAndSaveToCacheAsync(
             unsatisfiablePages,
+            m_readAheadPages,
             httpClientWrapper,
             httpInputStreamOptions);
 
@@ -147,6 +162,7 @@ namespace AppInstaller::Utility::HttpStream
     // If the requested size is 0, this method returns an empty buffer without making HTTP calls
     std::future<void> HttpLocalCache::DownloadAndSaveToCacheAsync(
         const std::vector<ULONG64> unsatisfiablePages,
+        const UINT32 readAheadPages,
         HttpClientWrapper* httpClientWrapper,
         InputStreamOptions httpInputStreamOptions)
     {
@@ -165,6 +181,19 @@ namespace AppInstaller::Utility::HttpStream
             ULONG64 lastUnsatisfiableJob = unsatisfiablePages[unsatisfiablePages.size() - 1];
             winrt::check_hresult(ULong64Add(lastUnsatisfiableJob, PAGE_SIZE, &downloadJobEndPosition));
 
+            // Extend the job with read-ahead pages, stopping at the first page that is
+            // already cached or at the end of the file.
+            for (UINT32 i = 0; i < readAheadPages; i++)
+            {
+                if (downloadJobEndPosition >= fileSize ||
+                    m_localCache.find(downloadJobEndPosition) != m_localCache.end())
+                {
+                    break;
+                }
+
+                winrt::check_hresult(ULong64Add(downloadJobEndPosition, PAGE_SIZE, &downloadJobEndPosition));
+            }
+
             // make sure to not overflow file size
             downloadJobEndPosition = std::min(downloadJobEndPosition, fileSize);
             winrt::check_hresult(ULong64Sub(downloadJobEndPosition, downloadJobStartPosition, &downloadJobSize));
@@ -18,8 +18,9 @@ namespace AppInstaller::Utility::HttpStream
     class HttpLocalCache
     {
     public:
-        const UINT32 PAGE_SIZE = 2 << 16;   // each entry in the cache is 64 KB
-        const UINT32 MAX_PAGES = 200;       // cache size capped at 12.5 MB (200 * 64KB)
+        const UINT32 PAGE_SIZE = 2 << 16;       // each entry in the cache is 128 KB
+        const UINT32 MAX_PAGES = 200;           // cache size capped at 25 MB (200 * 128KB)
+        const UINT32 MAX_READ_AHEAD_PAGES = 8;  // sequential read-ahead capped at 1 MB (8 * 128KB)
 
         // Returns a buffer matching the requested range by reading the parts of the range that are cached
         // and downloading the rest using the provided httpClientWrapper object
@@ -33,6 +34,11 @@ namespace AppInstaller::Utility::HttpStream
         std::map<ULONG64, CachedPage> m_localCache;
         UINT32 m_accessCounter = 0U;
 
+        // Read-ahead state; the window grows while reads arrive in sequential order
+        // and resets whenever the consumer seeks elsewhere.
+        ULONG64 m_nextSequentialPosition = 0U;
+        UINT32 m_readAheadPages = 0U;
+
         // Returns a vector of all pages corresponding to a range, and another (subset)
         // vector of the pages missing from the cache.
         void FindCachePages(
@@ -49,6 +55,7 @@ namespace AppInstaller::Utility::HttpStream
 
         std::future<void> DownloadAndSaveToCacheAsync(
             const std::vector<ULONG64> unsatisfiablePages,
+            const UINT32 readAheadPages,
             HttpClientWrapper* httpClientWrapper,
             const winrt::Windows::Storage::Streams::InputStreamOptions httpInputStreamOptions);
 
@@ -5,6 +5,8 @@
 #include "AppInstallerStrings.h"
 #include "AppInstallerLogging.h"
 
+#include <map>
+
 namespace AppInstaller::Locale
 {
     namespace
@@ -79,45 +81,83 @@ namespace AppInstaller::Locale
         return TRUE;
     }
 
-    double GetDistanceOfLanguage(std::string_view target, std::string_view available)
+    namespace
     {
-        // Before new SDK is released, we need to use LoadLibrary/GetProcAddress
-        InitializeBcp47Module();
-
-        if (g_bcp47 == nullptr)
+        double ComputeDistanceOfLanguage(std::string_view target, std::string_view available)
         {
-            // Didn't find an implementation. Just return 0 as no match.
-            AICLI_LOG(Core, Warning, << "bcp47 module not found.");
+            // Before new SDK is released, we need to use LoadLibrary/GetProcAddress
+            InitializeBcp47Module();
+
+            if (g_bcp47 == nullptr)
+            {
+                // Didn't find an implementation. Just return 0 as no match.
+                AICLI_LOG(Core, Warning, << "bcp47 module not found.");
+                return 0;
+            }
+
+            GetDistanceOfClosestLanguageInListFunc func =
+                (GetDistanceOfClosestLanguageInListFunc)(GetProcAddress(g_bcp47, "GetDistanceOfClosestLanguageInList"));
+            if (func != nullptr)
+            {
+                double distance = 0;
+                auto wTarget = Utility::ConvertToUTF16(target);
+                auto wAvailable = Utility::ConvertToUTF16(available);
+
+                // Do not check HRESULT because the method returns ERROR_NO_MATCH on no match, which is a valid case.
+                (void)func(wTarget.c_str(), wAvailable.c_str(), L';' /* Not used, we compare one at a time */, &distance);
+                return distance;
+            }
+
+            // Should not reach here.
             return 0;
         }
+    }
+
+    double GetDistanceOfLanguage(std::string_view target, std::string_view available)
+    {
+        // Locale selection queries the distance of the same small set of tags for every
+        // manifest whose localization is applied; memoize the system API's answers.
+        static std::mutex s_distanceCacheLock;
+        static std::map<std::pair<std::string, std::string>, double> s_distanceCache;
+
+        std::pair<std::string, std::string> key{ std::string{ target }, std::string{ available } };
 
-        GetDistanceOfClosestLanguageInListFunc func =
-            (GetDistanceOfClosestLanguageInListFunc)(GetProcAddress(g_bcp47, "GetDistanceOfClosestLanguageInList"));
-        if (func != nullptr)
         {
-            double distance = 0;
-            auto wTarget = Utility::ConvertToUTF16(target);
-            auto wAvailable = Utility::ConvertToUTF16(available);
+            std::lock_guard<std::mutex> lock{ s_distanceCacheLock };
+            auto itr = s_distanceCache.find(key);
+            if (itr != s_distanceCache.end())
+            {
+                return itr->second;
+            }
+        }
 
-            // Do not check HRESULT because the method returns ERROR_NO_MATCH on no match, which is a valid case.
-            (void)func(wTarget.c_str(), wAvailable.c_str(), L';' /* Not used, we compare one at a time */, &distance);
-            return distance;
+        double result = ComputeDistanceOfLanguage(target, available);
+
+        {
+            std::lock_guard<std::mutex> lock{ s_distanceCacheLock };
+            s_distanceCache.emplace(std::move(key), result);
         }
 
-        // Should not reach here.
-        return 0;
+        return result;
     }
 
     std::vector<std::string> GetUserPreferredLanguages()
     {
-        std::vector<std::string> result;
-
-        for (const auto& lang : winrt::Windows::System::UserProfile::GlobalizationPreferences::Languages())
+        // Reading the preference list is a WinRT call and it is made for every manifest
+        // whose localization is applied; capture it once per process.
+        static std::vector<std::string> s_languages = []()
         {
-            result.emplace_back(Utility::ConvertToUTF8(lang));
-        }
+            std::vector<std::string> result;
 
-        return result;
+            for (const auto& lang : winrt::Windows::System::UserProfile::GlobalizationPreferences::Languages())
+            {
+                result.emplace_back(Utility::ConvertToUTF8(lang));
+            }
+
+            return result;
+        }();
+
+        return s_languages;
     }
 
     std::string LocaleIdToBcp47Tag(LCID localeId)
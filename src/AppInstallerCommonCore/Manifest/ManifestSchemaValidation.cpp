@@ -96,80 +96,98 @@ namespace AppInstaller::Manifest::YamlParser
 
             return result;
         }
-    }
-
-    Json::Value LoadSchemaDoc(const ManifestVer& manifestVersion, ManifestTypeEnum manifestType)
-    {
-        int idx = MANIFESTSCHEMA_NO_RESOURCE;
-        std::map<ManifestTypeEnum, int> resourceMap;
 
-        if (manifestVersion >= ManifestVer{ s_ManifestVersionV1_5 })
-        {
-            resourceMap = {
-                { ManifestTypeEnum::Singleton, IDX_MANIFEST_SCHEMA_V1_5_SINGLETON },
-                { ManifestTypeEnum::Version, IDX_MANIFEST_SCHEMA_V1_5_VERSION },
-                { ManifestTypeEnum::Installer, IDX_MANIFEST_SCHEMA_V1_5_INSTALLER },
-                { ManifestTypeEnum::DefaultLocale, IDX_MANIFEST_SCHEMA_V1_5_DEFAULTLOCALE },
-                { ManifestTypeEnum::Locale, IDX_MANIFEST_SCHEMA_V1_5_LOCALE },
-            };
-        }
-        else if (manifestVersion >= ManifestVer{ s_ManifestVersionV1_4 })
-        {
-            resourceMap = {
-                { ManifestTypeEnum::Singleton, IDX_MANIFEST_SCHEMA_V1_4_SINGLETON },
-                { ManifestTypeEnum::Version, IDX_MANIFEST_SCHEMA_V1_4_VERSION },
-                { ManifestTypeEnum::Installer, IDX_MANIFEST_SCHEMA_V1_4_INSTALLER },
-                { ManifestTypeEnum::DefaultLocale, IDX_MANIFEST_SCHEMA_V1_4_DEFAULTLOCALE },
-                { ManifestTypeEnum::Locale, IDX_MANIFEST_SCHEMA_V1_4_LOCALE },
-            };
-        }
-        else if (manifestVersion >= ManifestVer{ s_ManifestVersionV1_2 })
-        {
-            resourceMap = {
-                { ManifestTypeEnum::Singleton, IDX_MANIFEST_SCHEMA_V1_2_SINGLETON },
-                { ManifestTypeEnum::Version, IDX_MANIFEST_SCHEMA_V1_2_VERSION },
-                { ManifestTypeEnum::Installer, IDX_MANIFEST_SCHEMA_V1_2_INSTALLER },
-                { ManifestTypeEnum::DefaultLocale, IDX_MANIFEST_SCHEMA_V1_2_DEFAULTLOCALE },
-                { ManifestTypeEnum::Locale, IDX_MANIFEST_SCHEMA_V1_2_LOCALE },
-            };
-        }
-        else if (manifestVersion >= ManifestVer{ s_ManifestVersionV1_1 })
-        {
-            resourceMap = {
-                { ManifestTypeEnum::Singleton, IDX_MANIFEST_SCHEMA_V1_1_SINGLETON },
-                { ManifestTypeEnum::Version, IDX_MANIFEST_SCHEMA_V1_1_VERSION },
-                { ManifestTypeEnum::Installer, IDX_MANIFEST_SCHEMA_V1_1_INSTALLER },
-                { ManifestTypeEnum::DefaultLocale, IDX_MANIFEST_SCHEMA_V1_1_DEFAULTLOCALE },
-                { ManifestTypeEnum::Locale, IDX_MANIFEST_SCHEMA_V1_1_LOCALE },
-            };
-        }
-        else if (manifestVersion >= ManifestVer{ s_ManifestVersionV1 })
+        int GetSchemaResourceIndex(const ManifestVer& manifestVersion, ManifestTypeEnum manifestType)
         {
-            resourceMap = {
-                { ManifestTypeEnum::Singleton, IDX_MANIFEST_SCHEMA_V1_SINGLETON },
-                { ManifestTypeEnum::Version, IDX_MANIFEST_SCHEMA_V1_VERSION },
-                { ManifestTypeEnum::Installer, IDX_MANIFEST_SCHEMA_V1_INSTALLER },
-                { ManifestTypeEnum::DefaultLocale, IDX_MANIFEST_SCHEMA_V1_DEFAULTLOCALE },
-                { ManifestTypeEnum::Locale, IDX_MANIFEST_SCHEMA_V1_LOCALE },
-            };
-        }
-        else
-        {
-            resourceMap = {
-                { ManifestTypeEnum::Preview, IDX_MANIFEST_SCHEMA_PREVIEW },
-            };
-        }
+            int idx = MANIFESTSCHEMA_NO_RESOURCE;
+            std::map<ManifestTypeEnum, int> resourceMap;
 
-        auto iter = resourceMap.find(manifestType);
-        if (iter != resourceMap.end())
-        {
-            idx = iter->second;
+            if (manifestVersion >= ManifestVer{ s_ManifestVersionV1_5 })
+            {
+                resourceMap = {
+                    { ManifestTypeEnum::Singleton, IDX_MANIFEST_SCHEMA_V1_5_SINGLETON },
+                    { ManifestTypeEnum::Version, IDX_MANIFEST_SCHEMA_V1_5_VERSION },
+                    { ManifestTypeEnum::Installer, IDX_MANIFEST_SCHEMA_V1_5_INSTALLER },
+                    { ManifestTypeEnum::DefaultLocale, IDX_MANIFEST_SCHEMA_V1_5_DEFAULTLOCALE },
+                    { ManifestTypeEnum::Locale, IDX_MANIFEST_SCHEMA_V1_5_LOCALE },
+                };
+            }
+            else if (manifestVersion >= ManifestVer{ s_ManifestVersionV1_4 })
+            {
+                resourceMap = {
+                    { ManifestTypeEnum::Singleton, IDX_MANIFEST_SCHEMA_V1_4_SINGLETON },
+                    { ManifestTypeEnum::Version, IDX_MANIFEST_SCHEMA_V1_4_VERSION },
+                    { ManifestTypeEnum::Installer, IDX_MANIFEST_SCHEMA_V1_4_INSTALLER },
+                    { ManifestTypeEnum::DefaultLocale, IDX_MANIFEST_SCHEMA_V1_4_DEFAULTLOCALE },
+                    { ManifestTypeEnum::Locale, IDX_MANIFEST_SCHEMA_V1_4_LOCALE },
+                };
+            }
+            else if (manifestVersion >= ManifestVer{ s_ManifestVersionV1_2 })
+            {
+                resourceMap = {
+                    { ManifestTypeEnum::Singleton, IDX_MANIFEST_SCHEMA_V1_2_SINGLETON },
+                    { ManifestTypeEnum::Version, IDX_MANIFEST_SCHEMA_V1_2_VERSION },
+                    { ManifestTypeEnum::Installer, IDX_MANIFEST_SCHEMA_V1_2_INSTALLER },
+                    { ManifestTypeEnum::DefaultLocale, IDX_MANIFEST_SCHEMA_V1_2_DEFAULTLOCALE },
+                    { ManifestTypeEnum::Locale, IDX_MANIFEST_SCHEMA_V1_2_LOCALE },
+                };
+            }
+            else if (manifestVersion >= ManifestVer{ s_ManifestVersionV1_1 })
+            {
+                resourceMap = {
+                    { ManifestTypeEnum::Singleton, IDX_MANIFEST_SCHEMA_V1_1_SINGLETON },
+                    { ManifestTypeEnum::Version, IDX_MANIFEST_SCHEMA_V1_1_VERSION },
+                    { ManifestTypeEnum::Installer, IDX_MANIFEST_SCHEMA_V1_1_INSTALLER },
+                    { ManifestTypeEnum::DefaultLocale, IDX_MANIFEST_SCHEMA_V1_1_DEFAULTLOCALE },
+                    { ManifestTypeEnum::Locale, IDX_MANIFEST_SCHEMA_V1_1_LOCALE },
+                };
+            }
+            else if (manifestVersion >= ManifestVer{ s_ManifestVersionV1 })
+            {
+                resourceMap = {
+                    { ManifestTypeEnum::Singleton, IDX_MANIFEST_SCHEMA_V1_SINGLETON },
+                    { ManifestTypeEnum::Version, IDX_MANIFEST_SCHEMA_V1_VERSION },
+                    { ManifestTypeEnum::Installer, IDX_MANIFEST_SCHEMA_V1_INSTALLER },
+                    { ManifestTypeEnum::DefaultLocale, IDX_MANIFEST_SCHEMA_V1_DEFAULTLOCALE },
+                    { ManifestTypeEnum::Locale, IDX_MANIFEST_SCHEMA_V1_LOCALE },
+                };
+            }
+            else
+            {
+                resourceMap = {
+                    { ManifestTypeEnum::Preview, IDX_MANIFEST_SCHEMA_PREVIEW },
+                };
+            }
+
+            auto iter = resourceMap.find(manifestType);
+            if (iter != resourceMap.end())
+            {
+                idx = iter->second;
+            }
+            else
+            {
+                THROW_HR(HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED));
+            }
+
+            return idx;
         }
-        else
+
+        // Returns the process-lifetime compiled schema for the given manifest version and type.
+        // Keyed by schema resource index, so manifest versions that share a schema share the compiled copy.
+        const valijson::Schema& GetPopulatedSchema(const ManifestVer& manifestVersion, ManifestTypeEnum manifestType)
         {
-            THROW_HR(HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED));
+            int idx = GetSchemaResourceIndex(manifestVersion, manifestType);
+
+            return JsonSchema::GetCompiledSchema("manifest." + std::to_string(idx), [idx]()
+                {
+                    return JsonSchema::LoadSchemaDoc(Resource::GetResourceAsString(idx, MANIFESTSCHEMA_RESOURCE_TYPE));
+                });
         }
+    }
 
+    Json::Value LoadSchemaDoc(const ManifestVer& manifestVersion, ManifestTypeEnum manifestType)
+    {
+        int idx = GetSchemaResourceIndex(manifestVersion, manifestType);
         std::string_view schemaStr = Resource::GetResourceAsString(idx, MANIFESTSCHEMA_RESOURCE_TYPE);
         return JsonSchema::LoadSchemaDoc(schemaStr);
     }
@@ -177,21 +195,10 @@ namespace AppInstaller::Manifest::YamlParser
     std::vector<ValidationError> ValidateAgainstSchema(const std::vector<YamlManifestInfo>& manifestList, const ManifestVer& manifestVersion)
     {
         std::vector<ValidationError> errors;
-        // A list of schema validator to avoid multiple loadings of same schema
-        std::map<ManifestTypeEnum, valijson::Schema> schemaList;
 
         for (const auto& entry : manifestList)
         {
-            if (schemaList.find(entry.ManifestType) == schemaList.end())
-            {
-                // Copy constructor of valijson::Schema was private
-                valijson::Schema& newSchema = schemaList.emplace(
-                    std::piecewise_construct, std::make_tuple(entry.ManifestType), std::make_tuple()).first->second;
-                Json::Value schemaJson = LoadSchemaDoc(manifestVersion, entry.ManifestType);
-                JsonSchema::PopulateSchema(schemaJson, newSchema);
-            }
-
-            const auto& schema = schemaList.find(entry.ManifestType)->second;
+            const auto& schema = GetPopulatedSchema(manifestVersion, entry.ManifestType);
             Json::Value manifestJson = ManifestYamlNodeToJson(entry.Root);
             valijson::ValidationResults results;
 
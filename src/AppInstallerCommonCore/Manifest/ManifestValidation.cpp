@@ -8,6 +8,7 @@
 #include "winget/MsixManifestValidation.h"
 #include "winget/Locale.h"
 #include "winget/Filesystem.h"
+#include "winget/ThreadGlobals.h"
 
 namespace AppInstaller::Manifest
 {
@@ -388,12 +389,59 @@ namespace AppInstaller::Manifest
         std::vector<ValidationError> errors;
         auto validationErrorLevel = treatErrorAsWarning ? ValidationError::Level::Warning : ValidationError::Level::Error;
         MsixManifestValidation msixManifestValidation(validationErrorLevel);
+
+        // Installer msix or msixbundle
+        std::vector<const ManifestInstaller*> msixInstallers;
         for (const auto& installer : manifest.Installers)
         {
-            // Installer msix or msixbundle
             if (installer.EffectiveInstallerType() == InstallerTypeEnum::Msix)
             {
-                auto installerErrors = msixManifestValidation.Validate(manifest, installer);
+                msixInstallers.emplace_back(&installer);
+            }
+        }
+
+        if (msixInstallers.size() <= 1)
+        {
+            for (const auto* installer : msixInstallers)
+            {
+                auto installerErrors = msixManifestValidation.Validate(manifest, *installer);
+                std::move(installerErrors.begin(), installerErrors.end(), std::inserter(errors, errors.end()));
+            }
+        }
+        else
+        {
+            // Each installer's metadata read is dominated by fetching and parsing its signature
+            // and manifest, so validate the installers on parallel worker tasks. The appx readers
+            // are created per task; each worker enters the MTA for them.
+            AICLI_LOG(Core, Info, << "Validating " << msixInstallers.size() << " msix installers in parallel");
+
+            auto validateSingleInstaller = [&](const ManifestInstaller* installer, ThreadLocalStorage::ThreadGlobals* callerGlobals)
+            {
+                std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                if (callerGlobals)
+                {
+                    previousGlobals = callerGlobals->SetForCurrentThread();
+                }
+
+                HRESULT coInit = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+                auto coUninit = wil::scope_exit([coInit]() { if (SUCCEEDED(coInit)) { CoUninitialize(); } });
+
+                return msixManifestValidation.Validate(manifest, *installer);
+            };
+
+            ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+            std::vector<std::future<std::vector<ValidationError>>> tasks;
+            tasks.reserve(msixInstallers.size());
+            for (const auto* installer : msixInstallers)
+            {
+                tasks.emplace_back(std::async(std::launch::async, validateSingleInstaller, installer, callerGlobals));
+            }
+
+            // Collect in declaration order so that the error output remains deterministic.
+            for (auto& task : tasks)
+            {
+                auto installerErrors = task.get();
                 std::move(installerErrors.begin(), installerErrors.end(), std::inserter(errors, errors.end()));
             }
         }
@@ -643,13 +643,16 @@ namespace AppInstaller::Manifest
             const YAML::Node& valueNode = keyValuePair.second;
 
             // We'll do case insensitive search first and validate correct case later.
-            auto fieldIter = std::find_if(fieldInfos.begin(), fieldInfos.end(),
-                [&](auto const& s)
+            // The tables are sorted by lowered name, so a binary search on the lowered key
+            // replaces a linear scan with case insensitive compares per field.
+            std::string loweredKey = Utility::ToLower(key);
+            auto fieldIter = std::lower_bound(fieldInfos.begin(), fieldInfos.end(), loweredKey,
+                [](const FieldProcessInfo& info, const std::string& value)
                 {
-                    return Utility::CaseInsensitiveEquals(s.Name, key);
+                    return info.LoweredName < value;
                 });
 
-            if (fieldIter != fieldInfos.end())
+            if (fieldIter != fieldInfos.end() && fieldIter->LoweredName == loweredKey)
             {
                 const FieldProcessInfo& fieldInfo = *fieldIter;
 
@@ -873,24 +876,46 @@ namespace AppInstaller::Manifest
         m_validateOption = validateOption;
         m_isMergedManifest = !rootNode["ManifestType"sv].IsNull() && rootNode["ManifestType"sv].as<std::string>() == "merged";
 
+        // Reset state that a previous use of this populator may have left behind
+        m_p_installersNode = nullptr;
+        m_p_localizationsNode = nullptr;
+
         ValidationErrors resultErrors;
         manifest.ManifestVersion = manifestVersion;
 
-        // Prepare field infos
-        RootFieldInfos = GetRootFieldProcessInfo(manifestVersion);
-        InstallerFieldInfos = GetInstallerFieldProcessInfo(manifestVersion);
-        SwitchesFieldInfos = GetSwitchesFieldProcessInfo(manifestVersion);
-        ExpectedReturnCodesFieldInfos = GetExpectedReturnCodesFieldProcessInfo(manifestVersion);
-        DependenciesFieldInfos = GetDependenciesFieldProcessInfo(manifestVersion);
-        PackageDependenciesFieldInfos = GetPackageDependenciesFieldProcessInfo(manifestVersion);
-        LocalizationFieldInfos = GetLocalizationFieldProcessInfo(manifestVersion);
-        AgreementFieldInfos = GetAgreementFieldProcessInfo(manifestVersion);
-        MarketsFieldInfos = GetMarketsFieldProcessInfo(manifestVersion);
-        AppsAndFeaturesEntryFieldInfos = GetAppsAndFeaturesEntryFieldProcessInfo(manifestVersion);
-        DocumentationFieldInfos = GetDocumentationFieldProcessInfo(manifestVersion);
-        NestedInstallerFileFieldInfos = GetNestedInstallerFileFieldProcessInfo(manifestVersion);
-        InstallationMetadataFieldInfos = GetInstallationMetadataFieldProcessInfo(manifestVersion);
-        InstallationMetadataFilesFieldInfos = GetInstallationMetadataFilesFieldProcessInfo(manifestVersion);
+        // Prepare field infos; they depend only on the manifest version, so when the populator
+        // is reused for a run of manifests the tables are only rebuilt when the version changes.
+        if (m_fieldInfosManifestVersion != manifestVersion.ToString())
+        {
+            RootFieldInfos = GetRootFieldProcessInfo(manifestVersion);
+            InstallerFieldInfos = GetInstallerFieldProcessInfo(manifestVersion);
+            SwitchesFieldInfos = GetSwitchesFieldProcessInfo(manifestVersion);
+            ExpectedReturnCodesFieldInfos = GetExpectedReturnCodesFieldProcessInfo(manifestVersion);
+            DependenciesFieldInfos = GetDependenciesFieldProcessInfo(manifestVersion);
+            PackageDependenciesFieldInfos = GetPackageDependenciesFieldProcessInfo(manifestVersion);
+            LocalizationFieldInfos = GetLocalizationFieldProcessInfo(manifestVersion);
+            AgreementFieldInfos = GetAgreementFieldProcessInfo(manifestVersion);
+            MarketsFieldInfos = GetMarketsFieldProcessInfo(manifestVersion);
+            AppsAndFeaturesEntryFieldInfos = GetAppsAndFeaturesEntryFieldProcessInfo(manifestVersion);
+            DocumentationFieldInfos = GetDocumentationFieldProcessInfo(manifestVersion);
+            NestedInstallerFileFieldInfos = GetNestedInstallerFileFieldProcessInfo(manifestVersion);
+            InstallationMetadataFieldInfos = GetInstallationMetadataFieldProcessInfo(manifestVersion);
+            InstallationMetadataFilesFieldInfos = GetInstallationMetadataFilesFieldProcessInfo(manifestVersion);
+
+            // Sort each table by its lowered field name; ValidateAndProcessFields relies on
+            // this ordering to binary search instead of scanning every entry per key.
+            for (auto* fieldInfos : {
+                &RootFieldInfos, &InstallerFieldInfos, &SwitchesFieldInfos, &ExpectedReturnCodesFieldInfos,
+                &DependenciesFieldInfos, &PackageDependenciesFieldInfos, &LocalizationFieldInfos, &AgreementFieldInfos,
+                &MarketsFieldInfos, &AppsAndFeaturesEntryFieldInfos, &DocumentationFieldInfos, &NestedInstallerFileFieldInfos,
+                &InstallationMetadataFieldInfos, &InstallationMetadataFilesFieldInfos })
+            {
+                std::sort(fieldInfos->begin(), fieldInfos->end(),
+                    [](const FieldProcessInfo& a, const FieldProcessInfo& b) { return a.LoweredName < b.LoweredName; });
+            }
+
+            m_fieldInfosManifestVersion = manifestVersion.ToString();
+        }
 
         // Populate root
         m_p_manifest = &manifest;
@@ -1003,7 +1028,10 @@ namespace AppInstaller::Manifest
         const ManifestVer& manifestVersion,
         ManifestValidateOption validateOption)
     {
-        ManifestYamlPopulator manifestPopulator;
+        // Building the field process info tables allocates hundreds of small objects; manifests
+        // are parsed in bulk during index building and validation, so reuse a per-thread
+        // populator to amortize the table construction across the run.
+        thread_local ManifestYamlPopulator manifestPopulator;
         return manifestPopulator.PopulateManifestInternal(rootNode, manifest, manifestVersion, validateOption);
     }
 }
\ No newline at end of file
@@ -61,7 +61,10 @@ namespace AppInstaller::Manifest
                 auto tempFile = Runtime::GetNewTempFilePath();
                 ProgressCallback callback;
                 Utility::Download(installerUrl, tempFile, Utility::DownloadType::Installer, callback);
-                m_downloadedInstallers.push_back(tempFile);
+                {
+                    std::lock_guard<std::mutex> lock{ m_lock };
+                    m_downloadedInstallers.push_back(tempFile);
+                }
                 return tempFile;
             }
             catch (...)
@@ -116,29 +119,33 @@ namespace AppInstaller::Manifest
     {
         std::shared_ptr<Msix::MsixInfo> msixInfo;
         // Cache Msix info for new installer url
-        auto findMsixInfo = m_msixInfoCache.find(installerUrl);
-        if (findMsixInfo == m_msixInfoCache.end())
         {
-            msixInfo = GetMsixInfoFromUrl(installerUrl);
-            if (!msixInfo)
+            std::lock_guard<std::mutex> lock{ m_lock };
+            auto findMsixInfo = m_msixInfoCache.find(installerUrl);
+            if (findMsixInfo != m_msixInfoCache.end())
             {
-                AICLI_LOG(Core, Warning, << "Failed to get Msix info directly from the installer url. "
-                    << "Downloading installer instead.");
-                msixInfo = GetMsixInfoFromLocalPath(installerUrl);
+                return findMsixInfo->second;
             }
+        }
 
-            if (msixInfo)
-            {
-                m_msixInfoCache.insert({ installerUrl, msixInfo });
-            }
-            else
-            {
-                AICLI_LOG(Core, Error, << "Msix info could not be obtained.");
-            }
+        msixInfo = GetMsixInfoFromUrl(installerUrl);
+        if (!msixInfo)
+        {
+            AICLI_LOG(Core, Warning, << "Failed to get Msix info directly from the installer url. "
+                << "Downloading installer instead.");
+            msixInfo = GetMsixInfoFromLocalPath(installerUrl);
+        }
+
+        if (msixInfo)
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+            // Another worker may have fetched the same url while we did; keep the first one.
+            auto insertResult = m_msixInfoCache.insert({ installerUrl, msixInfo });
+            msixInfo = insertResult.first->second;
         }
         else
         {
-            msixInfo = findMsixInfo->second;
+            AICLI_LOG(Core, Error, << "Msix info could not be obtained.");
         }
 
         return msixInfo;
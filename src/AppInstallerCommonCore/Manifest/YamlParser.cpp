@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "AppInstallerSHA256.h"
+#include "winget/SharedThreadGlobals.h"
 #include "winget/Yaml.h"
 #include "winget/ManifestSchemaValidation.h"
 #include "winget/ManifestYamlPopulator.h"
@@ -11,6 +12,9 @@ namespace AppInstaller::Manifest::YamlParser
 {
     namespace
     {
+        // The maximum number of files of a multi file manifest parsed at once.
+        constexpr size_t s_MaximumConcurrentManifestParses = 4;
+
         // Basic V1 manifest required fields check for later manifest consistency check
         void ValidateV1ManifestInput(const YamlManifestInfo& entry)
         {
@@ -472,14 +476,73 @@ namespace AppInstaller::Manifest::YamlParser
         {
             if (std::filesystem::is_directory(inputPath))
             {
+                std::vector<std::filesystem::path> files;
                 for (const auto& file : std::filesystem::directory_iterator(inputPath))
                 {
                     THROW_HR_IF_MSG(HRESULT_FROM_WIN32(ERROR_DIRECTORY_NOT_SUPPORTED), std::filesystem::is_directory(file.path()), "Subdirectory not supported in manifest path");
+                    files.emplace_back(file.path());
+                }
 
-                    YamlManifestInfo doc;
-                    doc.Root = YAML::Load(file.path());
-                    doc.FileName = file.path().filename().u8string();
-                    docList.emplace_back(std::move(doc));
+                docList.resize(files.size());
+
+                auto loadFile = [&](size_t i)
+                    {
+                        docList[i].Root = YAML::Load(files[i]);
+                        docList[i].FileName = files[i].filename().u8string();
+                    };
+
+                // Each file of a multi file manifest is an independent document, and the parse
+                // cost dominates reading the directory; parse them with a bounded set of workers.
+                size_t threadCount = std::min<size_t>({ s_MaximumConcurrentManifestParses, files.size(), std::thread::hardware_concurrency() });
+                if (threadCount < 2)
+                {
+                    for (size_t i = 0; i < files.size(); ++i)
+                    {
+                        loadFile(i);
+                    }
+                }
+                else
+                {
+                    ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+                    std::vector<std::exception_ptr> exceptions(threadCount);
+                    std::vector<std::thread> threads;
+
+                    for (size_t t = 0; t < threadCount; ++t)
+                    {
+                        threads.emplace_back([&, t]()
+                            {
+                                std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                                if (callerGlobals)
+                                {
+                                    previousGlobals = callerGlobals->SetForCurrentThread();
+                                }
+
+                                try
+                                {
+                                    for (size_t i = t; i < files.size(); i += threadCount)
+                                    {
+                                        loadFile(i);
+                                    }
+                                }
+                                catch (...)
+                                {
+                                    exceptions[t] = std::current_exception();
+                                }
+                            });
+                    }
+
+                    for (auto& thread : threads)
+                    {
+                        thread.join();
+                    }
+
+                    for (const auto& exception : exceptions)
+                    {
+                        if (exception)
+                        {
+                            std::rethrow_exception(exception);
+                        }
+                    }
                 }
             }
             else
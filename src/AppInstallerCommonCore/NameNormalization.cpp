@@ -4,6 +4,7 @@
 #include "Public/winget/NameNormalization.h"
 #include "Public/AppInstallerStrings.h"
 #include "Public/winget/Regex.h"
+#include <winget/SharedThreadGlobals.h>
 
 
 namespace AppInstaller::Utility
@@ -239,47 +240,54 @@ namespace AppInstaller::Utility
 
             static constexpr Regex::Options reOptions = Regex::Options::CaseInsensitive;
 
+            // The expressions below are constant, so construction clones them from the
+            // compiled pattern cache rather than recompiling every one of them.
+            static Regex::Expression Cached(std::string_view pattern)
+            {
+                return Regex::Expression::CreateCached(pattern, reOptions);
+            }
+
             // Architecture
-            Regex::Expression ArchitectureX32{ R"((?<=^|[^\p{L}\p{Nd}])(X32|X86)(?=\P{Nd}|$)(?:\sEDITION)?)", reOptions };
-            Regex::Expression ArchitectureX64{ R"((?<=^|[^\p{L}\p{Nd}])(X64|AMD64|X86([\p{Pd}\p{Pc}]64))(?=\P{Nd}|$)(?:\sEDITION)?)", reOptions };
-            Regex::Expression Architecture32Bit{ R"((?<=^|[^\p{L}\p{Nd}])(32[\p{Pd}\p{Pc}\p{Z}]?BIT)S?(?:\sEDITION)?)", reOptions };
-            Regex::Expression Architecture64Bit{ R"((?<=^|[^\p{L}\p{Nd}])(64[\p{Pd}\p{Pc}\p{Z}]?BIT)S?(?:\sEDITION)?)", reOptions };
-            Regex::Expression Architecture32Or64Bit{ R"((?<=^|[^\p{L}\p{Nd}])((64[\\\/]32|32[\\\/]64)[\p{Pd}\p{Pc}\p{Z}]?BIT)S?(?:\sEDITION)?)", reOptions };
+            Regex::Expression ArchitectureX32 = Cached(R"((?<=^|[^\p{L}\p{Nd}])(X32|X86)(?=\P{Nd}|$)(?:\sEDITION)?)");
+            Regex::Expression ArchitectureX64 = Cached(R"((?<=^|[^\p{L}\p{Nd}])(X64|AMD64|X86([\p{Pd}\p{Pc}]64))(?=\P{Nd}|$)(?:\sEDITION)?)");
+            Regex::Expression Architecture32Bit = Cached(R"((?<=^|[^\p{L}\p{Nd}])(32[\p{Pd}\p{Pc}\p{Z}]?BIT)S?(?:\sEDITION)?)");
+            Regex::Expression Architecture64Bit = Cached(R"((?<=^|[^\p{L}\p{Nd}])(64[\p{Pd}\p{Pc}\p{Z}]?BIT)S?(?:\sEDITION)?)");
+            Regex::Expression Architecture32Or64Bit = Cached(R"((?<=^|[^\p{L}\p{Nd}])((64[\\\/]32|32[\\\/]64)[\p{Pd}\p{Pc}\p{Z}]?BIT)S?(?:\sEDITION)?)");
 
             // Locale
-            Regex::Expression Locale{ R"((?<![A-Z])((?:\p{Lu}{2,3}(-(CANS|CYRL|LATN|MONG))?-\p{Lu}{2})(?![A-Z])(?:-VALENCIA)?))", reOptions };
+            Regex::Expression Locale = Cached(R"((?<![A-Z])((?:\p{Lu}{2,3}(-(CANS|CYRL|LATN|MONG))?-\p{Lu}{2})(?![A-Z])(?:-VALENCIA)?))");
 
             // Specifically for SAP Business Objects programs
-            Regex::Expression SAPPackage{ R"(^(?:[\p{Lu}\p{Nd}]+[\._])+[\p{Lu}\p{Nd}]+(?:-(?:\p{Nd}+\.)+\p{Nd}+)(?:-(?:\p{Lu}{2}(?:_\p{Lu}{2})?|CORE))(?:-(?:\p{Lu}{2}|\p{Nd}{2}))$)", reOptions };
+            Regex::Expression SAPPackage = Cached(R"(^(?:[\p{Lu}\p{Nd}]+[\._])+[\p{Lu}\p{Nd}]+(?:-(?:\p{Nd}+\.)+\p{Nd}+)(?:-(?:\p{Lu}{2}(?:_\p{Lu}{2})?|CORE))(?:-(?:\p{Lu}{2}|\p{Nd}{2}))$)");
 
             // Extract KB numbers from their parens to preserve them
-            Regex::Expression KBNumbers{ R"(\((KB\d+)\))", reOptions };
-
-            Regex::Expression NonLettersAndDigits{ R"([^\p{L}\p{Nd}])", reOptions };
-            Regex::Expression NonLetterDigitOrSpace{ R"([^\p{L}\p{Nd}\s])", reOptions };
-            Regex::Expression URIProtocol{ R"((?<!\p{L})(?:http[s]?|ftp):\/\/)", reOptions }; // remove protocol from URIs
-
-            Regex::Expression VersionDelimited{ R"(((?<!\p{L})(?:V|VER|VERSI(?:O|Ó)N|VERSÃO|VERSIE|WERSJA|BUILD|RELEASE|RC|SP)\P{L}?)?\p{Nd}+([\p{Po}\p{Pd}\p{Pc}]\p{Nd}?(RC|B|A|R|SP|K)?\p{Nd}+)+([\p{Po}\p{Pd}\p{Pc}]?[\p{L}\p{Nd}]+)*)", reOptions };
-            Regex::Expression Version{ R"((FOR\s)?(?<!\p{L})(?:P|V|R|VER|VERSI(?:O|Ó)N|VERSÃO|VERSIE|WERSJA|BUILD|RELEASE|RC|SP)(?:\P{L}|\P{L}\p{L})?(\p{Nd}|\.\p{Nd})+(?:RC|B|A|R|V|SP)?\p{Nd}?)", reOptions };
-            Regex::Expression VersionLetter{ R"((?<!\p{L})(?:(?:V|VER|VERSI(?:O|Ó)N|VERSÃO|VERSIE|WERSJA|BUILD|RELEASE|RC|SP)\P{L})?\p{Lu}\p{Nd}+(?:[\p{Po}\p{Pd}\p{Pc}]\p{Nd}+)+)", reOptions };
-            Regex::Expression NonNestedBracket{ R"(\([^\(\)]*\)|\[[^\[\]]*\])", reOptions }; // remove things in parentheses, if there aren't parentheses nested inside
-            Regex::Expression BracketEnclosed{ R"((?:\p{Ps}.*\p{Pe}|".*"))", reOptions }; // Impossible to properly handle nested parens with regex
-            Regex::Expression LeadingSymbols{ R"(^[^\p{L}\p{Nd}]+)", reOptions }; // remove symbols at the beginning
-            Regex::Expression TrailingNonLetters{ R"(\P{L}+$)", reOptions }; // remove non-letters at the end
-            Regex::Expression PrefixParens{ R"(^\(.*?\))", reOptions }; // remove things in parentheses at the front of program names
-            Regex::Expression EmptyParens{ R"((\(\s*\)|\[\s*\]|"\s*"))", reOptions }; // remove appearances of (), [], and "", with any number of spaces within
-            Regex::Expression EN{ R"(\sEN\s*$)", reOptions }; // remove appearances of EN (represents English language) at the ends of program names
-            Regex::Expression TrailingSymbols{ R"([^\p{L}\p{Nd}]+$)", reOptions }; // remove all non-letter/numbers at the end
-            Regex::Expression FilePath{ R"(((INSTALLED\sAT|IN)\s)?[CDEF]:\\(.+?\\)*[^\s]*\\?)", reOptions }; // remove file paths
-            Regex::Expression FilePathGHS{ R"(\(CHANGE #\d{1,2} TO [CDEF]:\\(.+?\\)*[^\s]*\\?\))", reOptions }; // remove file paths in certain Green Hills Software program names
-            Regex::Expression FilePathParens{ R"(\([CDEF]:\\(.+?\\)*[^\s]*\\?\))", reOptions }; // remove file paths within parentheses
-            Regex::Expression FilePathQuotes{ R"("[CDEF]:\\(.+?\\)*[^\s]*\\?")", reOptions }; // remove file paths within quotes
-            Regex::Expression Roblox{ R"((?<=^ROBLOX\s(PLAYER|STUDIO))(\sFOR\s.*))", reOptions }; // for Roblox programs
-            Regex::Expression Bomgar{ R"((?<=^BOMGAR\s(JUMP CLIENT|(ACCESS|REPRESENTATIVE) CONSOLE|BUTTON)|^EMBEDDED CALLBACK)(\s.*))", reOptions }; // for Bomgar programs
-            Regex::Expression AcronymSeparators{ R"((?:(?<=^\p{L})|(?<=\P{L}\p{L}))(\.|\/)(?=\p{L}(?:\P{L}|$)))", reOptions };
-            Regex::Expression NonLetters{ R"((?<=^|\s)[^\p{L}]+(?=\s|$))", reOptions }; // remove all non-letters not attached to 
-            Regex::Expression ProgramNameSplit{ R"([^\p{L}\p{Nd}\+\&])", reOptions }; // used to separate 'words' in program names
-            Regex::Expression PublisherNameSplit{ R"([^\p{L}\p{Nd}])", reOptions }; // used to separate 'words' in publisher names
+            Regex::Expression KBNumbers = Cached(R"(\((KB\d+)\))");
+
+            Regex::Expression NonLettersAndDigits = Cached(R"([^\p{L}\p{Nd}])");
+            Regex::Expression NonLetterDigitOrSpace = Cached(R"([^\p{L}\p{Nd}\s])");
+            Regex::Expression URIProtocol = Cached(R"((?<!\p{L})(?:http[s]?|ftp):\/\/)"); // remove protocol from URIs
+
+            Regex::Expression VersionDelimited = Cached(R"(((?<!\p{L})(?:V|VER|VERSI(?:O|Ó)N|VERSÃO|VERSIE|WERSJA|BUILD|RELEASE|RC|SP)\P{L}?)?\p{Nd}+([\p{Po}\p{Pd}\p{Pc}]\p{Nd}?(RC|B|A|R|SP|K)?\p{Nd}+)+([\p{Po}\p{Pd}\p{Pc}]?[\p{L}\p{Nd}]+)*)");
+            Regex::Expression Version = Cached(R"((FOR\s)?(?<!\p{L})(?:P|V|R|VER|VERSI(?:O|Ó)N|VERSÃO|VERSIE|WERSJA|BUILD|RELEASE|RC|SP)(?:\P{L}|\P{L}\p{L})?(\p{Nd}|\.\p{Nd})+(?:RC|B|A|R|V|SP)?\p{Nd}?)");
+            Regex::Expression VersionLetter = Cached(R"((?<!\p{L})(?:(?:V|VER|VERSI(?:O|Ó)N|VERSÃO|VERSIE|WERSJA|BUILD|RELEASE|RC|SP)\P{L})?\p{Lu}\p{Nd}+(?:[\p{Po}\p{Pd}\p{Pc}]\p{Nd}+)+)");
+            Regex::Expression NonNestedBracket = Cached(R"(\([^\(\)]*\)|\[[^\[\]]*\])"); // remove things in parentheses, if there aren't parentheses nested inside
+            Regex::Expression BracketEnclosed = Cached(R"((?:\p{Ps}.*\p{Pe}|".*"))"); // Impossible to properly handle nested parens with regex
+            Regex::Expression LeadingSymbols = Cached(R"(^[^\p{L}\p{Nd}]+)"); // remove symbols at the beginning
+            Regex::Expression TrailingNonLetters = Cached(R"(\P{L}+$)"); // remove non-letters at the end
+            Regex::Expression PrefixParens = Cached(R"(^\(.*?\))"); // remove things in parentheses at the front of program names
+            Regex::Expression EmptyParens = Cached(R"((\(\s*\)|\[\s*\]|"\s*"))"); // remove appearances of (), [], and "", with any number of spaces within
+            Regex::Expression EN = Cached(R"(\sEN\s*$)"); // remove appearances of EN (represents English language) at the ends of program names
+            Regex::Expression TrailingSymbols = Cached(R"([^\p{L}\p{Nd}]+$)"); // remove all non-letter/numbers at the end
+            Regex::Expression FilePath = Cached(R"(((INSTALLED\sAT|IN)\s)?[CDEF]:\\(.+?\\)*[^\s]*\\?)"); // remove file paths
+            Regex::Expression FilePathGHS = Cached(R"(\(CHANGE #\d{1,2} TO [CDEF]:\\(.+?\\)*[^\s]*\\?\))"); // remove file paths in certain Green Hills Software program names
+            Regex::Expression FilePathParens = Cached(R"(\([CDEF]:\\(.+?\\)*[^\s]*\\?\))"); // remove file paths within parentheses
+            Regex::Expression FilePathQuotes = Cached(R"("[CDEF]:\\(.+?\\)*[^\s]*\\?")"); // remove file paths within quotes
+            Regex::Expression Roblox = Cached(R"((?<=^ROBLOX\s(PLAYER|STUDIO))(\sFOR\s.*))"); // for Roblox programs
+            Regex::Expression Bomgar = Cached(R"((?<=^BOMGAR\s(JUMP CLIENT|(ACCESS|REPRESENTATIVE) CONSOLE|BUTTON)|^EMBEDDED CALLBACK)(\s.*))"); // for Bomgar programs
+            Regex::Expression AcronymSeparators = Cached(R"((?:(?<=^\p{L})|(?<=\P{L}\p{L}))(\.|\/)(?=\p{L}(?:\P{L}|$)))");
+            Regex::Expression NonLetters = Cached(R"((?<=^|\s)[^\p{L}]+(?=\s|$))"); // remove all non-letters not attached to 
+            Regex::Expression ProgramNameSplit = Cached(R"([^\p{L}\p{Nd}\+\&])"); // used to separate 'words' in program names
+            Regex::Expression PublisherNameSplit = Cached(R"([^\p{L}\p{Nd}])"); // used to separate 'words' in publisher names
 
             const std::vector<Regex::Expression*> ProgramNameRegexes
             {
@@ -472,7 +480,7 @@ namespace AppInstaller::Utility
         };
     }
 
-    NameNormalizer::NameNormalizer(NormalizationVersion version)
+    NameNormalizer::NameNormalizer(NormalizationVersion version) : m_version(version)
     {
         switch (version)
         {
@@ -502,6 +510,74 @@ namespace AppInstaller::Utility
         return m_normalizer->NormalizePublisher(publisher);
     }
 
+    std::vector<NormalizedName> NameNormalizer::NormalizeBatch(const std::vector<std::pair<std::string, std::string>>& namesAndPublishers) const
+    {
+        // Below this size the cost of spinning up workers outweighs the normalization itself.
+        constexpr size_t minimumBatchSizeForParallel = 32;
+
+        std::vector<NormalizedName> result(namesAndPublishers.size());
+
+        size_t threadCount = std::min<size_t>(std::thread::hardware_concurrency(), namesAndPublishers.size() / (minimumBatchSizeForParallel / 2));
+
+        if (threadCount < 2 || namesAndPublishers.size() < minimumBatchSizeForParallel)
+        {
+            for (size_t i = 0; i < namesAndPublishers.size(); ++i)
+            {
+                result[i] = m_normalizer->Normalize(namesAndPublishers[i].first, namesAndPublishers[i].second);
+            }
+
+            return result;
+        }
+
+        std::vector<std::exception_ptr> exceptions(threadCount);
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+
+        ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+        for (size_t t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&, t]()
+                {
+                    std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                    if (callerGlobals)
+                    {
+                        previousGlobals = callerGlobals->SetForCurrentThread();
+                    }
+
+                    try
+                    {
+                        // Each worker gets its own internals since they hold mutable ICU state.
+                        NameNormalizer normalizer{ m_version };
+
+                        for (size_t i = t; i < namesAndPublishers.size(); i += threadCount)
+                        {
+                            result[i] = normalizer.Normalize(namesAndPublishers[i].first, namesAndPublishers[i].second);
+                        }
+                    }
+                    catch (...)
+                    {
+                        exceptions[t] = std::current_exception();
+                    }
+                });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (const std::exception_ptr& exception : exceptions)
+        {
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+        }
+
+        return result;
+    }
+
     std::string NormalizedName::GetNormalizedName(NormalizationField fieldsToInclude) const
     {
         std::string result = Name();
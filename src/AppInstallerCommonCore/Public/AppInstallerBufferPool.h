@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace AppInstaller::Utility
+{
+    struct PooledBuffer;
+
+    // Acquires a buffer of at least minimumSize bytes from the process wide pool,
+    // allocating a new one when no pooled buffer fits. The streaming paths acquire
+    // and release buffers at a high rate with only a handful alive at once;
+    // recycling the allocations keeps their steady state off the heap.
+    PooledBuffer AcquireBufferFromPool(size_t minimumSize);
+
+    // A transient I/O buffer drawn from the process wide pool.
+    // The allocation is returned to the pool when the buffer is destroyed.
+    struct PooledBuffer
+    {
+        PooledBuffer() = default;
+        ~PooledBuffer();
+
+        PooledBuffer(PooledBuffer&& other) noexcept { *this = std::move(other); }
+
+        PooledBuffer& operator=(PooledBuffer&& other) noexcept
+        {
+            std::swap(m_data, other.m_data);
+            std::swap(m_capacity, other.m_capacity);
+            return *this;
+        }
+
+        PooledBuffer(const PooledBuffer&) = delete;
+        PooledBuffer& operator=(const PooledBuffer&) = delete;
+
+        uint8_t* get() const { return m_data.get(); }
+
+        // The usable size of the allocation; at least the size that was requested.
+        size_t size() const { return m_capacity; }
+
+        explicit operator bool() const { return static_cast<bool>(m_data); }
+
+    private:
+        friend PooledBuffer AcquireBufferFromPool(size_t minimumSize);
+
+        std::unique_ptr<uint8_t[]> m_data;
+        size_t m_capacity = 0;
+    };
+}
@@ -3,10 +3,14 @@
 #pragma once
 #include <AppInstallerLogging.h>
 
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <thread>
 
 namespace AppInstaller::Logging
 {
@@ -22,8 +26,8 @@ namespace AppInstaller::Logging
         FileLogger(const FileLogger&) = delete;
         FileLogger& operator=(const FileLogger&) = delete;
 
-        FileLogger(FileLogger&&) = default;
-        FileLogger& operator=(FileLogger&&) = default;
+        FileLogger(FileLogger&&) = delete;
+        FileLogger& operator=(FileLogger&&) = delete;
 
         static std::string GetNameForPath(const std::filesystem::path& filePath);
 
@@ -37,6 +41,8 @@ namespace AppInstaller::Logging
 
         void WriteDirect(Channel channel, Level level, std::string_view message) noexcept override;
 
+        void BeginShutdown() noexcept override;
+
         // Adds a FileLogger to the current Log
         static void Add();
         static void Add(const std::filesystem::path& filePath);
@@ -51,6 +57,20 @@ namespace AppInstaller::Logging
         std::filesystem::path m_filePath;
         std::ofstream m_stream;
 
+        // Formatted records are queued here and written by the background thread,
+        // keeping the file I/O off of the logging call path.
+        std::mutex m_queueLock;
+        std::condition_variable m_queueCondition;
+        std::deque<std::string> m_queue;
+        bool m_stopping = false;
+        std::thread m_writerThread;
+
         void OpenFileLoggerStream();
+
+        // Queues the given record for the writer thread, waiting if the queue is at capacity.
+        void EnqueueRecord(std::string&& record);
+
+        // Writes queued records until stopped; drains the queue before exiting.
+        void WriterThread();
     };
 }
@@ -309,4 +309,28 @@ namespace AppInstaller::Logging
     private:
         DestructionToken m_token;
     };
+
+    // An RAII object that writes paired ETW activity events around a unit of work,
+    // so that tools like WPA can attribute wall clock time to individual workflow
+    // tasks on production machines. Writes nothing when no session has enabled the
+    // trace provider, keeping the cost negligible for normal runs.
+    struct TraceActivityScope
+    {
+        // The name identifies the span; the optional function address allows symbol
+        // resolution for tasks that are plain functions without a name.
+        TraceActivityScope(std::string_view name, const void* function = nullptr);
+
+        TraceActivityScope(const TraceActivityScope&) = delete;
+        TraceActivityScope& operator=(const TraceActivityScope&) = delete;
+
+        TraceActivityScope(TraceActivityScope&&) = delete;
+        TraceActivityScope& operator=(TraceActivityScope&&) = delete;
+
+        ~TraceActivityScope();
+
+    private:
+        GUID m_activityId = GUID_NULL;
+        std::string m_name;
+        bool m_active = false;
+    };
 }
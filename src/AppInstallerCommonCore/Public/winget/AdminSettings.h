@@ -28,4 +28,9 @@ namespace AppInstaller::Settings
     bool IsAdminSettingEnabled(AdminSetting setting);
 
     std::vector<AdminSetting> GetAllAdminSettings();
+
+#ifndef AICLI_DISABLE_TEST_HOOKS
+    // Drops the process wide snapshot of the admin settings so that the next query reloads it.
+    void ResetAdminSettingsCache();
+#endif
 }
@@ -13,6 +13,17 @@ namespace AppInstaller::Manifest
 
         DependencyGraph(const Dependency& root, std::function<const DependencyList(const Dependency&)> infoFunction);
 
+        // Returns the nodes discovered so far that have not yet been evaluated, clearing the
+        // internal list; evaluates the root's dependencies first if that has not happened yet.
+        // Callers driving their own evaluation pass each node's dependencies to Expand and keep
+        // evaluating the newly discovered nodes it returns until none remain, then call
+        // CheckForLoopsAndGetOrder.
+        std::vector<Dependency> TakeNodesToEvaluate();
+
+        // Records the dependencies of an evaluated node, adding the adjacencies and returning
+        // the dependencies that are new to the graph.
+        std::vector<Dependency> Expand(const Dependency& node, const DependencyList& dependencies);
+
         void BuildGraph();
 
         void AddNode(const Dependency& node);
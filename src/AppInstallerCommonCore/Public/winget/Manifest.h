@@ -72,4 +72,33 @@ namespace AppInstaller::Manifest
             std::function<const string_t& (const ManifestInstaller&)> extractStringFromInstaller = {},
             std::function<const string_t& (const AppsAndFeaturesEntry&)> extractStringFromAppsAndFeaturesEntry = {}) const;
     };
+
+    // A shared, immutable manifest. Copying the handle shares the underlying manifest,
+    // allowing contexts that operate on the same package to avoid copying the full
+    // manifest graph; Mutate clones it first if it is actually shared.
+    struct SharedManifest
+    {
+        SharedManifest() : m_manifest(std::make_shared<Manifest>()) {}
+        SharedManifest(Manifest&& manifest) : m_manifest(std::make_shared<Manifest>(std::move(manifest))) {}
+        SharedManifest(const Manifest& manifest) : m_manifest(std::make_shared<Manifest>(manifest)) {}
+
+        operator const Manifest&() const { return *m_manifest; }
+
+        const Manifest& Get() const { return *m_manifest; }
+
+        // Gets a mutable manifest, cloning the current one first if it is shared with
+        // another handle so that they do not observe the mutation.
+        Manifest& Mutate()
+        {
+            if (m_manifest.use_count() > 1)
+            {
+                m_manifest = std::make_shared<Manifest>(*m_manifest);
+            }
+
+            return *m_manifest;
+        }
+
+    private:
+        std::shared_ptr<Manifest> m_manifest;
+    };
 }
\ No newline at end of file
@@ -24,9 +24,12 @@ namespace AppInstaller::Manifest
         struct FieldProcessInfo
         {
             FieldProcessInfo(std::string name, std::function<std::vector<ValidationError>(const YAML::Node&)> func, bool requireVerifiedPublisher = false) :
-                Name(std::move(name)), ProcessFunc(func), RequireVerifiedPublisher(requireVerifiedPublisher) {}
+                Name(std::move(name)), LoweredName(Utility::ToLower(Name)), ProcessFunc(func), RequireVerifiedPublisher(requireVerifiedPublisher) {}
 
             std::string Name;
+            // The lowered name is the lookup key; the tables are kept sorted by it so that
+            // dispatch in ValidateAndProcessFields can binary search.
+            std::string LoweredName;
             std::function<std::vector<ValidationError>(const YAML::Node&)> ProcessFunc;
             bool RequireVerifiedPublisher = false;
         };
@@ -66,6 +69,9 @@ namespace AppInstaller::Manifest
         YAML::Node const* m_p_installersNode = nullptr;
         YAML::Node const* m_p_localizationsNode = nullptr;
 
+        // The manifest version that the field process info tables were built for; empty if not yet built.
+        std::string m_fieldInfosManifestVersion;
+
         std::vector<FieldProcessInfo> GetRootFieldProcessInfo(const ManifestVer& manifestVersion);
         std::vector<FieldProcessInfo> GetInstallerFieldProcessInfo(const ManifestVer& manifestVersion, bool forRootFields = false);
         std::vector<FieldProcessInfo> GetSwitchesFieldProcessInfo(const ManifestVer& manifestVersion);
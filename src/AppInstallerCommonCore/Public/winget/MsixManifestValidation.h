@@ -6,6 +6,8 @@
 #include "winget/Manifest.h"
 #include "winget/ManifestValidation.h"
 
+#include <mutex>
+
 namespace AppInstaller::Manifest
 {
     struct MsixManifestValidation
@@ -15,10 +17,12 @@ namespace AppInstaller::Manifest
         ~MsixManifestValidation();
 
         // Validate manifest for Msix packages and Msix bundles.
+        // Safe to call concurrently for different installers of the same manifest.
         std::vector<ValidationError> Validate(
             const Manifest& manifest,
             const ManifestInstaller& installer);
     private:
+        std::mutex m_lock;
         std::map<std::string, std::shared_ptr<Msix::MsixInfo>> m_msixInfoCache;
         std::vector<std::filesystem::path> m_downloadedInstallers;
         ValidationError::Level m_validationErrorLevel;
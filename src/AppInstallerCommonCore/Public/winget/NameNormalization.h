@@ -5,6 +5,8 @@
 
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 
 namespace AppInstaller::Utility
@@ -89,7 +91,13 @@ namespace AppInstaller::Utility
         NormalizedName NormalizeName(std::string_view name) const;
         std::string NormalizePublisher(std::string_view publisher) const;
 
+        // Normalizes all of the given name and publisher pairs, returning the results in the
+        // same order as the inputs. Large batches are partitioned across a bounded set of
+        // threads, each using its own normalizer internals since they hold mutable ICU state.
+        std::vector<NormalizedName> NormalizeBatch(const std::vector<std::pair<std::string, std::string>>& namesAndPublishers) const;
+
     private:
+        NormalizationVersion m_version;
         std::unique_ptr<details::INameNormalizer> m_normalizer;
     };
 }
@@ -23,6 +23,12 @@ namespace AppInstaller::Regex
         Expression();
         Expression(std::string_view pattern, Options options = Options::None);
 
+        // Gets an expression for the pattern, compiling it only the first time that the
+        // pattern is requested. The compiled pattern is kept in a process wide cache and
+        // the returned expression is an independent clone of the cached one, so callers
+        // do not need to synchronize their use of it.
+        static Expression CreateCached(std::string_view pattern, Options options = Options::None);
+
         Expression(const Expression&);
         Expression& operator=(const Expression&);
 
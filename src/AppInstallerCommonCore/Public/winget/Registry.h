@@ -3,6 +3,7 @@
 #pragma once
 #include <wil/resource.h>
 
+#include <map>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -80,12 +81,14 @@ namespace AppInstaller::Registry
 
     struct Key;
     struct ValueList;
+    struct ValueSnapshot;
 
     // A registry value.
     struct Value
     {
         friend Key;
         friend ValueList;
+        friend ValueSnapshot;
 
         // The type of data stored in the Value.
         enum class Type : DWORD
@@ -198,6 +201,33 @@ namespace AppInstaller::Registry
         wil::shared_hkey m_key;
     };
 
+    // An in-memory snapshot of all of the values under a key.
+    // A single enumeration pass reads the name and data of every value together, replacing
+    // the individual registry query that each lookup would otherwise cost; use it when most
+    // of the values of a key will be read.
+    struct ValueSnapshot
+    {
+        friend Key;
+
+        ValueSnapshot() = default;
+
+        // Gets the value with the given name, if it was present when the snapshot was taken.
+        // Names are matched case-insensitively, as the registry does.
+        std::optional<Value> operator[](std::string_view name) const;
+        std::optional<Value> operator[](const std::wstring& name) const;
+
+    private:
+        ValueSnapshot(const wil::shared_hkey& key);
+
+        // Case-insensitive name ordering to match registry semantics.
+        struct NameLess
+        {
+            bool operator()(const std::wstring& lhs, const std::wstring& rhs) const;
+        };
+
+        std::map<std::wstring, Value, NameLess> m_values;
+    };
+
     // A registry key.
     struct Key
     {
@@ -276,6 +306,16 @@ namespace AppInstaller::Registry
 
         ValueList Values() const;
 
+        // Reads all of the values of the key and returns them as an in-memory snapshot.
+        ValueSnapshot SnapshotValues() const;
+
+        // Gets the last write time of the key as a FILETIME value.
+        int64_t LastWriteTime() const;
+
+        // Gets the raw key handle, for use with registry APIs that the wrapper does not
+        // cover (e.g. change notifications). The handle remains owned by this object.
+        HKEY Handle() const { return m_key.get(); }
+
         operator bool() const { return m_key.operator bool(); }
 
         // Open a Key; will return an empty Key if the subkey does not exist.
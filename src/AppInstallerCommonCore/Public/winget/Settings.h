@@ -76,6 +76,12 @@ namespace AppInstaller::Settings
         constexpr static StreamDefinition BackupUserSettings{ Type::UserFile, "settings.json.backup"sv };
         // The admin settings.
         constexpr static StreamDefinition AdminSettings{ Type::Secure, "admin_settings"sv };
+        // The cache of validated user settings values.
+        constexpr static StreamDefinition UserSettingsCache{ Type::Standard, "user_settings_cache"sv };
+        // The cache of rest source information responses.
+        constexpr static StreamDefinition RestSourceInformationCache{ Type::Standard, "rest_source_information_cache"sv };
+        // The journal of completed packages from an interrupted import run.
+        constexpr static StreamDefinition ImportJournal{ Type::Standard, "import_journal"sv };
 
         // Gets a Stream for the StreamDefinition.
         // If the stream is synchronized, attempts to Set the value can fail due to another writer
@@ -6,6 +6,26 @@
 #include <AppInstallerTelemetry.h>
 #include <mutex>
 
+// Set to 1 to account heap allocations made through the global new/delete operators and
+// report each workflow task's allocation delta and peak to the diagnostic log. This makes
+// the task that balloons memory during large operations visible without taking full dumps.
+// For locally instrumented builds only; keep set to 0 in committed code.
+#define WINGET_MEMORY_ACCOUNTING_ENABLED 0
+
+#if WINGET_MEMORY_ACCOUNTING_ENABLED
+namespace AppInstaller::MemoryAccounting
+{
+    // Gets the bytes currently allocated and not yet freed, process wide.
+    int64_t GetCurrentUsage();
+
+    // Gets the highest value that the current usage has reached since the last reset.
+    int64_t GetHighWaterMark();
+
+    // Resets the high water mark to the current usage.
+    void ResetHighWaterMark();
+}
+#endif
+
 namespace AppInstaller::ThreadLocalStorage
 {
     struct WingetThreadGlobals : public ThreadGlobals
@@ -52,6 +52,19 @@ namespace AppInstaller::Settings
         DeliveryOptimization,
     };
 
+    // The cost policy to apply to Delivery Optimization downloads.
+    // Default leaves the decision to the Delivery Optimization client.
+    enum class DOCostPolicy
+    {
+        Default,
+        Always,
+        Unrestricted,
+        Standard,
+        NoRoaming,
+        NoSurcharge,
+        NoCellular,
+    };
+
     // Enum of settings.
     // Must start at 0 to enable direct access to variant in UserSettings.
     // Max must be last and unused.
@@ -87,11 +100,14 @@ namespace AppInstaller::Settings
         InstallDefaultRoot,
         InstallIgnoreWarnings,
         DisableInstallNotes,
+        InstallProgressUpdateIntervalInMilliseconds,
         PortablePackageUserRoot,
         PortablePackageMachineRoot,
         // Network
         NetworkDownloader,
         NetworkDOProgressTimeoutInSeconds,
+        NetworkDOForegroundPriority,
+        NetworkDOCostPolicy,
         NetworkWingetAlternateSourceURL,
         // Logging
         LoggingLevelPreference,
@@ -159,6 +175,7 @@ namespace AppInstaller::Settings
         SETTINGMAPPING_SPECIALIZATION(Setting::InstallLocaleRequirement, std::vector<std::string>, std::vector<std::string>, {}, ".installBehavior.requirements.locale"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::InstallIgnoreWarnings, bool, bool, false, ".installBehavior.ignoreWarnings"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::DisableInstallNotes, bool, bool, false, ".installBehavior.disableInstallNotes"sv);
+        SETTINGMAPPING_SPECIALIZATION(Setting::InstallProgressUpdateIntervalInMilliseconds, uint32_t, std::chrono::milliseconds, 100ms, ".installBehavior.progressUpdateIntervalInMilliseconds"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::PortablePackageUserRoot, std::string, std::filesystem::path, {}, ".installBehavior.portablePackageUserRoot"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::PortablePackageMachineRoot, std::string, std::filesystem::path, {}, ".installBehavior.portablePackageMachineRoot"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::InstallDefaultRoot, std::string, std::filesystem::path, {}, ".installBehavior.defaultInstallRoot"sv);
@@ -167,6 +184,8 @@ namespace AppInstaller::Settings
         // Network
         SETTINGMAPPING_SPECIALIZATION(Setting::NetworkDownloader, std::string, InstallerDownloader, InstallerDownloader::Default, ".network.downloader"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::NetworkDOProgressTimeoutInSeconds, uint32_t, std::chrono::seconds, 60s, ".network.doProgressTimeoutInSeconds"sv);
+        SETTINGMAPPING_SPECIALIZATION(Setting::NetworkDOForegroundPriority, bool, bool, true, ".network.doForegroundPriority"sv);
+        SETTINGMAPPING_SPECIALIZATION(Setting::NetworkDOCostPolicy, std::string, DOCostPolicy, DOCostPolicy::Default, ".network.doCostPolicy"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::NetworkWingetAlternateSourceURL, bool, bool, true, ".network.enableWingetAlternateSourceURL"sv);
         // Debug
         SETTINGMAPPING_SPECIALIZATION(Setting::EnableSelfInitiatedMinidump, bool, bool, false, ".debugging.enableSelfInitiatedMinidump"sv);
@@ -231,10 +250,16 @@ namespace AppInstaller::Settings
             return std::get<details::SettingIndex(S)>(itr->second);
         }
 
+#ifndef AICLI_DISABLE_TEST_HOOKS
+        // Indicates whether the values came from the settings cache rather than from parsing the file.
+        bool LoadedFromCache() const { return m_loadedFromCache; }
+#endif
+
     protected:
         UserSettingsType m_type = UserSettingsType::Default;
         std::vector<Warning> m_warnings;
         std::map<Setting, details::SettingVariant> m_settings;
+        bool m_loadedFromCache = false;
 
         UserSettings(const std::optional<std::string>& content = std::nullopt);
         ~UserSettings() = default;
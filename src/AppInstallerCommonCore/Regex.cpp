@@ -5,6 +5,8 @@
 #include "Public/AppInstallerErrors.h"
 #include "Public/AppInstallerLogging.h"
 
+#include <map>
+
 #define WINGET_THROW_REGEX_ERROR_IF_FAILED(_err_,_func_) \
     if (U_FAILURE(_err_)) \
     { \
@@ -169,6 +171,25 @@ namespace AppInstaller::Regex
 
     Expression::Expression(std::string_view pattern, Options options) : pImpl(std::make_unique<impl>(pattern, options)) {}
 
+    Expression Expression::CreateCached(std::string_view pattern, Options options)
+    {
+        static std::mutex s_cacheLock;
+        static std::map<std::pair<std::string, Options>, Expression> s_cache;
+
+        std::lock_guard<std::mutex> lock{ s_cacheLock };
+
+        auto key = std::make_pair(std::string{ pattern }, options);
+        auto itr = s_cache.find(key);
+
+        if (itr == s_cache.end())
+        {
+            itr = s_cache.emplace(std::move(key), Expression{ pattern, options }).first;
+        }
+
+        // The copy clones the compiled pattern rather than recompiling it.
+        return itr->second;
+    }
+
     Expression::Expression(const Expression& other)
     {
         if (other.pImpl)
@@ -98,6 +98,49 @@ namespace AppInstaller::Registry
             }
         }
 
+        bool TryGetRegistryValueAtIndex(const wil::shared_hkey& key, DWORD index, std::wstring& valueName, DWORD& type, std::vector<BYTE>& data)
+        {
+            constexpr DWORD MaxNameLength = 32767;
+            valueName.resize(256);
+            data.resize(256);
+
+            for (;;)
+            {
+                DWORD charCount = wil::safe_cast<DWORD>(valueName.size());
+                DWORD byteCount = wil::safe_cast<DWORD>(data.size());
+
+                // Unlike the name-only enumeration above, the name and the data are retrieved
+                // together so that one enumeration call suffices per value.
+                LSTATUS status = RegEnumValueW(key.get(), index, &valueName[0], &charCount, nullptr, &type, data.data(), &byteCount);
+
+                if (status == ERROR_SUCCESS)
+                {
+                    valueName.resize(wil::safe_cast<size_t>(charCount));
+                    data.resize(wil::safe_cast<size_t>(byteCount));
+                    return true;
+                }
+                else if (status == ERROR_NO_MORE_ITEMS)
+                {
+                    return false;
+                }
+                else if (status == ERROR_MORE_DATA)
+                {
+                    // The error does not indicate which buffer was too small; grow both.
+                    if (valueName.size() > MaxNameLength)
+                    {
+                        THROW_WIN32(status);
+                    }
+
+                    valueName.resize(valueName.size() * 2);
+                    data.resize(byteCount > data.size() ? byteCount : data.size() * 2);
+                }
+                else
+                {
+                    THROW_IF_WIN32_ERROR(status);
+                }
+            }
+        }
+
         bool TryGetRegistryValueData(const wil::shared_hkey& key, const std::wstring& valueName, DWORD& type, std::vector<BYTE>& data)
         {
             data.resize(64);
@@ -269,6 +312,39 @@ namespace AppInstaller::Registry
 
     ValueList::ValueList(wil::shared_hkey key) : m_key(key) {}
 
+    bool ValueSnapshot::NameLess::operator()(const std::wstring& lhs, const std::wstring& rhs) const
+    {
+        return _wcsicmp(lhs.c_str(), rhs.c_str()) < 0;
+    }
+
+    ValueSnapshot::ValueSnapshot(const wil::shared_hkey& key)
+    {
+        std::wstring valueName;
+        DWORD type = REG_NONE;
+        std::vector<BYTE> data;
+
+        for (DWORD index = 0; TryGetRegistryValueAtIndex(key, index, valueName, type, data); ++index)
+        {
+            m_values.emplace(std::move(valueName), Value{ type, std::move(data) });
+        }
+    }
+
+    std::optional<Value> ValueSnapshot::operator[](std::string_view name) const
+    {
+        return operator[](Utility::ConvertToUTF16(name));
+    }
+
+    std::optional<Value> ValueSnapshot::operator[](const std::wstring& name) const
+    {
+        auto itr = m_values.find(name);
+        if (itr == m_values.end())
+        {
+            return std::nullopt;
+        }
+
+        return itr->second;
+    }
+
     Key::Key(HKEY key)
     {
         Initialize(key, {}, 0, KEY_READ, false);
@@ -458,6 +534,22 @@ namespace AppInstaller::Registry
         return { m_key };
     }
 
+    ValueSnapshot Key::SnapshotValues() const
+    {
+        return { m_key };
+    }
+
+    int64_t Key::LastWriteTime() const
+    {
+        FILETIME lastWriteTime{};
+        THROW_IF_WIN32_ERROR(RegQueryInfoKeyW(m_key.get(), nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, &lastWriteTime));
+
+        ULARGE_INTEGER result;
+        result.LowPart = lastWriteTime.dwLowDateTime;
+        result.HighPart = lastWriteTime.dwHighDateTime;
+        return static_cast<int64_t>(result.QuadPart);
+    }
+
     Key Key::OpenIfExists(HKEY key, std::string_view subKey, DWORD options, REGSAM access)
     {
         return OpenIfExists(key, Utility::ConvertToUTF16(subKey), options, access);
@@ -3,6 +3,76 @@
 #include "pch.h"
 #include "Public/winget/ThreadGlobals.h"
 
+#if WINGET_MEMORY_ACCOUNTING_ENABLED
+#include <atomic>
+#include <cstdlib>
+#include <malloc.h>
+#include <new>
+
+namespace AppInstaller::MemoryAccounting
+{
+    namespace
+    {
+        std::atomic<int64_t> s_currentUsage{ 0 };
+        std::atomic<int64_t> s_highWaterMark{ 0 };
+
+        void RecordAllocation(int64_t delta)
+        {
+            int64_t current = s_currentUsage.fetch_add(delta, std::memory_order_relaxed) + delta;
+
+            if (delta > 0)
+            {
+                int64_t mark = s_highWaterMark.load(std::memory_order_relaxed);
+                while (current > mark && !s_highWaterMark.compare_exchange_weak(mark, current, std::memory_order_relaxed))
+                {
+                }
+            }
+        }
+    }
+
+    int64_t GetCurrentUsage()
+    {
+        return s_currentUsage.load(std::memory_order_relaxed);
+    }
+
+    int64_t GetHighWaterMark()
+    {
+        return s_highWaterMark.load(std::memory_order_relaxed);
+    }
+
+    void ResetHighWaterMark()
+    {
+        s_highWaterMark.store(s_currentUsage.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+// Replace the ordinary global allocation operators to maintain the process wide counters.
+// The default array, sized, and nothrow forms all forward to these two, so replacing them
+// covers every operator delete without tracking per pointer state; _msize reports the size
+// of the block being freed.
+void* operator new(std::size_t size)
+{
+    void* result = std::malloc(size);
+
+    if (!result)
+    {
+        throw std::bad_alloc{};
+    }
+
+    AppInstaller::MemoryAccounting::RecordAllocation(static_cast<int64_t>(_msize(result)));
+    return result;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    if (pointer)
+    {
+        AppInstaller::MemoryAccounting::RecordAllocation(-static_cast<int64_t>(_msize(pointer)));
+        std::free(pointer);
+    }
+}
+#endif
+
 namespace AppInstaller::ThreadLocalStorage
 {
     using namespace AppInstaller::Logging;
@@ -131,31 +131,6 @@ namespace AppInstaller::Settings
             // jsoncpp doesn't support std::string_view yet.
             auto path = std::string(details::SettingMapping<S>::Path);
 
-            // Settings set by Group Policy override anything else. See if there is one.
-            auto policyValue = GetValueFromPolicy<S>();
-            if (policyValue.has_value())
-            {
-                // If the value is valid, use it.
-                // Otherwise, fall back to default.
-                // In any case, we do not need to read the setting from the JSON.
-                auto validatedValue = details::SettingMapping<S>::Validate(policyValue.value());
-                if (validatedValue.has_value())
-                {
-                    // Add it to the map
-                    settings[S].emplace<details::SettingIndex(S)>(
-                        std::forward<typename details::SettingMapping<S>::value_t>(validatedValue.value()));
-                    AICLI_LOG(Core, Verbose, << "Valid setting from Group Policy. Field: " << path << " Value: " << GetValueString(policyValue.value()));
-                }
-                else
-                {
-                    auto valueAsString = GetValueString(policyValue.value());
-                    AICLI_LOG(Core, Error, << "Invalid setting from Group Policy. Field: " << path << " Value: " << valueAsString);
-                    warnings.emplace_back(StringResource::String::SettingsWarningInvalidValueFromPolicy, path, valueAsString);
-                }
-
-                return;
-            }
-
             const Json::Path jsonPath(path);
             Json::Value result = jsonPath.resolve(root);
             if (!result.isNull())
@@ -213,6 +188,355 @@ namespace AppInstaller::Settings
 
             return path;
         }
+
+        // Applies a Group Policy value over whatever was loaded for the setting, if the policy is set.
+        // This runs after loading from either the settings file or the settings cache, so that policy
+        // changes always take effect and policy values never end up in the cache.
+        template <Setting S>
+        void ApplyPolicy(
+            std::map<Setting, details::SettingVariant>& settings,
+            std::vector<UserSettings::Warning>& warnings)
+        {
+            auto policyValue = GetValueFromPolicy<S>();
+            if (!policyValue.has_value())
+            {
+                return;
+            }
+
+            // jsoncpp doesn't support std::string_view yet.
+            auto path = std::string(details::SettingMapping<S>::Path);
+
+            // If the value is valid, use it.
+            // Otherwise, fall back to default; the policy overrides any value from the JSON.
+            auto validatedValue = details::SettingMapping<S>::Validate(policyValue.value());
+            if (validatedValue.has_value())
+            {
+                settings[S].emplace<details::SettingIndex(S)>(
+                    std::forward<typename details::SettingMapping<S>::value_t>(validatedValue.value()));
+                AICLI_LOG(Core, Verbose, << "Valid setting from Group Policy. Field: " << path << " Value: " << GetValueString(policyValue.value()));
+            }
+            else
+            {
+                settings.erase(S);
+                auto valueAsString = GetValueString(policyValue.value());
+                AICLI_LOG(Core, Error, << "Invalid setting from Group Policy. Field: " << path << " Value: " << valueAsString);
+                warnings.emplace_back(StringResource::String::SettingsWarningInvalidValueFromPolicy, path, valueAsString);
+            }
+        }
+
+        template <size_t... S>
+        void ApplyAllPolicies(
+            std::map<Setting, details::SettingVariant>& settings,
+            std::vector<UserSettings::Warning>& warnings,
+            std::index_sequence<S...>)
+        {
+            // Use folding to call each policy apply function.
+            (FoldHelper{}, ..., ApplyPolicy<static_cast<Setting>(S)>(settings, warnings));
+        }
+
+        // -- Settings cache --
+        // A compact binary serialization of the validated settings values, keyed to the exact state
+        // of the settings file that produced it. When the file is unchanged, loading the cache
+        // replaces reading, parsing and validating the JSON on startup.
+
+        // Bump this when the serialization below or any setting's value_t changes.
+        constexpr uint32_t s_SettingsCacheFormatVersion = 1;
+
+        // Identifies the format and the settings file state that a cache was built from.
+        struct SettingsCacheHeader
+        {
+            uint32_t FormatVersion = 0;
+            uint32_t SettingCount = 0;
+            int64_t SourceWriteTime = 0;
+            uint64_t SourceSize = 0;
+        };
+
+        void WriteCacheBytes(std::vector<uint8_t>& buffer, const void* data, size_t size)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+            buffer.insert(buffer.end(), bytes, bytes + size);
+        }
+
+        template <class T> struct IsStdVector : std::false_type {};
+        template <class T, class A> struct IsStdVector<std::vector<T, A>> : std::true_type {};
+
+        template <class T> struct IsDuration : std::false_type {};
+        template <class R, class P> struct IsDuration<std::chrono::duration<R, P>> : std::true_type {};
+
+        template <class T>
+        void WriteCacheValue(std::vector<uint8_t>& buffer, const T& value)
+        {
+            if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+            {
+                int64_t raw = static_cast<int64_t>(value);
+                WriteCacheBytes(buffer, &raw, sizeof(raw));
+            }
+            else if constexpr (IsDuration<T>::value)
+            {
+                int64_t raw = static_cast<int64_t>(value.count());
+                WriteCacheBytes(buffer, &raw, sizeof(raw));
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                uint32_t size = static_cast<uint32_t>(value.size());
+                WriteCacheBytes(buffer, &size, sizeof(size));
+                WriteCacheBytes(buffer, value.data(), value.size());
+            }
+            else if constexpr (std::is_same_v<T, std::filesystem::path>)
+            {
+                WriteCacheValue(buffer, value.u8string());
+            }
+            else if constexpr (IsStdVector<T>::value)
+            {
+                uint32_t size = static_cast<uint32_t>(value.size());
+                WriteCacheBytes(buffer, &size, sizeof(size));
+                for (const auto& item : value)
+                {
+                    WriteCacheValue(buffer, item);
+                }
+            }
+            else
+            {
+                static_assert(IsStdVector<T>::value, "No cache serialization defined for this setting value type");
+            }
+        }
+
+        // Provides bounds checked reading of the cache buffer.
+        struct SettingsCacheReader
+        {
+            SettingsCacheReader(const std::vector<uint8_t>& buffer) : m_current(buffer.data()), m_end(buffer.data() + buffer.size()) {}
+
+            bool ReadBytes(void* target, size_t size)
+            {
+                if (static_cast<size_t>(m_end - m_current) < size)
+                {
+                    return false;
+                }
+
+                std::copy(m_current, m_current + size, reinterpret_cast<uint8_t*>(target));
+                m_current += size;
+                return true;
+            }
+
+            bool Done() const { return m_current == m_end; }
+
+        private:
+            const uint8_t* m_current;
+            const uint8_t* m_end;
+        };
+
+        template <class T>
+        std::optional<T> ReadCacheValue(SettingsCacheReader& reader)
+        {
+            if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+            {
+                int64_t raw = 0;
+                if (!reader.ReadBytes(&raw, sizeof(raw)))
+                {
+                    return {};
+                }
+
+                return static_cast<T>(raw);
+            }
+            else if constexpr (IsDuration<T>::value)
+            {
+                int64_t raw = 0;
+                if (!reader.ReadBytes(&raw, sizeof(raw)))
+                {
+                    return {};
+                }
+
+                return T{ static_cast<typename T::rep>(raw) };
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                uint32_t size = 0;
+                if (!reader.ReadBytes(&size, sizeof(size)))
+                {
+                    return {};
+                }
+
+                std::string result(size, '\0');
+                if (!reader.ReadBytes(result.data(), size))
+                {
+                    return {};
+                }
+
+                return result;
+            }
+            else if constexpr (std::is_same_v<T, std::filesystem::path>)
+            {
+                auto utf8 = ReadCacheValue<std::string>(reader);
+                if (!utf8.has_value())
+                {
+                    return {};
+                }
+
+                return std::filesystem::path{ ConvertToUTF16(utf8.value()) };
+            }
+            else if constexpr (IsStdVector<T>::value)
+            {
+                uint32_t size = 0;
+                if (!reader.ReadBytes(&size, sizeof(size)))
+                {
+                    return {};
+                }
+
+                T result;
+                for (uint32_t i = 0; i < size; ++i)
+                {
+                    auto item = ReadCacheValue<typename T::value_type>(reader);
+                    if (!item.has_value())
+                    {
+                        return {};
+                    }
+
+                    result.emplace_back(std::move(item.value()));
+                }
+
+                return result;
+            }
+        }
+
+        template <Setting S>
+        void SerializeSetting(const std::map<Setting, details::SettingVariant>& settings, std::vector<uint8_t>& buffer)
+        {
+            auto itr = settings.find(S);
+            if (itr != settings.end())
+            {
+                uint32_t id = static_cast<uint32_t>(S);
+                WriteCacheBytes(buffer, &id, sizeof(id));
+                WriteCacheValue(buffer, std::get<details::SettingIndex(S)>(itr->second));
+            }
+        }
+
+        template <size_t... S>
+        void SerializeAllSettings(const std::map<Setting, details::SettingVariant>& settings, std::vector<uint8_t>& buffer, std::index_sequence<S...>)
+        {
+            // Use folding to call each setting serialize function.
+            (FoldHelper{}, ..., SerializeSetting<static_cast<Setting>(S)>(settings, buffer));
+        }
+
+        template <Setting S>
+        bool DeserializeSettingIfMatch(uint32_t id, SettingsCacheReader& reader, std::map<Setting, details::SettingVariant>& settings, bool& success)
+        {
+            if (id != static_cast<uint32_t>(S))
+            {
+                return false;
+            }
+
+            auto value = ReadCacheValue<typename details::SettingMapping<S>::value_t>(reader);
+            if (value.has_value())
+            {
+                settings[S].emplace<details::SettingIndex(S)>(std::move(value.value()));
+            }
+            else
+            {
+                success = false;
+            }
+
+            return true;
+        }
+
+        template <size_t... S>
+        bool DeserializeSetting(uint32_t id, SettingsCacheReader& reader, std::map<Setting, details::SettingVariant>& settings, std::index_sequence<S...>)
+        {
+            bool success = true;
+            bool matched = (... || DeserializeSettingIfMatch<static_cast<Setting>(S)>(id, reader, settings, success));
+            return matched && success;
+        }
+
+        // Gets the header that a cache built from the current state of the given settings file would have.
+        // Returns nothing when the file cannot be inspected (for instance, when it does not exist).
+        std::optional<SettingsCacheHeader> GetSettingsCacheHeader(const std::filesystem::path& settingsPath)
+        {
+            std::error_code error;
+            auto writeTime = std::filesystem::last_write_time(settingsPath, error);
+            if (error)
+            {
+                return {};
+            }
+
+            auto size = std::filesystem::file_size(settingsPath, error);
+            if (error)
+            {
+                return {};
+            }
+
+            SettingsCacheHeader result;
+            result.FormatVersion = s_SettingsCacheFormatVersion;
+            result.SettingCount = static_cast<uint32_t>(Setting::Max);
+            result.SourceWriteTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+            result.SourceSize = static_cast<uint64_t>(size);
+            return result;
+        }
+
+        // Attempts to load the settings values from the cache.
+        // Only succeeds when the cache was built by this format version from the exact
+        // settings file state described by the expected header.
+        bool TryLoadSettingsCache(const SettingsCacheHeader& expected, std::map<Setting, details::SettingVariant>& settings)
+        {
+            try
+            {
+                auto stream = Stream{ Stream::UserSettingsCache }.Get();
+                if (!stream)
+                {
+                    return false;
+                }
+
+                std::vector<uint8_t> buffer = ParseFromHexString(Trim(Utility::ReadEntireStream(*stream)));
+                SettingsCacheReader reader{ buffer };
+
+                SettingsCacheHeader header;
+                if (!reader.ReadBytes(&header, sizeof(header)) ||
+                    header.FormatVersion != expected.FormatVersion ||
+                    header.SettingCount != expected.SettingCount ||
+                    header.SourceWriteTime != expected.SourceWriteTime ||
+                    header.SourceSize != expected.SourceSize)
+                {
+                    return false;
+                }
+
+                std::map<Setting, details::SettingVariant> cached;
+                while (!reader.Done())
+                {
+                    uint32_t id = 0;
+                    if (!reader.ReadBytes(&id, sizeof(id)) ||
+                        !DeserializeSetting(id, reader, cached, std::make_index_sequence<static_cast<size_t>(Setting::Max)>()))
+                    {
+                        return false;
+                    }
+                }
+
+                settings = std::move(cached);
+                return true;
+            }
+            catch (...)
+            {
+                AICLI_LOG(Core, Warning, << "Failed to load settings cache; falling back to parsing");
+                return false;
+            }
+        }
+
+        // Writes a cache of the given settings values; failure to do so only costs the next load a parse.
+        void TryWriteSettingsCache(const SettingsCacheHeader& header, const std::map<Setting, details::SettingVariant>& settings)
+        {
+            try
+            {
+                std::vector<uint8_t> buffer;
+                WriteCacheBytes(buffer, &header, sizeof(header));
+                SerializeAllSettings(settings, buffer, std::make_index_sequence<static_cast<size_t>(Setting::Max)>());
+
+                if (!Stream{ Stream::UserSettingsCache }.Set(ConvertToHexString(buffer)))
+                {
+                    AICLI_LOG(Core, Verbose, << "Settings cache changed concurrently; not writing it");
+                }
+            }
+            catch (...)
+            {
+                AICLI_LOG(Core, Warning, << "Failed to write settings cache");
+            }
+        }
     }
 
     namespace details
@@ -271,6 +595,7 @@ namespace AppInstaller::Settings
         WINGET_VALIDATE_PASS_THROUGH(InstallIgnoreWarnings)
         WINGET_VALIDATE_PASS_THROUGH(DisableInstallNotes)
         WINGET_VALIDATE_PASS_THROUGH(UninstallPurgePortablePackage)
+        WINGET_VALIDATE_PASS_THROUGH(NetworkDOForegroundPriority)
         WINGET_VALIDATE_PASS_THROUGH(NetworkWingetAlternateSourceURL)
 
         WINGET_VALIDATE_SIGNATURE(PortablePackageUserRoot)
@@ -374,6 +699,53 @@ namespace AppInstaller::Settings
             return std::chrono::seconds(value);
         }
 
+        WINGET_VALIDATE_SIGNATURE(InstallProgressUpdateIntervalInMilliseconds)
+        {
+            return std::chrono::milliseconds(value);
+        }
+
+        WINGET_VALIDATE_SIGNATURE(NetworkDOCostPolicy)
+        {
+            static constexpr std::string_view s_costPolicy_default = "default";
+            static constexpr std::string_view s_costPolicy_always = "always";
+            static constexpr std::string_view s_costPolicy_unrestricted = "unrestricted";
+            static constexpr std::string_view s_costPolicy_standard = "standard";
+            static constexpr std::string_view s_costPolicy_noRoaming = "noRoaming";
+            static constexpr std::string_view s_costPolicy_noSurcharge = "noSurcharge";
+            static constexpr std::string_view s_costPolicy_noCellular = "noCellular";
+
+            if (Utility::CaseInsensitiveEquals(value, s_costPolicy_default))
+            {
+                return DOCostPolicy::Default;
+            }
+            else if (Utility::CaseInsensitiveEquals(value, s_costPolicy_always))
+            {
+                return DOCostPolicy::Always;
+            }
+            else if (Utility::CaseInsensitiveEquals(value, s_costPolicy_unrestricted))
+            {
+                return DOCostPolicy::Unrestricted;
+            }
+            else if (Utility::CaseInsensitiveEquals(value, s_costPolicy_standard))
+            {
+                return DOCostPolicy::Standard;
+            }
+            else if (Utility::CaseInsensitiveEquals(value, s_costPolicy_noRoaming))
+            {
+                return DOCostPolicy::NoRoaming;
+            }
+            else if (Utility::CaseInsensitiveEquals(value, s_costPolicy_noSurcharge))
+            {
+                return DOCostPolicy::NoSurcharge;
+            }
+            else if (Utility::CaseInsensitiveEquals(value, s_costPolicy_noCellular))
+            {
+                return DOCostPolicy::NoCellular;
+            }
+
+            return {};
+        }
+
         WINGET_VALIDATE_SIGNATURE(LoggingLevelPreference)
         {
             // logging preference possible values
@@ -473,16 +845,18 @@ namespace AppInstaller::Settings
     UserSettings::UserSettings(const std::optional<std::string>& content) : m_type(UserSettingsType::Default)
     {
         Json::Value settingsRoot = Json::Value::nullSingleton();
+        std::optional<SettingsCacheHeader> cacheHeader;
 
         // Settings can be loaded from settings.json or settings.json.backup files.
         // 0 - Use default (empty) settings if disabled by group policy.
         // if
         // 1 - Use passed in settings content if available.
         // else
-        // 2 - Use settings.json if exists and passes parsing.
-        // 3 - Use settings.backup.json if settings.json fails to parse.
+        // 2 - Use the settings cache if settings.json is unchanged since the cache was written.
+        // 3 - Use settings.json if exists and passes parsing.
+        // 4 - Use settings.backup.json if settings.json fails to parse.
         // finally
-        // 4 - Use default (empty) if both settings files fail to load.
+        // 5 - Use default (empty) if both settings files fail to load.
 
         if (!GroupPolicies().IsEnabled(TogglePolicy::Policy::Settings))
         {
@@ -502,33 +876,46 @@ namespace AppInstaller::Settings
         }
         else
         {
-            auto settingsJson = ParseFile(Stream::PrimaryUserSettings, m_warnings);
-            if (settingsJson.has_value())
+            cacheHeader = GetSettingsCacheHeader(Stream{ Stream::PrimaryUserSettings }.GetPath());
+
+            if (cacheHeader.has_value() && TryLoadSettingsCache(cacheHeader.value(), m_settings))
             {
-                AICLI_LOG(Core, Info, << "Settings loaded from " << Stream::PrimaryUserSettings.Name);
+                // The cache was built from the exact file state present now, so this is
+                // equivalent to parsing and validating settings.json without doing either.
+                AICLI_LOG(Core, Info, << "Settings loaded from settings cache");
                 m_type = UserSettingsType::Standard;
-                settingsRoot = settingsJson.value();
+                m_loadedFromCache = true;
             }
-
-            // Settings didn't parse or doesn't exist, try with backup.
-            if (settingsRoot.isNull())
+            else
             {
-                auto settingsBackupJson = ParseFile(Stream::BackupUserSettings, m_warnings);
-                if (settingsBackupJson.has_value())
+                auto settingsJson = ParseFile(Stream::PrimaryUserSettings, m_warnings);
+                if (settingsJson.has_value())
                 {
-                    AICLI_LOG(Core, Info, << "Settings loaded from " << Stream::BackupUserSettings.Name);
-                    m_warnings.emplace_back(StringResource::String::SettingsWarningLoadedBackupSettings);
-                    m_type = UserSettingsType::Backup;
-                    settingsRoot = settingsBackupJson.value();
+                    AICLI_LOG(Core, Info, << "Settings loaded from " << Stream::PrimaryUserSettings.Name);
+                    m_type = UserSettingsType::Standard;
+                    settingsRoot = settingsJson.value();
                 }
-                else
+
+                // Settings didn't parse or doesn't exist, try with backup.
+                if (settingsRoot.isNull())
                 {
-                    // Settings and back up didn't parse or exist. If they exist then warn the user.
-                    auto settingsPath = Stream{ Stream::PrimaryUserSettings }.GetPath();
-                    auto backupPath = Stream{ Stream::BackupUserSettings }.GetPath();
-                    if (std::filesystem::exists(settingsPath) || std::filesystem::exists(backupPath))
+                    auto settingsBackupJson = ParseFile(Stream::BackupUserSettings, m_warnings);
+                    if (settingsBackupJson.has_value())
+                    {
+                        AICLI_LOG(Core, Info, << "Settings loaded from " << Stream::BackupUserSettings.Name);
+                        m_warnings.emplace_back(StringResource::String::SettingsWarningLoadedBackupSettings);
+                        m_type = UserSettingsType::Backup;
+                        settingsRoot = settingsBackupJson.value();
+                    }
+                    else
                     {
-                        m_warnings.emplace_back(StringResource::String::SettingsWarningUsingDefault);
+                        // Settings and back up didn't parse or exist. If they exist then warn the user.
+                        auto settingsPath = Stream{ Stream::PrimaryUserSettings }.GetPath();
+                        auto backupPath = Stream{ Stream::BackupUserSettings }.GetPath();
+                        if (std::filesystem::exists(settingsPath) || std::filesystem::exists(backupPath))
+                        {
+                            m_warnings.emplace_back(StringResource::String::SettingsWarningUsingDefault);
+                        }
                     }
                 }
             }
@@ -537,11 +924,21 @@ namespace AppInstaller::Settings
         if (!settingsRoot.isNull())
         {
             ValidateAll(settingsRoot, m_settings, m_warnings, std::make_index_sequence<static_cast<size_t>(Setting::Max)>());
+
+            // Only a clean standard load is cached; loading the cache later reproduces this state exactly.
+            if (m_type == UserSettingsType::Standard && m_warnings.empty() && cacheHeader.has_value())
+            {
+                TryWriteSettingsCache(cacheHeader.value(), m_settings);
+            }
         }
-        else
+        else if (!m_loadedFromCache)
         {
             AICLI_LOG(Core, Info, << "Valid settings file not found. Using default values.");
         }
+
+        // Group Policy is applied after loading from either the file or the cache, so that
+        // policy changes always take effect and policy values are never written to the cache.
+        ApplyAllPolicies(m_settings, m_warnings, std::make_index_sequence<static_cast<size_t>(Setting::Max)>());
     }
 
     void UserSettings::PrepareToShellExecuteFile() const
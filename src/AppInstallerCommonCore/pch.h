@@ -39,6 +39,7 @@
 #include <chrono>
 #include <condition_variable>
 #include <cwctype>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <functional>
@@ -56,6 +57,7 @@
 #include <sstream>
 #include <stack>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <unordered_set>
 #include <vector>
@@ -45,6 +45,19 @@ namespace AppInstaller::Repository::Correlation
         return InstanceInternal();
     }
 
+    std::vector<double> IARPMatchConfidenceAlgorithm::ComputeConfidence(const std::vector<ARPEntry>& arpEntries) const
+    {
+        std::vector<double> result;
+        result.reserve(arpEntries.size());
+
+        for (const auto& arpEntry : arpEntries)
+        {
+            result.push_back(ComputeConfidence(arpEntry));
+        }
+
+        return result;
+    }
+
 #ifndef AICLI_DISABLE_TEST_HOOKS
     void IARPMatchConfidenceAlgorithm::OverrideInstance(IARPMatchConfidenceAlgorithm* algorithmOverride)
     {
@@ -81,15 +94,16 @@ namespace AppInstaller::Repository::Correlation
 
         algorithm.Init(manifest);
 
+        std::vector<double> scores = algorithm.ComputeConfidence(arpEntries);
+
         ARPHeuristicsCorrelationResult result;
         result.Measures.reserve(arpEntries.size());
 
-        for (const auto& arpEntry : arpEntries)
+        for (size_t i = 0; i < arpEntries.size(); ++i)
         {
-            auto score = algorithm.ComputeConfidence(arpEntry);
-            AICLI_LOG(Repo, Verbose, << "Match confidence for " << arpEntry.Entry->GetProperty(PackageProperty::Id) << ": " << score);
+            AICLI_LOG(Repo, Verbose, << "Match confidence for " << arpEntries[i].Entry->GetProperty(PackageProperty::Id) << ": " << scores[i]);
 
-            result.Measures.emplace_back(CorrelationMeasure{ score, arpEntry.Entry->GetInstalledVersion() });
+            result.Measures.emplace_back(CorrelationMeasure{ scores[i], arpEntries[i].Entry->GetInstalledVersion() });
         }
 
         std::sort(result.Measures.begin(), result.Measures.end(), [](const CorrelationMeasure& a, const CorrelationMeasure& b) { return a.Measure > b.Measure; });
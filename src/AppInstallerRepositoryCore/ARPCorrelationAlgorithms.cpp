@@ -97,12 +97,52 @@ namespace AppInstaller::Repository::Correlation
             double editDistance = distance.At(s1.size() - 1, s2.size() - 1);
             return 1 - editDistance / (static_cast<uint64_t>(s1.size()) + static_cast<uint64_t>(s2.size()));
         }
+
+        // An upper bound on EditDistanceScore computed from the sorted word sequences.
+        // With only add and remove operations, the edit distance is at least the total
+        // length minus twice the number of words the sequences share, so the score can
+        // be at most 2 * common / (size1 + size2). Counting the common words is a linear
+        // merge rather than the quadratic scoring matrix.
+        double EditDistanceScoreBound(const std::vector<std::string>& sorted1, const std::vector<std::string>& sorted2)
+        {
+            if (sorted1.empty() || sorted2.empty())
+            {
+                return 0;
+            }
+
+            size_t common = 0;
+            auto itr1 = sorted1.begin();
+            auto itr2 = sorted2.begin();
+
+            while (itr1 != sorted1.end() && itr2 != sorted2.end())
+            {
+                if (*itr1 < *itr2)
+                {
+                    ++itr1;
+                }
+                else if (*itr2 < *itr1)
+                {
+                    ++itr2;
+                }
+                else
+                {
+                    ++common;
+                    ++itr1;
+                    ++itr2;
+                }
+            }
+
+            return (2.0 * common) / (sorted1.size() + sorted2.size());
+        }
     }
 
     WordsEditDistanceMatchConfidenceAlgorithm::NameAndPublisher::NameAndPublisher(const WordSequence& name, const WordSequence& publisher) : Name(name), Publisher(publisher)
     {
         NamePublisher.insert(NamePublisher.end(), publisher.begin(), publisher.end());
         NamePublisher.insert(NamePublisher.end(), name.begin(), name.end());
+
+        SortedNameWords = Name;
+        std::sort(SortedNameWords.begin(), SortedNameWords.end());
     }
 
     WordsEditDistanceMatchConfidenceAlgorithm::NameAndPublisher::NameAndPublisher(WordSequence&& name, WordSequence&& publisher) : Name(std::move(name)), Publisher(std::move(publisher))
@@ -110,6 +150,8 @@ namespace AppInstaller::Repository::Correlation
         NamePublisher.insert(NamePublisher.end(), publisher.begin(), publisher.end());
         NamePublisher.insert(NamePublisher.end(), name.begin(), name.end());
 
+        SortedNameWords = Name;
+        std::sort(SortedNameWords.begin(), SortedNameWords.end());
     }
 
     void WordsEditDistanceMatchConfidenceAlgorithm::Init(const AppInstaller::Manifest::Manifest& manifest)
@@ -120,20 +162,20 @@ namespace AppInstaller::Repository::Correlation
         WordSequence defaultPublisher;
         if (manifest.DefaultLocalization.Contains(Manifest::Localization::Publisher))
         {
-            defaultPublisher = NormalizeAndPreparePublisher(manifest.DefaultLocalization.Get<Manifest::Localization::Publisher>());
+            defaultPublisher = NormalizeAndPreparePublisher(m_normalizer, manifest.DefaultLocalization.Get<Manifest::Localization::Publisher>());
         }
 
         if (manifest.DefaultLocalization.Contains(Manifest::Localization::PackageName))
         {
-            WordSequence defaultName = NormalizeAndPrepareName(manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>());
+            WordSequence defaultName = NormalizeAndPrepareName(m_normalizer, manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>());
             m_namesAndPublishers.emplace_back(defaultName, defaultPublisher);
 
             for (const auto& loc : manifest.Localizations)
             {
                 if (loc.Contains(Manifest::Localization::PackageName) || loc.Contains(Manifest::Localization::Publisher))
                 {
-                    auto name = loc.Contains(Manifest::Localization::PackageName) ? NormalizeAndPrepareName(loc.Get<Manifest::Localization::PackageName>()) : defaultName;
-                    auto publisher = loc.Contains(Manifest::Localization::Publisher) ? NormalizeAndPreparePublisher(loc.Get<Manifest::Localization::Publisher>()) : defaultPublisher;
+                    auto name = loc.Contains(Manifest::Localization::PackageName) ? NormalizeAndPrepareName(m_normalizer, loc.Get<Manifest::Localization::PackageName>()) : defaultName;
+                    auto publisher = loc.Contains(Manifest::Localization::Publisher) ? NormalizeAndPreparePublisher(m_normalizer, loc.Get<Manifest::Localization::Publisher>()) : defaultPublisher;
 
                     m_namesAndPublishers.emplace_back(std::move(name), std::move(publisher));
                 }
@@ -143,15 +185,124 @@ namespace AppInstaller::Repository::Correlation
 
     double WordsEditDistanceMatchConfidenceAlgorithm::ComputeConfidence(const ARPEntry& arpEntry) const
     {
+        auto installed = arpEntry.Entry->GetInstalledVersion();
+
+        // The installed source persists precomputed normalization keys; only entries
+        // without them (older caches, other source types) pay for normalization here.
+        auto metadata = installed->GetMetadata();
+        auto normalizedName = metadata.find(PackageVersionMetadata::NormalizedName);
+        auto normalizedPublisher = metadata.find(PackageVersionMetadata::NormalizedPublisher);
+
         // Name and Publisher are available as multi properties, but for ARP entries there will only be 0 or 1 values.
         NameAndPublisher arpNameAndPublisher(
-            NormalizeAndPrepareName(arpEntry.Entry->GetInstalledVersion()->GetProperty(PackageVersionProperty::Name).get()),
-            NormalizeAndPreparePublisher(arpEntry.Entry->GetInstalledVersion()->GetProperty(PackageVersionProperty::Publisher).get()));
+            normalizedName != metadata.end() ?
+                PrepareString(normalizedName->second) :
+                NormalizeAndPrepareName(m_normalizer, installed->GetProperty(PackageVersionProperty::Name).get()),
+            normalizedPublisher != metadata.end() ?
+                PrepareString(normalizedPublisher->second) :
+                NormalizeAndPreparePublisher(m_normalizer, installed->GetProperty(PackageVersionProperty::Publisher).get()));
+
+        return ComputeConfidence(arpNameAndPublisher, arpEntry.IsNewOrUpdated);
+    }
+
+    std::vector<double> WordsEditDistanceMatchConfidenceAlgorithm::ComputeConfidence(const std::vector<ARPEntry>& arpEntries) const
+    {
+        // Read the entry strings on the calling thread; the packages come from a source
+        // that is not safe to use from multiple threads.
+        struct EntryStrings
+        {
+            std::string Name;
+            std::string Publisher;
+            // Precomputed normalization keys persisted by the installed source, when present.
+            std::optional<std::string> NormalizedName;
+            std::optional<std::string> NormalizedPublisher;
+            bool IsNewOrUpdated;
+        };
+
+        std::vector<EntryStrings> entryStrings;
+        entryStrings.reserve(arpEntries.size());
+
+        for (const auto& arpEntry : arpEntries)
+        {
+            auto installed = arpEntry.Entry->GetInstalledVersion();
+            auto metadata = installed->GetMetadata();
+
+            EntryStrings strings;
+            strings.IsNewOrUpdated = arpEntry.IsNewOrUpdated;
+
+            auto normalizedName = metadata.find(PackageVersionMetadata::NormalizedName);
+            if (normalizedName != metadata.end())
+            {
+                strings.NormalizedName = std::move(normalizedName->second);
+            }
+            else
+            {
+                strings.Name = installed->GetProperty(PackageVersionProperty::Name);
+            }
+
+            auto normalizedPublisher = metadata.find(PackageVersionMetadata::NormalizedPublisher);
+            if (normalizedPublisher != metadata.end())
+            {
+                strings.NormalizedPublisher = std::move(normalizedPublisher->second);
+            }
+            else
+            {
+                strings.Publisher = installed->GetProperty(PackageVersionProperty::Publisher);
+            }
+
+            entryStrings.emplace_back(std::move(strings));
+        }
+
+        // Batch normalize the entries that did not carry persisted keys; the batch API
+        // partitions large batches across threads with per-worker normalizer internals.
+        std::vector<size_t> batchIndex(entryStrings.size(), std::numeric_limits<size_t>::max());
+        std::vector<std::pair<std::string, std::string>> toNormalize;
 
+        for (size_t i = 0; i < entryStrings.size(); ++i)
+        {
+            const EntryStrings& strings = entryStrings[i];
+            if (!strings.NormalizedName || !strings.NormalizedPublisher)
+            {
+                batchIndex[i] = toNormalize.size();
+                toNormalize.emplace_back(strings.Name, strings.Publisher);
+            }
+        }
+
+        std::vector<Utility::NormalizedName> normalized = m_normalizer.NormalizeBatch(toNormalize);
+
+        std::vector<double> scores(arpEntries.size());
+
+        for (size_t i = 0; i < entryStrings.size(); ++i)
+        {
+            const EntryStrings& strings = entryStrings[i];
+
+            NameAndPublisher arpNameAndPublisher(
+                strings.NormalizedName ?
+                    PrepareString(*strings.NormalizedName) :
+                    PrepareString(normalized[batchIndex[i]].Name()),
+                strings.NormalizedPublisher ?
+                    PrepareString(*strings.NormalizedPublisher) :
+                    PrepareString(normalized[batchIndex[i]].Publisher()));
+
+            scores[i] = ComputeConfidence(arpNameAndPublisher, strings.IsNewOrUpdated);
+        }
+
+        return scores;
+    }
+
+    double WordsEditDistanceMatchConfidenceAlgorithm::ComputeConfidence(const NameAndPublisher& arpNameAndPublisher, bool isNewOrUpdated) const
+    {
         // Get the best score across all localizations
         double bestMatchingScore = 0;
         for (const auto& manifestNameAndPublisher : m_namesAndPublishers)
         {
+            // Candidates sharing too few words with the entry cannot reach the name
+            // threshold; rule them out with the linear bound before paying for the matrix.
+            if (EditDistanceScoreBound(manifestNameAndPublisher.SortedNameWords, arpNameAndPublisher.SortedNameWords) < m_nameMatchingScoreMinThreshold)
+            {
+                continue;
+            }
+
             // Sometimes the publisher may be included in the name, for example Microsoft PowerToys as opposed to simply PowerToys.
             // This may happen both in the ARP entry and the manifest. We try adding it in case it is in one but not in both.
             auto nameScore = EditDistanceScore(manifestNameAndPublisher.Name, arpNameAndPublisher.Name);
@@ -175,23 +326,23 @@ namespace AppInstaller::Repository::Correlation
         }
 
         // Factor in whether this entry is new
-        auto result = bestMatchingScore * m_stringMatchingWeight + (arpEntry.IsNewOrUpdated ? 1 : 0) * (1 - m_stringMatchingWeight);
+        auto result = bestMatchingScore * m_stringMatchingWeight + (isNewOrUpdated ? 1 : 0) * (1 - m_stringMatchingWeight);
 
         return result;
     }
 
-    WordSequence WordsEditDistanceMatchConfidenceAlgorithm::PrepareString(std::string_view s) const
+    WordSequence WordsEditDistanceMatchConfidenceAlgorithm::PrepareString(std::string_view s)
     {
         return Utility::SplitIntoWords(Utility::FoldCase(s));
     }
 
-    WordSequence WordsEditDistanceMatchConfidenceAlgorithm::NormalizeAndPrepareName(std::string_view name) const
+    WordSequence WordsEditDistanceMatchConfidenceAlgorithm::NormalizeAndPrepareName(const Utility::NameNormalizer& normalizer, std::string_view name)
     {
-        return PrepareString(m_normalizer.NormalizeName(name).Name());
+        return PrepareString(normalizer.NormalizeName(name).Name());
     }
 
-    WordSequence WordsEditDistanceMatchConfidenceAlgorithm::NormalizeAndPreparePublisher(std::string_view publisher) const
+    WordSequence WordsEditDistanceMatchConfidenceAlgorithm::NormalizeAndPreparePublisher(const Utility::NameNormalizer& normalizer, std::string_view publisher)
     {
-        return PrepareString(m_normalizer.NormalizePublisher(publisher));
+        return PrepareString(normalizer.NormalizePublisher(publisher));
     }
 }
@@ -4,6 +4,11 @@
 #include "CompositeSource.h"
 #include "Microsoft/PinningIndex.h"
 #include <winget/ExperimentalFeature.h>
+#include <winget/ThreadGlobals.h>
+
+#include <condition_variable>
+#include <future>
+#include <mutex>
 
 using namespace AppInstaller::Repository::Microsoft;
 using namespace AppInstaller::Settings;
@@ -14,6 +19,358 @@ namespace AppInstaller::Repository
 
     namespace
     {
+        // The outcome of searching a single source during a parallel fan-out.
+        // Exactly one of Result or Exception is meaningful.
+        struct SourceSearchOutcome
+        {
+            SearchResult Result;
+            std::exception_ptr Exception;
+        };
+
+        // The soft deadline given to each source in a parallel fan-out; a source that has
+        // not answered by then is abandoned and surfaced as a failure, so the other
+        // sources' results are delivered instead of stalling behind the slowest one.
+        constexpr std::chrono::seconds s_CompositeSearch_SourceLatencyBudget{ 30 };
+
+        // The number of consecutive failures or timeouts after which a source is
+        // considered degraded and skipped by subsequent fan-outs in this process.
+        constexpr size_t s_CompositeSearch_DegradedFailureThreshold = 3;
+
+        // How long a degraded source is skipped before a fan-out probes it again. Without a
+        // retry, a transient outage (say a minute of lost connectivity) would degrade the
+        // source for the process lifetime, which for the keep-alive COM server can be days.
+        constexpr std::chrono::minutes s_CompositeSearch_DegradedRetryInterval{ 5 };
+
+        // Circuit breaker for sources that repeatedly fail or exceed the search latency
+        // budget. A degraded source is skipped by later parallel fan-outs (surfaced as a
+        // failure in the results) until the retry interval elapses, after which a single
+        // fan-out probes it again; a successful search resets its count, while a failed
+        // probe arms the next interval.
+        struct SourceCircuitBreaker
+        {
+            static SourceCircuitBreaker& Instance()
+            {
+                static SourceCircuitBreaker s_instance;
+                return s_instance;
+            }
+
+            bool IsDegraded(const std::string& identifier)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+                auto itr = m_states.find(identifier);
+                if (itr == m_states.end() || itr->second.FailureCount < s_CompositeSearch_DegradedFailureThreshold)
+                {
+                    return false;
+                }
+
+                if (std::chrono::steady_clock::now() - itr->second.LastFailure >= s_CompositeSearch_DegradedRetryInterval)
+                {
+                    // Half-open: let this fan-out probe the source, and push the next probe
+                    // out a full interval so that concurrent fan-outs do not all pile on.
+                    itr->second.LastFailure = std::chrono::steady_clock::now();
+                    AICLI_LOG(Repo, Info, << "Degraded source [" << identifier << "] will be probed again");
+                    return false;
+                }
+
+                return true;
+            }
+
+            void RecordFailure(const std::string& identifier)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+                auto& state = m_states[identifier];
+                state.LastFailure = std::chrono::steady_clock::now();
+                if (++state.FailureCount == s_CompositeSearch_DegradedFailureThreshold)
+                {
+                    AICLI_LOG(Repo, Warning, << "Source [" << identifier << "] has failed " <<
+                        s_CompositeSearch_DegradedFailureThreshold << " consecutive searches and will be skipped for the next " <<
+                        std::chrono::duration_cast<std::chrono::seconds>(s_CompositeSearch_DegradedRetryInterval).count() << " seconds");
+                }
+            }
+
+            void RecordSuccess(const std::string& identifier)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+                m_states.erase(identifier);
+            }
+
+        private:
+            struct SourceState
+            {
+                size_t FailureCount = 0;
+                std::chrono::steady_clock::time_point LastFailure;
+            };
+
+            std::mutex m_lock;
+            std::map<std::string, SourceState, std::less<>> m_states;
+        };
+
+        // The channel between the fan-out and one of its workers. A worker that exceeds
+        // the latency budget is abandoned and may outlive the search, so it owns copies
+        // of everything it touches and shares only this state with the fan-out.
+        struct PendingSourceSearch
+        {
+            std::mutex Lock;
+            std::condition_variable Signal;
+            SourceSearchOutcome Outcome;
+            bool Completed = false;
+            bool Abandoned = false;
+        };
+
+        // Issues the given search against each source on its own thread, returning the outcomes
+        // in the same order as the sources so that the merge stage remains deterministic.
+        // The workers log through a sub thread globals that they share ownership of, keeping
+        // logging correlated with the caller without tying a worker's lifetime to the caller's.
+        // Each source gets the latency budget to answer; one that does not is abandoned and
+        // reported as a timeout failure, and the circuit breaker skips sources that have
+        // repeatedly misbehaved without waiting on them at all.
+        std::vector<SourceSearchOutcome> SearchSourcesInParallel(const std::vector<Source>& sources, const SearchRequest& request)
+        {
+            auto searchSingleSource = [&request](const Source& source, ThreadLocalStorage::ThreadGlobals* callerGlobals)
+            {
+                std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                if (callerGlobals)
+                {
+                    previousGlobals = callerGlobals->SetForCurrentThread();
+                }
+
+                SourceSearchOutcome outcome;
+
+                try
+                {
+                    outcome.Result = source.Search(request);
+                }
+                catch (...)
+                {
+                    outcome.Exception = std::current_exception();
+                }
+
+                return outcome;
+            };
+
+            ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+            if (sources.size() == 1)
+            {
+                // No point in paying for a thread when there is nothing to overlap; with a
+                // single source there are also no other results to deliver early, so neither
+                // the budget nor the circuit breaker applies.
+                std::vector<SourceSearchOutcome> outcomes;
+                outcomes.emplace_back(searchSingleSource(sources[0], callerGlobals));
+                return outcomes;
+            }
+
+            // An abandoned worker can outlive the caller and the context that owns the
+            // caller's globals, so the workers must not hold the raw pointer. A sub thread
+            // globals shares ownership of the diagnostic logger and carries its own
+            // telemetry logger, so it remains safe to log through after the caller is gone.
+            std::shared_ptr<ThreadLocalStorage::WingetThreadGlobals> workerGlobals;
+            if (auto wingetGlobals = dynamic_cast<ThreadLocalStorage::WingetThreadGlobals*>(callerGlobals))
+            {
+                workerGlobals = std::make_shared<ThreadLocalStorage::WingetThreadGlobals>(
+                    *wingetGlobals, ThreadLocalStorage::WingetThreadGlobals::create_sub_thread_globals_t{});
+            }
+
+            std::vector<SourceSearchOutcome> outcomes(sources.size());
+            std::vector<std::shared_ptr<PendingSourceSearch>> pending(sources.size());
+            std::vector<std::thread> threads(sources.size());
+
+            for (size_t i = 0; i < sources.size(); ++i)
+            {
+                if (SourceCircuitBreaker::Instance().IsDegraded(sources[i].GetIdentifier()))
+                {
+                    AICLI_LOG(Repo, Info, << "Skipping degraded source [" << sources[i].GetIdentifier() << "]");
+                    outcomes[i].Exception = std::make_exception_ptr(wil::ResultException{ APPINSTALLER_CLI_ERROR_SOURCE_DEGRADED });
+                    continue;
+                }
+
+                pending[i] = std::make_shared<PendingSourceSearch>();
+
+                // The worker owns a copy of the source handle and the request, because it
+                // continues past the fan-out if it is abandoned at the deadline.
+                threads[i] = std::thread([state = pending[i], source = sources[i], request, workerGlobals]()
+                    {
+                        std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                        if (workerGlobals)
+                        {
+                            previousGlobals = workerGlobals->SetForCurrentThread();
+                        }
+
+                        SourceSearchOutcome outcome;
+
+                        try
+                        {
+                            outcome.Result = source.Search(request);
+                        }
+                        catch (...)
+                        {
+                            outcome.Exception = std::current_exception();
+                        }
+
+                        bool failed = static_cast<bool>(outcome.Exception);
+                        bool abandoned = false;
+
+                        {
+                            std::lock_guard<std::mutex> lock{ state->Lock };
+                            state->Outcome = std::move(outcome);
+                            state->Completed = true;
+                            abandoned = state->Abandoned;
+                        }
+                        state->Signal.notify_all();
+
+                        // An abandoned worker was already counted as a timeout; only live
+                        // completions drive the breaker, so a chronically slow source trips it.
+                        if (!abandoned)
+                        {
+                            if (failed)
+                            {
+                                SourceCircuitBreaker::Instance().RecordFailure(source.GetIdentifier());
+                            }
+                            else
+                            {
+                                SourceCircuitBreaker::Instance().RecordSuccess(source.GetIdentifier());
+                            }
+                        }
+                    });
+            }
+
+            const auto deadline = std::chrono::steady_clock::now() + s_CompositeSearch_SourceLatencyBudget;
+
+            for (size_t i = 0; i < sources.size(); ++i)
+            {
+                if (!pending[i])
+                {
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock{ pending[i]->Lock };
+                if (pending[i]->Signal.wait_until(lock, deadline, [&]() { return pending[i]->Completed; }))
+                {
+                    outcomes[i] = std::move(pending[i]->Outcome);
+                    lock.unlock();
+                    threads[i].join();
+                }
+                else
+                {
+                    pending[i]->Abandoned = true;
+                    lock.unlock();
+                    threads[i].detach();
+
+                    AICLI_LOG(Repo, Warning, << "Source [" << sources[i].GetIdentifier() << "] exceeded the search latency budget; abandoning it");
+                    outcomes[i].Exception = std::make_exception_ptr(wil::ResultException{ APPINSTALLER_CLI_ERROR_SOURCE_SEARCH_TIMED_OUT });
+                    SourceCircuitBreaker::Instance().RecordFailure(sources[i].GetIdentifier());
+                }
+            }
+
+            return outcomes;
+        }
+
+        constexpr std::string_view s_CorrelationCacheDirectory = "correlationCache"sv;
+        constexpr size_t s_CorrelationCache_MaximumEntries = 4096;
+
+        // Persistent cache of correlation searches known to produce no matches for the current
+        // version of a source. Upgrade re-issues the same system reference searches for
+        // installed packages that no source carries on every run; recording those deterministic
+        // misses lets later runs skip the search entirely. The cache is stamped with the
+        // source's last update time, so updating the source naturally invalidates it.
+        struct CorrelationNegativeCache
+        {
+            CorrelationNegativeCache(const Source& source)
+            {
+                try
+                {
+                    m_sourceStamp = std::chrono::duration_cast<std::chrono::seconds>(source.GetDetails().LastUpdateTime.time_since_epoch()).count();
+                    if (m_sourceStamp == 0)
+                    {
+                        // A source without an update time gives no invalidation signal; do not cache.
+                        return;
+                    }
+
+                    m_path = Runtime::GetPathTo(Runtime::PathName::LocalState) / s_CorrelationCacheDirectory /
+                        (Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(source.GetIdentifier())) + ".txt");
+                    m_enabled = true;
+
+                    std::ifstream stream{ m_path };
+                    if (!stream)
+                    {
+                        return;
+                    }
+
+                    std::string line;
+                    if (!std::getline(stream, line) || line != std::to_string(m_sourceStamp))
+                    {
+                        // The source has been updated since the cache was written.
+                        return;
+                    }
+
+                    while (std::getline(stream, line))
+                    {
+                        if (!line.empty())
+                        {
+                            m_misses.emplace(std::move(line));
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    LOG_CAUGHT_EXCEPTION();
+                    m_enabled = false;
+                }
+            }
+
+            ~CorrelationNegativeCache()
+            {
+                if (!m_enabled || !m_dirty)
+                {
+                    return;
+                }
+
+                try
+                {
+                    std::filesystem::create_directories(m_path.parent_path());
+
+                    std::ofstream stream{ m_path, std::ofstream::trunc };
+                    stream << m_sourceStamp << '\n';
+                    for (const std::string& miss : m_misses)
+                    {
+                        stream << miss << '\n';
+                    }
+                }
+                catch (...)
+                {
+                    LOG_CAUGHT_EXCEPTION();
+                }
+            }
+
+            // Determines whether the given search is a recorded miss against this source version.
+            bool IsKnownMiss(const SearchRequest& request) const
+            {
+                return m_enabled && m_misses.count(HashRequest(request)) != 0;
+            }
+
+            // Records that the given search produced no matches.
+            void RecordMiss(const SearchRequest& request)
+            {
+                if (m_enabled && m_misses.size() < s_CorrelationCache_MaximumEntries)
+                {
+                    m_misses.emplace(HashRequest(request));
+                    m_dirty = true;
+                }
+            }
+
+        private:
+            static std::string HashRequest(const SearchRequest& request)
+            {
+                return Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(request.ToString()));
+            }
+
+            bool m_enabled = false;
+            bool m_dirty = false;
+            int64_t m_sourceStamp = 0;
+            std::filesystem::path m_path;
+            std::set<std::string> m_misses;
+        };
+
         Utility::VersionAndChannel GetVACFromVersion(IPackageVersion* packageVersion)
         {
             return {
@@ -364,6 +721,25 @@ namespace AppInstaller::Repository
                 return m_baseInstalledVersion->GetProperty(property);
             }
 
+            std::vector<Utility::LocIndString> GetProperties(const std::vector<PackageVersionProperty>& properties) const override
+            {
+                std::vector<Utility::LocIndString> result = m_baseInstalledVersion->GetProperties(properties);
+
+                // If there is an override version, use it.
+                if (!m_overrideVersion.empty())
+                {
+                    for (size_t i = 0; i < properties.size(); ++i)
+                    {
+                        if (properties[i] == PackageVersionProperty::Version)
+                        {
+                            result[i] = Utility::LocIndString{ m_overrideVersion };
+                        }
+                    }
+                }
+
+                return result;
+            }
+
             std::vector<Utility::LocIndString> GetMultiProperty(PackageVersionMultiProperty property) const override
             {
                 return m_baseInstalledVersion->GetMultiProperty(property);
@@ -625,10 +1001,26 @@ namespace AppInstaller::Repository
                     std::remove_if(result.begin(), result.end(), [&](const PackageVersionKey& pvk) { return !Utility::ICUCaseInsensitiveEquals(pvk.Channel, channel); }),
                     result.end());
 
-                // Put latest versions at the front; for versions available from multiple sources maintain the order they were added in
-                std::stable_sort(result.begin(), result.end());
+                // Put latest versions at the front; for versions available from multiple sources maintain the order they were added in.
+                // Comparing keys directly parses the version and channel of both sides on every comparison,
+                // so parse each key once up front and sort on the parsed values.
+                std::vector<std::pair<Utility::VersionAndChannel, size_t>> sortKeys;
+                sortKeys.reserve(result.size());
+                for (size_t i = 0; i < result.size(); ++i)
+                {
+                    sortKeys.emplace_back(Utility::VersionAndChannel{ Utility::Version{ result[i].Version }, Utility::Channel{ result[i].Channel } }, i);
+                }
 
-                return result;
+                std::stable_sort(sortKeys.begin(), sortKeys.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+                std::vector<PackageVersionKey> sortedResult;
+                sortedResult.reserve(result.size());
+                for (const auto& sortKey : sortKeys)
+                {
+                    sortedResult.emplace_back(std::move(result[sortKey.second]));
+                }
+
+                return sortedResult;
             }
 
             std::shared_ptr<IPackageVersion> GetLatestAvailableVersion(PinBehavior pinBehavior) const override
@@ -738,6 +1130,20 @@ namespace AppInstaller::Repository
                 }
             }
 
+            // The available packages backing this composite, for correlation key staging.
+            std::vector<std::shared_ptr<IPackage>> GetAvailablePackages() const
+            {
+                std::vector<std::shared_ptr<IPackage>> result;
+                result.reserve(m_availablePackages.size());
+
+                for (const auto& availablePackage : m_availablePackages)
+                {
+                    result.emplace_back(availablePackage.GetPackage());
+                }
+
+                return result;
+            }
+
             const std::shared_ptr<IPackage>& GetTrackingPackage() const
             {
                 return m_trackingPackage;
@@ -765,17 +1171,19 @@ namespace AppInstaller::Repository
                 m_trackingPackageVersion = std::move(trackingPackageVersion);
             }
 
-            // Gets the information about the pins that exist for this package
-            void GetExistingPins(PinningIndex& pinningIndex)
+            // Gets the information about the pins that exist for this package.
+            // The pins for all packages are loaded into the map up front; per package
+            // queries against the pinning database add up on large upgrade scans.
+            void GetExistingPins(const std::map<Pinning::PinKey, Pinning::Pin>& pins)
             {
                 for (auto& availablePackage : m_availablePackages)
                 {
                     Pinning::PinKey pinKey = GetPinKeyForAvailable(availablePackage.GetPackage().get());
 
-                    auto pin = pinningIndex.GetPin(pinKey);
-                    if (pin.has_value())
+                    auto pin = pins.find(pinKey);
+                    if (pin != pins.end())
                     {
-                        availablePackage.SetPin(std::move(pin.value()));
+                        availablePackage.SetPin(Pinning::Pin{ pin->second });
                     }
                 }
 
@@ -785,10 +1193,10 @@ namespace AppInstaller::Repository
                         m_installedPackage->GetProperty(PackageProperty::Id).get()
                     );
 
-                    auto pin = pinningIndex.GetPin(pinKey);
-                    if (pin.has_value())
+                    auto pin = pins.find(pinKey);
+                    if (pin != pins.end())
                     {
-                        m_installedPackage->SetPin(std::move(pin.value()));
+                        m_installedPackage->SetPin(Pinning::Pin{ pin->second });
                     }
                 }
             }
@@ -865,17 +1273,43 @@ namespace AppInstaller::Repository
             CompositeResultMatch(std::shared_ptr<CompositePackage> p, PackageMatchFilter f) : Package(std::move(p)), MatchCriteria(std::move(f)) {}
         };
 
+        // Caches case folded strings so that each distinct string is folded at most once
+        // per composite search operation, as the same installed package strings get
+        // referenced for every available source being correlated.
+        struct FoldCaseCache
+        {
+            const Utility::LocIndString& Fold(std::string_view input)
+            {
+                auto itr = m_cache.find(input);
+                if (itr == m_cache.end())
+                {
+                    itr = m_cache.emplace(input, Utility::LocIndString{ Utility::FoldCase(input) }).first;
+                }
+
+                return itr->second;
+            }
+
+        private:
+            std::map<std::string, Utility::LocIndString, std::less<>> m_cache;
+        };
+
         // Stores data to enable correlation between installed and available packages.
         struct CompositeResult
         {
-            // A system reference string.
-            struct SystemReferenceString
+            // A borrowed view of a system reference string, used to probe the lookup
+            // set without copying the folded strings.
+            struct SystemReferenceStringView
             {
-                SystemReferenceString(PackageMatchField field, Utility::LocIndString string) :
-                    Field(field), String1(Utility::FoldCase(string)) {}
+                PackageMatchField Field;
+                std::string_view String1;
+                std::string_view String2;
+            };
 
-                SystemReferenceString(PackageMatchField field, Utility::LocIndString string1, Utility::LocIndString string2) :
-                    Field(field), String1(Utility::FoldCase(string1)), String2(Utility::FoldCase(string2)) {}
+            // A system reference string; the strings are expected to already be case folded.
+            struct SystemReferenceString
+            {
+                SystemReferenceString(PackageMatchField field, Utility::LocIndString foldedString1, Utility::LocIndString foldedString2 = {}) :
+                    Field(field), String1(std::move(foldedString1)), String2(std::move(foldedString2)) {}
 
                 bool operator<(const SystemReferenceString& other) const
                 {
@@ -897,6 +1331,36 @@ namespace AppInstaller::Repository
                     return Field == other.Field && String1 == other.String1 && String2 == other.String2;
                 }
 
+                friend bool operator<(const SystemReferenceString& lhs, const SystemReferenceStringView& rhs)
+                {
+                    if (lhs.Field != rhs.Field)
+                    {
+                        return lhs.Field < rhs.Field;
+                    }
+
+                    if (lhs.String1.get() != rhs.String1)
+                    {
+                        return lhs.String1.get() < rhs.String1;
+                    }
+
+                    return lhs.String2.get() < rhs.String2;
+                }
+
+                friend bool operator<(const SystemReferenceStringView& lhs, const SystemReferenceString& rhs)
+                {
+                    if (lhs.Field != rhs.Field)
+                    {
+                        return lhs.Field < rhs.Field;
+                    }
+
+                    if (lhs.String1 != rhs.String1.get())
+                    {
+                        return lhs.String1 < rhs.String1.get();
+                    }
+
+                    return lhs.String2 < rhs.String2.get();
+                }
+
                 void AddToFilters(
                     std::vector<PackageMatchFilter>& filters) const
                 {
@@ -920,19 +1384,25 @@ namespace AppInstaller::Repository
             // Data relevant to correlation for a package.
             struct PackageData
             {
-                std::set<SystemReferenceString> SystemReferenceStrings;
+                std::set<SystemReferenceString, std::less<>> SystemReferenceStrings;
 
-                void AddIfNotPresent(SystemReferenceString&& srs)
+                // Probes with a borrowed view of the folded strings; the folded strings
+                // are only copied when a new entry is actually inserted.
+                void AddIfNotPresent(FoldCaseCache& foldCache, PackageMatchField field, std::string_view string1, std::string_view string2 = {})
                 {
-                    if (SystemReferenceStrings.find(srs) == SystemReferenceStrings.end())
+                    const Utility::LocIndString& folded1 = foldCache.Fold(string1);
+                    const Utility::LocIndString& folded2 = foldCache.Fold(string2);
+
+                    if (SystemReferenceStrings.find(SystemReferenceStringView{ field, folded1, folded2 }) == SystemReferenceStrings.end())
                     {
-                        SystemReferenceStrings.emplace(std::move(srs));
+                        SystemReferenceStrings.emplace(field, folded1, folded2);
                     }
                 }
 
                 SearchRequest CreateInclusionsSearchRequest(SearchPurpose searchPurpose) const
                 {
                     SearchRequest result;
+                    result.Inclusions.reserve(SystemReferenceStrings.size());
                     for (const auto& srs : SystemReferenceStrings)
                     {
                         srs.AddToFilters(result.Inclusions);
@@ -956,10 +1426,17 @@ namespace AppInstaller::Repository
             //     downloadManifests: when creating system reference strings, also download manifests to get more data.
             std::optional<PackageData> CheckForExistingResultFromAvailablePackageMatch(const ResultMatch& availableMatch, bool downloadManifests)
             {
-                for (auto& match : Matches)
+                size_t availableKey = CorrelationKey(availableMatch.Package.get());
+
+                for (const auto& [key, matchIndex] : m_availableKeys)
                 {
-                    const CompositePackage* compositeMatch = dynamic_cast<const CompositePackage*>(match.Package.get());
-                    if (compositeMatch && compositeMatch->IsSameAsAnyAvailable(availableMatch.Package.get()))
+                    if (key != availableKey)
+                    {
+                        continue;
+                    }
+
+                    CompositeResultMatch& match = Matches[matchIndex];
+                    if (match.Package->IsSameAsAnyAvailable(availableMatch.Package.get()))
                     {
                         if (ResultMatchComparator{}(availableMatch, match))
                         {
@@ -993,8 +1470,16 @@ namespace AppInstaller::Repository
             // If we don't, return package data for further use.
             std::optional<PackageData> CheckForExistingResultFromTrackingPackageMatch(const ResultMatch& trackingMatch)
             {
-                for (auto& match : Matches)
+                size_t trackingKey = CorrelationKey(trackingMatch.Package.get());
+
+                for (const auto& [key, matchIndex] : m_trackingKeys)
                 {
+                    if (key != trackingKey)
+                    {
+                        continue;
+                    }
+
+                    CompositeResultMatch& match = Matches[matchIndex];
                     const std::shared_ptr<IPackage>& trackingPackage = match.Package->GetTrackingPackage();
                     if (trackingPackage && trackingPackage->IsSame(trackingMatch.Package.get()))
                     {
@@ -1019,9 +1504,16 @@ namespace AppInstaller::Repository
             // Determines if the results contain the given installed package.
             bool ContainsInstalledPackage(const IPackage* installedPackage)
             {
-                for (auto& match : Matches)
+                size_t installedKey = CorrelationKey(installedPackage);
+
+                for (const auto& [key, matchIndex] : m_installedKeys)
                 {
-                    const std::shared_ptr<IPackage>& matchPackage = match.Package->GetInstalledPackage();
+                    if (key != installedKey)
+                    {
+                        continue;
+                    }
+
+                    std::shared_ptr<IPackage> matchPackage = Matches[matchIndex].Package->GetInstalledPackage();
                     if (matchPackage && matchPackage->IsSame(installedPackage))
                     {
                         return true;
@@ -1031,6 +1523,34 @@ namespace AppInstaller::Repository
                 return false;
             }
 
+            // Adds a match to the result, staging its correlation keys into the flat
+            // columns that the merge phase probes. Scanning these contiguous arrays and
+            // only dereferencing a package on a key collision keeps the merge from
+            // walking every match's pointer web for every candidate.
+            void AddMatch(std::shared_ptr<CompositePackage> package, PackageMatchFilter matchCriteria)
+            {
+                size_t matchIndex = Matches.size();
+
+                std::shared_ptr<IPackage> installedPackage = package->GetInstalledPackage();
+                if (installedPackage)
+                {
+                    m_installedKeys.emplace_back(CorrelationKey(installedPackage.get()), matchIndex);
+                }
+
+                const std::shared_ptr<IPackage>& trackingPackage = package->GetTrackingPackage();
+                if (trackingPackage)
+                {
+                    m_trackingKeys.emplace_back(CorrelationKey(trackingPackage.get()), matchIndex);
+                }
+
+                for (const auto& availablePackage : package->GetAvailablePackages())
+                {
+                    m_availableKeys.emplace_back(CorrelationKey(availablePackage.get()), matchIndex);
+                }
+
+                Matches.emplace_back(std::move(package), std::move(matchCriteria));
+            }
+
             // Destructively converts the result to the standard variant.
             operator SearchResult() &&
             {
@@ -1091,11 +1611,64 @@ namespace AppInstaller::Repository
                 return result;
             }
 
+            // Equivalent to SearchAndHandleFailures, but consuming the outcome of a search
+            // that was already performed (typically by the parallel fan-out).
+            SearchResult HandleSearchOutcomeFailures(const Source& source, SourceSearchOutcome&& outcome)
+            {
+                SearchResult result;
+
+                if (outcome.Exception)
+                {
+                    if (AddFailureIfSourceNotPresent({ source.GetDetails().Name, outcome.Exception }))
+                    {
+                        try
+                        {
+                            std::rethrow_exception(outcome.Exception);
+                        }
+                        catch (...)
+                        {
+                            LOG_CAUGHT_EXCEPTION();
+                        }
+                        AICLI_LOG(Repo, Warning, << "Failed to search source for correlation: " << source.GetDetails().Name);
+                    }
+                }
+                else
+                {
+                    result = std::move(outcome.Result);
+                }
+
+                // Move failures into the result
+                for (SearchResult::Failure& failure : result.Failures)
+                {
+                    AddFailureIfSourceNotPresent(std::move(failure));
+                }
+
+                return result;
+            }
+
             std::vector<CompositeResultMatch> Matches;
             bool Truncated = false;
             std::vector<SearchResult::Failure> Failures;
 
         private:
+            // The result object spans the entire composite search, so folded strings are shared
+            // across the correlation of all sources.
+            FoldCaseCache m_foldCache;
+
+            // Flat columns of (correlation key, match index) pairs, appended by AddMatch and
+            // probed by the merge phase lookups above.
+            std::vector<std::pair<size_t, size_t>> m_installedKeys;
+            std::vector<std::pair<size_t, size_t>> m_trackingKeys;
+            std::vector<std::pair<size_t, size_t>> m_availableKeys;
+
+            // Computes the identity prefilter key for a package. Packages for which IsSame
+            // can hold always surface the same Id, so equal packages produce equal keys and
+            // a key mismatch skips the virtual comparison without changing the results.
+            static size_t CorrelationKey(const IPackage* package)
+            {
+                return std::hash<std::string_view>{}(Utility::FoldCase(static_cast<std::string_view>(package->GetProperty(PackageProperty::Id))));
+            }
+
             void AddSystemReferenceStrings(IPackageVersion* version, PackageData& data)
             {
                 GetSystemReferenceStrings(
@@ -1125,24 +1698,21 @@ namespace AppInstaller::Repository
             {
                 for (const auto& pfn : manifest.GetPackageFamilyNames())
                 {
-                    data.AddIfNotPresent(SystemReferenceString{ PackageMatchField::PackageFamilyName, Utility::LocIndString{ pfn } });
+                    data.AddIfNotPresent(m_foldCache, PackageMatchField::PackageFamilyName, pfn);
                 }
                 for (const auto& productCode : manifest.GetProductCodes())
                 {
-                    data.AddIfNotPresent(SystemReferenceString{ PackageMatchField::ProductCode, Utility::LocIndString{ productCode } });
+                    data.AddIfNotPresent(m_foldCache, PackageMatchField::ProductCode, productCode);
                 }
                 for (const auto& upgradeCode : manifest.GetUpgradeCodes())
                 {
-                    data.AddIfNotPresent(SystemReferenceString{ PackageMatchField::UpgradeCode, Utility::LocIndString{ upgradeCode } });
+                    data.AddIfNotPresent(m_foldCache, PackageMatchField::UpgradeCode, upgradeCode);
                 }
                 for (const auto& name : manifest.GetPackageNames())
                 {
                     for (const auto& publisher : manifest.GetPublishers())
                     {
-                        data.AddIfNotPresent(SystemReferenceString{
-                            PackageMatchField::NormalizedNameAndPublisher,
-                            Utility::LocIndString{ name },
-                            Utility::LocIndString{ publisher } });
+                        data.AddIfNotPresent(m_foldCache, PackageMatchField::NormalizedNameAndPublisher, name, publisher);
                     }
                 }
             }
@@ -1153,9 +1723,9 @@ namespace AppInstaller::Repository
                 PackageMatchField field,
                 PackageData& data)
             {
-                for (auto&& string : installedVersion->GetMultiProperty(prop))
+                for (const auto& string : installedVersion->GetMultiProperty(prop))
                 {
-                    data.AddIfNotPresent(SystemReferenceString{ field, std::move(string) });
+                    data.AddIfNotPresent(m_foldCache, field, string);
                 }
             }
 
@@ -1173,10 +1743,7 @@ namespace AppInstaller::Repository
                 {
                     for (size_t j = 0; j < publishers.size(); ++j)
                     {
-                        data.AddIfNotPresent(SystemReferenceString{
-                            PackageMatchField::NormalizedNameAndPublisher,
-                            names[i],
-                            publishers[j] });
+                        data.AddIfNotPresent(m_foldCache, PackageMatchField::NormalizedNameAndPublisher, names[i], publishers[j]);
                     }
                 }
             }
@@ -1210,13 +1777,22 @@ namespace AppInstaller::Repository
         {
             if (ExperimentalFeature::IsEnabled(ExperimentalFeature::Feature::Pinning) && !result.Matches.empty())
             {
-                // Look up any pins for the packages found
+                // Look up any pins for the packages found.
+                // Load the whole pin set once; pin counts are small and this turns
+                // hundreds of per package queries into a single statement.
                 auto pinningIndex = PinningIndex::OpenOrCreateDefault();
                 if (pinningIndex)
                 {
+                    std::map<Pinning::PinKey, Pinning::Pin> pins;
+                    for (Pinning::Pin& pin : pinningIndex->GetAllPins())
+                    {
+                        Pinning::PinKey key = pin.GetKey();
+                        pins.emplace(std::move(key), std::move(pin));
+                    }
+
                     for (auto& match : result.Matches)
                     {
-                        match.Package->GetExistingPins(*pinningIndex);
+                        match.Package->GetExistingPins(pins);
                     }
                 }
             }
@@ -1304,6 +1880,10 @@ namespace AppInstaller::Repository
             SearchResult installedResult = m_installedSource.Search(request);
             result.Truncated = installedResult.Truncated;
 
+            // Per available source caches of correlation searches known to produce no matches,
+            // created lazily and persisted when they go out of scope.
+            std::map<std::string, std::unique_ptr<CorrelationNegativeCache>> negativeCaches;
+
             for (auto&& match : installedResult.Matches)
             {
                 if (!match.Package)
@@ -1404,10 +1984,29 @@ namespace AppInstaller::Repository
                             continue;
                         }
 
+                        auto& negativeCache = negativeCaches[source.GetIdentifier()];
+                        if (!negativeCache)
+                        {
+                            negativeCache = std::make_unique<CorrelationNegativeCache>(source);
+                        }
+
+                        if (negativeCache->IsKnownMiss(systemReferenceSearch))
+                        {
+                            AICLI_LOG(Repo, Verbose, << "Skipping search against source [" << source.GetIdentifier() << "]; it is a known miss for this source version");
+                            continue;
+                        }
+
+                        size_t failuresBefore = result.Failures.size();
                         SearchResult availableResult = result.SearchAndHandleFailures(source, systemReferenceSearch);
 
                         if (availableResult.Matches.empty())
                         {
+                            // Only record a miss when the source actually answered; a failed search
+                            // is transient and must not be cached as a deterministic miss.
+                            if (result.Failures.size() == failuresBefore)
+                            {
+                                negativeCache->RecordMiss(systemReferenceSearch);
+                            }
                             continue;
                         }
 
@@ -1428,7 +2027,7 @@ namespace AppInstaller::Repository
                 }
 
                 // Move the installed result into the composite result
-                result.Matches.emplace_back(std::move(compositePackage), std::move(match.MatchCriteria));
+                result.AddMatch(std::move(compositePackage), std::move(match.MatchCriteria));
             }
 
             // Optimization for the "everything installed" case, no need to allow for reverse correlations
@@ -1439,9 +2038,15 @@ namespace AppInstaller::Repository
             }
         }
 
+        // Search all available sources in parallel up front; the merge below consumes the
+        // outcomes in source order so that results remain deterministic.
+        std::vector<SourceSearchOutcome> availableOutcomes = SearchSourcesInParallel(m_availableSources, request);
+
         // Search available sources
-        for (const auto& source : m_availableSources)
+        for (size_t sourceIndex = 0; sourceIndex < m_availableSources.size(); ++sourceIndex)
         {
+            const auto& source = m_availableSources[sourceIndex];
+
             // Search the tracking catalog as it can potentially get better correlations
             auto trackingCatalog = source.GetTrackingCatalog();
             SearchResult trackingResult = trackingCatalog.Search(request);
@@ -1486,12 +2091,12 @@ namespace AppInstaller::Repository
 
                         compositePackage->SetTracking(source, std::move(match.Package), std::move(trackingPackageVersion));
 
-                        result.Matches.emplace_back(std::move(compositePackage), match.MatchCriteria);
+                        result.AddMatch(std::move(compositePackage), match.MatchCriteria);
                     }
                 }
             }
 
-            SearchResult availableResult = result.SearchAndHandleFailures(source, request);
+            SearchResult availableResult = result.HandleSearchOutcomeFailures(source, std::move(availableOutcomes[sourceIndex]));
 
             for (auto&& match : availableResult.Matches)
             {
@@ -1531,14 +2136,14 @@ namespace AppInstaller::Repository
                     {
                         // TODO: Needs a whole separate change to fix the fact that we don't support multiple available packages and what the different search behaviors mean
                         foundInstalledMatch = true;
-                        result.Matches.emplace_back(std::make_shared<CompositePackage>(std::move(installedPackage), std::move(match.Package)), match.MatchCriteria);
+                        result.AddMatch(std::make_shared<CompositePackage>(std::move(installedPackage), std::move(match.Package)), match.MatchCriteria);
                     }
                 }
 
                 // If there was no correlation for this package, add it without one.
                 if ((m_searchBehavior == CompositeSearchBehavior::AllPackages || m_searchBehavior == CompositeSearchBehavior::AvailablePackages) && !foundInstalledMatch)
                 {
-                    result.Matches.emplace_back(std::make_shared<CompositePackage>(std::shared_ptr<IPackage>{}, std::move(match.Package)), match.MatchCriteria);
+                    result.AddMatch(std::make_shared<CompositePackage>(std::shared_ptr<IPackage>{}, std::move(match.Package)), match.MatchCriteria);
                 }
             }
         }
@@ -1560,25 +2165,31 @@ namespace AppInstaller::Repository
     {
         SearchResult result;
 
-        // Search available sources
-        for (const auto& source : m_availableSources)
+        // Search available sources in parallel, merging in source order.
+        std::vector<SourceSearchOutcome> outcomes = SearchSourcesInParallel(m_availableSources, request);
+
+        for (size_t sourceIndex = 0; sourceIndex < m_availableSources.size(); ++sourceIndex)
         {
-            SearchResult oneSourceResult;
+            const auto& source = m_availableSources[sourceIndex];
+            SourceSearchOutcome& outcome = outcomes[sourceIndex];
 
-            try
-            {
-                oneSourceResult = source.Search(request);
-            }
-            catch (...)
+            if (outcome.Exception)
             {
-                LOG_CAUGHT_EXCEPTION();
+                try
+                {
+                    std::rethrow_exception(outcome.Exception);
+                }
+                catch (...)
+                {
+                    LOG_CAUGHT_EXCEPTION();
+                }
                 AICLI_LOG(Repo, Warning, << "Failed to search source: " << source.GetDetails().Name);
-                result.Failures.emplace_back(SearchResult::Failure{ source.GetDetails().Name, std::current_exception() });
+                result.Failures.emplace_back(SearchResult::Failure{ source.GetDetails().Name, outcome.Exception });
             }
 
             // Move into the single result
-            std::move(oneSourceResult.Matches.begin(), oneSourceResult.Matches.end(), std::back_inserter(result.Matches));
-            std::move(oneSourceResult.Failures.begin(), oneSourceResult.Failures.end(), std::back_inserter(result.Failures));
+            std::move(outcome.Result.Matches.begin(), outcome.Result.Matches.end(), std::back_inserter(result.Matches));
+            std::move(outcome.Result.Failures.begin(), outcome.Result.Failures.end(), std::back_inserter(result.Failures));
         }
 
         SortResultMatches(result.Matches);
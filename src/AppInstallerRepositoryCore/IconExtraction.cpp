@@ -10,9 +10,110 @@
 namespace AppInstaller::Repository
 {
     using namespace AppInstaller::Repository::Microsoft;
+    using namespace std::string_view_literals;
 
     namespace
     {
+        constexpr std::string_view s_IconCacheDirectory = "iconCache"sv;
+
+        // The maximum number of icons kept in the on disk cache; least recently used entries
+        // beyond this are removed when a new icon is stored.
+        constexpr size_t s_IconCacheSizeLimit = 128;
+
+        // Gets the cache file path for the given ARP entry identity.
+        std::filesystem::path GetIconCacheFilePath(const std::string& productCode, Manifest::ScopeEnum scope)
+        {
+            std::string cacheIdentity = productCode;
+            cacheIdentity += '|';
+            cacheIdentity += Manifest::ScopeToString(scope);
+
+            return Runtime::GetPathTo(Runtime::PathName::LocalState) / s_IconCacheDirectory /
+                (Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(cacheIdentity)) + ".ico");
+        }
+
+        // Best effort load of a cached icon; any failure behaves as a cache miss.
+        // A hit refreshes the file time so that the entry stays resident in the cache.
+        std::optional<std::vector<BYTE>> TryLoadCachedIcon(const std::filesystem::path& cachePath)
+        {
+            try
+            {
+                if (cachePath.empty() || !std::filesystem::exists(cachePath))
+                {
+                    return std::nullopt;
+                }
+
+                std::ifstream iconFile{ cachePath, std::ios::in | std::ios::binary };
+                std::vector<BYTE> result = Utility::ReadEntireStreamAsByteArray(iconFile);
+                if (result.empty())
+                {
+                    return std::nullopt;
+                }
+
+                std::filesystem::last_write_time(cachePath, std::filesystem::file_time_type::clock::now());
+                return result;
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+                return std::nullopt;
+            }
+        }
+
+        // Best effort persistence of an extracted icon, trimming the least recently
+        // used entries when the cache exceeds its size limit.
+        void TrySaveCachedIcon(const std::filesystem::path& cachePath, const std::vector<BYTE>& iconContent)
+        {
+            try
+            {
+                if (cachePath.empty() || iconContent.empty())
+                {
+                    return;
+                }
+
+                std::filesystem::create_directories(cachePath.parent_path());
+
+                {
+                    std::ofstream iconFile{ cachePath, std::ios::out | std::ios::binary | std::ios::trunc };
+                    iconFile.write(reinterpret_cast<const char*>(iconContent.data()), iconContent.size());
+                }
+
+                std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> entries;
+                for (const auto& entry : std::filesystem::directory_iterator{ cachePath.parent_path() })
+                {
+                    if (entry.is_regular_file())
+                    {
+                        entries.emplace_back(entry.last_write_time(), entry.path());
+                    }
+                }
+
+                if (entries.size() > s_IconCacheSizeLimit)
+                {
+                    std::sort(entries.begin(), entries.end());
+                    for (size_t i = 0; i < entries.size() - s_IconCacheSizeLimit; ++i)
+                    {
+                        std::filesystem::remove(entries[i].second);
+                    }
+                }
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+                AICLI_LOG(Repo, Warning, << "Failed to save icon cache entry");
+            }
+        }
+
+        // Constructs the extracted icon info for .ico contents.
+        ExtractedIconInfo CreateIcoIconInfo(std::vector<BYTE>&& iconContent)
+        {
+            ExtractedIconInfo iconInfo;
+            iconInfo.IconFileType = Manifest::IconFileTypeEnum::Ico;
+            iconInfo.IconTheme = Manifest::IconThemeEnum::Default;
+            iconInfo.IconResolution = Manifest::IconResolutionEnum::Custom;
+            iconInfo.IconSha256 = Utility::SHA256::ComputeHash(iconContent.data(), static_cast<uint32_t>(iconContent.size()));
+            iconInfo.IconContent = std::move(iconContent);
+            return iconInfo;
+        }
+
         // Struct used as data object passed to Enumerate callback function of EnumResourceNamesEx
         struct EnumGroupIconProcParameter
         {
@@ -232,6 +333,13 @@ namespace AppInstaller::Repository
         }
 #endif
 
+        std::filesystem::path cachePath = GetIconCacheFilePath(productCode, scope);
+        std::optional<std::vector<BYTE>> cachedIcon = TryLoadCachedIcon(cachePath);
+        if (cachedIcon)
+        {
+            return { CreateIcoIconInfo(std::move(cachedIcon.value())) };
+        }
+
         ARPHelper arpHelper;
         Registry::Key arpEntry = arpHelper.FindARPEntry(productCode, scope);
 
@@ -289,14 +397,9 @@ namespace AppInstaller::Repository
                     // Construct ExtractedIconInfo return result
                     if (!iconContent.empty())
                     {
-                        ExtractedIconInfo iconInfo;
-                        iconInfo.IconFileType = Manifest::IconFileTypeEnum::Ico;
-                        iconInfo.IconTheme = Manifest::IconThemeEnum::Default;
-                        iconInfo.IconResolution = Manifest::IconResolutionEnum::Custom;
-                        iconInfo.IconSha256 = Utility::SHA256::ComputeHash(iconContent.data(), static_cast<uint32_t>(iconContent.size()));
-                        iconInfo.IconContent = std::move(iconContent);
-
-                        return { std::move(iconInfo) };
+                        TrySaveCachedIcon(cachePath, iconContent);
+
+                        return { CreateIcoIconInfo(std::move(iconContent)) };
                     }
                 }
             }
@@ -304,4 +407,12 @@ namespace AppInstaller::Repository
 
         return {};
     }
+
+    std::future<std::vector<ExtractedIconInfo>> ExtractIconFromArpEntryAsync(std::string productCode, Manifest::ScopeEnum scope)
+    {
+        return std::async(std::launch::async, [productCode = std::move(productCode), scope]()
+            {
+                return ExtractIconFromArpEntry(productCode, scope);
+            });
+    }
 }
\ No newline at end of file
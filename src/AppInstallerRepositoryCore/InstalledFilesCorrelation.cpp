@@ -14,13 +14,38 @@ namespace AppInstaller::Repository::Correlation
     namespace
     {
         constexpr std::string_view s_ShellLinkFileExtension = ".lnk"sv;
-        const std::vector<std::pair<std::filesystem::path, std::string>> s_CandidateInstallLocationRoots =
+
+        struct CandidateInstallLocationRoot
         {
-            { Filesystem::GetKnownFolderPath(FOLDERID_LocalAppData), "%LOCALAPPDATA%" },
-            { Filesystem::GetKnownFolderPath(FOLDERID_ProgramFiles), "%PROGRAMFILES%" },
-            { Filesystem::GetKnownFolderPath(FOLDERID_ProgramFilesX86), "%PROGRAMFILES(X86)%" },
+            std::filesystem::path Path;
+            // Canonicalizing stats the path; the roots never change, so it is done once.
+            std::filesystem::path CanonicalPath;
+            std::string UnexpandedName;
         };
 
+        const std::vector<CandidateInstallLocationRoot>& GetCandidateInstallLocationRoots()
+        {
+            static const std::vector<CandidateInstallLocationRoot> s_candidateInstallLocationRoots = []()
+            {
+                std::vector<CandidateInstallLocationRoot> result;
+
+                auto addRoot = [&](const KNOWNFOLDERID& id, std::string unexpandedName)
+                {
+                    std::filesystem::path path = Filesystem::GetKnownFolderPath(id);
+                    std::filesystem::path canonicalPath = std::filesystem::weakly_canonical(path);
+                    result.emplace_back(CandidateInstallLocationRoot{ std::move(path), std::move(canonicalPath), std::move(unexpandedName) });
+                };
+
+                addRoot(FOLDERID_LocalAppData, "%LOCALAPPDATA%");
+                addRoot(FOLDERID_ProgramFiles, "%PROGRAMFILES%");
+                addRoot(FOLDERID_ProgramFilesX86, "%PROGRAMFILES(X86)%");
+
+                return result;
+            }();
+
+            return s_candidateInstallLocationRoots;
+        }
+
         // Contains shell link info
         struct ShellLinkFileInfo
         {
@@ -118,12 +143,11 @@ namespace AppInstaller::Repository::Correlation
         }
 
         // Returns nullopt if path is not under base.
-        std::optional<std::filesystem::path> GetRelativePath(const std::filesystem::path& path, const std::filesystem::path& base)
+        // Both paths must already be canonical; the computation is purely lexical so that
+        // correlating many files does not stat the same directories over and over.
+        std::optional<std::filesystem::path> GetRelativePathFromCanonical(const std::filesystem::path& canonicalPath, const std::filesystem::path& canonicalBase)
         {
-            auto canonicalPath = std::filesystem::weakly_canonical(path);
-            auto canonicalBase = std::filesystem::weakly_canonical(base);
-
-            auto relativePath = std::filesystem::relative(canonicalPath, canonicalBase);
+            auto relativePath = canonicalPath.lexically_relative(canonicalBase);
             if (!relativePath.empty() && *relativePath.begin() != "." && *relativePath.begin() != "..")
             {
                 return relativePath;
@@ -134,13 +158,13 @@ namespace AppInstaller::Repository::Correlation
             }
         }
 
-        std::optional<std::filesystem::path> CheckOneInstallLocation(const std::filesystem::path& childFile, const std::filesystem::path& baseFolder)
+        std::optional<std::filesystem::path> CheckOneInstallLocation(const std::filesystem::path& canonicalChildFile, const CandidateInstallLocationRoot& root)
         {
-            auto relativePath = GetRelativePath(childFile, baseFolder);
+            auto relativePath = GetRelativePathFromCanonical(canonicalChildFile, root.CanonicalPath);
             if (relativePath)
             {
                 // TODO: Here we assume the install location is the top directory of relative path.
-                auto installLocation = baseFolder / *relativePath->begin();
+                auto installLocation = root.Path / *relativePath->begin();
                 if (std::filesystem::exists(installLocation) && std::filesystem::is_directory(installLocation))
                 {
                     return installLocation;
@@ -151,11 +175,11 @@ namespace AppInstaller::Repository::Correlation
         }
 
         // If install location is not provided in arp entry, try LocalAppData folder and Program Files folders.
-        std::optional<std::filesystem::path> CheckInstallLocation(const std::filesystem::path& path)
+        std::optional<std::filesystem::path> CheckInstallLocation(const std::filesystem::path& canonicalPath)
         {
-            for (auto const& entry : s_CandidateInstallLocationRoots)
+            for (auto const& entry : GetCandidateInstallLocationRoots())
             {
-                auto installLocation = CheckOneInstallLocation(path, entry.first);
+                auto installLocation = CheckOneInstallLocation(canonicalPath, entry);
                 if (installLocation)
                 {
                     return installLocation;
@@ -189,9 +213,9 @@ namespace AppInstaller::Repository::Correlation
         {
             // Try to match the candidate install location roots first.
             std::filesystem::path resultInstallLocation = installLocation;
-            for (auto const& entry : s_CandidateInstallLocationRoots)
+            for (auto const& entry : GetCandidateInstallLocationRoots())
             {
-                if (Filesystem::ReplaceCommonPathPrefix(resultInstallLocation, entry.first, entry.second))
+                if (Filesystem::ReplaceCommonPathPrefix(resultInstallLocation, entry.Path, entry.UnexpandedName))
                 {
                     return resultInstallLocation.u8string();
                 }
@@ -258,10 +282,15 @@ namespace AppInstaller::Repository::Correlation
         InstallationMetadata result;
 
         std::filesystem::path installLocation;
+        // Canonicalized alongside installLocation so that each file only pays for
+        // canonicalizing its own path rather than re-canonicalizing the location.
+        std::filesystem::path canonicalInstallLocation;
+
         // Use arp install location if provided
         if (!arpInstallLocation.empty())
         {
             installLocation = Filesystem::GetExpandedPath(arpInstallLocation);
+            canonicalInstallLocation = std::filesystem::weakly_canonical(installLocation);
         }
 
         for (auto const& files : m_files)
@@ -277,19 +306,22 @@ namespace AppInstaller::Repository::Correlation
                     // Collect installed files metadata if exist
                     if (std::filesystem::exists(linkInfo->Path) && std::filesystem::is_regular_file(linkInfo->Path))
                     {
+                        auto canonicalFilePath = std::filesystem::weakly_canonical(linkInfo->Path);
+
                         if (installLocation.empty())
                         {
                             // TODO: In most cases, installed files are under same folder, so use the first file to determine install location at the moment.
-                            auto location = CheckInstallLocation(linkInfo->Path);
+                            auto location = CheckInstallLocation(canonicalFilePath);
                             if (!location)
                             {
                                 continue;
                             }
 
                             installLocation = location.value();
+                            canonicalInstallLocation = std::filesystem::weakly_canonical(installLocation);
                         }
 
-                        auto relativePath = GetRelativePath(linkInfo->Path, installLocation);
+                        auto relativePath = GetRelativePathFromCanonical(canonicalFilePath, canonicalInstallLocation);
                         if (relativePath)
                         {
                             AppInstaller::Manifest::InstalledFile fileEntry;
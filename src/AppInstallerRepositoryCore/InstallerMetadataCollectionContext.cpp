@@ -794,29 +794,94 @@ namespace AppInstaller::Repository::Metadata
     std::unique_ptr<InstallerMetadataCollectionContext> InstallerMetadataCollectionContext::FromFile(const std::filesystem::path& file, const std::filesystem::path& logFile)
     {
         THROW_HR_IF(E_INVALIDARG, file.empty());
-        THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND), !std::filesystem::exists(file));
 
         std::unique_ptr<InstallerMetadataCollectionContext> result = std::make_unique<InstallerMetadataCollectionContext>();
-        auto threadGlobalsLifetime = result->InitializeLogging(logFile);
+        result->InitializeFromFile(file, logFile);
 
-        AICLI_LOG(Repo, Info, << "Opening InstallerMetadataCollectionContext input file: " << file);
-        std::ifstream fileStream{ file };
+        return result;
+    }
 
-        auto content = ReadEntireStream(fileStream);
-        // CppRestSdk's implementation of json parsing does not work with '\0', so trimming them here
-        content.erase(std::find(content.begin(), content.end(), '\0'), content.end());
+    std::unique_ptr<InstallerMetadataCollectionContext> InstallerMetadataCollectionContext::FromURI(std::wstring_view uri, const std::filesystem::path& logFile)
+    {
+        THROW_HR_IF(E_INVALIDARG, uri.empty());
 
-        result->InitializePreinstallState(ConvertToUTF16(content));
+        std::unique_ptr<InstallerMetadataCollectionContext> result = std::make_unique<InstallerMetadataCollectionContext>();
+        result->InitializeFromURI(std::wstring{ uri }, logFile);
 
         return result;
     }
 
-    std::unique_ptr<InstallerMetadataCollectionContext> InstallerMetadataCollectionContext::FromURI(std::wstring_view uri, const std::filesystem::path& logFile)
+    std::unique_ptr<InstallerMetadataCollectionContext> InstallerMetadataCollectionContext::FromJSON(const std::wstring& json, const std::filesystem::path& logFile)
+    {
+        THROW_HR_IF(E_INVALIDARG, json.empty());
+
+        std::unique_ptr<InstallerMetadataCollectionContext> result = std::make_unique<InstallerMetadataCollectionContext>();
+        result->InitializeFromJSON(json, logFile);
+
+        return result;
+    }
+
+    std::unique_ptr<InstallerMetadataCollectionContext> InstallerMetadataCollectionContext::FromFileAsync(const std::filesystem::path& file, const std::filesystem::path& logFile)
+    {
+        THROW_HR_IF(E_INVALIDARG, file.empty());
+
+        std::unique_ptr<InstallerMetadataCollectionContext> result = std::make_unique<InstallerMetadataCollectionContext>();
+        InstallerMetadataCollectionContext* context = result.get();
+        result->m_initialization = std::async(std::launch::async, [context, file, logFile]()
+            {
+                context->InitializeFromFile(file, logFile);
+            });
+
+        return result;
+    }
+
+    std::unique_ptr<InstallerMetadataCollectionContext> InstallerMetadataCollectionContext::FromURIAsync(std::wstring_view uri, const std::filesystem::path& logFile)
     {
         THROW_HR_IF(E_INVALIDARG, uri.empty());
 
         std::unique_ptr<InstallerMetadataCollectionContext> result = std::make_unique<InstallerMetadataCollectionContext>();
-        auto threadGlobalsLifetime = result->InitializeLogging(logFile);
+        InstallerMetadataCollectionContext* context = result.get();
+        result->m_initialization = std::async(std::launch::async, [context, uri = std::wstring{ uri }, logFile]()
+            {
+                context->InitializeFromURI(uri, logFile);
+            });
+
+        return result;
+    }
+
+    std::unique_ptr<InstallerMetadataCollectionContext> InstallerMetadataCollectionContext::FromJSONAsync(const std::wstring& json, const std::filesystem::path& logFile)
+    {
+        THROW_HR_IF(E_INVALIDARG, json.empty());
+
+        std::unique_ptr<InstallerMetadataCollectionContext> result = std::make_unique<InstallerMetadataCollectionContext>();
+        InstallerMetadataCollectionContext* context = result.get();
+        result->m_initialization = std::async(std::launch::async, [context, json, logFile]()
+            {
+                context->InitializeFromJSON(json, logFile);
+            });
+
+        return result;
+    }
+
+    void InstallerMetadataCollectionContext::InitializeFromFile(const std::filesystem::path& file, const std::filesystem::path& logFile)
+    {
+        THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND), !std::filesystem::exists(file));
+
+        auto threadGlobalsLifetime = InitializeLogging(logFile);
+
+        AICLI_LOG(Repo, Info, << "Opening InstallerMetadataCollectionContext input file: " << file);
+        std::ifstream fileStream{ file };
+
+        auto content = ReadEntireStream(fileStream);
+        // CppRestSdk's implementation of json parsing does not work with '\0', so trimming them here
+        content.erase(std::find(content.begin(), content.end(), '\0'), content.end());
+
+        InitializePreinstallState(ConvertToUTF16(content));
+    }
+
+    void InstallerMetadataCollectionContext::InitializeFromURI(const std::wstring& uri, const std::filesystem::path& logFile)
+    {
+        auto threadGlobalsLifetime = InitializeLogging(logFile);
 
         std::string utf8Uri = ConvertToUTF8(uri);
         THROW_HR_IF(E_INVALIDARG, !IsUrlRemote(utf8Uri));
@@ -848,24 +913,27 @@ namespace AppInstaller::Repository::Metadata
             }
         }
 
-        result->InitializePreinstallState(ConvertToUTF16(jsonStream.str()));
-
-        return result;
+        InitializePreinstallState(ConvertToUTF16(jsonStream.str()));
     }
 
-    std::unique_ptr<InstallerMetadataCollectionContext> InstallerMetadataCollectionContext::FromJSON(const std::wstring& json, const std::filesystem::path& logFile)
+    void InstallerMetadataCollectionContext::InitializeFromJSON(const std::wstring& json, const std::filesystem::path& logFile)
     {
-        THROW_HR_IF(E_INVALIDARG, json.empty());
-
-        std::unique_ptr<InstallerMetadataCollectionContext> result = std::make_unique<InstallerMetadataCollectionContext>();
-        auto threadGlobalsLifetime = result->InitializeLogging(logFile);
-        result->InitializePreinstallState(json);
+        auto threadGlobalsLifetime = InitializeLogging(logFile);
+        InitializePreinstallState(json);
+    }
 
-        return result;
+    void InstallerMetadataCollectionContext::WaitForInitialization()
+    {
+        if (m_initialization.valid())
+        {
+            m_initialization.get();
+        }
     }
 
     void InstallerMetadataCollectionContext::Complete(const std::filesystem::path& output)
     {
+        WaitForInitialization();
+
         auto threadGlobalsLifetime = m_threadGlobals.SetForCurrentThread();
 
         THROW_HR_IF(E_INVALIDARG, !output.has_filename());
@@ -883,6 +951,8 @@ namespace AppInstaller::Repository::Metadata
 
     void InstallerMetadataCollectionContext::Complete(std::ostream& output)
     {
+        WaitForInitialization();
+
         auto threadGlobalsLifetime = m_threadGlobals.SetForCurrentThread();
         CompleteWithThreadGlobalsSet(output);
     }
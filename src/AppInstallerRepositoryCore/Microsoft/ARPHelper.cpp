@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "ARPHelper.h"
+#include "winget/NameNormalization.h"
 #include "winget/PortableARPEntry.h"
 
 namespace AppInstaller::Repository::Microsoft
@@ -58,50 +59,49 @@ namespace AppInstaller::Repository::Microsoft
 
             return unpacked;
         }
+    }
 
-        // Gets a mapping from ProductCode to UpgradeCode for MSI packages.
-        std::map<std::string, std::string> GetUpgradeCodes()
+    std::map<std::string, std::string> ARPHelper::GetUpgradeCodes() const
+    {
+        // The UpgradeCode is not stored in the ARP registry keys, so we have to get it separately.
+        // We could use MsiGetProductProperty or MsiGetProperty from the MSI API to query it,
+        // but it is very slow.
+        //
+        // The UpgradeCode is also stored in the registry under
+        //   HKLM\SOFTWARE\Microsoft\Windows\CurrentVersion\Installer\UpgradeCodes
+        // (Note that this key is not documented, so it is possible that it will change but very unlikely...)
+        //
+        // Under 'UpgradeCodes' there is one key for each upgrade code, and each upgrade code key
+        // contains the product code as a value. All the upgrade codes and product codes are GUIDs,
+        // but represented in an unusual way - see TryUnpackUpgradeCodeGuid()
+
+        AICLI_LOG(Repo, Info, << "Reading MSI UpgradeCodes");
+        std::map<std::string, std::string> upgradeCodes;
+
+        // There is no UpgradeCodes key on the x86 view of the registry
+        Registry::Key upgradeCodesKey = Registry::Key::OpenIfExists(HKEY_LOCAL_MACHINE, "SOFTWARE\\Microsoft\\Windows\\CurrentVersion\\Installer\\UpgradeCodes", 0, KEY_READ | KEY_WOW64_64KEY);
+
+        if (upgradeCodesKey)
         {
-            // The UpgradeCode is not stored in the ARP registry keys, so we have to get it separately.
-            // We could use MsiGetProductProperty or MsiGetProperty from the MSI API to query it,
-            // but it is very slow.
-            //
-            // The UpgradeCode is also stored in the registry under
-            //   HKLM\SOFTWARE\Microsoft\Windows\CurrentVersion\Installer\UpgradeCodes
-            // (Note that this key is not documented, so it is possible that it will change but very unlikely...)
-            //
-            // Under 'UpgradeCodes' there is one key for each upgrade code, and each upgrade code key
-            // contains the product code as a value. All the upgrade codes and product codes are GUIDs,
-            // but represented in an unusual way - see TryUnpackUpgradeCodeGuid()
-
-            AICLI_LOG(Repo, Info, << "Reading MSI UpgradeCodes");
-            std::map<std::string, std::string> upgradeCodes;
-
-            // There is no UpgradeCodes key on the x86 view of the registry
-            Registry::Key upgradeCodesKey = Registry::Key::OpenIfExists(HKEY_LOCAL_MACHINE, "SOFTWARE\\Microsoft\\Windows\\CurrentVersion\\Installer\\UpgradeCodes", 0, KEY_READ | KEY_WOW64_64KEY);
-
-            if (upgradeCodesKey)
+            for (const auto& upgradeCodeKeyRef : upgradeCodesKey)
             {
-                for (const auto& upgradeCodeKeyRef : upgradeCodesKey)
+                auto upgradeCode = TryUnpackUpgradeCodeGuid(upgradeCodeKeyRef.Name());
+                if (upgradeCode)
                 {
-                    auto upgradeCode = TryUnpackUpgradeCodeGuid(upgradeCodeKeyRef.Name());
-                    if (upgradeCode)
+                    auto upgradeCodeKey = upgradeCodeKeyRef.Open();
+                    for (const auto& productCodeValue : upgradeCodeKey.Values())
                     {
-                        auto upgradeCodeKey = upgradeCodeKeyRef.Open();
-                        for (const auto& productCodeValue : upgradeCodeKey.Values())
+                        auto productCode = TryUnpackUpgradeCodeGuid(productCodeValue.Name());
+                        if (productCode)
                         {
-                            auto productCode = TryUnpackUpgradeCodeGuid(productCodeValue.Name());
-                            if (productCode)
-                            {
-                                upgradeCodes[*productCode] = *upgradeCode;
-                            }
+                            upgradeCodes[*productCode] = *upgradeCode;
                         }
                     }
                 }
             }
-
-            return upgradeCodes;
         }
+
+        return upgradeCodes;
     }
 
     Registry::Key ARPHelper::GetARPKey(Manifest::ScopeEnum scope, Utility::Architecture architecture) const
@@ -228,27 +228,65 @@ namespace AppInstaller::Repository::Microsoft
         return {};
     }
 
+    namespace
+    {
+        // The value read helpers are shared between keys and value snapshots,
+        // which expose the same lookup operator.
+        template <typename ValueSource>
+        bool GetBoolValueImpl(const ValueSource& source, const std::wstring& name)
+        {
+            auto value = source[name];
+            return (value && value->GetType() == Registry::Value::Type::DWord && value->GetValue<Registry::Value::Type::DWord>());
+        }
+
+        template <typename ValueSource>
+        std::string GetStringValueImpl(const ValueSource& source, const std::wstring& name)
+        {
+            auto value = source[name];
+            if (value && value->GetType() == Registry::Value::Type::String)
+            {
+                return value->GetValue<Registry::Value::Type::String>();
+            }
+
+            return {};
+        }
+    }
+
     bool ARPHelper::GetBoolValue(const Registry::Key& arpKey, const std::wstring& name)
     {
-        auto value = arpKey[name];
-        return (value && value->GetType() == Registry::Value::Type::DWord && value->GetValue<Registry::Value::Type::DWord>());
+        return GetBoolValueImpl(arpKey, name);
+    }
+
+    bool ARPHelper::GetBoolValue(const Registry::ValueSnapshot& arpValues, const std::wstring& name)
+    {
+        return GetBoolValueImpl(arpValues, name);
     }
 
     std::string ARPHelper::GetStringValue(const Registry::Key& arpKey, const std::wstring& name)
     {
-        auto value = arpKey[name];
-        if (value && value->GetType() == Registry::Value::Type::String)
-        {
-            return value->GetValue<Registry::Value::Type::String>();
-        }
+        return GetStringValueImpl(arpKey, name);
+    }
 
-        return {};
+    std::string ARPHelper::GetStringValue(const Registry::ValueSnapshot& arpValues, const std::wstring& name)
+    {
+        return GetStringValueImpl(arpValues, name);
     }
 
     std::string ARPHelper::DetermineVersion(const Registry::Key& arpKey) const
+    {
+        return DetermineVersionImpl(arpKey);
+    }
+
+    std::string ARPHelper::DetermineVersion(const Registry::ValueSnapshot& arpValues) const
+    {
+        return DetermineVersionImpl(arpValues);
+    }
+
+    template <typename ValueSource>
+    std::string ARPHelper::DetermineVersionImpl(const ValueSource& source) const
     {
         // First check DisplayVersion for a complete version string
-        auto displayVersion = arpKey[DisplayVersion];
+        auto displayVersion = source[DisplayVersion];
         if (displayVersion && displayVersion->GetType() == Registry::Value::Type::String)
         {
             std::string result = displayVersion->GetValue<Registry::Value::Type::String>();
@@ -261,8 +299,8 @@ namespace AppInstaller::Repository::Microsoft
         // Next attempt VersionMajor.VersionMinor, then MajorVersion.MinorVersion
         for (const auto& names : { std::make_pair(std::ref(VersionMajor), std::ref(VersionMinor)), std::make_pair(std::ref(MajorVersion), std::ref(MinorVersion)) })
         {
-            auto majorVersion = arpKey[names.first];
-            auto minorVersion = arpKey[names.second];
+            auto majorVersion = source[names.first];
+            auto minorVersion = source[names.second];
             if (majorVersion || minorVersion)
             {
                 uint32_t majorVersionInt = 0;
@@ -288,7 +326,7 @@ namespace AppInstaller::Repository::Microsoft
         }
 
         // Finally attempt to turn the Version DWORD into a version string
-        auto version = arpKey[Version];
+        auto version = source[Version];
         if (version && version->GetType() == Registry::Value::Type::DWord)
         {
             uint32_t versionInt = version->GetValue<Registry::Value::Type::DWord>();
@@ -305,7 +343,18 @@ namespace AppInstaller::Repository::Microsoft
 
     void ARPHelper::AddMetadataIfPresent(const Registry::Key& key, const std::wstring& name, SQLiteIndex& index, SQLiteIndex::IdType manifestId, PackageVersionMetadata metadata) const
     {
-        auto value = key[name];
+        AddMetadataIfPresentImpl(key, name, index, manifestId, metadata);
+    }
+
+    void ARPHelper::AddMetadataIfPresent(const Registry::ValueSnapshot& values, const std::wstring& name, SQLiteIndex& index, SQLiteIndex::IdType manifestId, PackageVersionMetadata metadata) const
+    {
+        AddMetadataIfPresentImpl(values, name, index, manifestId, metadata);
+    }
+
+    template <typename ValueSource>
+    void ARPHelper::AddMetadataIfPresentImpl(const ValueSource& source, const std::wstring& name, SQLiteIndex& index, SQLiteIndex::IdType manifestId, PackageVersionMetadata metadata) const
+    {
+        auto value = source[name];
         if (value)
         {
             std::string valueString;
@@ -359,6 +408,10 @@ namespace AppInstaller::Repository::Microsoft
     {
         AICLI_LOG(Repo, Info, << "Examining ARP entries for " << scope << " | " << architecture);
 
+        // Used to persist correlation-normalized keys alongside each entry; must match the
+        // normalization that the correlation confidence algorithm performs at read time.
+        Utility::NameNormalizer normalizer{ Utility::NormalizationVersion::InitialPreserveWhiteSpace };
+
         for (const auto& arpEntry : key)
         {
             std::string productCode;
@@ -366,158 +419,253 @@ namespace AppInstaller::Repository::Microsoft
             try
             {
                 productCode = arpEntry.Name();
+                PopulateIndexFromARPEntry(index, arpEntry.Open(), productCode, scope, architecture, upgradeCodes, normalizer);
+            }
+            catch (...)
+            {
+                AICLI_LOG(Repo, Warning, << "Failed to read ARP entry, ignoring it: " << scope << '|' << architecture << '|' << productCode);
+                LOG_CAUGHT_EXCEPTION();
+            }
+        }
+    }
 
-                Manifest::Manifest manifest;
-                manifest.DefaultLocalization.Add<Manifest::Localization::Tags>({ "ARP" });
+    bool ARPHelper::PopulateIndexFromARPEntry(
+        SQLiteIndex& index,
+        const Registry::Key& arpKey,
+        const std::string& productCode,
+        std::string_view scope,
+        std::string_view architecture,
+        const std::map<std::string, std::string>& upgradeCodes,
+        const Utility::NameNormalizer& normalizer) const
+    {
+        Manifest::Manifest manifest;
+        manifest.DefaultLocalization.Add<Manifest::Localization::Tags>({ "ARP" });
+
+        // Use the key name as the Id, as it is supposed to be unique.
+        // TODO: We probably want something better here, like constructing the value as
+        //       `Publisher.DisplayName`. We would need to ensure that there are no matches
+        //       against the rest of the data however (might happen if same package is
+        //       installed for multiple architectures/languages).
+        manifest.Id = productCode;
+
+        manifest.Installers.emplace_back();
+        // TODO: This likely needs some cleanup applied, as it looks like INNO tends to append an "_is#"
+        //       that might vary across machines/installs. There may be other things we want to clean up as well,
+        //       like trimming spaces at the ends, or removing the version string from the product code
+        //       if it is present.
+        manifest.Installers[0].ProductCode = productCode;
+
+        // Most of the values of the entry are inspected below; take one snapshot of the
+        // key rather than issuing a registry query per value.
+        Registry::ValueSnapshot arpValues = arpKey.SnapshotValues();
+
+        // Ignore entries that are listed as SystemComponent
+        if (GetBoolValue(arpValues, SystemComponent))
+        {
+            AICLI_LOG(Repo, Verbose, << "Skipping " << productCode << " because it is a SystemComponent");
+            return false;
+        }
 
-                // Use the key name as the Id, as it is supposed to be unique.
-                // TODO: We probably want something better here, like constructing the value as
-                //       `Publisher.DisplayName`. We would need to ensure that there are no matches
-                //       against the rest of the data however (might happen if same package is
-                //       installed for multiple architectures/languages).
-                manifest.Id = productCode;
+        // If no name is provided, ignore this entry
+        auto displayName = arpValues[DisplayName];
+        if (!displayName || displayName->GetType() != Registry::Value::Type::String)
+        {
+            AICLI_LOG(Repo, Verbose, << "Skipping " << productCode << " because DisplayName is not a REG_SZ value");
+            return false;
+        }
+        auto displayNameValue = displayName->GetValue<Registry::Value::Type::String>();
+        if (displayNameValue.empty())
+        {
+            AICLI_LOG(Repo, Verbose, << "Skipping " << productCode << " because DisplayName is empty");
+            return false;
+        }
 
-                manifest.Installers.emplace_back();
-                // TODO: This likely needs some cleanup applied, as it looks like INNO tends to append an "_is#"
-                //       that might vary across machines/installs. There may be other things we want to clean up as well,
-                //       like trimming spaces at the ends, or removing the version string from the product code
-                //       if it is present.
-                manifest.Installers[0].ProductCode = productCode;
+        manifest.DefaultLocalization.Add<Manifest::Localization::PackageName>(displayNameValue);
+        // Add DisplayName to ARP entries too
+        // This is to help normalized publisher and name correlation where ARP DisplayName matching
+        // will be getting improved in future iterations.
+        manifest.Installers[0].AppsAndFeaturesEntries.emplace_back();
+        manifest.Installers[0].AppsAndFeaturesEntries[0].DisplayName = displayNameValue;
 
-                Registry::Key arpKey = arpEntry.Open();
+        // If no version can be determined, ignore this entry
+        manifest.Version = DetermineVersion(arpValues);
+        if (manifest.Version.empty())
+        {
+            AICLI_LOG(Repo, Verbose, << "Skipping " << productCode << " because a version could not be determined");
+            return false;
+        }
 
-                // Ignore entries that are listed as SystemComponent
-                if (GetBoolValue(arpKey, SystemComponent))
-                {
-                    AICLI_LOG(Repo, Verbose, << "Skipping " << productCode << " because it is a SystemComponent");
-                    continue;
-                }
+        auto publisher = arpValues[Publisher];
+        if (publisher && publisher->GetType() == Registry::Value::Type::String)
+        {
+            manifest.DefaultLocalization.Add<Manifest::Localization::Publisher>(publisher->GetValue<Registry::Value::Type::String>());
+
+            // If Publisher is set, change the Id using name normalization
+            // TODO: Figure out how to actually make this work since there are often instances of the same
+            // data in x64 and x86 entries that will collide.
+            //auto normalizedName = index.NormalizeName(
+            //    manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>(),
+            //    manifest.DefaultLocalization.Get<Manifest::Localization::Publisher>());
+            //manifest.Id = normalizedName.Publisher() + '.' + normalizedName.Name();
+        }
 
-                // If no name is provided, ignore this entry
-                auto displayName = arpKey[DisplayName];
-                if (!displayName || displayName->GetType() != Registry::Value::Type::String)
-                {
-                    AICLI_LOG(Repo, Verbose, << "Skipping " << productCode << " because DisplayName is not a REG_SZ value");
-                    continue;
-                }
-                auto displayNameValue = displayName->GetValue<Registry::Value::Type::String>();
-                if (displayNameValue.empty())
-                {
-                    AICLI_LOG(Repo, Verbose, << "Skipping " << productCode << " because DisplayName is empty");
-                    continue;
-                }
+        // Pick up WindowsInstaller to determine if this is an MSI install.
+        // TODO: Could also determine Inno (and maybe other types) through detecting other keys here.
+        auto installedType = Manifest::InstallerTypeEnum::Exe;
 
-                manifest.DefaultLocalization.Add<Manifest::Localization::PackageName>(displayNameValue);
-                // Add DisplayName to ARP entries too
-                // This is to help normalized publisher and name correlation where ARP DisplayName matching
-                // will be getting improved in future iterations.
-                manifest.Installers[0].AppsAndFeaturesEntries.emplace_back();
-                manifest.Installers[0].AppsAndFeaturesEntries[0].DisplayName = displayNameValue;
+        if (GetBoolValue(arpValues, WindowsInstaller))
+        {
+            installedType = Manifest::InstallerTypeEnum::Msi;
 
-                // If no version can be determined, ignore this entry
-                manifest.Version = DetermineVersion(arpKey);
-                if (manifest.Version.empty())
-                {
-                    AICLI_LOG(Repo, Verbose, << "Skipping " << productCode << " because a version could not be determined");
-                    continue;
-                }
+            // If this is an MSI, look up the UpgradeCode
+            auto upgradeCodeItr = upgradeCodes.find(productCode);
+            if (upgradeCodeItr != upgradeCodes.end())
+            {
+                manifest.Installers[0].AppsAndFeaturesEntries[0].UpgradeCode = upgradeCodeItr->second;
+            }
+        }
 
-                auto publisher = arpKey[Publisher];
-                if (publisher && publisher->GetType() == Registry::Value::Type::String)
-                {
-                    manifest.DefaultLocalization.Add<Manifest::Localization::Publisher>(publisher->GetValue<Registry::Value::Type::String>());
-
-                    // If Publisher is set, change the Id using name normalization
-                    // TODO: Figure out how to actually make this work since there are often instances of the same
-                    // data in x64 and x86 entries that will collide.
-                    //auto normalizedName = index.NormalizeName(
-                    //    manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>(),
-                    //    manifest.DefaultLocalization.Get<Manifest::Localization::Publisher>());
-                    //manifest.Id = normalizedName.Publisher() + '.' + normalizedName.Name();
-                }
+        // TODO: If we want to keep the constructed manifest around to allow for `show` type commands
+        //       against installed packages, we should use URLInfoAbout/HelpLink for the Homepage.
 
-                // Pick up WindowsInstaller to determine if this is an MSI install.
-                // TODO: Could also determine Inno (and maybe other types) through detecting other keys here.
-                auto installedType = Manifest::InstallerTypeEnum::Exe;
+        // TODO: Determine the best way to handle duplicates; sometimes the same package will be listed under
+        //       both x64 and x86 locations for ARP.
+        //       For now, we will attempt to insert and catch.
+        std::optional<SQLiteIndex::IdType> manifestIdOpt;
 
-                if (GetBoolValue(arpKey, WindowsInstaller))
-                {
-                    installedType = Manifest::InstallerTypeEnum::Msi;
+        try
+        {
+            // Use the ProductCode as a unique key for the path
+            manifestIdOpt = index.AddManifest(manifest, Utility::ConvertToUTF16(manifest.Installers[0].ProductCode));
+        }
+        catch (...)
+        {
+            // Ignore errors if they occur, they are most likely a duplicate value
+        }
 
-                    // If this is an MSI, look up the UpgradeCode
-                    auto upgradeCodeItr = upgradeCodes.find(productCode);
-                    if (upgradeCodeItr != upgradeCodes.end())
-                    {
-                        manifest.Installers[0].AppsAndFeaturesEntries[0].UpgradeCode = upgradeCodeItr->second;
-                    }
-                }
+        if (!manifestIdOpt)
+        {
+            AICLI_LOG(Repo, Warning,
+                << "Ignoring duplicate ARP entry " << scope << '|' << architecture << '|' << productCode << " [" << manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>() << "]");
+            return false;
+        }
 
-                // TODO: If we want to keep the constructed manifest around to allow for `show` type commands
-                //       against installed packages, we should use URLInfoAbout/HelpLink for the Homepage.
+        SQLiteIndex::IdType manifestId = manifestIdOpt.value();
 
-                // TODO: Determine the best way to handle duplicates; sometimes the same package will be listed under
-                //       both x64 and x86 locations for ARP.
-                //       For now, we will attempt to insert and catch.
-                std::optional<SQLiteIndex::IdType> manifestIdOpt;
+        // Pass scope along to metadata.
+        index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::InstalledScope, scope);
 
-                try
-                {
-                    // Use the ProductCode as a unique key for the path
-                    manifestIdOpt = index.AddManifest(manifest, Utility::ConvertToUTF16(manifest.Installers[0].ProductCode));
-                }
-                catch (...)
-                {
-                    // Ignore errors if they occur, they are most likely a duplicate value
-                }
+        // TODO: Pass along architecture, although there are cases where it is not clear what architecture the package
+        //       is from it's ARP location, despite it very clearly being a specific architecture. And note that user
+        //       scope does not have separate ARP locations, so every architecture would appear as native.
 
-                if (!manifestIdOpt)
-                {
-                    AICLI_LOG(Repo, Warning,
-                        << "Ignoring duplicate ARP entry " << scope << '|' << architecture << '|' << productCode << " [" << manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>() << "]");
-                    continue;
-                }
+        // Publisher is needed for certain scenarios but we don't store it from the manifest
+        if (manifest.DefaultLocalization.Contains(Manifest::Localization::Publisher))
+        {
+            index.SetMetadataByManifestId(
+                manifestId, PackageVersionMetadata::Publisher,
+                manifest.DefaultLocalization.Get<Manifest::Localization::Publisher>());
 
-                SQLiteIndex::IdType manifestId = manifestIdOpt.value();
+            std::string normalizedPublisher = normalizer.NormalizePublisher(
+                manifest.DefaultLocalization.Get<Manifest::Localization::Publisher>());
+            if (!normalizedPublisher.empty())
+            {
+                index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::NormalizedPublisher, normalizedPublisher);
+            }
+        }
 
-                // Pass scope along to metadata.
-                index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::InstalledScope, scope);
+        // Persist the correlation-normalized name so that upgrade correlation can read a
+        // precomputed key rather than normalizing the same entry on every invocation.
+        // The cached installed source carries this across runs for unchanged entries.
+        std::string normalizedName = normalizer.NormalizeName(displayNameValue).Name();
+        if (!normalizedName.empty())
+        {
+            index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::NormalizedName, normalizedName);
+        }
 
-                // TODO: Pass along architecture, although there are cases where it is not clear what architecture the package
-                //       is from it's ARP location, despite it very clearly being a specific architecture. And note that user
-                //       scope does not have separate ARP locations, so every architecture would appear as native.
+        // Pick up InstallLocation when upgrade supports remove/install to enable this location
+        // to survive across the removal.
+        AddMetadataIfPresent(arpValues, InstallLocation, index, manifestId, PackageVersionMetadata::InstalledLocation);
 
-                // Publisher is needed for certain scenarios but we don't store it from the manifest
-                if (manifest.DefaultLocalization.Contains(Manifest::Localization::Publisher))
-                {
-                    index.SetMetadataByManifestId(
-                        manifestId, PackageVersionMetadata::Publisher,
-                        manifest.DefaultLocalization.Get<Manifest::Localization::Publisher>());
-                }
+        // Pick up UninstallString and QuietUninstallString for uninstall.
+        AddMetadataIfPresent(arpValues, UninstallString, index, manifestId, PackageVersionMetadata::StandardUninstallCommand);
+        AddMetadataIfPresent(arpValues, QuietUninstallString, index, manifestId, PackageVersionMetadata::SilentUninstallCommand);
 
-                // Pick up InstallLocation when upgrade supports remove/install to enable this location
-                // to survive across the removal.
-                AddMetadataIfPresent(arpKey, InstallLocation, index, manifestId, PackageVersionMetadata::InstalledLocation);
+        // Pick up Language to enable proper selection of language for upgrade.
+        AddMetadataIfPresent(arpValues, Language, index, manifestId, PackageVersionMetadata::InstalledLocale);
 
-                // Pick up UninstallString and QuietUninstallString for uninstall.
-                AddMetadataIfPresent(arpKey, UninstallString, index, manifestId, PackageVersionMetadata::StandardUninstallCommand);
-                AddMetadataIfPresent(arpKey, QuietUninstallString, index, manifestId, PackageVersionMetadata::SilentUninstallCommand);
+        if (Manifest::ConvertToInstallerTypeEnum(GetStringValue(arpValues, std::wstring{ ToString(PortableValueName::WinGetInstallerType) })) == Manifest::InstallerTypeEnum::Portable)
+        {
+            // Portable uninstall requires the installed architecture for locating the entry in the registry.
+            index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::InstalledArchitecture, architecture);
+            installedType = Manifest::InstallerTypeEnum::Portable;
+        }
 
-                // Pick up Language to enable proper selection of language for upgrade.
-                AddMetadataIfPresent(arpKey, Language, index, manifestId, PackageVersionMetadata::InstalledLocale);
+        index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::InstalledType, Manifest::InstallerTypeToString(installedType));
 
-                if (Manifest::ConvertToInstallerTypeEnum(GetStringValue(arpKey, std::wstring{ ToString(PortableValueName::WinGetInstallerType) })) == Manifest::InstallerTypeEnum::Portable)
-                {
-                    // Portable uninstall requires the installed architecture for locating the entry in the registry.
-                    index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::InstalledArchitecture, architecture);
-                    installedType = Manifest::InstallerTypeEnum::Portable;
-                }
+        return true;
+    }
 
-                index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::InstalledType, Manifest::InstallerTypeToString(installedType));
-            }
-            catch (...)
+    ARPChangeWatcher& ARPChangeWatcher::Instance()
+    {
+        static ARPChangeWatcher instance;
+        return instance;
+    }
+
+    bool ARPChangeWatcher::MayHaveChanged()
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+
+        if (!m_armed)
+        {
+            return true;
+        }
+
+        return m_changeEvent.is_signaled();
+    }
+
+    void ARPChangeWatcher::Arm()
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+
+        // Dropping the previous keys cancels their outstanding notifications; the event may
+        // be signaled by that cancellation, so reset it only after they are gone.
+        m_watchedRoots.clear();
+
+        if (!m_changeEvent)
+        {
+            m_changeEvent.create(wil::EventOptions::ManualReset);
+        }
+
+        m_changeEvent.ResetEvent();
+        m_armed = true;
+
+        ARPHelper arpHelper;
+
+        for (auto scope : { Manifest::ScopeEnum::Machine, Manifest::ScopeEnum::User })
+        {
+            for (auto architecture : Utility::GetApplicableArchitectures())
             {
-                AICLI_LOG(Repo, Warning, << "Failed to read ARP entry, ignoring it: " << scope << '|' << architecture << '|' << productCode);
-                LOG_CAUGHT_EXCEPTION();
+                Registry::Key arpRootKey = arpHelper.GetARPKey(scope, architecture);
+
+                if (arpRootKey)
+                {
+                    // Watch the subtree so that edits to an entry's values are seen, not
+                    // just entries appearing and disappearing.
+                    LSTATUS status = RegNotifyChangeKeyValue(
+                        arpRootKey.Handle(), TRUE, REG_NOTIFY_CHANGE_NAME | REG_NOTIFY_CHANGE_LAST_SET, m_changeEvent.get(), TRUE);
+
+                    if (status != ERROR_SUCCESS)
+                    {
+                        AICLI_LOG(Repo, Warning, << "Failed to register ARP change notification [" << status << "]; treating ARP as always changed");
+                        m_armed = false;
+                        m_watchedRoots.clear();
+                        return;
+                    }
+
+                    // The notification is cancelled if the key closes; hold it until the next Arm.
+                    m_watchedRoots.emplace_back(std::move(arpRootKey));
+                }
             }
         }
     }
@@ -5,9 +5,13 @@
 #include <AppInstallerArchitecture.h>
 #include <winget/Registry.h>
 #include <winget/ManifestInstaller.h>
+#include <winget/NameNormalization.h>
 #include <wil/resource.h>
 
+#include <map>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace AppInstaller::Repository::Microsoft
 {
@@ -64,9 +68,11 @@ namespace AppInstaller::Repository::Microsoft
 
         // Returns true IFF the value exists and contains a non-zero DWORD.
         static bool GetBoolValue(const Registry::Key& arpKey, const std::wstring& name);
+        static bool GetBoolValue(const Registry::ValueSnapshot& arpValues, const std::wstring& name);
 
         // Returns the string value if it exists.
         static std::string GetStringValue(const Registry::Key& arpKey, const std::wstring& name);
+        static std::string GetStringValue(const Registry::ValueSnapshot& arpValues, const std::wstring& name);
 
         // Determines the version from an ARP entry.
         // The priority is:
@@ -74,9 +80,14 @@ namespace AppInstaller::Repository::Microsoft
         //  Version
         //  MajorVersion, MinorVersion
         std::string DetermineVersion(const Registry::Key& arpKey) const;
+        std::string DetermineVersion(const Registry::ValueSnapshot& arpValues) const;
 
         // Reads a value and adds it to the metadata if it exists.
         void AddMetadataIfPresent(const Registry::Key& key, const std::wstring& name, SQLiteIndex& index, SQLiteIndex::IdType manifestId, PackageVersionMetadata metadata) const;
+        void AddMetadataIfPresent(const Registry::ValueSnapshot& values, const std::wstring& name, SQLiteIndex& index, SQLiteIndex::IdType manifestId, PackageVersionMetadata metadata) const;
+
+        // Gets a mapping from ProductCode to UpgradeCode for MSI packages.
+        std::map<std::string, std::string> GetUpgradeCodes() const;
 
         // Populates the index with the ARP entries from the given scope (machine/user).
         // Handles all of the architectures for the given scope.
@@ -86,5 +97,56 @@ namespace AppInstaller::Repository::Microsoft
         // This entry point is primarily to allow unit tests to operate of arbitrary keys;
         // product code should use PopulateIndexFromARP.
         void PopulateIndexFromKey(SQLiteIndex& index, const Registry::Key& key, std::string_view scope, std::string_view architecture, const std::map<std::string, std::string>& upgradeCodes = {}) const;
+
+        // Populates the index with a single ARP entry (one opened subkey of an ARP root).
+        // Returns true if the entry was added; false if it was skipped (system component,
+        // no display name or version, or a duplicate of an entry already in the index).
+        // The normalizer must use NormalizationVersion::InitialPreserveWhiteSpace to match
+        // the keys that correlation reads back.
+        bool PopulateIndexFromARPEntry(
+            SQLiteIndex& index,
+            const Registry::Key& arpKey,
+            const std::string& productCode,
+            std::string_view scope,
+            std::string_view architecture,
+            const std::map<std::string, std::string>& upgradeCodes,
+            const Utility::NameNormalizer& normalizer) const;
+
+    private:
+        // The shared implementations of the value readers above; ValueSource is either
+        // Registry::Key or Registry::ValueSnapshot.
+        template <typename ValueSource>
+        std::string DetermineVersionImpl(const ValueSource& source) const;
+
+        template <typename ValueSource>
+        void AddMetadataIfPresentImpl(const ValueSource& source, const std::wstring& name, SQLiteIndex& index, SQLiteIndex::IdType manifestId, PackageVersionMetadata metadata) const;
+    };
+
+    // Watches the ARP roots for registry changes so that repeated installed source opens
+    // within the same process can skip re-enumerating unchanged hives.
+    // The underlying change notifications are one-shot and process lifetime only; change
+    // detection across process runs is handled by the installed source cache watermark.
+    struct ARPChangeWatcher
+    {
+        // Gets the process-wide watcher.
+        static ARPChangeWatcher& Instance();
+
+        // Returns true if any watched ARP root may have changed since the last call to Arm,
+        // or if the watcher has never been (successfully) armed.
+        // The OS signals the notification event when the registering thread exits, so a
+        // stale registration reads as changed rather than as unchanged.
+        bool MayHaveChanged();
+
+        // (Re)registers change notifications on all of the ARP roots and resets the change state.
+        // Arm before enumerating so that a change racing the enumeration is not missed.
+        void Arm();
+
+    private:
+        ARPChangeWatcher() = default;
+
+        std::mutex m_lock;
+        wil::unique_event m_changeEvent;
+        std::vector<Registry::Key> m_watchedRoots;
+        bool m_armed = false;
     };
 }
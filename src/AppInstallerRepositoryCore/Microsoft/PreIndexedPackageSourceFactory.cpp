@@ -278,6 +278,11 @@ namespace AppInstaller::Repository::Microsoft
 
                 SQLiteIndex index = SQLiteIndex::Open(indexLocation.u8string(), SQLiteIndex::OpenDisposition::Immutable);
 
+                // Unlike the desktop context, the index is read directly out of the deployed
+                // package rather than from a private snapshot, so the shared lock must remain
+                // held for the lifetime of the source to keep an update from replacing the
+                // package out from under it.
+
                 // We didn't use to store the source identifier, so we compute it here in case it's
                 // missing from the details.
                 m_details.Identifier = GetPackageFamilyNameFromDetails(m_details);
@@ -453,6 +458,11 @@ namespace AppInstaller::Repository::Microsoft
 
                 SQLiteIndex index = SQLiteIndex::Open(tempIndexFile.GetFilePath().u8string(), SQLiteIndex::OpenDisposition::Immutable, std::move(tempIndexFile));
 
+                // The temp index file is a private snapshot of the package data, so the cross
+                // process lock is not needed once it has been populated. Releasing it here allows
+                // an update to replace the package while this source remains open on its snapshot.
+                lock.Release();
+
                 // We didn't use to store the source identifier, so we compute it here in case it's
                 // missing from the details.
                 m_details.Identifier = GetPackageFamilyNameFromDetails(m_details);
@@ -482,12 +492,18 @@ namespace AppInstaller::Repository::Microsoft
                 if (std::filesystem::exists(packagePath))
                 {
                     // If we already have a trusted index package, use it to determine if we need to update or not.
-                    Msix::WriteLockedMsixFile indexPackage{ packagePath };
-                    if (indexPackage.ValidateTrustInfo(WI_IsFlagSet(details.TrustLevel, SourceTrustLevel::StoreOrigin)) &&
-                        !packageInfo.IsNewerThan(packagePath))
+                    // Check the version first: it reads only the package manifest, while trust validation
+                    // reads the entire package. When the remote data is newer the existing package is
+                    // getting replaced regardless, so its (expensive) validation can be skipped; the new
+                    // package is validated below before the swap, and Open validates again before use.
+                    if (!packageInfo.IsNewerThan(packagePath))
                     {
-                        AICLI_LOG(Repo, Info, << "Remote source data was not newer than existing, no update needed");
-                        return true;
+                        Msix::WriteLockedMsixFile indexPackage{ packagePath };
+                        if (indexPackage.ValidateTrustInfo(WI_IsFlagSet(details.TrustLevel, SourceTrustLevel::StoreOrigin)))
+                        {
+                            AICLI_LOG(Repo, Info, << "Remote source data was not newer than existing, no update needed");
+                            return true;
+                        }
                     }
                 }
 
@@ -8,6 +8,7 @@
 #include <winget/ManifestInstaller.h>
 
 #include <winget/Registry.h>
+#include <winget/SharedThreadGlobals.h>
 #include <AppInstallerArchitecture.h>
 
 using namespace std::string_literals;
@@ -17,6 +18,504 @@ namespace AppInstaller::Repository::Microsoft
 {
     namespace
     {
+        constexpr std::string_view s_InstalledSourceCacheDirectory = "installedSourceCache"sv;
+
+        // Gets the base path (without extension) for the cache files of the given filter.
+        std::filesystem::path GetCacheFileBasePath(PredefinedInstalledSourceFactory::Filter filter)
+        {
+            std::string fileName = "installed_";
+            fileName += PredefinedInstalledSourceFactory::FilterToString(filter);
+            return Runtime::GetPathTo(Runtime::PathName::LocalState) / s_InstalledSourceCacheDirectory / fileName;
+        }
+
+        // The last write state of one ARP entry, used by the incremental cache refresh to
+        // determine which entries changed between invocations.
+        struct ARPEntryState
+        {
+            Manifest::ScopeEnum Scope = Manifest::ScopeEnum::Unknown;
+            Utility::Architecture Architecture = Utility::Architecture::Unknown;
+            std::string ProductCode;
+            int64_t LastWriteTime = 0;
+        };
+
+        // The installed state observed at the start of an invocation. ARP entries are covered
+        // by their registry key write times (editing a value updates the entry's own key time),
+        // and MSIX packages by their full names.
+        struct InstalledStateSnapshot
+        {
+            // Covers the entire state; matches the value persisted in the cache fingerprint file.
+            // Empty when the state could not be fingerprinted, which disables caching for the
+            // invocation.
+            std::string Fingerprint;
+
+            // Covers only the MSIX portion of the state. The incremental refresh can only
+            // reconcile ARP entries, so it requires this portion to be unchanged.
+            std::string MSIXFingerprint;
+
+            // Whether ARP entries are part of the state for the filter.
+            bool IncludesARP = false;
+
+            // The per entry ARP state, persisted alongside the cache as its watermark.
+            std::vector<ARPEntryState> ARPEntries;
+        };
+
+        // Process lifetime memo of the ARP portion of the snapshot, reused while the change
+        // watcher reports the ARP roots unchanged. Saves re-enumerating every entry's write
+        // time on back-to-back opens (e.g. scheduled upgrade checks against the COM server).
+        struct ARPSnapshotMemo
+        {
+            static ARPSnapshotMemo& Instance()
+            {
+                static ARPSnapshotMemo memo;
+                return memo;
+            }
+
+            std::mutex Lock;
+            std::map<PredefinedInstalledSourceFactory::Filter, std::pair<std::string, std::vector<ARPEntryState>>> PerFilter;
+        };
+
+        // Computes a snapshot of the machine's installed state that is inexpensive relative
+        // to a full enumeration.
+        InstalledStateSnapshot ComputeInstalledStateSnapshot(PredefinedInstalledSourceFactory::Filter filter)
+        {
+            using Filter = PredefinedInstalledSourceFactory::Filter;
+
+            try
+            {
+                InstalledStateSnapshot result;
+                std::string arpPart;
+
+                if (filter == Filter::None || filter == Filter::ARP || filter == Filter::User || filter == Filter::Machine)
+                {
+                    result.IncludesARP = true;
+                    bool reused = false;
+
+                    if (!ARPChangeWatcher::Instance().MayHaveChanged())
+                    {
+                        ARPSnapshotMemo& memo = ARPSnapshotMemo::Instance();
+                        std::lock_guard<std::mutex> lock{ memo.Lock };
+
+                        auto itr = memo.PerFilter.find(filter);
+                        if (itr != memo.PerFilter.end())
+                        {
+                            arpPart = itr->second.first;
+                            result.ARPEntries = itr->second.second;
+                            reused = true;
+                        }
+                    }
+
+                    if (!reused)
+                    {
+                        // Arm before enumerating so that a change racing the enumeration
+                        // signals the watcher rather than being missed.
+                        ARPChangeWatcher::Instance().Arm();
+
+                        std::ostringstream arpStream;
+                        ARPHelper arpHelper;
+
+                        for (auto scope : { Manifest::ScopeEnum::Machine, Manifest::ScopeEnum::User })
+                        {
+                            if ((scope == Manifest::ScopeEnum::Machine && filter == Filter::User) ||
+                                (scope == Manifest::ScopeEnum::User && filter == Filter::Machine))
+                            {
+                                continue;
+                            }
+
+                            for (auto architecture : Utility::GetApplicableArchitectures())
+                            {
+                                Registry::Key arpRootKey = arpHelper.GetARPKey(scope, architecture);
+
+                                if (arpRootKey)
+                                {
+                                    arpStream << '|' << Manifest::ScopeToString(scope) << ':' << Utility::ToString(architecture) << ':' << arpRootKey.LastWriteTime();
+
+                                    for (const auto& arpEntry : arpRootKey)
+                                    {
+                                        ARPEntryState state{ scope, architecture, arpEntry.Name(), arpEntry.Open().LastWriteTime() };
+                                        arpStream << '/' << state.ProductCode << ':' << state.LastWriteTime;
+                                        result.ARPEntries.emplace_back(std::move(state));
+                                    }
+                                }
+                            }
+                        }
+
+                        arpPart = arpStream.str();
+
+                        ARPSnapshotMemo& memo = ARPSnapshotMemo::Instance();
+                        std::lock_guard<std::mutex> lock{ memo.Lock };
+                        memo.PerFilter[filter] = std::make_pair(arpPart, result.ARPEntries);
+                    }
+                }
+
+                std::string msixPart;
+
+                if (filter == Filter::None || filter == Filter::MSIX || filter == Filter::User || filter == Filter::Machine)
+                {
+                    using namespace winrt::Windows::ApplicationModel;
+                    using namespace winrt::Windows::Management::Deployment;
+                    using namespace winrt::Windows::Foundation::Collections;
+
+                    std::ostringstream msixStream;
+
+                    PackageManager packageManager;
+                    IIterable<Package> packages;
+                    if (filter == Filter::Machine)
+                    {
+                        packages = packageManager.FindProvisionedPackages();
+                    }
+                    else
+                    {
+                        packages = packageManager.FindPackagesForUserWithPackageTypes({}, PackageTypes::Main);
+                    }
+
+                    for (const auto& package : packages)
+                    {
+                        msixStream << '|' << Utility::ConvertToUTF8(package.Id().FullName());
+                    }
+
+                    msixPart = msixStream.str();
+                }
+
+                result.MSIXFingerprint = Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(msixPart));
+
+                std::string combined{ PredefinedInstalledSourceFactory::FilterToString(filter) };
+                combined += arpPart;
+                combined += msixPart;
+                result.Fingerprint = Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(combined));
+
+                return result;
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+                AICLI_LOG(Repo, Warning, << "Unable to compute installed state fingerprint; installed source caching disabled for this invocation");
+                return {};
+            }
+        }
+
+        // Attempts to open a cached installed source index matching the given fingerprint.
+        std::optional<SQLiteIndex> TryOpenCachedInstalledIndex(PredefinedInstalledSourceFactory::Filter filter, const std::string& fingerprint)
+        {
+            if (fingerprint.empty())
+            {
+                return std::nullopt;
+            }
+
+            try
+            {
+                std::filesystem::path basePath = GetCacheFileBasePath(filter);
+                std::filesystem::path fingerprintPath = basePath;
+                fingerprintPath += ".fingerprint";
+                std::filesystem::path indexPath = basePath;
+                indexPath += ".db";
+
+                if (!std::filesystem::exists(fingerprintPath) || !std::filesystem::exists(indexPath))
+                {
+                    return std::nullopt;
+                }
+
+                std::ifstream fingerprintStream{ fingerprintPath };
+                std::string cachedFingerprint;
+                std::getline(fingerprintStream, cachedFingerprint);
+
+                if (cachedFingerprint != fingerprint)
+                {
+                    AICLI_LOG(Repo, Info, << "Installed source cache fingerprint mismatch; rebuilding");
+                    return std::nullopt;
+                }
+
+                return SQLiteIndex::Open(indexPath.u8string(), SQLiteStorageBase::OpenDisposition::ReadMapped);
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+                AICLI_LOG(Repo, Warning, << "Failed to open cached installed source; rebuilding");
+                return std::nullopt;
+            }
+        }
+
+        // Writes the cache watermark: the per entry ARP state that the fingerprint covered.
+        // The first line is the MSIX portion fingerprint; each following line is one entry as
+        // scope|architecture|lastWriteTime|productCode, with the product code last because
+        // registry key names may themselves contain the separator.
+        void SaveWatermark(const std::filesystem::path& watermarkPath, const InstalledStateSnapshot& snapshot)
+        {
+            std::ofstream stream{ watermarkPath, std::ios_base::trunc };
+            stream << snapshot.MSIXFingerprint << '\n';
+
+            for (const ARPEntryState& entry : snapshot.ARPEntries)
+            {
+                stream << Manifest::ScopeToString(entry.Scope) << '|' << Utility::ToString(entry.Architecture) << '|' << entry.LastWriteTime << '|' << entry.ProductCode << '\n';
+            }
+        }
+
+        // Reads the cache watermark back; returns the MSIX portion fingerprint and the entry
+        // states, or nothing if the watermark is absent or malformed.
+        std::optional<std::pair<std::string, std::vector<ARPEntryState>>> TryLoadWatermark(const std::filesystem::path& watermarkPath)
+        {
+            if (!std::filesystem::exists(watermarkPath))
+            {
+                return std::nullopt;
+            }
+
+            std::ifstream stream{ watermarkPath };
+
+            std::string msixFingerprint;
+            if (!std::getline(stream, msixFingerprint))
+            {
+                return std::nullopt;
+            }
+
+            std::vector<ARPEntryState> entries;
+            std::string line;
+            while (std::getline(stream, line))
+            {
+                size_t first = line.find('|');
+                size_t second = (first != std::string::npos) ? line.find('|', first + 1) : std::string::npos;
+                size_t third = (second != std::string::npos) ? line.find('|', second + 1) : std::string::npos;
+
+                if (third == std::string::npos)
+                {
+                    return std::nullopt;
+                }
+
+                ARPEntryState entry;
+                entry.Scope = Manifest::ConvertToScopeEnum(line.substr(0, first));
+                entry.Architecture = Utility::ConvertToArchitectureEnum(line.substr(first + 1, second - first - 1));
+                entry.LastWriteTime = std::stoll(line.substr(second + 1, third - second - 1));
+                entry.ProductCode = line.substr(third + 1);
+                entries.emplace_back(std::move(entry));
+            }
+
+            return std::make_pair(std::move(msixFingerprint), std::move(entries));
+        }
+
+        // Removes the entry with the given product code from the index, if present.
+        // ARP entries use their product code as both the manifest Id and the unique path key.
+        void RemoveARPEntryFromIndex(SQLiteIndex& index, const std::string& productCode)
+        {
+            SearchRequest request;
+            request.Inclusions.emplace_back(PackageMatchFilter{ PackageMatchField::Id, MatchType::CaseInsensitive, productCode });
+
+            for (const auto& match : index.Search(request).Matches)
+            {
+                for (const auto& versionKey : index.GetVersionKeysById(match.first))
+                {
+                    std::optional<SQLiteIndex::IdType> manifestId = index.GetManifestIdByKey(match.first, versionKey.GetVersion().ToString(), versionKey.GetChannel().ToString());
+                    if (manifestId)
+                    {
+                        index.RemoveManifestById(manifestId.value());
+                    }
+                }
+            }
+        }
+
+        // Attempts to bring the cached index up to date by re-reading only the ARP entries
+        // that changed since the cache was written, rather than rebuilding from scratch.
+        // Returns true if the cache was refreshed and revalidated against the new fingerprint.
+        bool TryRefreshCachedIndexIncrementally(PredefinedInstalledSourceFactory::Filter filter, const InstalledStateSnapshot& snapshot)
+        {
+            if (snapshot.Fingerprint.empty() || !snapshot.IncludesARP)
+            {
+                return false;
+            }
+
+            try
+            {
+                std::filesystem::path basePath = GetCacheFileBasePath(filter);
+                std::filesystem::path fingerprintPath = basePath;
+                fingerprintPath += ".fingerprint";
+                std::filesystem::path indexPath = basePath;
+                indexPath += ".db";
+                std::filesystem::path watermarkPath = basePath;
+                watermarkPath += ".watermark";
+
+                if (!std::filesystem::exists(fingerprintPath) || !std::filesystem::exists(indexPath))
+                {
+                    return false;
+                }
+
+                auto watermark = TryLoadWatermark(watermarkPath);
+                if (!watermark)
+                {
+                    return false;
+                }
+
+                if (watermark->first != snapshot.MSIXFingerprint)
+                {
+                    AICLI_LOG(Repo, Info, << "MSIX state changed; skipping incremental installed source cache refresh");
+                    return false;
+                }
+
+                // Group both sides by product code; an entry can appear under several roots
+                // (e.g. the x64 and x86 views), while the index holds one row per product code.
+                std::map<std::string, std::vector<const ARPEntryState*>> oldEntries;
+                for (const ARPEntryState& entry : watermark->second)
+                {
+                    oldEntries[Utility::ToLower(entry.ProductCode)].emplace_back(&entry);
+                }
+
+                std::map<std::string, std::vector<const ARPEntryState*>> newEntries;
+                for (const ARPEntryState& entry : snapshot.ARPEntries)
+                {
+                    newEntries[Utility::ToLower(entry.ProductCode)].emplace_back(&entry);
+                }
+
+                auto statesEqual = [](const std::vector<const ARPEntryState*>& a, const std::vector<const ARPEntryState*>& b)
+                {
+                    if (a.size() != b.size())
+                    {
+                        return false;
+                    }
+
+                    for (size_t i = 0; i < a.size(); ++i)
+                    {
+                        if (a[i]->Scope != b[i]->Scope || a[i]->Architecture != b[i]->Architecture || a[i]->LastWriteTime != b[i]->LastWriteTime)
+                        {
+                            return false;
+                        }
+                    }
+
+                    return true;
+                };
+
+                // A product code needs reconciling if its set of observations differs in any way;
+                // a null current state means the entry is gone entirely.
+                std::vector<std::pair<std::string, const std::vector<const ARPEntryState*>*>> changed;
+
+                for (const auto& [productCode, states] : newEntries)
+                {
+                    auto itr = oldEntries.find(productCode);
+                    if (itr == oldEntries.end() || !statesEqual(itr->second, states))
+                    {
+                        changed.emplace_back(productCode, &states);
+                    }
+                }
+
+                for (const auto& [productCode, states] : oldEntries)
+                {
+                    if (newEntries.find(productCode) == newEntries.end())
+                    {
+                        changed.emplace_back(productCode, nullptr);
+                    }
+                }
+
+                // When a large fraction of the entries changed, the parallel full rebuild is
+                // faster than reconciling row by row.
+                if (changed.size() > 8 && changed.size() * 4 > newEntries.size())
+                {
+                    AICLI_LOG(Repo, Info, << "Too many ARP entries changed [" << changed.size() << " of " << newEntries.size() << "]; rebuilding installed source cache");
+                    return false;
+                }
+
+                AICLI_LOG(Repo, Info, << "Incrementally refreshing installed source cache: " << changed.size() << " of " << newEntries.size() << " ARP entries changed");
+
+                // Remove the fingerprint first so that a failure part way through leaves a
+                // cache that will never be treated as valid.
+                std::filesystem::remove(fingerprintPath);
+
+                {
+                    SQLiteIndex index = SQLiteIndex::Open(indexPath.u8string(), SQLiteStorageBase::OpenDisposition::ReadWrite);
+
+                    ARPHelper arpHelper;
+                    Utility::NameNormalizer normalizer{ Utility::NormalizationVersion::InitialPreserveWhiteSpace };
+                    std::map<std::string, std::string> upgradeCodes;
+                    bool upgradeCodesLoaded = false;
+
+                    for (const auto& [productCode, currentStates] : changed)
+                    {
+                        RemoveARPEntryFromIndex(index, productCode);
+
+                        if (currentStates)
+                        {
+                            if (!upgradeCodesLoaded)
+                            {
+                                upgradeCodes = arpHelper.GetUpgradeCodes();
+                                upgradeCodesLoaded = true;
+                            }
+
+                            // Mirror the full population: the first location that yields a
+                            // usable entry wins and the rest are duplicates.
+                            for (const ARPEntryState* state : *currentStates)
+                            {
+                                Registry::Key arpRootKey = arpHelper.GetARPKey(state->Scope, state->Architecture);
+                                if (!arpRootKey)
+                                {
+                                    continue;
+                                }
+
+                                std::optional<Registry::Key> arpKey = arpRootKey.SubKey(state->ProductCode);
+                                if (!arpKey)
+                                {
+                                    continue;
+                                }
+
+                                if (arpHelper.PopulateIndexFromARPEntry(
+                                    index, arpKey.value(), state->ProductCode,
+                                    Manifest::ScopeToString(state->Scope), Utility::ToString(state->Architecture),
+                                    upgradeCodes, normalizer))
+                                {
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                }
+
+                SaveWatermark(watermarkPath, snapshot);
+
+                std::ofstream fingerprintStream{ fingerprintPath, std::ios_base::trunc };
+                fingerprintStream << snapshot.Fingerprint;
+
+                return true;
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+                AICLI_LOG(Repo, Warning, << "Failed to incrementally refresh installed source cache; rebuilding");
+                return false;
+            }
+        }
+
+        // Best effort persistence of the built index for reuse by the next invocation.
+        void TrySaveCachedInstalledIndex(PredefinedInstalledSourceFactory::Filter filter, const InstalledStateSnapshot& snapshot, SQLiteIndex& index)
+        {
+            if (snapshot.Fingerprint.empty())
+            {
+                return;
+            }
+
+            try
+            {
+                std::filesystem::path basePath = GetCacheFileBasePath(filter);
+                std::filesystem::create_directories(basePath.parent_path());
+
+                std::filesystem::path fingerprintPath = basePath;
+                fingerprintPath += ".fingerprint";
+                std::filesystem::path indexPath = basePath;
+                indexPath += ".db";
+                std::filesystem::path watermarkPath = basePath;
+                watermarkPath += ".watermark";
+
+                // Remove the fingerprint first so that a failure part way through leaves a
+                // cache that will never be treated as valid.
+                std::filesystem::remove(fingerprintPath);
+                std::filesystem::remove(watermarkPath);
+                std::filesystem::remove(indexPath);
+
+                index.CopyTo(indexPath.u8string());
+                SaveWatermark(watermarkPath, snapshot);
+
+                std::ofstream fingerprintStream{ fingerprintPath, std::ios_base::trunc };
+                fingerprintStream << snapshot.Fingerprint;
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+                AICLI_LOG(Repo, Warning, << "Failed to save installed source cache");
+            }
+        }
+
         // Populates the index with the entries from MSIX.
         void PopulateIndexFromMSIX(SQLiteIndex& index, Manifest::ScopeEnum scope)
         {
@@ -129,21 +628,47 @@ namespace AppInstaller::Repository::Microsoft
                 PredefinedInstalledSourceFactory::Filter filter = PredefinedInstalledSourceFactory::StringToFilter(m_details.Arg);
                 AICLI_LOG(Repo, Info, << "Creating PredefinedInstalledSource with filter [" << PredefinedInstalledSourceFactory::FilterToString(filter) << ']');
 
+                // If the installed state is unchanged since the last invocation, reuse the
+                // index built then rather than enumerating everything again.
+                InstalledStateSnapshot snapshot = ComputeInstalledStateSnapshot(filter);
+
+                if (std::optional<SQLiteIndex> cachedIndex = TryOpenCachedInstalledIndex(filter, snapshot.Fingerprint))
+                {
+                    AICLI_LOG(Repo, Info, << "Using cached installed source index");
+                    return std::make_shared<SQLiteIndexSource>(m_details, std::move(cachedIndex).value(), Synchronization::CrossProcessReaderWriteLock{}, true);
+                }
+
+                // When only a few ARP entries changed, update the cached index in place by
+                // re-reading just those entries instead of rebuilding everything.
+                if (TryRefreshCachedIndexIncrementally(filter, snapshot))
+                {
+                    if (std::optional<SQLiteIndex> cachedIndex = TryOpenCachedInstalledIndex(filter, snapshot.Fingerprint))
+                    {
+                        AICLI_LOG(Repo, Info, << "Using incrementally refreshed installed source index");
+                        return std::make_shared<SQLiteIndexSource>(m_details, std::move(cachedIndex).value(), Synchronization::CrossProcessReaderWriteLock{}, true);
+                    }
+                }
+
                 // Create an in memory index
                 SQLiteIndex index = SQLiteIndex::CreateNew(SQLITE_MEMORY_DB_CONNECTION_TARGET, Schema::Version::Latest());
 
-                // Put installed packages into the index
+                // Collect the population units applicable to the filter.
+                // Each unit runs on its own thread below; the index serializes writes internally,
+                // and enumerating the registry hives and the MSIX catalog dominates the cost,
+                // so overlapping the units hides most of the startup latency.
+                ARPHelper arpHelper;
+                std::vector<std::function<void()>> populateTasks;
+
                 if (filter == PredefinedInstalledSourceFactory::Filter::None || filter == PredefinedInstalledSourceFactory::Filter::ARP ||
                     filter == PredefinedInstalledSourceFactory::Filter::User || filter == PredefinedInstalledSourceFactory::Filter::Machine)
                 {
-                    ARPHelper arpHelper;
                     if (filter != PredefinedInstalledSourceFactory::Filter::User)
                     {
-                        arpHelper.PopulateIndexFromARP(index, Manifest::ScopeEnum::Machine);
+                        populateTasks.emplace_back([&]() { arpHelper.PopulateIndexFromARP(index, Manifest::ScopeEnum::Machine); });
                     }
                     if (filter != PredefinedInstalledSourceFactory::Filter::Machine)
                     {
-                        arpHelper.PopulateIndexFromARP(index, Manifest::ScopeEnum::User);
+                        populateTasks.emplace_back([&]() { arpHelper.PopulateIndexFromARP(index, Manifest::ScopeEnum::User); });
                     }
                 }
 
@@ -151,13 +676,69 @@ namespace AppInstaller::Repository::Microsoft
                     filter == PredefinedInstalledSourceFactory::Filter::MSIX ||
                     filter == PredefinedInstalledSourceFactory::Filter::User)
                 {
-                    PopulateIndexFromMSIX(index, Manifest::ScopeEnum::User);
+                    populateTasks.emplace_back([&]() { PopulateIndexFromMSIX(index, Manifest::ScopeEnum::User); });
                 }
                 else if (filter == PredefinedInstalledSourceFactory::Filter::Machine)
                 {
-                    PopulateIndexFromMSIX(index, Manifest::ScopeEnum::Machine);
+                    populateTasks.emplace_back([&]() { PopulateIndexFromMSIX(index, Manifest::ScopeEnum::Machine); });
                 }
 
+                if (populateTasks.size() == 1)
+                {
+                    populateTasks[0]();
+                }
+                else if (!populateTasks.empty())
+                {
+                    std::vector<std::exception_ptr> exceptions(populateTasks.size());
+                    std::vector<std::thread> threads;
+                    threads.reserve(populateTasks.size());
+
+                    ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+                    for (size_t i = 0; i < populateTasks.size(); ++i)
+                    {
+                        threads.emplace_back([&, i]()
+                            {
+                                std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                                if (callerGlobals)
+                                {
+                                    previousGlobals = callerGlobals->SetForCurrentThread();
+                                }
+
+                                HRESULT coInit = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+                                try
+                                {
+                                    populateTasks[i]();
+                                }
+                                catch (...)
+                                {
+                                    exceptions[i] = std::current_exception();
+                                }
+
+                                if (SUCCEEDED(coInit))
+                                {
+                                    CoUninitialize();
+                                }
+                            });
+                    }
+
+                    for (std::thread& thread : threads)
+                    {
+                        thread.join();
+                    }
+
+                    for (const std::exception_ptr& exception : exceptions)
+                    {
+                        if (exception)
+                        {
+                            std::rethrow_exception(exception);
+                        }
+                    }
+                }
+
+                TrySaveCachedInstalledIndex(filter, snapshot, index);
+
                 return std::make_shared<SQLiteIndexSource>(m_details, std::move(index), Synchronization::CrossProcessReaderWriteLock{}, true);
             }
 
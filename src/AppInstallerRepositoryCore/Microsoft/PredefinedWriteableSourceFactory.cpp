@@ -41,6 +41,78 @@ namespace AppInstaller::Repository::Microsoft
             }
         };
 
+        // The number of independent indices that the installing data is spread across.
+        // Writes are one small row set per queued install, so a handful of shards is
+        // enough to keep a burst of concurrent queue items from convoying on one lock.
+        constexpr size_t s_installingShardCount = 4;
+
+        // Shards the installing data across several in-memory indices, each with its own
+        // interface lock, so that concurrent additions from the orchestrator queue do not
+        // serialize on a single index. Searches fan out to every shard and merge the results.
+        struct ShardedWriteableSource : public ISource, public IMutablePackageSource
+        {
+            ShardedWriteableSource(const SourceDetails& details, size_t shardCount) : m_details(details)
+            {
+                for (size_t i = 0; i < shardCount; ++i)
+                {
+                    // Create an in memory index without paths or dependencies
+                    SQLiteIndex index = SQLiteIndex::CreateNew(SQLITE_MEMORY_DB_CONNECTION_TARGET, Schema::Version::Latest(), SQLiteIndex::CreateOptions::SupportPathless | SQLiteIndex::CreateOptions::DisableDependenciesSupport);
+
+                    m_shards.emplace_back(std::make_shared<SQLiteIndexWriteableSource>(details, std::move(index), Synchronization::CrossProcessReaderWriteLock{}, true));
+                }
+            }
+
+            const std::string& GetIdentifier() const override { return m_details.Identifier; }
+
+            const SourceDetails& GetDetails() const override { return m_details; }
+
+            SearchResult Search(const SearchRequest& request) const override
+            {
+                SearchResult result;
+
+                for (const auto& shard : m_shards)
+                {
+                    SearchResult shardResult = shard->Search(request);
+
+                    for (auto& match : shardResult.Matches)
+                    {
+                        result.Matches.emplace_back(std::move(match));
+                    }
+
+                    result.Truncated = result.Truncated || shardResult.Truncated;
+                }
+
+                if (request.MaximumResults && result.Matches.size() > request.MaximumResults)
+                {
+                    result.Matches.erase(result.Matches.begin() + request.MaximumResults, result.Matches.end());
+                    result.Truncated = true;
+                }
+
+                return result;
+            }
+
+            void AddPackageVersion(const Manifest::Manifest& manifest, const std::filesystem::path& relativePath) override
+            {
+                GetShard(manifest.Id).AddPackageVersion(manifest, relativePath);
+            }
+
+            void RemovePackageVersion(const Manifest::Manifest& manifest, const std::filesystem::path& relativePath) override
+            {
+                GetShard(manifest.Id).RemovePackageVersion(manifest, relativePath);
+            }
+
+        private:
+            // All versions of a package live in one shard so that version enumeration
+            // and removal see the same data that addition wrote.
+            SQLiteIndexWriteableSource& GetShard(std::string_view packageId) const
+            {
+                return *m_shards[std::hash<std::string>{}(Utility::FoldCase(packageId)) % m_shards.size()];
+            }
+
+            SourceDetails m_details;
+            std::vector<std::shared_ptr<SQLiteIndexWriteableSource>> m_shards;
+        };
+
         struct PredefinedWriteableSourceReference : public ISourceReference
         {
             PredefinedWriteableSourceReference(const SourceDetails& details) : m_details(details)
@@ -60,10 +132,7 @@ namespace AppInstaller::Repository::Microsoft
                 std::call_once(g_InstallingSourceOnceFlag,
                     [&]()
                     {
-                        // Create an in memory index without paths or dependencies
-                        SQLiteIndex index = SQLiteIndex::CreateNew(SQLITE_MEMORY_DB_CONNECTION_TARGET, Schema::Version::Latest(), SQLiteIndex::CreateOptions::SupportPathless | SQLiteIndex::CreateOptions::DisableDependenciesSupport);
-
-                        g_sharedSource = std::make_shared<SQLiteIndexWriteableSource>(m_details, std::move(index), Synchronization::CrossProcessReaderWriteLock{}, true);
+                        g_sharedSource = std::make_shared<ShardedWriteableSource>(m_details, s_installingShardCount);
                     });
 
                 return g_sharedSource;
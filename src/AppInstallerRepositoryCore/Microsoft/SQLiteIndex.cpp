@@ -13,6 +13,9 @@
 #include "Schema/1_4/Interface.h"
 #include "Schema/1_5/Interface.h"
 #include "Schema/1_6/Interface.h"
+#include "Schema/1_7/Interface.h"
+#include "Schema/1_8/Interface.h"
+#include "Schema/1_9/Interface.h"
 
 namespace AppInstaller::Repository::Microsoft
 {
@@ -63,11 +66,23 @@ namespace AppInstaller::Repository::Microsoft
         {
             return std::make_unique<V1_5::Interface>();
         }
-        else if (m_version == Version{ 1, 6 } ||
+        else if (m_version == Version{ 1, 6 })
+        {
+            return std::make_unique<V1_6::Interface>();
+        }
+        else if (m_version == Version{ 1, 7 })
+        {
+            return std::make_unique<V1_7::Interface>();
+        }
+        else if (m_version == Version{ 1, 8 })
+        {
+            return std::make_unique<V1_8::Interface>();
+        }
+        else if (m_version == Version{ 1, 9 } ||
             m_version.MajorVersion == 1 ||
             m_version.IsLatest())
         {
-            return std::make_unique<V1_6::Interface>();
+            return std::make_unique<V1_9::Interface>();
         }
 
         // We do not have the capacity to operate on this schema version
@@ -132,6 +147,52 @@ namespace AppInstaller::Repository::Microsoft
         return result;
     }
 
+    std::vector<SQLiteIndex::IdType> SQLiteIndex::AddManifests(const std::vector<ManifestAndPath>& manifests)
+    {
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+        AICLI_LOG(Repo, Verbose, << "Adding " << manifests.size() << " manifests in a single transaction");
+
+        // Insert in case folded id order so that the id table and its index are appended
+        // to rather than split; on a fresh index build from a full catalog the incoming
+        // order is effectively random, which makes every insert a potential page split.
+        std::vector<size_t> insertOrder;
+        insertOrder.reserve(manifests.size());
+        std::vector<std::string> foldedIds;
+        foldedIds.reserve(manifests.size());
+
+        for (size_t i = 0; i < manifests.size(); ++i)
+        {
+            insertOrder.emplace_back(i);
+            foldedIds.emplace_back(Utility::FoldCase(static_cast<std::string_view>(manifests[i].Manifest.Id)));
+        }
+
+        std::stable_sort(insertOrder.begin(), insertOrder.end(), [&](size_t a, size_t b) { return foldedIds[a] < foldedIds[b]; });
+
+        std::vector<IdType> result(manifests.size());
+
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(m_dbconn, "sqliteindex_addmanifests");
+
+        for (size_t i : insertOrder)
+        {
+            result[i] = m_interface->AddManifest(m_dbconn, manifests[i].Manifest, manifests[i].RelativePath);
+        }
+
+        SetLastWriteTime();
+
+        savepoint.Commit();
+
+        return result;
+    }
+
+    void SQLiteIndex::CopyTo(const std::string& filePath)
+    {
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+        AICLI_LOG(Repo, Info, << "Copying index to file [" << filePath << "]");
+
+        SQLite::Connection target = SQLite::Connection::Create(filePath, SQLite::Connection::OpenDisposition::Create);
+        SQLite::Backup(target, m_dbconn);
+    }
+
     bool SQLiteIndex::UpdateManifest(const std::filesystem::path& manifestPath, const std::filesystem::path& relativePath)
     {
         AICLI_LOG(Repo, Verbose, << "Updating manifest from file [" << manifestPath << "]");
@@ -228,9 +289,17 @@ namespace AppInstaller::Repository::Microsoft
 
     Schema::ISQLiteIndex::SearchResult SQLiteIndex::Search(const SearchRequest& request) const
     {
-        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
         AICLI_LOG(Repo, Verbose, << "Performing search: " << request.ToString());
 
+        // Read dispositions search on a per-thread connection, so concurrent searches from
+        // server threads do not serialize on the interface lock or inside a shared connection.
+        if (GetOpenDisposition() != OpenDisposition::ReadWrite)
+        {
+            return m_interface->Search(GetThreadReadConnection(), request);
+        }
+
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+
         return m_interface->Search(m_dbconn, request);
     }
 
@@ -246,6 +315,12 @@ namespace AppInstaller::Repository::Microsoft
         return m_interface->GetMultiPropertyByManifestId(m_dbconn, manifestId, property);
     }
 
+    SQLiteIndex::PropertiesResult SQLiteIndex::GetPropertiesByManifestIds(const std::vector<IdType>& manifestIds, const std::vector<PackageVersionProperty>& properties) const
+    {
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+        return m_interface->GetPropertiesByManifestIds(m_dbconn, manifestIds, properties);
+    }
+
     std::optional<SQLiteIndex::IdType> SQLiteIndex::GetManifestIdByKey(IdType id, std::string_view version, std::string_view channel) const
     {
         std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
@@ -290,4 +365,15 @@ namespace AppInstaller::Repository::Microsoft
     {
         return m_interface->GetDependentsById(m_dbconn, packageId);
     }
+
+    SQLiteIndex::DependencyClosureResult SQLiteIndex::GetDependencyClosureByManifestRowIds(const std::vector<SQLite::rowid_t>& manifestRowIds) const
+    {
+        return m_interface->GetDependencyClosureByManifestRowIds(m_dbconn, manifestRowIds);
+    }
+
+    std::vector<SQLiteIndex::ChangeJournalEntry> SQLiteIndex::GetChangesSince(SQLite::rowid_t sequence) const
+    {
+        std::lock_guard<std::mutex> lockInterface{ *m_interfaceLock };
+        return m_interface->GetChangesSince(m_dbconn, sequence);
+    }
 }
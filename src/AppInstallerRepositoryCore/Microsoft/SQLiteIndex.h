@@ -34,6 +34,21 @@ namespace AppInstaller::Repository::Microsoft
         // The return type of GetMetadataByManifestId
         using MetadataResult = Schema::ISQLiteIndex::MetadataResult;
 
+        // The return type of GetPropertiesByManifestIds
+        using PropertiesResult = Schema::ISQLiteIndex::PropertiesResult;
+
+        // A single dependency declared by a manifest.
+        using DependencyEdge = Schema::ISQLiteIndex::DependencyEdge;
+
+        // The return type of GetDependencyClosureByManifestRowIds
+        using DependencyClosureResult = Schema::ISQLiteIndex::DependencyClosureResult;
+
+        // The type of change recorded in the change journal.
+        using ChangeType = Schema::ISQLiteIndex::ChangeType;
+
+        // A single entry returned by GetChangesSince.
+        using ChangeJournalEntry = Schema::ISQLiteIndex::ChangeJournalEntry;
+
         // Options for creating a new index.
         using CreateOptions = Schema::ISQLiteIndex::CreateOptions;
 
@@ -73,6 +88,20 @@ namespace AppInstaller::Repository::Microsoft
         // Returns the manifest id.
         IdType AddManifest(const Manifest::Manifest& manifest);
 
+        // A manifest and its optional repository relative path, for adding manifests in bulk.
+        struct ManifestAndPath
+        {
+            Manifest::Manifest Manifest;
+            std::optional<std::filesystem::path> RelativePath;
+        };
+
+        // Adds all of the given manifests to the index within a single transaction,
+        // amortizing the per-manifest commit cost across the batch. The manifests are
+        // inserted in id order to keep the underlying B-tree inserts appends.
+        // Either every manifest is added or none are.
+        // Returns the manifest ids in the same order as the input.
+        std::vector<IdType> AddManifests(const std::vector<ManifestAndPath>& manifests);
+
         // Updates the manifest with matching { Id, Version, Channel } in the index.
         // The return value indicates whether the index was modified by the function.
         bool UpdateManifest(const std::filesystem::path& manifestPath, const std::filesystem::path& relativePath);
@@ -97,6 +126,11 @@ namespace AppInstaller::Repository::Microsoft
         // Removes the manifest with the given id.
         void RemoveManifestById(IdType manifestId);
 
+        // Creates a copy of this index's database at the given path, replacing the contents
+        // of any database already there. Uses the SQLite backup API, so the copy is
+        // transactionally consistent.
+        void CopyTo(const std::string& filePath);
+
         // Removes data that is no longer needed for an index that is to be published.
         void PrepareForPackaging();
 
@@ -113,6 +147,11 @@ namespace AppInstaller::Repository::Microsoft
         // Gets the string values for the given property and manifest id, if present.
         std::vector<std::string> GetMultiPropertyByManifestId(IdType manifestId, PackageVersionMultiProperty property) const;
 
+        // Gets the strings for each of the given properties and manifest ids.
+        // Properties stored 1:1 with the manifest are retrieved for all of the ids with a
+        // single statement, rather than one statement per id and property.
+        PropertiesResult GetPropertiesByManifestIds(const std::vector<IdType>& manifestIds, const std::vector<PackageVersionProperty>& properties) const;
+
         // Gets the manifest id for the given { id, version, channel }, if present.
         // If version is empty, gets the value for the 'latest' version.
         std::optional<IdType> GetManifestIdByKey(IdType id, std::string_view version, std::string_view channel) const;
@@ -136,6 +175,16 @@ namespace AppInstaller::Repository::Microsoft
         // Get all the dependencies for a specific manifest.
         std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependenciesByManifestRowId(SQLite::rowid_t manifestRowId) const;
         std::vector<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependentsById(AppInstaller::Manifest::string_t packageId) const;
+
+        // Gets the transitive dependency closure of the given manifests with a single recursive statement,
+        // mapping each manifest in the closure to the dependencies that it declares.
+        DependencyClosureResult GetDependencyClosureByManifestRowIds(const std::vector<SQLite::rowid_t>& manifestRowIds) const;
+
+        // Gets the change journal entries recorded after the given sequence number, in increasing
+        // sequence order. Pass 0 to get the entire journal. Each entry carries its own sequence
+        // number, so a caller can resume from the last entry it has applied.
+        // Schema versions without a change journal return an empty result.
+        std::vector<ChangeJournalEntry> GetChangesSince(SQLite::rowid_t sequence) const;
     private:
         // Constructor used to create a new index.
         SQLiteIndex(const std::string& target, Schema::Version version);
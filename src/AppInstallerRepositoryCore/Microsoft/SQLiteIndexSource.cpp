@@ -5,6 +5,8 @@
 #include "Microsoft/PreIndexedPackageSourceFactory.h"
 #include <winget/ManifestYamlParser.h>
 
+#include <list>
+
 
 using namespace AppInstaller::Utility;
 
@@ -13,6 +15,65 @@ namespace AppInstaller::Repository::Microsoft
 {
     namespace
     {
+        // The package version properties that are hydrated together on first use.
+        constexpr PackageVersionProperty s_hydratedProperties[] =
+        {
+            PackageVersionProperty::Id,
+            PackageVersionProperty::Name,
+            PackageVersionProperty::Version,
+            PackageVersionProperty::Channel,
+        };
+
+        // A process wide cache of parsed manifests, keyed by their SHA256 hash.
+        // Evaluating show/install/upgrade creates multiple package version objects for the
+        // same manifest, each of which would otherwise download and parse the YAML again.
+        // The hash fully identifies the manifest contents, so entries can never serve
+        // stale data; manifests without a hash in the index are not cached.
+        struct ParsedManifestCache
+        {
+            static ParsedManifestCache& Instance()
+            {
+                static ParsedManifestCache s_instance;
+                return s_instance;
+            }
+
+            std::optional<Manifest::Manifest> TryGet(const std::string& hash)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                for (auto itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+                {
+                    if (itr->first == hash)
+                    {
+                        // Move the hit to the front to keep the most recently used entries alive.
+                        m_entries.splice(m_entries.begin(), m_entries, itr);
+                        return m_entries.front().second;
+                    }
+                }
+
+                return std::nullopt;
+            }
+
+            void Store(const std::string& hash, const Manifest::Manifest& manifest)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                m_entries.emplace_front(hash, manifest);
+
+                if (m_entries.size() > m_sizeLimit)
+                {
+                    m_entries.pop_back();
+                }
+            }
+
+        private:
+            ParsedManifestCache() = default;
+
+            std::mutex m_lock;
+            size_t m_sizeLimit = 64;
+            std::list<std::pair<std::string, Manifest::Manifest>> m_entries;
+        };
+
         // The base for the package objects.
         struct SourceReference
         {
@@ -46,6 +107,14 @@ namespace AppInstaller::Repository::Microsoft
                     return LocIndString{ GetReferenceSource()->GetIdentifier() };
                 case PackageVersionProperty::SourceName:
                     return LocIndString{ GetReferenceSource()->GetDetails().Name };
+                case PackageVersionProperty::Id:
+                case PackageVersionProperty::Name:
+                case PackageVersionProperty::Version:
+                case PackageVersionProperty::Channel:
+                    // These properties are read for every package version that is displayed;
+                    // hydrate all of them with a single statement on the first request and
+                    // serve the rest from the cache.
+                    return GetHydratedProperty(property);
                 default:
                     // Values coming from the index will always be localized/independent.
                     std::optional<std::string> optValue = GetReferenceSource()->GetIndex().GetPropertyByManifestId(m_manifestId, property);
@@ -68,6 +137,14 @@ namespace AppInstaller::Repository::Microsoft
 
             Manifest::Manifest GetManifest() override
             {
+                // Retrieving the manifest costs a round trip to the source for remote data;
+                // cache it so that repeated access within an operation only pays once.
+                std::lock_guard<std::mutex> lock{ m_manifestLock };
+                if (m_manifest)
+                {
+                    return *m_manifest;
+                }
+
                 std::shared_ptr<SQLiteIndexSource> source = GetReferenceSource();
 
                 std::optional<std::string> relativePathOpt = source->GetIndex().GetPropertyByManifestId(m_manifestId, PackageVersionProperty::RelativePath);
@@ -80,13 +157,27 @@ namespace AppInstaller::Repository::Microsoft
                 if (manifestHashString)
                 {
                     manifestSHA256 = SHA256::ConvertToBytes(manifestHashString.value());
+
+                    // The hash identifies the contents; another package version object may
+                    // have already fetched and parsed this manifest.
+                    std::optional<Manifest::Manifest> cached = ParsedManifestCache::Instance().TryGet(manifestHashString.value());
+                    if (cached)
+                    {
+                        m_manifest = std::move(cached);
+                        return *m_manifest;
+                    }
                 }
 
-                // Try the primary location 
+                // Try the primary location
                 HRESULT primaryHR = S_OK;
                 try
                 {
-                    return GetManifestFromArgAndRelativePath(source->GetDetails().Arg, relativePathOpt.value(), manifestSHA256);
+                    m_manifest = GetManifestFromArgAndRelativePath(source->GetDetails().Arg, relativePathOpt.value(), manifestSHA256);
+                    if (manifestHashString)
+                    {
+                        ParsedManifestCache::Instance().Store(manifestHashString.value(), *m_manifest);
+                    }
+                    return *m_manifest;
                 }
                 catch (...)
                 {
@@ -100,7 +191,12 @@ namespace AppInstaller::Repository::Microsoft
                 // Try alternate location
                 try
                 {
-                    return GetManifestFromArgAndRelativePath(source->GetDetails().AlternateArg, relativePathOpt.value(), manifestSHA256);
+                    m_manifest = GetManifestFromArgAndRelativePath(source->GetDetails().AlternateArg, relativePathOpt.value(), manifestSHA256);
+                    if (manifestHashString)
+                    {
+                        ParsedManifestCache::Instance().Store(manifestHashString.value(), *m_manifest);
+                    }
+                    return *m_manifest;
                 }
                 CATCH_LOG_MSG("GetManifest failed on alternate location");
 
@@ -126,6 +222,33 @@ namespace AppInstaller::Repository::Microsoft
             }
 
         private:
+            Utility::LocIndString GetHydratedProperty(PackageVersionProperty property) const
+            {
+                std::lock_guard<std::mutex> lock{ m_hydratedPropertiesLock };
+
+                if (m_hydratedProperties.empty())
+                {
+                    auto values = GetReferenceSource()->GetIndex().GetPropertiesByManifestIds(
+                        { m_manifestId }, { std::begin(s_hydratedProperties), std::end(s_hydratedProperties) });
+
+                    for (auto& column : values)
+                    {
+                        // Values coming from the index will always be localized/independent.
+                        m_hydratedProperties.emplace_back(column[0] ? std::move(column[0]).value() : std::string{});
+                    }
+                }
+
+                for (size_t i = 0; i < std::size(s_hydratedProperties); ++i)
+                {
+                    if (s_hydratedProperties[i] == property)
+                    {
+                        return m_hydratedProperties[i];
+                    }
+                }
+
+                THROW_HR(E_UNEXPECTED);
+            }
+
             static Manifest::Manifest GetManifestFromArgAndRelativePath(const std::string& arg, const std::string& relativePath, const SHA256::HashBuffer& expectedHash)
             {
                 std::string fullPath = arg;
@@ -192,6 +315,10 @@ namespace AppInstaller::Repository::Microsoft
             }
 
             SQLiteIndex::IdType m_manifestId;
+            std::mutex m_manifestLock;
+            std::optional<Manifest::Manifest> m_manifest;
+            mutable std::mutex m_hydratedPropertiesLock;
+            mutable std::vector<Utility::LocIndString> m_hydratedProperties;
         };
 
         // The base for IPackage implementations here.
@@ -266,14 +393,24 @@ namespace AppInstaller::Repository::Microsoft
             std::vector<PackageVersionKey> GetAvailableVersionKeys(PinBehavior) const override
             {
                 std::shared_ptr<SQLiteIndexSource> source = GetReferenceSource();
-                std::vector<Utility::VersionAndChannel> versions = source->GetIndex().GetVersionKeysById(m_idId);
 
-                std::vector<PackageVersionKey> result;
-                for (const auto& vac : versions)
+                // The version list is only enumerated for packages that are actually inspected,
+                // but it may then be requested several times; fill it from the index once and
+                // serve any further calls from the cache.
+                std::lock_guard<std::mutex> lock{ m_versionKeysLock };
+
+                if (!m_versionKeys)
                 {
-                    result.emplace_back(source->GetIdentifier(), vac.GetVersion().ToString(), vac.GetChannel().ToString());
+                    std::vector<PackageVersionKey> keys;
+                    for (const auto& vac : source->GetIndex().GetVersionKeysById(m_idId))
+                    {
+                        keys.emplace_back(source->GetIdentifier(), vac.GetVersion().ToString(), vac.GetChannel().ToString());
+                    }
+
+                    m_versionKeys = std::move(keys);
                 }
-                return result;
+
+                return *m_versionKeys;
             }
 
             std::shared_ptr<IPackageVersion> GetLatestAvailableVersion(PinBehavior) const override
@@ -317,6 +454,10 @@ namespace AppInstaller::Repository::Microsoft
 
                 return false;
             }
+
+        private:
+            mutable std::mutex m_versionKeysLock;
+            mutable std::optional<std::vector<PackageVersionKey>> m_versionKeys;
         };
 
         // The IPackage impl for SQLiteIndexSource of Installed packages.
@@ -375,7 +516,7 @@ namespace AppInstaller::Repository::Microsoft
         Synchronization::CrossProcessReaderWriteLock&& lock,
         bool isInstalledSource,
         bool requireManifestHash) :
-        m_details(details), m_lock(std::move(lock)), m_isInstalled(isInstalledSource), m_index(std::move(index)), m_requireManifestHash(requireManifestHash)
+        m_details(details), m_lock(std::move(lock)), m_isInstalled(isInstalledSource), m_index(std::make_shared<SQLiteIndex>(std::move(index))), m_requireManifestHash(requireManifestHash)
     {
     }
 
@@ -391,7 +532,7 @@ namespace AppInstaller::Repository::Microsoft
 
     SearchResult SQLiteIndexSource::Search(const SearchRequest& request) const
     {
-        auto indexResults = m_index.Search(request);
+        auto indexResults = GetIndex().Search(request);
 
         SearchResult result;
         std::shared_ptr<SQLiteIndexSource> sharedThis = NonConstSharedFromThis();
@@ -419,11 +560,52 @@ namespace AppInstaller::Repository::Microsoft
         return (other && GetIdentifier() == other->GetIdentifier());
     }
 
+    bool SQLiteIndexSource::TryUpdateIndex()
+    {
+        std::shared_ptr<SQLiteIndex> current = AcquireIndex();
+
+        // An in-memory database has no backing file that an update could replace.
+        if (current->GetFilePath().empty() || current->GetFilePath() == SQLITE_MEMORY_DB_CONNECTION_TARGET)
+        {
+            return false;
+        }
+
+        // The last write time is stamped into the index when it is published, so a newer
+        // value indicates that the backing file has been replaced with a new generation
+        // of data. A source reading from a private snapshot will never observe a change,
+        // as its file is not the target of updates.
+        std::chrono::system_clock::time_point currentWriteTime = current->GetLastWriteTime();
+
+        SQLiteIndex candidate = SQLiteIndex::Open(current->GetFilePath(), current->GetOpenDisposition());
+
+        if (candidate.GetLastWriteTime() <= currentWriteTime)
+        {
+            return false;
+        }
+
+        AICLI_LOG(Repo, Info, << "Source [" << GetIdentifier() << "] swapping in updated index data");
+
+        std::lock_guard<std::mutex> lock{ *m_indexLock };
+
+        // Retire rather than destroy the previous index so that any reference already
+        // handed out through GetIndex remains valid for the lifetime of the source.
+        m_retiredIndexes.emplace_back(std::move(m_index));
+        m_index = std::make_shared<SQLiteIndex>(std::move(candidate));
+
+        return true;
+    }
+
     std::shared_ptr<SQLiteIndexSource> SQLiteIndexSource::NonConstSharedFromThis() const
     {
         return const_cast<SQLiteIndexSource*>(this)->shared_from_this();
     }
 
+    std::shared_ptr<SQLiteIndex> SQLiteIndexSource::AcquireIndex() const
+    {
+        std::lock_guard<std::mutex> lock{ *m_indexLock };
+        return m_index;
+    }
+
     SQLiteIndexWriteableSource::SQLiteIndexWriteableSource(const SourceDetails& details, SQLiteIndex&& index, Synchronization::CrossProcessReaderWriteLock&& lock, bool isInstalledSource) :
         SQLiteIndexSource(details, std::move(index), std::move(lock), isInstalledSource)
     {
@@ -431,11 +613,11 @@ namespace AppInstaller::Repository::Microsoft
 
     void SQLiteIndexWriteableSource::AddPackageVersion(const Manifest::Manifest& manifest, const std::filesystem::path& relativePath)
     {
-        m_index.AddManifest(manifest, relativePath);
+        GetIndex().AddManifest(manifest, relativePath);
     }
-    
+
     void SQLiteIndexWriteableSource::RemovePackageVersion(const Manifest::Manifest& manifest, const std::filesystem::path& relativePath)
     {
-        m_index.RemoveManifest(manifest, relativePath);
+        GetIndex().RemoveManifest(manifest, relativePath);
     }
 }
@@ -6,6 +6,8 @@
 #include <AppInstallerSynchronization.h>
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 
 namespace AppInstaller::Repository::Microsoft
@@ -40,8 +42,16 @@ namespace AppInstaller::Repository::Microsoft
         SearchResult Search(const SearchRequest& request) const override;
 
         // Gets the index.
-        SQLiteIndex& GetIndex() { return m_index; }
-        const SQLiteIndex& GetIndex() const { return m_index; }
+        SQLiteIndex& GetIndex() { return *AcquireIndex(); }
+        const SQLiteIndex& GetIndex() const { return *AcquireIndex(); }
+
+        // Checks whether the file backing the index holds newer data than the index
+        // currently in use; if so, opens it and atomically swaps it in, preserving this
+        // source object and any package objects created from it. The previous index is
+        // retired rather than destroyed so that references already handed out remain
+        // valid for the lifetime of the source.
+        // Returns true if a newer index was swapped in.
+        bool TryUpdateIndex();
 
         // Determines if the other source refers to the same as this.
         bool IsSame(const SQLiteIndexSource* other) const;
@@ -51,13 +61,17 @@ namespace AppInstaller::Repository::Microsoft
     private:
         std::shared_ptr<SQLiteIndexSource> NonConstSharedFromThis() const;
 
+        // Gets shared ownership of the index currently in use.
+        std::shared_ptr<SQLiteIndex> AcquireIndex() const;
+
         SourceDetails m_details;
         Synchronization::CrossProcessReaderWriteLock m_lock;
         bool m_requireManifestHash;
         bool m_isInstalled;
-
-    protected:
-        SQLiteIndex m_index;
+        mutable std::unique_ptr<std::mutex> m_indexLock = std::make_unique<std::mutex>();
+        std::shared_ptr<SQLiteIndex> m_index;
+        // Indexes replaced by TryUpdateIndex, kept alive for outstanding references.
+        std::vector<std::shared_ptr<SQLiteIndex>> m_retiredIndexes;
     };
 
     // A source that holds a SQLiteIndex and lock.
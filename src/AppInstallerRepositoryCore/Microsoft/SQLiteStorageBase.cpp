@@ -3,11 +3,84 @@
 #include "pch.h"
 #include "SQLiteStorageBase.h"
 #include "Schema/MetadataTable.h"
+#include <winget/SharedThreadGlobals.h>
 
 namespace AppInstaller::Repository::Microsoft
 {
     namespace
     {
+        // The maximum number of bytes mapped for a ReadMapped open; comfortably larger
+        // than the indices we expect to open this way (the community index is ~30MB).
+        constexpr int64_t s_ReadMappedMaximumBytes = 0x10000000; // 256MB
+
+        // The maximum number of connections used for a structural integrity scan.
+        constexpr size_t s_VerifyIntegrityMaximumThreads = 4;
+
+        // The lookaside arena configured for index connections; sized for the statement
+        // churn of a search, where each prepared statement makes a burst of small
+        // transient allocations.
+        constexpr uint32_t s_LookasideSlotSizeBytes = 1024;
+        constexpr uint32_t s_LookasideSlotCount = 256;
+
+        // The buffer size used for the advisory cache warming read.
+        constexpr size_t s_WarmFileCacheBufferSize = 1 << 20; // 1MB
+
+        // Best effort advisory preload for read-only opens: pull the file through the OS
+        // cache with one sequential read so that the page reads of the actual queries do
+        // not each pay cold disk latency. A named event keyed on the file path is the
+        // cross process advisory; the first opener creates it and does the read, while
+        // openers that find it already present skip the redundant work. The handle is
+        // kept for the life of the process so that overlapping processes observe it.
+        void WarmFileCacheAdvisory(const std::string& filePath)
+        {
+            try
+            {
+                std::wstring eventName = L"WinGetSQLiteIndexWarm_";
+                eventName += Utility::ConvertToUTF16(Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(Utility::FoldCase(std::string_view{ filePath }))));
+
+                wil::unique_handle warmEvent{ ::CreateEventW(nullptr, TRUE, FALSE, eventName.c_str()) };
+                if (!warmEvent || ::GetLastError() == ERROR_ALREADY_EXISTS)
+                {
+                    return;
+                }
+
+                wil::unique_hfile file{ ::CreateFileW(
+                    Utility::ConvertToUTF16(filePath).c_str(),
+                    GENERIC_READ,
+                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                    nullptr,
+                    OPEN_EXISTING,
+                    FILE_FLAG_SEQUENTIAL_SCAN,
+                    nullptr) };
+                if (!file)
+                {
+                    return;
+                }
+
+                std::vector<char> buffer(s_WarmFileCacheBufferSize);
+                uint64_t remaining = s_ReadMappedMaximumBytes;
+                DWORD bytesRead = 0;
+
+                while (remaining != 0 &&
+                    ::ReadFile(file.get(), buffer.data(), static_cast<DWORD>(std::min<uint64_t>(buffer.size(), remaining)), &bytesRead, nullptr) &&
+                    bytesRead != 0)
+                {
+                    remaining -= bytesRead;
+                }
+
+                static std::mutex s_warmEventsLock;
+                static std::vector<wil::unique_handle> s_warmEvents;
+                {
+                    std::lock_guard<std::mutex> lock{ s_warmEventsLock };
+                    s_warmEvents.emplace_back(std::move(warmEvent));
+                }
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+            }
+        }
+
         static char const* const GetOpenDispositionString(SQLiteStorageBase::OpenDisposition disposition)
         {
             switch (disposition)
@@ -18,6 +91,8 @@ namespace AppInstaller::Repository::Microsoft
                 return "ReadWrite";
             case AppInstaller::Repository::Microsoft::SQLiteStorageBase::OpenDisposition::Immutable:
                 return "ImmutableRead";
+            case AppInstaller::Repository::Microsoft::SQLiteStorageBase::OpenDisposition::ReadMapped:
+                return "ReadMapped";
             default:
                 return "Unknown";
             }
@@ -43,6 +118,12 @@ namespace AppInstaller::Repository::Microsoft
         m_indexFile(std::move(indexFile))
     {
         AICLI_LOG(Repo, Info, << "Opening SQLite Index for " << GetOpenDispositionString(disposition) << " at '" << filePath << "'");
+
+        if (disposition != OpenDisposition::ReadWrite && !filePath.empty() && filePath != SQLITE_MEMORY_DB_CONNECTION_TARGET)
+        {
+            WarmFileCacheAdvisory(filePath);
+        }
+
         switch (disposition)
         {
         case OpenDisposition::Read:
@@ -51,6 +132,9 @@ namespace AppInstaller::Repository::Microsoft
         case OpenDisposition::ReadWrite:
             m_dbconn = SQLite::Connection::Create(filePath, SQLite::Connection::OpenDisposition::ReadWrite, SQLite::Connection::OpenFlags::None);
             break;
+        case OpenDisposition::ReadMapped:
+            m_dbconn = SQLite::Connection::Create(filePath, SQLite::Connection::OpenDisposition::ReadOnly, SQLite::Connection::OpenFlags::SharedCache);
+            break;
         case OpenDisposition::Immutable:
         {
             // Following the algorithm set forth at https://sqlite.org/uri.html [3.1] to convert to a URI path
@@ -102,13 +186,197 @@ namespace AppInstaller::Repository::Microsoft
             THROW_HR(E_UNEXPECTED);
         }
 
+        // Lookaside must be configured before the first statement runs on the connection.
+        m_dbconn.ConfigureLookaside(s_LookasideSlotSizeBytes, s_LookasideSlotCount);
+
+        if (disposition == OpenDisposition::ReadMapped)
+        {
+            m_dbconn.SetMemoryMapSize(s_ReadMappedMaximumBytes);
+        }
+
         m_version = Schema::Version::GetSchemaVersion(m_dbconn);
+        m_filePath = filePath;
+        m_disposition = disposition;
+
+        if (disposition == OpenDisposition::ReadWrite)
+        {
+            // A set marker means the last write session did not close cleanly; verify the
+            // database before trusting it rather than letting corruption surface as
+            // confusing errors deeper in a command.
+            if (Schema::MetadataTable::TryGetNamedValue<int64_t>(m_dbconn, Schema::s_MetadataValueName_IntegrityMarker).value_or(0))
+            {
+                AICLI_LOG(Repo, Warning, << "Database was not closed cleanly, verifying structural integrity: " << filePath);
+                THROW_HR_IF(APPINSTALLER_CLI_ERROR_INDEX_INTEGRITY_COMPROMISED, !VerifyStructuralIntegrity());
+                AICLI_LOG(Repo, Info, << "Structural integrity scan passed");
+            }
+
+            Schema::MetadataTable::SetNamedValue(m_dbconn, Schema::s_MetadataValueName_IntegrityMarker, 1ll);
+        }
     }
 
     SQLiteStorageBase::SQLiteStorageBase(const std::string& target, Schema::Version version) :
         m_dbconn(SQLite::Connection::Create(target, SQLite::Connection::OpenDisposition::Create))
     {
         m_version = version;
+        m_filePath = target;
+        m_disposition = OpenDisposition::ReadWrite;
+        m_dbconn.ConfigureLookaside(s_LookasideSlotSizeBytes, s_LookasideSlotCount);
         Schema::MetadataTable::Create(m_dbconn);
+        Schema::MetadataTable::SetNamedValue(m_dbconn, Schema::s_MetadataValueName_IntegrityMarker, 1ll);
+    }
+
+    SQLiteStorageBase::WriteBatch::WriteBatch(SQLite::Connection& connection) :
+        m_savepoint(SQLite::Savepoint::Create(connection, "storagebase_writebatch"))
+    {
+    }
+
+    void SQLiteStorageBase::WriteBatch::Commit()
+    {
+        m_savepoint.Commit();
+    }
+
+    SQLiteStorageBase::WriteBatch SQLiteStorageBase::BeginWriteBatch()
+    {
+        return { m_dbconn };
+    }
+
+    const SQLite::Connection& SQLiteStorageBase::GetThreadReadConnection() const
+    {
+        // Writable and memory backed databases must use the single shared connection: a
+        // writer needs to see its own uncommitted state, and a memory database's contents
+        // are per connection.
+        if (m_disposition == OpenDisposition::ReadWrite || m_filePath.empty() || m_filePath == SQLITE_MEMORY_DB_CONNECTION_TARGET)
+        {
+            return m_dbconn;
+        }
+
+        std::lock_guard<std::mutex> lock{ m_threadReadConnections->Lock };
+
+        auto itr = m_threadReadConnections->Connections.find(std::this_thread::get_id());
+        if (itr == m_threadReadConnections->Connections.end())
+        {
+            // Thread connections deliberately do not use the shared cache; each one reads
+            // its own snapshot so that readers never block each other inside SQLite.
+            SQLite::Connection connection = SQLite::Connection::Create(m_filePath, SQLite::Connection::OpenDisposition::ReadOnly, SQLite::Connection::OpenFlags::None);
+            connection.ConfigureLookaside(s_LookasideSlotSizeBytes, s_LookasideSlotCount);
+
+            if (m_disposition == OpenDisposition::ReadMapped)
+            {
+                connection.SetMemoryMapSize(s_ReadMappedMaximumBytes);
+            }
+
+            itr = m_threadReadConnections->Connections.emplace(std::this_thread::get_id(), std::move(connection)).first;
+        }
+
+        return itr->second;
+    }
+
+    SQLiteStorageBase::~SQLiteStorageBase()
+    {
+        // The connection is null when this object was moved from.
+        if (m_disposition == OpenDisposition::ReadWrite && static_cast<sqlite3*>(m_dbconn))
+        {
+            try
+            {
+                Schema::MetadataTable::SetNamedValue(m_dbconn, Schema::s_MetadataValueName_IntegrityMarker, 0ll);
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+            }
+        }
+    }
+
+    bool SQLiteStorageBase::VerifyStructuralIntegrity() const
+    {
+        try
+        {
+            std::vector<std::string> tables;
+            {
+                SQLite::Statement getTables = SQLite::Statement::Create(m_dbconn, "select [name] from [sqlite_master] where [type] = 'table' order by [name]");
+                while (getTables.Step())
+                {
+                    tables.emplace_back(getTables.GetColumn<std::string>(0));
+                }
+            }
+
+            // Walking the entire table btree forces every page that it references through
+            // SQLite's structural validation, without the index consistency work that makes
+            // a full `PRAGMA integrity_check` expensive.
+            auto scanTable = [](const SQLite::Connection& connection, const std::string& table)
+            {
+                std::string sql = "select count(*) from [";
+                sql += table;
+                sql += "] not indexed";
+                SQLite::Statement scan = SQLite::Statement::Create(connection, sql);
+                scan.Step();
+            };
+
+            size_t threadCount = std::min<size_t>(
+                { static_cast<size_t>(std::thread::hardware_concurrency()), tables.size(), s_VerifyIntegrityMaximumThreads });
+
+            if (threadCount < 2 || m_filePath.empty() || m_filePath == SQLITE_MEMORY_DB_CONNECTION_TARGET)
+            {
+                for (const std::string& table : tables)
+                {
+                    scanTable(m_dbconn, table);
+                }
+            }
+            else
+            {
+                std::vector<std::exception_ptr> exceptions(threadCount);
+                std::vector<std::thread> threads;
+                threads.reserve(threadCount);
+
+                ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+                for (size_t t = 0; t < threadCount; ++t)
+                {
+                    threads.emplace_back([&, t]()
+                        {
+                            std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                            if (callerGlobals)
+                            {
+                                previousGlobals = callerGlobals->SetForCurrentThread();
+                            }
+
+                            try
+                            {
+                                SQLite::Connection connection = SQLite::Connection::Create(m_filePath, SQLite::Connection::OpenDisposition::ReadOnly);
+
+                                for (size_t i = t; i < tables.size(); i += threadCount)
+                                {
+                                    scanTable(connection, tables[i]);
+                                }
+                            }
+                            catch (...)
+                            {
+                                exceptions[t] = std::current_exception();
+                            }
+                        });
+                }
+
+                for (std::thread& thread : threads)
+                {
+                    thread.join();
+                }
+
+                for (std::exception_ptr& exception : exceptions)
+                {
+                    if (exception)
+                    {
+                        std::rethrow_exception(exception);
+                    }
+                }
+            }
+        }
+        catch (...)
+        {
+            AICLI_LOG(Repo, Error, << "Structural integrity scan failed for: " << m_filePath);
+            LOG_CAUGHT_EXCEPTION();
+            return false;
+        }
+
+        return true;
     }
 }
\ No newline at end of file
@@ -6,7 +6,9 @@
 #include <winget/ManagedFile.h>
 #include <AppInstallerVersions.h>
 
+#include <map>
 #include <mutex>
+#include <thread>
 
 namespace AppInstaller::Repository::Microsoft
 {
@@ -21,14 +23,70 @@ namespace AppInstaller::Repository::Microsoft
             ReadWrite,
             // The database will not change while in use; open for immutable read.
             Immutable,
+            // Open for read only, using memory-mapped I/O and the shared cache.
+            // Intended for frequently opened, read-heavy databases like the pre-indexed source,
+            // where it avoids buffer-pool copies and rewarming the page cache on every open.
+            ReadMapped,
         };
 
+        // A scope that coalesces the logical writes made through the owning storage object
+        // into a single transaction. While it is active the per-operation savepoints nest
+        // inside it, so a loop of writes pays one real commit (and one fsync) at Commit
+        // rather than one per write. Destruction without Commit rolls the whole batch back.
+        // The caller must be the only writer to the storage for the batch's lifetime.
+        struct WriteBatch
+        {
+            WriteBatch(const WriteBatch&) = delete;
+            WriteBatch& operator=(const WriteBatch&) = delete;
+
+            WriteBatch(WriteBatch&&) = default;
+            WriteBatch& operator=(WriteBatch&&) = default;
+
+            // Commits all writes made during the batch.
+            void Commit();
+
+        private:
+            friend SQLiteStorageBase;
+
+            WriteBatch(SQLite::Connection& connection);
+
+            SQLite::Savepoint m_savepoint;
+        };
+
+        // Begins a scope that groups the writes made through this storage into one commit.
+        [[nodiscard]] WriteBatch BeginWriteBatch();
+
+        // Clears the unclean shutdown marker for write sessions; a crash before this point
+        // leaves it set and triggers a structural integrity scan on the next open.
+        ~SQLiteStorageBase();
+
+        SQLiteStorageBase(SQLiteStorageBase&&) = default;
+        SQLiteStorageBase& operator=(SQLiteStorageBase&&) = default;
+
+        // Determines whether the database is structurally sound by walking the btree of
+        // every table, which forces each referenced page through SQLite's validation.
+        // Tables are scanned on parallel read-only connections when the database is file
+        // backed. This surfaces the common torn-write and truncation corruption in roughly
+        // the cost of a sequential read, far faster than a full `PRAGMA integrity_check`,
+        // enabling a salvage-or-refetch decision at open time.
+        // Returns false if any scan reports an error.
+        bool VerifyStructuralIntegrity() const;
+
         // Gets the last write time for the index.
         std::chrono::system_clock::time_point GetLastWriteTime();
 
+        // Gets the file path that the database was opened from.
+        const std::string& GetFilePath() const { return m_filePath; }
+
+        // Gets the disposition that the database was opened with.
+        OpenDisposition GetOpenDisposition() const { return m_disposition; }
+
         // Gets the schema version of the index.
         Schema::Version GetVersion() const { return m_version; }
 
+        // Switches the backing database to write-ahead logging; see Connection::EnableWriteAheadLogging.
+        void EnableWriteAheadLogging() { m_dbconn.EnableWriteAheadLogging(); }
+
     protected:
         SQLiteStorageBase(const std::string& target, Schema::Version version);
 
@@ -40,9 +98,27 @@ namespace AppInstaller::Repository::Microsoft
         // Gets the corresponding OpenFlags based on the disposition.
         SQLite::Connection::OpenFlags GetOpenFlags(SQLiteStorageBase::OpenDisposition disposition);
 
+        // Gets a connection for a read operation on the calling thread. When the database was
+        // opened with a read only disposition and is file backed, each thread gets its own
+        // private connection (with its own statement cache), so concurrent readers do not
+        // serialize inside a shared connection; otherwise the shared connection is returned
+        // and the caller must hold the interface lock. Thread connections live until the
+        // storage object is destroyed.
+        const SQLite::Connection& GetThreadReadConnection() const;
+
+        // The per-thread read connections; see GetThreadReadConnection.
+        struct ThreadReadConnections
+        {
+            std::mutex Lock;
+            std::map<std::thread::id, SQLite::Connection> Connections;
+        };
+
         Utility::ManagedFile m_indexFile;
         SQLite::Connection m_dbconn;
         Schema::Version m_version;
+        std::string m_filePath;
+        OpenDisposition m_disposition = OpenDisposition::Read;
         std::unique_ptr<std::mutex> m_interfaceLock = std::make_unique<std::mutex>();
+        std::unique_ptr<ThreadReadConnections> m_threadReadConnections = std::make_unique<ThreadReadConnections>();
     };
 }
\ No newline at end of file
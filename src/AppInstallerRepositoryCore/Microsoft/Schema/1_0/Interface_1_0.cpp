@@ -489,20 +489,20 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         // Remove any duplicate manifest entries
         resultsTable->RemoveDuplicateManifestRows();
 
-        // Second phase, for remaining filters, flag matching search results, then remove unflagged values.
+        // Second phase, for remaining filters, remove search results not found by the filter.
+        // The match type variants of each filter are given together so that the removal is a single pass.
         for (size_t i = filterIndex; i < request.Filters.size(); ++i)
         {
             PackageMatchFilter filter = request.Filters[i];
 
-            resultsTable->PrepareToFilter();
-
+            std::vector<PackageMatchFilter> matchTypeVariants;
             for (MatchType match : GetMatchTypeOrder(filter.Type))
             {
                 filter.Type = match;
-                resultsTable->FilterOnField(filter);
+                matchTypeVariants.emplace_back(filter);
             }
 
-            resultsTable->CompleteFilter();
+            resultsTable->FilterOnFields(matchTypeVariants);
         }
 
         return resultsTable->GetSearchResults(request.MaximumResults);
@@ -524,6 +524,100 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         return {};
     }
 
+    ISQLiteIndex::PropertiesResult Interface::GetPropertiesByManifestIds(
+        const SQLite::Connection& connection,
+        const std::vector<SQLite::rowid_t>& manifestIds,
+        const std::vector<PackageVersionProperty>& properties) const
+    {
+        PropertiesResult result(properties.size(), std::vector<std::optional<std::string>>(manifestIds.size()));
+
+        if (manifestIds.empty() || properties.empty())
+        {
+            return result;
+        }
+
+        // Partition the properties into those stored 1:1 with the manifest, which can be
+        // retrieved for every id with a single joined statement, and the rest, which fall
+        // back to per-id retrieval.
+        std::vector<SQLite::Builder::QualifiedColumn> joinedColumns;
+        std::vector<std::string_view> joinedManifestColumns;
+        std::vector<size_t> joinedProperties;
+        std::vector<size_t> fallbackProperties;
+
+        for (size_t i = 0; i < properties.size(); ++i)
+        {
+            auto addJoined = [&](std::string_view tableName, std::string_view valueName)
+                {
+                    joinedColumns.emplace_back(tableName, valueName);
+                    joinedManifestColumns.emplace_back(valueName);
+                    joinedProperties.emplace_back(i);
+                };
+
+            switch (properties[i])
+            {
+            case PackageVersionProperty::Id:
+                addJoined(IdTable::TableName(), IdTable::ValueName());
+                break;
+            case PackageVersionProperty::Name:
+                addJoined(NameTable::TableName(), NameTable::ValueName());
+                break;
+            case PackageVersionProperty::Version:
+                addJoined(VersionTable::TableName(), VersionTable::ValueName());
+                break;
+            case PackageVersionProperty::Channel:
+                addJoined(ChannelTable::TableName(), ChannelTable::ValueName());
+                break;
+            default:
+                fallbackProperties.emplace_back(i);
+                break;
+            }
+        }
+
+        if (!joinedColumns.empty())
+        {
+            // A manifest id may be requested more than once; deliver its row to every position holding it.
+            std::map<SQLite::rowid_t, std::vector<size_t>> idPositions;
+            for (size_t i = 0; i < manifestIds.size(); ++i)
+            {
+                idPositions[manifestIds[i]].emplace_back(i);
+            }
+
+            // Manifest ids that are not present produce no row, leaving their values unset
+            // just as GetPropertyByManifestId would.
+            SQLite::Statement select = ManifestTable::GetValuesByManifestIds_Statement(connection, manifestIds, joinedColumns, joinedManifestColumns);
+
+            while (select.Step())
+            {
+                auto itr = idPositions.find(select.GetColumn<SQLite::rowid_t>(0));
+                if (itr == idPositions.end())
+                {
+                    continue;
+                }
+
+                for (size_t i = 0; i < joinedProperties.size(); ++i)
+                {
+                    // View into the row; each destination makes its own copy below.
+                    std::string_view value = select.GetColumnView(static_cast<int>(i) + 1);
+
+                    for (size_t position : itr->second)
+                    {
+                        result[joinedProperties[i]][position] = value;
+                    }
+                }
+            }
+        }
+
+        for (size_t property : fallbackProperties)
+        {
+            for (size_t i = 0; i < manifestIds.size(); ++i)
+            {
+                result[property][i] = GetPropertyByManifestId(connection, manifestIds[i], properties[property]);
+            }
+        }
+
+        return result;
+    }
+
     std::optional<SQLite::rowid_t> Interface::GetManifestIdByKey(const SQLite::Connection& connection, SQLite::rowid_t id, std::string_view version, std::string_view channel) const
     {
         return StaticGetManifestIdByKey(connection, id, version, channel);
@@ -544,6 +638,16 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         return {};
     }
 
+    ISQLiteIndex::DependencyClosureResult Interface::GetDependencyClosureByManifestRowIds(const SQLite::Connection&, const std::vector<SQLite::rowid_t>&) const
+    {
+        return {};
+    }
+
+    std::vector<ISQLiteIndex::ChangeJournalEntry> Interface::GetChangesSince(const SQLite::Connection&, SQLite::rowid_t) const
+    {
+        return {};
+    }
+
     std::vector<Utility::VersionAndChannel> Interface::GetVersionKeysById(const SQLite::Connection& connection, SQLite::rowid_t id) const
     {
         auto versionsAndChannels = ManifestTable::GetAllValuesById<IdTable, VersionTable, ChannelTable>(connection, id);
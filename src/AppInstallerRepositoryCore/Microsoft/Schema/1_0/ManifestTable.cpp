@@ -113,6 +113,51 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             return result;
         }
 
+        // Creates and prepares a statement selecting the values for all of the given manifest ids.
+        // Ex.
+        // SELECT [manifest].[rowid], [ids].[id], [names].[name] FROM [manifest]
+        // JOIN [ids] ON [manifest].[id] = [ids].[rowid]
+        // JOIN [names] ON [manifest].[name] = [names].[rowid]
+        // WHERE [manifest].[rowid] IN (?, ?)
+        SQLite::Statement ManifestTableGetValuesByManifestIds_Statement(
+            const SQLite::Connection& connection,
+            const std::vector<SQLite::rowid_t>& ids,
+            const std::vector<SQLite::Builder::QualifiedColumn>& columns,
+            const std::vector<std::string_view>& manifestColumnNames)
+        {
+            THROW_HR_IF(E_UNEXPECTED, manifestColumnNames.size() != columns.size());
+
+            using QCol = SQLite::Builder::QualifiedColumn;
+
+            SQLite::Builder::StatementBuilder builder;
+            builder.Select().Column(QCol{ s_ManifestTable_Table_Name, SQLite::RowIDName });
+
+            for (const auto& column : columns)
+            {
+                builder.Column(column);
+            }
+
+            builder.From(s_ManifestTable_Table_Name);
+
+            // join tables
+            for (size_t i = 0; i < columns.size(); ++i)
+            {
+                builder.Join(columns[i].Table).On(QCol{ s_ManifestTable_Table_Name, manifestColumnNames[i] }, QCol{ columns[i].Table, SQLite::RowIDName });
+            }
+
+            builder.Where(QCol{ s_ManifestTable_Table_Name, SQLite::RowIDName }).In(ids.size());
+
+            SQLite::Statement select = builder.Prepare(connection);
+
+            int bindIndex = 0;
+            for (const auto& id : ids)
+            {
+                select.Bind(++bindIndex, id);
+            }
+
+            return select;
+        }
+
         SQLite::Statement ManifestTableGetAllValuesByIds_Statement(
             const SQLite::Connection& connection,
             std::initializer_list<SQLite::Builder::QualifiedColumn> valueColumns,
@@ -447,6 +492,15 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         return connection.GetLastInsertRowID();
     }
 
+    SQLite::Statement ManifestTable::GetValuesByManifestIds_Statement(
+        const SQLite::Connection& connection,
+        const std::vector<SQLite::rowid_t>& ids,
+        const std::vector<SQLite::Builder::QualifiedColumn>& columns,
+        const std::vector<std::string_view>& manifestColumnNames)
+    {
+        return details::ManifestTableGetValuesByManifestIds_Statement(connection, ids, columns, manifestColumnNames);
+    }
+
     bool ManifestTable::ExistsById(const SQLite::Connection& connection, SQLite::rowid_t id)
     {
         SQLite::Builder::StatementBuilder builder;
@@ -46,6 +46,13 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             std::initializer_list<SQLite::Builder::QualifiedColumn> columns,
             std::initializer_list<std::string_view> manifestColumnNames);
 
+        // Gets the requested values for all of the manifests with the given rowids.
+        SQLite::Statement ManifestTableGetValuesByManifestIds_Statement(
+            const SQLite::Connection& connection,
+            const std::vector<SQLite::rowid_t>& ids,
+            const std::vector<SQLite::Builder::QualifiedColumn>& columns,
+            const std::vector<std::string_view>& manifestColumnNames);
+
         // Gets all values for rows that match the given ids.
         SQLite::Statement ManifestTableGetAllValuesByIds_Statement(
             const SQLite::Connection& connection,
@@ -144,6 +151,16 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             return details::ManifestTableGetValuesById_Statement(connection, id, { SQLite::Builder::QualifiedColumn{ Tables::TableName(), Tables::ValueName() }... }, { details::GetManifestTableColumnName<Tables>()... }).GetRow<typename Tables::value_t...>();
         }
 
+        // Gets the values requested for all of the manifests with the given rowids using a single statement.
+        // Each result row begins with the manifest rowid, followed by the requested values.
+        // The column set is determined at runtime, so the tables are given as qualified columns
+        // rather than as template parameters.
+        static SQLite::Statement GetValuesByManifestIds_Statement(
+            const SQLite::Connection& connection,
+            const std::vector<SQLite::rowid_t>& ids,
+            const std::vector<SQLite::Builder::QualifiedColumn>& columns,
+            const std::vector<std::string_view>& manifestColumnNames);
+
         // Gets the values for rows that match the given ids.
         template <typename ValueTable, typename... IdTables>
         static std::vector<typename ValueTable::value_t> GetAllValuesByIds(const SQLite::Connection& connection, std::initializer_list<SQLite::rowid_t> ids)
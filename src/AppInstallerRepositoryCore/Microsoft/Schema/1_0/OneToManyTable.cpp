@@ -21,13 +21,13 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         {
             // Create the mapping table insert statement for multiple use.
             // Bind the rowid of the value to 2.
-            SQLite::Statement CreateMappingInsertStatementForManifestId(SQLite::Connection& connection, std::string_view tableName, std::string_view valueName, SQLite::rowid_t manifestId)
+            SQLite::CachedStatement CreateMappingInsertStatementForManifestId(SQLite::Connection& connection, std::string_view tableName, std::string_view valueName, SQLite::rowid_t manifestId)
             {
                 SQLite::Builder::StatementBuilder insertMappingBuilder;
                 insertMappingBuilder.InsertInto({ tableName, s_OneToManyTable_MapTable_Suffix }).
                     Columns({ s_OneToManyTable_MapTable_ManifestName, valueName }).Values(manifestId, SQLite::Builder::Unbound);
 
-                return insertMappingBuilder.Prepare(connection);
+                return insertMappingBuilder.PrepareCached(connection);
             }
 
             // Get a collection of the value ids associated with the given manifest id.
@@ -38,7 +38,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
                 SQLite::Builder::StatementBuilder selectMappingBuilder;
                 selectMappingBuilder.Select(valueName).From({ tableName, s_OneToManyTable_MapTable_Suffix }).Where(s_OneToManyTable_MapTable_ManifestName).Equals(manifestId);
 
-                SQLite::Statement selectMappingStatement = selectMappingBuilder.Prepare(connection);
+                SQLite::CachedStatement selectMappingStatement = selectMappingBuilder.PrepareCached(connection);
 
                 while (selectMappingStatement.Step())
                 {
@@ -55,15 +55,16 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
                     SQLite::Builder::StatementBuilder selectValueMappingBuilder;
                     selectValueMappingBuilder.Select(s_OneToManyTable_MapTable_ManifestName).From({ tableName, s_OneToManyTable_MapTable_Suffix }).Where(valueName).Equals(SQLite::Builder::Unbound).Limit(1);
 
-                    SelectIfAnyMappingsByValueId = selectValueMappingBuilder.Prepare(connection);
+                    SelectIfAnyMappingsByValueId = selectValueMappingBuilder.PrepareCached(connection);
 
                     SQLite::Builder::StatementBuilder deleteValueBuilder;
                     deleteValueBuilder.DeleteFrom(tableName).Where(SQLite::RowIDName).Equals(SQLite::Builder::Unbound);
 
-                    DeleteValueById = deleteValueBuilder.Prepare(connection);
+                    DeleteValueById = deleteValueBuilder.PrepareCached(connection);
                 }
 
-                void Execute(SQLite::rowid_t valueId)
+                // Returns true if the value row was deleted.
+                bool Execute(SQLite::rowid_t valueId)
                 {
                     SelectIfAnyMappingsByValueId.Reset();
                     SelectIfAnyMappingsByValueId.Bind(1, valueId);
@@ -75,14 +76,17 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
                         DeleteValueById.Bind(1, valueId);
 
                         DeleteValueById.Execute();
+                        return true;
                     }
+
+                    return false;
                 }
 
             private:
                 // Bind valid rowid to 1.
-                SQLite::Statement SelectIfAnyMappingsByValueId;
+                SQLite::CachedStatement SelectIfAnyMappingsByValueId;
                 // Bind valid rowid to 1.
-                SQLite::Statement DeleteValueById;
+                SQLite::CachedStatement DeleteValueById;
             };
         }
 
@@ -160,7 +164,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
                 From({ tableName, s_OneToManyTable_MapTable_Suffix }).As("map").Join(tableName).
                 On(QCol("map", valueName), QCol(tableName, SQLite::RowIDName)).Where(QCol("map", s_OneToManyTable_MapTable_ManifestName)).Equals(manifestId);
 
-            SQLite::Statement statement = builder.Prepare(connection);
+            SQLite::CachedStatement statement = builder.PrepareCached(connection);
 
             while (statement.Step())
             {
@@ -176,7 +180,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         {
             SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, std::string{ tableName } + "_ensureandinsert_v1_0");
 
-            SQLite::Statement insertMapping = CreateMappingInsertStatementForManifestId(connection, tableName, valueName, manifestId);
+            SQLite::CachedStatement insertMapping = CreateMappingInsertStatementForManifestId(connection, tableName, valueName, manifestId);
 
             for (const std::string& value : values)
             {
@@ -197,10 +201,29 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             std::string_view tableName, std::string_view valueName,
             const std::vector<Utility::NormalizedString>& values, SQLite::rowid_t manifestId)
         {
+            // Compare the incoming values against the indexed state first; an update that does
+            // not change this table is the common case for index maintenance, and detecting it
+            // from the single mapping join avoids interning every value below.
+            {
+                std::vector<std::string> existingValues = OneToManyTableGetValuesByManifestId(connection, tableName, valueName, manifestId);
+
+                if (existingValues.size() == values.size())
+                {
+                    std::vector<std::string> incomingValues{ values.begin(), values.end() };
+                    std::sort(incomingValues.begin(), incomingValues.end());
+                    std::sort(existingValues.begin(), existingValues.end());
+
+                    if (std::equal(existingValues.begin(), existingValues.end(), incomingValues.begin()))
+                    {
+                        return false;
+                    }
+                }
+            }
+
             std::vector<SQLite::rowid_t> oldValueIds = GetValueIdsByManifestId(connection, tableName, valueName, manifestId);
             bool modificationNeeded = false;
 
-            SQLite::Statement insertMapping = CreateMappingInsertStatementForManifestId(connection, tableName, valueName, manifestId);
+            SQLite::CachedStatement insertMapping = CreateMappingInsertStatementForManifestId(connection, tableName, valueName, manifestId);
 
             for (const std::string& value : values)
             {
@@ -227,9 +250,10 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             deleteBuilder.DeleteFrom({ tableName, s_OneToManyTable_MapTable_Suffix }).
                 Where(s_OneToManyTable_MapTable_ManifestName).Equals(manifestId).And(valueName).Equals(SQLite::Builder::Unbound);
 
-            SQLite::Statement deleteStatement = deleteBuilder.Prepare(connection);
+            SQLite::CachedStatement deleteStatement = deleteBuilder.PrepareCached(connection);
 
             DeleteValueIfNotNeededStatements dvinns(connection, tableName, valueName);
+            bool valuesDeleted = false;
 
             for (SQLite::rowid_t valueId : oldValueIds)
             {
@@ -242,7 +266,12 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
                 deleteStatement.Execute();
 
                 // Second, delete the value itself if not needed
-                dvinns.Execute(valueId);
+                valuesDeleted = dvinns.Execute(valueId) || valuesDeleted;
+            }
+
+            if (valuesDeleted)
+            {
+                connection.InvalidateInternedValues(tableName);
             }
 
             return modificationNeeded;
@@ -263,10 +292,16 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
 
             // For each value, see if any references exist
             DeleteValueIfNotNeededStatements dvinns(connection, tableName, valueName);
+            bool valuesDeleted = false;
 
             for (SQLite::rowid_t value : values)
             {
-                dvinns.Execute(value);
+                valuesDeleted = dvinns.Execute(value) || valuesDeleted;
+            }
+
+            if (valuesDeleted)
+            {
+                connection.InvalidateInternedValues(tableName);
             }
 
             savepoint.Commit();
@@ -285,6 +320,17 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             OneToOneTablePrepareForPackaging(connection, tableName, useNamedIndices, preserveValuesIndex);
         }
 
+        void OneToManyTableCreateManifestCoveringIndex(SQLite::Connection& connection, std::string_view tableName, std::string_view valueName)
+        {
+            // Reuses the name of the manifest index that PrepareForPackaging drops, so that
+            // packaging a database a second time remains well defined.
+            SQLite::Builder::StatementBuilder createIndexBuilder;
+            createIndexBuilder.CreateIndex({ tableName, s_OneToManyTable_MapTable_Suffix, s_OneToManyTable_MapTable_IndexSuffix }).
+                On({ tableName, s_OneToManyTable_MapTable_Suffix }).Columns({ s_OneToManyTable_MapTable_ManifestName, valueName });
+
+            createIndexBuilder.Execute(connection);
+        }
+
         bool OneToManyTableCheckConsistency(const SQLite::Connection& connection, std::string_view tableName, std::string_view valueName, bool log)
         {
             using QCol = SQLite::Builder::QualifiedColumn;
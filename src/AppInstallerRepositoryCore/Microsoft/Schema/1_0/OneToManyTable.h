@@ -43,6 +43,10 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         // Removes data that is no longer needed for an index that is to be published.
         void OneToManyTablePrepareForPackaging(SQLite::Connection& connection, std::string_view tableName, bool useNamedIndices, bool preserveManifestIndex, bool preserveValuesIndex);
 
+        // Creates a covering index over the map table keyed by manifest, so that reading the
+        // values of a manifest is answered entirely from the index rather than scanning the map.
+        void OneToManyTableCreateManifestCoveringIndex(SQLite::Connection& connection, std::string_view tableName, std::string_view valueName);
+
         // Checks the consistency of the index to ensure that every referenced row exists.
         // Returns true if index is consistent; false if it is not.
          bool OneToManyTableCheckConsistency(const SQLite::Connection& connection, std::string_view tableName, std::string_view valueName, bool log);
@@ -121,6 +125,13 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             details::OneToManyTablePrepareForPackaging(connection, TableInfo::TableName(), false, false, false);
         }
 
+        // Creates a covering index over the map table keyed by manifest, so that reading the
+        // values of a manifest is answered entirely from the index rather than scanning the map.
+        static void CreateManifestCoveringIndex(SQLite::Connection& connection)
+        {
+            details::OneToManyTableCreateManifestCoveringIndex(connection, TableInfo::TableName(), TableInfo::ValueName());
+        }
+
         // Checks the consistency of the index to ensure that every referenced row exists.
         // Returns true if index is consistent; false if it is not.
         static bool CheckConsistency(const SQLite::Connection& connection, bool log)
@@ -64,7 +64,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
                 selectBuilder.Equals(value);
             }
 
-            SQLite::Statement select = selectBuilder.Prepare(connection);
+            SQLite::CachedStatement select = selectBuilder.PrepareCached(connection);
 
             if (select.Step())
             {
@@ -81,7 +81,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             SQLite::Builder::StatementBuilder selectBuilder;
             selectBuilder.Select(valueName).From(tableName).Where(SQLite::RowIDName).Equals(id);
 
-            SQLite::Statement select = selectBuilder.Prepare(connection);
+            SQLite::CachedStatement select = selectBuilder.PrepareCached(connection);
 
             if (select.Step())
             {
@@ -115,6 +115,17 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
 
         SQLite::rowid_t OneToOneTableEnsureExists(SQLite::Connection& connection, std::string_view tableName, std::string_view valueName, std::string_view value, bool overwriteLikeMatch)
         {
+            // Repeated values are heavily duplicated across manifests; the interned id lets
+            // them skip the table probe entirely. The LIKE match path rewrites row values,
+            // so it bypasses the pool and invalidates it below when it does so.
+            if (!overwriteLikeMatch)
+            {
+                if (auto internedId = connection.GetInternedValueId(tableName, value))
+                {
+                    return internedId.value();
+                }
+            }
+
             auto selectResult = OneToOneTableSelectIdByValue(connection, tableName, valueName, value, overwriteLikeMatch);
             if (selectResult)
             {
@@ -128,8 +139,14 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
                         updateBuilder.Update(tableName).Set().Column(valueName).Equals(value).Where(SQLite::RowIDName).Equals(selectResult);
 
                         updateBuilder.Execute(connection);
+
+                        connection.InvalidateInternedValues(tableName);
                     }
                 }
+                else
+                {
+                    connection.InternValueId(tableName, value, selectResult.value());
+                }
 
                 return selectResult.value();
             }
@@ -137,17 +154,32 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             SQLite::Builder::StatementBuilder insertBuilder;
             insertBuilder.InsertInto(tableName).Columns(valueName).Values(value);
 
-            insertBuilder.Execute(connection);
+            insertBuilder.ExecuteCached(connection);
+
+            // Starting in V1.9, the table may be a view over interned string storage whose
+            // INSTEAD OF trigger restores the last insert rowid when it completes, so the new
+            // row must be located by its value rather than through GetLastInsertRowID.
+            selectResult = OneToOneTableSelectIdByValue(connection, tableName, valueName, value, false);
+            THROW_HR_IF(E_UNEXPECTED, !selectResult);
+
+            SQLite::rowid_t result = selectResult.value();
+
+            if (!overwriteLikeMatch)
+            {
+                connection.InternValueId(tableName, value, result);
+            }
 
-            return connection.GetLastInsertRowID();
+            return result;
         }
 
         void OneToOneTablePrepareForPackaging(SQLite::Connection& connection, std::string_view tableName, bool useNamedIndices, bool preserveValuesIndex)
         {
             if (useNamedIndices && !preserveValuesIndex)
             {
+                // Starting in V1.9, the table may be a view over interned string storage,
+                // in which case this index never existed; tolerate its absence.
                 SQLite::Builder::StatementBuilder dropIndexBuilder;
-                dropIndexBuilder.DropIndex({ tableName, s_OneToOneTable_IndexSuffix });
+                dropIndexBuilder.DropIndexIfExists({ tableName, s_OneToOneTable_IndexSuffix });
                 dropIndexBuilder.Execute(connection);
             }
         }
@@ -175,6 +207,9 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             builder.DeleteFrom(tableName).Where(SQLite::RowIDName).Equals(id);
 
             builder.Execute(connection);
+
+            // Only the id of the removed value is known here, so drop the table's pool.
+            connection.InvalidateInternedValues(tableName);
         }
 
         bool OneToOneTableCheckConsistency(const SQLite::Connection& connection, std::string_view tableName, std::string_view valueName, bool log)
@@ -36,6 +36,48 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             }
         }
 
+        // Attempts to resolve an entire path with a single select, joining the parts table to
+        // itself once per component and anchoring the first component at the relative root.
+        // The generated SQL depends only on the component count, so resolving many paths of
+        // the same depth (the shape of an index update run) reuses one cached statement.
+        // Returns the rowid of the leaf part if the full path exists.
+        std::optional<SQLite::rowid_t> SelectFullPath(const SQLite::Connection& connection, const std::vector<std::string>& parts)
+        {
+            using QCol = SQLite::Builder::QualifiedColumn;
+
+            std::vector<std::string> aliases;
+            for (size_t i = 0; i < parts.size(); ++i)
+            {
+                aliases.emplace_back("p" + std::to_string(i));
+            }
+
+            SQLite::Builder::StatementBuilder builder;
+            builder.Select(QCol(aliases.back(), SQLite::RowIDName)).From(s_PathPartTable_Table_Name).As(aliases[0]);
+
+            for (size_t i = 1; i < parts.size(); ++i)
+            {
+                builder.Join(s_PathPartTable_Table_Name).As(aliases[i]).
+                    On(QCol(aliases[i], s_PathPartTable_ParentValue_Name), QCol(aliases[i - 1], SQLite::RowIDName));
+            }
+
+            builder.Where(QCol(aliases[0], s_PathPartTable_ParentValue_Name)).IsNull();
+            for (size_t i = 0; i < parts.size(); ++i)
+            {
+                builder.And(QCol(aliases[i], s_PathPartTable_PartValue_Name)).Equals(parts[i]);
+            }
+
+            SQLite::CachedStatement select = builder.PrepareCached(connection);
+
+            if (select.Step())
+            {
+                return select.GetColumn<SQLite::rowid_t>(0);
+            }
+            else
+            {
+                return {};
+            }
+        }
+
         // Inserts the given path part into the table, returning the rowid of the inserted row.
         SQLite::rowid_t InsertPathPart(SQLite::Connection& connection, std::optional<SQLite::rowid_t> parent, std::string_view part)
         {
@@ -181,12 +223,37 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             savepoint = std::make_unique<SQLite::Savepoint>(SQLite::Savepoint::Create(connection, "ensurepathexists_v1_0"));
         }
 
+        std::vector<std::string> utf8parts;
+        for (const auto& part : relativePath)
+        {
+            utf8parts.emplace_back(part.u8string());
+        }
+
+        // Probe for the entire path first; it being fully present is by far the common case
+        // during an index update run, and the single probe replaces one query per component.
+        // A miss falls back to the component walk, which finds the longest existing prefix.
+        if (std::optional<SQLite::rowid_t> fullPathLeaf = SelectFullPath(connection, utf8parts))
+        {
+            if (savepoint)
+            {
+                savepoint->Commit();
+            }
+
+            // The path already exists; when asked to create it, no parts were added.
+            return { (createIfNotFound ? false : true), fullPathLeaf.value() };
+        }
+        else if (!createIfNotFound)
+        {
+            // Some part of the path was not found, and we were told not to create.
+            // Return false to indicate that the path does not exist.
+            return {};
+        }
+
         bool partsAdded = false;
 
         std::optional<SQLite::rowid_t> parent;
-        for (const auto& part : relativePath)
+        for (const std::string& utf8part : utf8parts)
         {
-            std::string utf8part = part.u8string();
             std::optional<SQLite::rowid_t> current = SelectPathPart(connection, parent, utf8part);
 
             if (!current)
@@ -279,14 +346,15 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
 
             if (select.Step())
             {
-                std::string partValue = select.GetColumn<std::string>(1);
+                std::string_view partValue = select.GetColumnView(1);
                 if (result.empty())
                 {
                     result = partValue;
                 }
                 else
                 {
-                    result = partValue + '/' + result;
+                    result.insert(0, 1, '/');
+                    result.insert(0, partValue);
                 }
 
                 if (select.GetColumnIsNull(0))
@@ -30,21 +30,16 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         // Removes rows with manifest ids whose sort order is below the highest one.
         void RemoveDuplicateManifestRows();
 
-        // Prepares the table for a filtering pass.
-        void PrepareToFilter();
-
-        // Performs the requested filter type on the requested field.
-        void FilterOnField(const PackageMatchFilter& filter);
-
-        // Completes a filtering pass, removing filtered rows.
-        void CompleteFilter();
+        // Performs a filtering pass, removing rows not found by any of the given filters.
+        // The filters are expected to be the match type variants of a single requested filter.
+        void FilterOnFields(const std::vector<PackageMatchFilter>& filters);
 
         // Gets the results from the table.
         ISQLiteIndex::SearchResult GetSearchResults(size_t limit = 0);
 
     protected:
-        // Builds the search statement for the specified field and match type.
-        std::vector<int> BuildSearchStatement(SQLite::Builder::StatementBuilder& builder, PackageMatchField field, MatchType match) const;
+        // Builds the search statement for the given filter.
+        virtual std::vector<int> BuildSearchStatement(SQLite::Builder::StatementBuilder& builder, const PackageMatchFilter& filter) const;
 
         virtual std::vector<int> BuildSearchStatement(
             SQLite::Builder::StatementBuilder& builder,
@@ -24,7 +24,6 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         constexpr std::string_view s_SearchResultsTable_MatchType = "match"sv;
         constexpr std::string_view s_SearchResultsTable_MatchValue = "value"sv;
         constexpr std::string_view s_SearchResultsTable_SortValue = "sort"sv;
-        constexpr std::string_view s_SearchResultsTable_Filter = "filter"sv;
 
         constexpr std::string_view s_SearchResultsTable_Index_Suffix = "_i_m"sv;
 
@@ -47,7 +46,6 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             builder.Column(ColumnBuilder(s_SearchResultsTable_MatchType, Type::Int).NotNull());
             builder.Column(ColumnBuilder(s_SearchResultsTable_MatchValue, Type::Text).NotNull());
             builder.Column(ColumnBuilder(s_SearchResultsTable_SortValue, Type::Int).NotNull());
-            builder.Column(ColumnBuilder(s_SearchResultsTable_Filter, Type::Bool).NotNull());
 
             builder.EndColumns();
 
@@ -78,7 +76,7 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         // Create an insert statement to select values into the table as requested.
         // The goal is a statement like this:
         //      INSERT INTO <tempTable>
-        //      SELECT valueTable.m, <field>, <match>, valueTable.v, <sort>, <filter> FROM
+        //      SELECT valueTable.m, <field>, <match>, valueTable.v, <sort> FROM
         //      (SELECT manifest.rowid as m, manifest.id as v from manifest join ids on manifest.id = ids.rowid where ids.id = <value>) AS valueTable
         // Where the subselect is built by the owning table.
         StatementBuilder builder;
@@ -88,11 +86,10 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             Value(filter.Type).
             Column(QualifiedColumn(s_SearchResultsTable_SubSelect_TableAlias, s_SearchResultsTable_SubSelect_ValueAlias)).
             Value(sortOrdinal).
-            Value(false).
         From().BeginParenthetical();
 
         // Add the field specific portion
-        std::vector<int> bindIndex = BuildSearchStatement(builder, filter.Field, filter.Type);
+        std::vector<int> bindIndex = BuildSearchStatement(builder, filter);
 
         if (bindIndex.empty())
         {
@@ -131,55 +128,82 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         AICLI_LOG(Repo, Verbose, << "Removed " << m_connection.GetChanges() << " duplicate rows");
     }
 
-    void SearchResultsTable::PrepareToFilter()
+    void SearchResultsTable::FilterOnFields(const std::vector<PackageMatchFilter>& filters)
     {
-        // Reset all filter values to unselected
-        SQLite::Builder::StatementBuilder builder;
-        builder.Update(GetQualifiedName()).Set().Column(s_SearchResultsTable_Filter).Equals(false);
+        using namespace SQLite::Builder;
 
-        builder.Execute(m_connection);
-    }
+        // Determine which of the filters are supported by this version before emitting
+        // anything; a filter on an unsupported field matches nothing, so if none of the
+        // given filters are supported the pass must empty the results.
+        std::vector<const PackageMatchFilter*> supportedFilters;
+        for (const PackageMatchFilter& filter : filters)
+        {
+            StatementBuilder probe;
+            if (BuildSearchStatement(probe, filter).empty())
+            {
+                AICLI_LOG(Repo, Verbose, << "PackageMatchField not supported in this version: " << ToString(filter.Field));
+            }
+            else
+            {
+                supportedFilters.emplace_back(&filter);
+            }
+        }
 
-    void SearchResultsTable::FilterOnField(const PackageMatchFilter& filter)
-    {
-        using namespace SQLite::Builder;
+        if (supportedFilters.empty())
+        {
+            if (filters.empty())
+            {
+                return;
+            }
 
-        // Create an update statement to mark rows that are found by the search.
-        // This will arbitrarily choose one of the rows if multiple have the same lowest sort order.
+            // The requested field is not supported by this version, so nothing can match
+            // it; the filter must remove every row rather than none of them.
+            StatementBuilder deleteAll;
+            deleteAll.DeleteFrom(GetQualifiedName());
+            deleteAll.Execute(m_connection);
+            AICLI_LOG(Repo, Verbose, << "Filter deleted " << m_connection.GetChanges() << " rows");
+            return;
+        }
+
+        // Create a delete statement that keeps only rows found by one of the searches.
+        // The subselects are combined with UNION, which SQLite executes as a merge of
+        // sorted result streams, making the filter a single pass over the table rather
+        // than a flag update, per-filter marking updates, and a sweep delete.
         // The goal is a statement like this:
-        //      UPDATE <temp> set filter = 1 where manifest in (
+        //      DELETE from <temp> where manifest not in (
         //          SELECT m from (
         //              SELECT manifest.rowid as m, manifest.id as v from manifest join ids on manifest.id = ids.rowid where ids.id = <value>
         //          )
+        //          UNION
+        //          SELECT m from (...)
         //      )
         StatementBuilder builder;
-        builder.Update(GetQualifiedName()).Set().Column(s_SearchResultsTable_Filter).Equals(true).Where(s_SearchResultsTable_Manifest).In().BeginParenthetical().
-            Select(s_SearchResultsTable_SubSelect_ManifestAlias).From().BeginParenthetical();
-
-        // Add the field specific portion
-        std::vector<int> bindIndex = BuildSearchStatement(builder, filter.Field, filter.Type);
+        builder.DeleteFrom(GetQualifiedName()).Where(s_SearchResultsTable_Manifest).Not().In().BeginParenthetical();
 
-        if (bindIndex.empty())
+        std::vector<std::vector<int>> bindIndexes;
+        for (size_t i = 0; i < supportedFilters.size(); ++i)
         {
-            AICLI_LOG(Repo, Verbose, << "PackageMatchField not supported in this version: " << ToString(filter.Field));
-            return;
+            if (i != 0)
+            {
+                builder.Union();
+            }
+
+            builder.Select(s_SearchResultsTable_SubSelect_ManifestAlias).From().BeginParenthetical();
+
+            // Add the field specific portion
+            bindIndexes.emplace_back(BuildSearchStatement(builder, *supportedFilters[i]));
+
+            builder.EndParenthetical();
         }
 
-        builder.EndParenthetical().EndParenthetical();
+        builder.EndParenthetical();
 
         SQLite::Statement statement = builder.Prepare(m_connection);
-        BindStatementForMatchType(statement, filter, bindIndex);
+        for (size_t i = 0; i < supportedFilters.size(); ++i)
+        {
+            BindStatementForMatchType(statement, *supportedFilters[i], bindIndexes[i]);
+        }
         statement.Execute();
-        AICLI_LOG(Repo, Verbose, << "Filter kept " << m_connection.GetChanges() << " rows");
-    }
-
-    void SearchResultsTable::CompleteFilter()
-    {
-        // Delete all unselected values
-        SQLite::Builder::StatementBuilder builder;
-        builder.DeleteFrom(GetQualifiedName()).Where(s_SearchResultsTable_Filter).Equals(false);
-
-        builder.Execute(m_connection);
         AICLI_LOG(Repo, Verbose, << "Filter deleted " << m_connection.GetChanges() << " rows");
     }
 
@@ -206,6 +230,13 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
             Join(ManifestTable::TableName()).On(QCol(tempTableAlias, s_SearchResultsTable_Manifest), QCol(ManifestTable::TableName(), SQLite::RowIDName)).
             GroupBy(QCol(ManifestTable::TableName(), IdTable::ValueName())).OrderBy(QCol(tempTableAlias, s_SearchResultsTable_SortValue));
 
+        // Push the limit into the statement so that SQLite stops producing rows once enough
+        // have been found; one extra row is requested to keep the truncation detection below.
+        if (limit)
+        {
+            builder.Limit(limit + 1);
+        }
+
         SQLite::Statement select = builder.Prepare(m_connection);
 
         ISQLiteIndex::SearchResult result;
@@ -216,8 +247,10 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
                 break;
             }
 
-            result.Matches.emplace_back(select.GetColumn<SQLite::rowid_t>(0), 
-                PackageMatchFilter(select.GetColumn<PackageMatchField>(1), select.GetColumn<MatchType>(2), select.GetColumn<std::string>(3)));
+            // The match value view feeds the NormalizedString construction directly,
+            // rather than copying the column into a string that is then renormalized.
+            result.Matches.emplace_back(select.GetColumn<SQLite::rowid_t>(0),
+                PackageMatchFilter(select.GetColumn<PackageMatchField>(1), select.GetColumn<MatchType>(2), Utility::NormalizedString{ select.GetColumnView(3) }));
         }
 
         result.Truncated = (select.GetState() != SQLite::Statement::State::Completed);
@@ -225,9 +258,9 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_0
         return result;
     }
 
-    std::vector<int> SearchResultsTable::BuildSearchStatement(SQLite::Builder::StatementBuilder& builder, PackageMatchField field, MatchType match) const
+    std::vector<int> SearchResultsTable::BuildSearchStatement(SQLite::Builder::StatementBuilder& builder, const PackageMatchFilter& filter) const
     {
-        return BuildSearchStatement(builder, field, s_SearchResultsTable_SubSelect_ManifestAlias, s_SearchResultsTable_SubSelect_ValueAlias, MatchUsesLike(match));
+        return BuildSearchStatement(builder, filter.Field, s_SearchResultsTable_SubSelect_ManifestAlias, s_SearchResultsTable_SubSelect_ValueAlias, MatchUsesLike(filter.Type));
     }
 
     std::vector<int> SearchResultsTable::BuildSearchStatement(
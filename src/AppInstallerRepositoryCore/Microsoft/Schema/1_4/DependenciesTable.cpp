@@ -402,6 +402,71 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_4
         return resultSet;
     }
 
+    ISQLiteIndex::DependencyClosureResult DependenciesTable::GetDependencyClosure(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& manifestRowIds)
+    {
+        ISQLiteIndex::DependencyClosureResult result;
+
+        if (manifestRowIds.empty() || !Exists(connection))
+        {
+            return result;
+        }
+
+        std::string seedList;
+        for (size_t i = 0; i < manifestRowIds.size(); ++i)
+        {
+            seedList += (i == 0 ? "?" : ", ?");
+        }
+
+        // The statement builder has no support for common table expressions, so the query is written out.
+        // The closure is computed over manifests: each step takes the dependency edges of the current
+        // manifests and continues through every manifest of the packages that they depend upon.
+        // UNION (rather than UNION ALL) deduplicates the recursive table, which also terminates
+        // the recursion when the dependency data contains a cycle.
+        // The final select left joins so that closure manifests without dependencies are still reported.
+        std::ostringstream sql;
+        sql <<
+            "WITH RECURSIVE [closure]([m]) AS ("
+            "SELECT [" << SQLite::RowIDName << "] FROM [" << ManifestTable::TableName() << "] WHERE [" << SQLite::RowIDName << "] IN (" << seedList << ") "
+            "UNION "
+            "SELECT [" << ManifestTable::TableName() << "].[" << SQLite::RowIDName << "] FROM [closure] "
+            "JOIN [" << s_DependenciesTable_Table_Name << "] ON [" << s_DependenciesTable_Table_Name << "].[" << s_DependenciesTable_Manifest_Column_Name << "] = [closure].[m] "
+            "JOIN [" << ManifestTable::TableName() << "] ON [" << ManifestTable::TableName() << "].[" << IdTable::ValueName() << "] = [" << s_DependenciesTable_Table_Name << "].[" << s_DependenciesTable_PackageId_Column_Name << "]"
+            ") "
+            "SELECT [closure].[m], [dep].[" << s_DependenciesTable_PackageId_Column_Name << "], [pId].[" << IdTable::ValueName() << "], [minV].[" << VersionTable::ValueName() << "] "
+            "FROM [closure] "
+            "LEFT OUTER JOIN [" << s_DependenciesTable_Table_Name << "] AS [dep] ON [dep].[" << s_DependenciesTable_Manifest_Column_Name << "] = [closure].[m] "
+            "LEFT OUTER JOIN [" << IdTable::TableName() << "] AS [pId] ON [pId].[" << SQLite::RowIDName << "] = [dep].[" << s_DependenciesTable_PackageId_Column_Name << "] "
+            "LEFT OUTER JOIN [" << VersionTable::TableName() << "] AS [minV] ON [minV].[" << SQLite::RowIDName << "] = [dep].[" << s_DependenciesTable_MinVersion_Column_Name << "]";
+
+        SQLite::Statement select = SQLite::Statement::Create(connection, sql.str());
+
+        for (size_t i = 0; i < manifestRowIds.size(); ++i)
+        {
+            select.Bind(static_cast<int>(i + 1), manifestRowIds[i]);
+        }
+
+        while (select.Step())
+        {
+            auto& edges = result[select.GetColumn<SQLite::rowid_t>(0)];
+
+            // A null package id means that the closure manifest has no dependencies.
+            if (!select.GetColumnIsNull(1))
+            {
+                ISQLiteIndex::DependencyEdge edge;
+                edge.PackageRowId = select.GetColumn<SQLite::rowid_t>(1);
+                edge.PackageId = select.GetColumn<std::string>(2);
+                if (!select.GetColumnIsNull(3))
+                {
+                    edge.MinVersion = select.GetColumn<std::string>(3);
+                }
+
+                edges.emplace_back(std::move(edge));
+            }
+        }
+
+        return result;
+    }
+
     void DependenciesTable::PrepareForPackaging(SQLite::Connection& connection)
     {
         SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "prepareForPacking_V1_4");
@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "SQLiteWrapper.h"
 #include "SQLiteStatementBuilder.h"
+#include "Microsoft/Schema/ISQLiteIndex.h"
 #include <winget/Manifest.h>
 
 namespace AppInstaller::Repository::Microsoft::Schema::V1_4
@@ -40,6 +41,9 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_4
         // Get dependencies by package id.
         static std::vector<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependentsById(const SQLite::Connection& connection, AppInstaller::Manifest::string_t packageId);
 
+        // Get the transitive dependency closure of the given manifests with a single recursive query.
+        static ISQLiteIndex::DependencyClosureResult GetDependencyClosure(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& manifestRowIds);
+
         // Check dependencies table consistency.
         static bool CheckConsistency(const SQLite::Connection& connection, bool log);
 
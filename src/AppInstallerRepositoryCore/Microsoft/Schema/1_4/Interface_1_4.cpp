@@ -134,6 +134,11 @@ namespace AppInstaller::Repository::Microsoft::Schema::V1_4
         return DependenciesTable::GetDependentsById(connection, packageId);
     }
 
+    ISQLiteIndex::DependencyClosureResult Interface::GetDependencyClosureByManifestRowIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& manifestRowIds) const
+    {
+        return DependenciesTable::GetDependencyClosure(connection, manifestRowIds);
+    }
+
     bool Interface::ValidateDependenciesWithMinVersions(const SQLite::Connection& connection, bool log) const
     {
         try
@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include "Microsoft/Schema/ISQLiteIndex.h"
+#include "Microsoft/Schema/1_6/Interface.h"
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_7
+{
+    // Interface to this schema version exposed through ISQLiteIndex.
+    struct Interface : public V1_6::Interface
+    {
+        Interface(Utility::NormalizationVersion normVersion = Utility::NormalizationVersion::Initial);
+
+        // Version 1.0
+        Schema::Version GetVersion() const override;
+        void CreateTables(SQLite::Connection& connection, CreateOptions options) override;
+        SQLite::rowid_t AddManifest(SQLite::Connection& connection, const Manifest::Manifest& manifest, const std::optional<std::filesystem::path>& relativePath) override;
+        std::pair<bool, SQLite::rowid_t> UpdateManifest(SQLite::Connection& connection, const Manifest::Manifest& manifest, const std::optional<std::filesystem::path>& relativePath) override;
+        void RemoveManifestById(SQLite::Connection& connection, SQLite::rowid_t manifestId) override;
+        bool CheckConsistency(const SQLite::Connection& connection, bool log) const override;
+
+    protected:
+        std::unique_ptr<V1_0::SearchResultsTable> CreateSearchResultsTable(const SQLite::Connection& connection) const override;
+        void PrepareForPackaging(SQLite::Connection& connection, bool vacuum) override;
+    };
+}
@@ -0,0 +1,187 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Microsoft/Schema/1_7/Interface.h"
+#include "Microsoft/Schema/1_7/SearchResultsTable.h"
+#include "Microsoft/Schema/1_7/SearchTrigramsTable.h"
+#include "Microsoft/Schema/1_0/IdTable.h"
+#include "Microsoft/Schema/1_0/NameTable.h"
+#include "Microsoft/Schema/1_0/MonikerTable.h"
+#include "Microsoft/Schema/1_0/TagsTable.h"
+#include "SQLiteStatementBuilder.h"
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_7
+{
+    namespace
+    {
+        // Gets the rowid of the given value in the table, if present.
+        std::optional<SQLite::rowid_t> SelectValueRowId(const SQLite::Connection& connection, std::string_view valueTable, std::string_view valueColumn, std::string_view value)
+        {
+            SQLite::Builder::StatementBuilder builder;
+            builder.Select(SQLite::RowIDName).From(valueTable).Where(valueColumn).Equals(value);
+
+            SQLite::Statement statement = builder.Prepare(connection);
+
+            if (statement.Step())
+            {
+                return statement.GetColumn<SQLite::rowid_t>(0);
+            }
+
+            return {};
+        }
+
+        // Indexes the trigrams of the searchable text values referenced by the manifest.
+        // The values themselves were inserted by the chained schema versions; adding the
+        // trigrams for values that already have them is a no-op.
+        void AddTrigramsForManifest(SQLite::Connection& connection, const Manifest::Manifest& manifest)
+        {
+            if (auto idRowId = V1_0::IdTable::SelectIdByValue(connection, manifest.Id, true))
+            {
+                SearchTrigramsTable::EnsureTrigramsExist(connection, PackageMatchField::Id, idRowId.value(), manifest.Id);
+            }
+
+            std::string packageName = manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>();
+            if (auto nameRowId = V1_0::NameTable::SelectIdByValue(connection, packageName))
+            {
+                SearchTrigramsTable::EnsureTrigramsExist(connection, PackageMatchField::Name, nameRowId.value(), packageName);
+            }
+
+            if (auto monikerRowId = V1_0::MonikerTable::SelectIdByValue(connection, manifest.Moniker))
+            {
+                SearchTrigramsTable::EnsureTrigramsExist(connection, PackageMatchField::Moniker, monikerRowId.value(), manifest.Moniker);
+            }
+
+            for (const auto& tag : manifest.GetAggregatedTags())
+            {
+                if (auto tagRowId = SelectValueRowId(connection, V1_0::TagsTable::TableName(), V1_0::TagsTable::ValueName(), tag))
+                {
+                    SearchTrigramsTable::EnsureTrigramsExist(connection, PackageMatchField::Tag, tagRowId.value(), tag);
+                }
+            }
+        }
+
+        // Removes the trigram rows whose value rows no longer exist.
+        void RemoveUnreferencedTrigrams(SQLite::Connection& connection)
+        {
+            SearchTrigramsTable::RemoveUnreferenced(connection, PackageMatchField::Id, V1_0::IdTable::TableName());
+            SearchTrigramsTable::RemoveUnreferenced(connection, PackageMatchField::Name, V1_0::NameTable::TableName());
+            SearchTrigramsTable::RemoveUnreferenced(connection, PackageMatchField::Moniker, V1_0::MonikerTable::TableName());
+            SearchTrigramsTable::RemoveUnreferenced(connection, PackageMatchField::Tag, V1_0::TagsTable::TableName());
+        }
+    }
+
+    Interface::Interface(Utility::NormalizationVersion normVersion) : V1_6::Interface(normVersion)
+    {
+    }
+
+    Schema::Version Interface::GetVersion() const
+    {
+        return { 1, 7 };
+    }
+
+    void Interface::CreateTables(SQLite::Connection& connection, CreateOptions options)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "createtables_v1_7");
+
+        V1_6::Interface::CreateTables(connection, options);
+
+        SearchTrigramsTable::Create(connection);
+
+        savepoint.Commit();
+    }
+
+    SQLite::rowid_t Interface::AddManifest(SQLite::Connection& connection, const Manifest::Manifest& manifest, const std::optional<std::filesystem::path>& relativePath)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "addmanifest_v1_7");
+
+        SQLite::rowid_t manifestId = V1_6::Interface::AddManifest(connection, manifest, relativePath);
+
+        // Add the new 1.7 data
+        AddTrigramsForManifest(connection, manifest);
+
+        savepoint.Commit();
+
+        return manifestId;
+    }
+
+    std::pair<bool, SQLite::rowid_t> Interface::UpdateManifest(SQLite::Connection& connection, const Manifest::Manifest& manifest, const std::optional<std::filesystem::path>& relativePath)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "updatemanifest_v1_7");
+
+        auto [indexModified, manifestId] = V1_6::Interface::UpdateManifest(connection, manifest, relativePath);
+
+        if (indexModified)
+        {
+            // Index any values newly referenced by the manifest; trigram rows for values that
+            // the update orphaned only cost space and are swept by RemoveManifestById and
+            // PrepareForPackaging, as a stale row can never produce an incorrect match.
+            AddTrigramsForManifest(connection, manifest);
+        }
+
+        savepoint.Commit();
+
+        return { indexModified, manifestId };
+    }
+
+    void Interface::RemoveManifestById(SQLite::Connection& connection, SQLite::rowid_t manifestId)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "RemoveManifestById_v1_7");
+
+        // Removes the manifest.
+        V1_6::Interface::RemoveManifestById(connection, manifestId);
+
+        // Remove trigrams for any values that are no longer present.
+        RemoveUnreferencedTrigrams(connection);
+
+        savepoint.Commit();
+    }
+
+    bool Interface::CheckConsistency(const SQLite::Connection& connection, bool log) const
+    {
+        bool result = V1_6::Interface::CheckConsistency(connection, log);
+
+        // If the v1.6 index was consistent, or if full logging of inconsistency was requested, check the v1.7 data.
+        if (result || log)
+        {
+            result = SearchTrigramsTable::CheckConsistency(connection, PackageMatchField::Id, V1_0::IdTable::TableName(), log) && result;
+        }
+
+        if (result || log)
+        {
+            result = SearchTrigramsTable::CheckConsistency(connection, PackageMatchField::Name, V1_0::NameTable::TableName(), log) && result;
+        }
+
+        if (result || log)
+        {
+            result = SearchTrigramsTable::CheckConsistency(connection, PackageMatchField::Moniker, V1_0::MonikerTable::TableName(), log) && result;
+        }
+
+        if (result || log)
+        {
+            result = SearchTrigramsTable::CheckConsistency(connection, PackageMatchField::Tag, V1_0::TagsTable::TableName(), log) && result;
+        }
+
+        return result;
+    }
+
+    std::unique_ptr<V1_0::SearchResultsTable> Interface::CreateSearchResultsTable(const SQLite::Connection& connection) const
+    {
+        return std::make_unique<V1_7::SearchResultsTable>(connection);
+    }
+
+    void Interface::PrepareForPackaging(SQLite::Connection& connection, bool vacuum)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "prepareforpackaging_v1_7");
+
+        V1_6::Interface::PrepareForPackaging(connection, false);
+
+        RemoveUnreferencedTrigrams(connection);
+
+        savepoint.Commit();
+
+        if (vacuum)
+        {
+            Vacuum(connection);
+        }
+    }
+}
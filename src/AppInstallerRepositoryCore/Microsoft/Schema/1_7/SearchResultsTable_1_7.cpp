@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "SearchResultsTable.h"
+
+#include "Microsoft/Schema/1_0/IdTable.h"
+#include "Microsoft/Schema/1_0/NameTable.h"
+#include "Microsoft/Schema/1_0/MonikerTable.h"
+#include "Microsoft/Schema/1_0/TagsTable.h"
+#include "Microsoft/Schema/1_7/SearchTrigramsTable.h"
+
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_7
+{
+    namespace
+    {
+        // Gets the table holding the values for the field, if the field is covered by the trigram index.
+        std::string_view GetTrigramValueTableName(PackageMatchField field)
+        {
+            switch (field)
+            {
+            case PackageMatchField::Id:
+                return V1_0::IdTable::TableName();
+            case PackageMatchField::Name:
+                return V1_0::NameTable::TableName();
+            case PackageMatchField::Moniker:
+                return V1_0::MonikerTable::TableName();
+            case PackageMatchField::Tag:
+                return V1_0::TagsTable::TableName();
+            default:
+                return {};
+            }
+        }
+
+        // Determines whether the filter can be narrowed with trigram index probes.
+        // The probes only ever reduce the rows that the LIKE predicate inspects; the
+        // final match decision is unchanged from previous schema versions.
+        bool UsesTrigramProbe(const PackageMatchFilter& filter)
+        {
+            return (filter.Type == MatchType::Substring || filter.Type == MatchType::CaseInsensitive) &&
+                !GetTrigramValueTableName(filter.Field).empty();
+        }
+    }
+
+    std::vector<int> SearchResultsTable::BuildSearchStatement(SQLite::Builder::StatementBuilder& builder, const PackageMatchFilter& filter) const
+    {
+        std::vector<int> result = V1_6::SearchResultsTable::BuildSearchStatement(builder, filter);
+
+        if (result.empty() || !UsesTrigramProbe(filter))
+        {
+            return result;
+        }
+
+        std::vector<std::string> probes = SearchTrigramsTable::GetProbeTrigrams(filter.Value);
+
+        // Narrow the rows to those whose value contains every probe trigram before the LIKE runs.
+        using QCol = SQLite::Builder::QualifiedColumn;
+        std::string_view valueTable = GetTrigramValueTableName(filter.Field);
+
+        for (size_t i = 0; i < probes.size(); ++i)
+        {
+            builder.And(QCol(valueTable, SQLite::RowIDName)).In().BeginParenthetical().
+                Select(SearchTrigramsTable::ValueName()).From(SearchTrigramsTable::TableName()).
+                Where(SearchTrigramsTable::FieldName()).Equals(filter.Field).
+                And(SearchTrigramsTable::TrigramName()).Equals(SQLite::Builder::Unbound).
+            EndParenthetical();
+            result.push_back(builder.GetLastBindIndex());
+        }
+
+        return result;
+    }
+
+    void SearchResultsTable::BindStatementForMatchType(SQLite::Statement& statement, const PackageMatchFilter& filter, const std::vector<int>& bindIndex)
+    {
+        V1_6::SearchResultsTable::BindStatementForMatchType(statement, filter, bindIndex);
+
+        if (UsesTrigramProbe(filter) && bindIndex.size() > 1)
+        {
+            std::vector<std::string> probes = SearchTrigramsTable::GetProbeTrigrams(filter.Value);
+            THROW_HR_IF(E_UNEXPECTED, probes.size() + 1 != bindIndex.size());
+
+            for (size_t i = 0; i < probes.size(); ++i)
+            {
+                statement.Bind(bindIndex[i + 1], probes[i]);
+            }
+        }
+    }
+}
@@ -0,0 +1,200 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "SearchTrigramsTable.h"
+#include "SQLiteStatementBuilder.h"
+
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_7
+{
+    using namespace SQLite;
+
+    static constexpr std::string_view s_SearchTrigramsTable_Table_Name = "trigrams"sv;
+    static constexpr std::string_view s_SearchTrigramsTable_PrimaryKeyIndex_Name = "trigrams_pk"sv;
+    static constexpr std::string_view s_SearchTrigramsTable_ValueIndex_Name = "trigrams_i_v"sv;
+    static constexpr std::string_view s_SearchTrigramsTable_Trigram_Column = "trigram"sv;
+    static constexpr std::string_view s_SearchTrigramsTable_Field_Column = "field"sv;
+    static constexpr std::string_view s_SearchTrigramsTable_Value_Column = "value"sv;
+
+    namespace
+    {
+        // The trigrams are formed over the case folded UTF-8 bytes; both indexing and probing
+        // use the same split so multi-byte sequences remain consistent between the two.
+        constexpr size_t s_SearchTrigramsTable_TrigramSize = 3;
+
+        // The number of index probes a single search will make; more probes narrow the
+        // candidate set further but each one costs an index lookup.
+        constexpr size_t s_SearchTrigramsTable_MaximumProbes = 3;
+    }
+
+    std::string_view SearchTrigramsTable::TableName()
+    {
+        return s_SearchTrigramsTable_Table_Name;
+    }
+
+    std::string_view SearchTrigramsTable::TrigramName()
+    {
+        return s_SearchTrigramsTable_Trigram_Column;
+    }
+
+    std::string_view SearchTrigramsTable::FieldName()
+    {
+        return s_SearchTrigramsTable_Field_Column;
+    }
+
+    std::string_view SearchTrigramsTable::ValueName()
+    {
+        return s_SearchTrigramsTable_Value_Column;
+    }
+
+    void SearchTrigramsTable::Create(SQLite::Connection& connection)
+    {
+        using namespace Builder;
+
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "createtrigrams_v1_7");
+
+        StatementBuilder createTableBuilder;
+        createTableBuilder.CreateTable(s_SearchTrigramsTable_Table_Name).Columns({
+            ColumnBuilder(s_SearchTrigramsTable_Trigram_Column, Type::Text).NotNull(),
+            ColumnBuilder(s_SearchTrigramsTable_Field_Column, Type::Int64).NotNull(),
+            ColumnBuilder(s_SearchTrigramsTable_Value_Column, Type::Int64).NotNull()
+            });
+
+        createTableBuilder.Execute(connection);
+
+        // Serves the search probes; unique to also act as the primary key.
+        StatementBuilder createPKIndexBuilder;
+        createPKIndexBuilder.CreateUniqueIndex(s_SearchTrigramsTable_PrimaryKeyIndex_Name).On(s_SearchTrigramsTable_Table_Name).
+            Columns({ s_SearchTrigramsTable_Field_Column, s_SearchTrigramsTable_Trigram_Column, s_SearchTrigramsTable_Value_Column });
+        createPKIndexBuilder.Execute(connection);
+
+        // Serves the presence check when indexing and the cleanup of removed values.
+        StatementBuilder createValueIndexBuilder;
+        createValueIndexBuilder.CreateIndex(s_SearchTrigramsTable_ValueIndex_Name).On(s_SearchTrigramsTable_Table_Name).
+            Columns({ s_SearchTrigramsTable_Field_Column, s_SearchTrigramsTable_Value_Column });
+        createValueIndexBuilder.Execute(connection);
+
+        savepoint.Commit();
+    }
+
+    std::vector<std::string> SearchTrigramsTable::GetTrigrams(std::string_view text)
+    {
+        std::vector<std::string> result;
+
+        std::string folded = Utility::FoldCase(text);
+        if (folded.size() < s_SearchTrigramsTable_TrigramSize)
+        {
+            return result;
+        }
+
+        for (size_t i = 0; i + s_SearchTrigramsTable_TrigramSize <= folded.size(); ++i)
+        {
+            std::string trigram = folded.substr(i, s_SearchTrigramsTable_TrigramSize);
+            if (std::find(result.begin(), result.end(), trigram) == result.end())
+            {
+                result.emplace_back(std::move(trigram));
+            }
+        }
+
+        return result;
+    }
+
+    std::vector<std::string> SearchTrigramsTable::GetProbeTrigrams(std::string_view value)
+    {
+        std::vector<std::string> trigrams = GetTrigrams(value);
+
+        if (trigrams.size() <= s_SearchTrigramsTable_MaximumProbes)
+        {
+            return trigrams;
+        }
+
+        // Take trigrams spread across the value; being distinct, any subset keeps the
+        // probe sound while bounding the number of lookups for long search strings.
+        return { trigrams.front(), trigrams[trigrams.size() / 2], trigrams.back() };
+    }
+
+    void SearchTrigramsTable::EnsureTrigramsExist(SQLite::Connection& connection, PackageMatchField field, SQLite::rowid_t value, std::string_view text)
+    {
+        using namespace Builder;
+
+        std::vector<std::string> trigrams = GetTrigrams(text);
+        if (trigrams.empty())
+        {
+            return;
+        }
+
+        // The value rows are immutable once created, so the presence of any trigram row
+        // for the value means that all of them are already present.
+        StatementBuilder selectBuilder;
+        selectBuilder.Select(RowCount).From(s_SearchTrigramsTable_Table_Name).
+            Where(s_SearchTrigramsTable_Field_Column).Equals(field).And(s_SearchTrigramsTable_Value_Column).Equals(value);
+
+        Statement select = selectBuilder.Prepare(connection);
+        THROW_HR_IF(E_UNEXPECTED, !select.Step());
+        if (select.GetColumn<int64_t>(0) != 0)
+        {
+            return;
+        }
+
+        for (const std::string& trigram : trigrams)
+        {
+            StatementBuilder insertBuilder;
+            insertBuilder.InsertInto(s_SearchTrigramsTable_Table_Name).
+                Columns({ s_SearchTrigramsTable_Trigram_Column, s_SearchTrigramsTable_Field_Column, s_SearchTrigramsTable_Value_Column }).
+                Values(trigram, field, value);
+
+            insertBuilder.Execute(connection);
+        }
+    }
+
+    void SearchTrigramsTable::RemoveUnreferenced(SQLite::Connection& connection, PackageMatchField field, std::string_view valueTable)
+    {
+        using namespace Builder;
+
+        StatementBuilder builder;
+        builder.DeleteFrom(s_SearchTrigramsTable_Table_Name).
+            Where(s_SearchTrigramsTable_Field_Column).Equals(field).
+            And(s_SearchTrigramsTable_Value_Column).Not().In().BeginParenthetical().
+                Select(SQLite::RowIDName).From(valueTable).
+            EndParenthetical();
+
+        builder.Execute(connection);
+        AICLI_LOG(Repo, Verbose, << "Removed " << connection.GetChanges() << " unreferenced trigram rows for " << valueTable);
+    }
+
+    bool SearchTrigramsTable::CheckConsistency(const SQLite::Connection& connection, PackageMatchField field, std::string_view valueTable, bool log)
+    {
+        using QCol = Builder::QualifiedColumn;
+        constexpr std::string_view s_trigrams = "t"sv;
+
+        // Build a select statement to find trigram rows containing references to value rows with nonexistent rowids
+        // Such as:
+        // Select t.rowid, t.value from trigrams as t left outer join tags on t.value = tags.rowid where tags.rowid is null and t.field = <field>
+        Builder::StatementBuilder builder;
+        builder.
+            Select({ QCol(s_trigrams, SQLite::RowIDName), QCol(s_trigrams, s_SearchTrigramsTable_Value_Column) }).
+            From(s_SearchTrigramsTable_Table_Name).As(s_trigrams).
+            LeftOuterJoin(valueTable).On(QCol(s_trigrams, s_SearchTrigramsTable_Value_Column), QCol(valueTable, SQLite::RowIDName)).
+            Where(QCol(valueTable, SQLite::RowIDName)).IsNull().
+            And(QCol(s_trigrams, s_SearchTrigramsTable_Field_Column)).Equals(field);
+
+        SQLite::Statement select = builder.Prepare(connection);
+
+        bool result = true;
+
+        while (select.Step())
+        {
+            result = false;
+
+            if (!log)
+            {
+                break;
+            }
+
+            AICLI_LOG(Repo, Info, << "  [INVALID] " << s_SearchTrigramsTable_Table_Name << " [" << select.GetColumn<SQLite::rowid_t>(0) <<
+                "] refers to " << valueTable << " [" << select.GetColumn<SQLite::rowid_t>(1) << "]");
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include "SQLiteWrapper.h"
+#include "Public/winget/RepositorySearch.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_7
+{
+    // An inverted index of case folded character trigrams over the searchable text values.
+    // Substring searches probe this index to reduce the candidate rows before the existing
+    // LIKE predicate runs, rather than scanning the entire value table.
+    struct SearchTrigramsTable
+    {
+        // Get the table name.
+        static std::string_view TableName();
+
+        // Get the trigram column name.
+        static std::string_view TrigramName();
+
+        // Get the field column name.
+        static std::string_view FieldName();
+
+        // Get the value column name.
+        static std::string_view ValueName();
+
+        // Creates the table and its indices.
+        static void Create(SQLite::Connection& connection);
+
+        // Gets the distinct trigrams of the case folded text.
+        // The result is empty when the folded text is too short to be indexed.
+        static std::vector<std::string> GetTrigrams(std::string_view text);
+
+        // Gets the trigrams to probe the index with for the given search value.
+        // A bounded subset of GetTrigrams; every probe must be present for a row to be a candidate.
+        static std::vector<std::string> GetProbeTrigrams(std::string_view value);
+
+        // Adds the trigrams of the text for the given value row of the field, if not already present.
+        static void EnsureTrigramsExist(SQLite::Connection& connection, PackageMatchField field, SQLite::rowid_t value, std::string_view text);
+
+        // Removes trigram rows for the field whose value row no longer exists in the given table.
+        static void RemoveUnreferenced(SQLite::Connection& connection, PackageMatchField field, std::string_view valueTable);
+
+        // Checks that every trigram row for the field references an existing row in the given table.
+        // Returns true if consistent; false if it is not.
+        static bool CheckConsistency(const SQLite::Connection& connection, PackageMatchField field, std::string_view valueTable, bool log);
+    };
+}
@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ChangeJournalTable.h"
+#include "SQLiteStatementBuilder.h"
+
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_8
+{
+    using namespace SQLite;
+
+    static constexpr std::string_view s_ChangeJournalTable_Table_Name = "changejournal"sv;
+    static constexpr std::string_view s_ChangeJournalTable_Change_Column = "change"sv;
+    static constexpr std::string_view s_ChangeJournalTable_Id_Column = "id"sv;
+    static constexpr std::string_view s_ChangeJournalTable_Version_Column = "version"sv;
+    static constexpr std::string_view s_ChangeJournalTable_Channel_Column = "channel"sv;
+
+    // The rowid is the sequence number; reads key off of it directly.
+    static constexpr std::string_view s_ChangeJournalTableStmt_GetChangesSince =
+        "select [rowid], [change], [id], [version], [channel] from [changejournal] where [rowid] > ? order by [rowid]"sv;
+
+    std::string_view ChangeJournalTable::TableName()
+    {
+        return s_ChangeJournalTable_Table_Name;
+    }
+
+    void ChangeJournalTable::Create(SQLite::Connection& connection)
+    {
+        using namespace Builder;
+
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "createchangejournal_v1_8");
+
+        // AUTOINCREMENT prevents rowids from ever being reused, even after journal rows are
+        // deleted; consumers depend on the sequence numbers being strictly increasing.
+        StatementBuilder createTableBuilder;
+        createTableBuilder.CreateTable(s_ChangeJournalTable_Table_Name).Columns({
+            IntegerPrimaryKey().AutoIncrement(),
+            ColumnBuilder(s_ChangeJournalTable_Change_Column, Type::Int64).NotNull(),
+            ColumnBuilder(s_ChangeJournalTable_Id_Column, Type::Text).NotNull(),
+            ColumnBuilder(s_ChangeJournalTable_Version_Column, Type::Text).NotNull(),
+            ColumnBuilder(s_ChangeJournalTable_Channel_Column, Type::Text).NotNull()
+            });
+
+        createTableBuilder.Execute(connection);
+
+        savepoint.Commit();
+    }
+
+    void ChangeJournalTable::RecordChange(SQLite::Connection& connection, ISQLiteIndex::ChangeType change, std::string_view id, std::string_view version, std::string_view channel)
+    {
+        using namespace Builder;
+
+        StatementBuilder builder;
+        builder.InsertInto(s_ChangeJournalTable_Table_Name).
+            Columns({ s_ChangeJournalTable_Change_Column, s_ChangeJournalTable_Id_Column, s_ChangeJournalTable_Version_Column, s_ChangeJournalTable_Channel_Column }).
+            Values(change, id, version, channel);
+
+        builder.Execute(connection);
+    }
+
+    std::vector<ISQLiteIndex::ChangeJournalEntry> ChangeJournalTable::GetChangesSince(const SQLite::Connection& connection, SQLite::rowid_t sequence)
+    {
+        SQLite::Statement select = SQLite::Statement::Create(connection, s_ChangeJournalTableStmt_GetChangesSince);
+        select.Bind(1, sequence);
+
+        std::vector<ISQLiteIndex::ChangeJournalEntry> result;
+
+        while (select.Step())
+        {
+            ISQLiteIndex::ChangeJournalEntry entry;
+            entry.Sequence = select.GetColumn<SQLite::rowid_t>(0);
+            entry.Change = static_cast<ISQLiteIndex::ChangeType>(select.GetColumn<int64_t>(1));
+            entry.Id = select.GetColumn<std::string>(2);
+            entry.Version = select.GetColumn<std::string>(3);
+            entry.Channel = select.GetColumn<std::string>(4);
+            result.emplace_back(std::move(entry));
+        }
+
+        return result;
+    }
+}
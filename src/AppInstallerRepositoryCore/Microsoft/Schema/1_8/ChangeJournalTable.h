@@ -0,0 +1,32 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include "SQLiteWrapper.h"
+#include "Microsoft/Schema/ISQLiteIndex.h"
+
+#include <string_view>
+#include <vector>
+
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_8
+{
+    // An append only journal of the manifest level changes made to the index.
+    // Each row records the change type and the { Id, Version, Channel } key of the affected
+    // manifest by value, so entries remain usable after the manifest rows themselves are gone.
+    // Sequence numbers are strictly increasing and never reused, enabling rebuild tooling
+    // and delta sync consumers to apply only the entries after the last one they have seen.
+    struct ChangeJournalTable
+    {
+        // Get the table name.
+        static std::string_view TableName();
+
+        // Creates the table.
+        static void Create(SQLite::Connection& connection);
+
+        // Appends an entry recording the given change.
+        static void RecordChange(SQLite::Connection& connection, ISQLiteIndex::ChangeType change, std::string_view id, std::string_view version, std::string_view channel);
+
+        // Gets the entries recorded after the given sequence number, in increasing sequence order.
+        static std::vector<ISQLiteIndex::ChangeJournalEntry> GetChangesSince(const SQLite::Connection& connection, SQLite::rowid_t sequence);
+    };
+}
@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include "Microsoft/Schema/ISQLiteIndex.h"
+#include "Microsoft/Schema/1_7/Interface.h"
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_8
+{
+    // Interface to this schema version exposed through ISQLiteIndex.
+    struct Interface : public V1_7::Interface
+    {
+        Interface(Utility::NormalizationVersion normVersion = Utility::NormalizationVersion::Initial);
+
+        // Version 1.0
+        Schema::Version GetVersion() const override;
+        void CreateTables(SQLite::Connection& connection, CreateOptions options) override;
+        SQLite::rowid_t AddManifest(SQLite::Connection& connection, const Manifest::Manifest& manifest, const std::optional<std::filesystem::path>& relativePath) override;
+        std::pair<bool, SQLite::rowid_t> UpdateManifest(SQLite::Connection& connection, const Manifest::Manifest& manifest, const std::optional<std::filesystem::path>& relativePath) override;
+        void RemoveManifestById(SQLite::Connection& connection, SQLite::rowid_t manifestId) override;
+        std::optional<SQLite::rowid_t> GetManifestIdByKey(const SQLite::Connection& connection, SQLite::rowid_t id, std::string_view version, std::string_view channel) const override;
+
+        // Version 1.1
+        void PrepareForPackaging(SQLite::Connection& connection, bool vacuum) override;
+
+        // Version 1.8
+        std::vector<ChangeJournalEntry> GetChangesSince(const SQLite::Connection& connection, SQLite::rowid_t sequence) const override;
+    };
+}
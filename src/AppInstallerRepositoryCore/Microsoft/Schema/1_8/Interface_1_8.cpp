@@ -0,0 +1,200 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Microsoft/Schema/1_8/Interface.h"
+#include "Microsoft/Schema/1_8/ChangeJournalTable.h"
+#include "Microsoft/Schema/1_8/LatestVersionTable.h"
+#include "Microsoft/Schema/1_0/IdTable.h"
+#include "Microsoft/Schema/1_0/VersionTable.h"
+#include "Microsoft/Schema/1_0/ChannelTable.h"
+#include "Microsoft/Schema/1_0/ManifestTable.h"
+#include "Microsoft/Schema/1_0/TagsTable.h"
+#include "Microsoft/Schema/1_0/CommandsTable.h"
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_8
+{
+    namespace
+    {
+        // Recomputes the latest version pointer for the given id and channel from the
+        // manifests that remain, removing the pointer when the last version is gone.
+        void RecomputeLatestVersion(SQLite::Connection& connection, SQLite::rowid_t idRowId, SQLite::rowid_t channelRowId)
+        {
+            std::vector<std::string> versionStrings =
+                V1_0::ManifestTable::GetAllValuesByIds<V1_0::VersionTable, V1_0::IdTable, V1_0::ChannelTable>(connection, { idRowId, channelRowId });
+
+            if (versionStrings.empty())
+            {
+                LatestVersionTable::DeleteByIds(connection, idRowId, channelRowId);
+                return;
+            }
+
+            std::vector<Utility::Version> versions;
+            for (std::string& v : versionStrings)
+            {
+                versions.emplace_back(std::move(v));
+            }
+
+            std::sort(versions.begin(), versions.end());
+
+            std::optional<SQLite::rowid_t> versionRowId = V1_0::VersionTable::SelectIdByValue(connection, versions.back().ToString());
+            if (!versionRowId)
+            {
+                AICLI_LOG(Repo, Warning, << "Did not find a Version row for the latest version { " << versions.back().ToString() << " }");
+                LatestVersionTable::DeleteByIds(connection, idRowId, channelRowId);
+                return;
+            }
+
+            std::optional<SQLite::rowid_t> manifestRowId =
+                V1_0::ManifestTable::SelectByValueIds<V1_0::IdTable, V1_0::VersionTable, V1_0::ChannelTable>(connection, { idRowId, versionRowId.value(), channelRowId });
+            if (manifestRowId)
+            {
+                LatestVersionTable::SetLatestManifestId(connection, idRowId, channelRowId, manifestRowId.value());
+            }
+        }
+    }
+
+    Interface::Interface(Utility::NormalizationVersion normVersion) : V1_7::Interface(normVersion)
+    {
+    }
+
+    Schema::Version Interface::GetVersion() const
+    {
+        return { 1, 8 };
+    }
+
+    void Interface::CreateTables(SQLite::Connection& connection, CreateOptions options)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "createtables_v1_8");
+
+        V1_7::Interface::CreateTables(connection, options);
+
+        ChangeJournalTable::Create(connection);
+
+        LatestVersionTable::Create(connection);
+
+        savepoint.Commit();
+    }
+
+    SQLite::rowid_t Interface::AddManifest(SQLite::Connection& connection, const Manifest::Manifest& manifest, const std::optional<std::filesystem::path>& relativePath)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "addmanifest_v1_8");
+
+        SQLite::rowid_t manifestId = V1_7::Interface::AddManifest(connection, manifest, relativePath);
+
+        ChangeJournalTable::RecordChange(connection, ChangeType::Add, manifest.Id, manifest.Version, manifest.Channel);
+
+        // Advance the latest version pointer if the new manifest outranks the current one.
+        auto [idRowId, channelRowId] = V1_0::ManifestTable::GetIdsById<V1_0::IdTable, V1_0::ChannelTable>(connection, manifestId);
+
+        std::optional<SQLite::rowid_t> currentLatest = LatestVersionTable::GetLatestManifestId(connection, idRowId, channelRowId);
+        bool isLatest = true;
+
+        if (currentLatest)
+        {
+            auto [currentVersion] = V1_0::ManifestTable::GetValuesById<V1_0::VersionTable>(connection, currentLatest.value());
+            isLatest = Utility::Version(currentVersion) < Utility::Version(manifest.Version);
+        }
+
+        if (isLatest)
+        {
+            LatestVersionTable::SetLatestManifestId(connection, idRowId, channelRowId, manifestId);
+        }
+
+        savepoint.Commit();
+
+        return manifestId;
+    }
+
+    std::pair<bool, SQLite::rowid_t> Interface::UpdateManifest(SQLite::Connection& connection, const Manifest::Manifest& manifest, const std::optional<std::filesystem::path>& relativePath)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "updatemanifest_v1_8");
+
+        auto [indexModified, manifestId] = V1_7::Interface::UpdateManifest(connection, manifest, relativePath);
+
+        // Only journal updates that actually modified the index; replaying a no-op
+        // would needlessly dirty the consumer's copy of the manifest.
+        if (indexModified)
+        {
+            ChangeJournalTable::RecordChange(connection, ChangeType::Update, manifest.Id, manifest.Version, manifest.Channel);
+        }
+
+        savepoint.Commit();
+
+        return { indexModified, manifestId };
+    }
+
+    void Interface::RemoveManifestById(SQLite::Connection& connection, SQLite::rowid_t manifestId)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "RemoveManifestById_v1_8");
+
+        // Capture the manifest key before the removal destroys it.
+        std::optional<std::string> id = GetPropertyByManifestId(connection, manifestId, PackageVersionProperty::Id);
+        std::optional<std::string> version = GetPropertyByManifestId(connection, manifestId, PackageVersionProperty::Version);
+        std::optional<std::string> channel = GetPropertyByManifestId(connection, manifestId, PackageVersionProperty::Channel);
+
+        auto [idRowId, channelRowId] = V1_0::ManifestTable::GetIdsById<V1_0::IdTable, V1_0::ChannelTable>(connection, manifestId);
+        bool wasLatest = (LatestVersionTable::GetLatestManifestId(connection, idRowId, channelRowId) == manifestId);
+
+        V1_7::Interface::RemoveManifestById(connection, manifestId);
+
+        if (id)
+        {
+            ChangeJournalTable::RecordChange(connection, ChangeType::Remove, id.value(), version.value_or(""), channel.value_or(""));
+        }
+
+        // Only a removal of the latest version can change the pointer.
+        if (wasLatest)
+        {
+            RecomputeLatestVersion(connection, idRowId, channelRowId);
+        }
+
+        savepoint.Commit();
+    }
+
+    void Interface::PrepareForPackaging(SQLite::Connection& connection, bool vacuum)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "prepareforpackaging_v1_8");
+
+        V1_7::Interface::PrepareForPackaging(connection, false);
+
+        // Earlier versions drop the manifest side indices of the tag and command map tables
+        // to save space, which leaves reading the values of one manifest scanning the whole
+        // map table on the consumer machine. Ship a covering { manifest, value } index
+        // instead, which answers those reads without touching the map table at all.
+        // The value indices stay dropped: substring matching cannot use them anyway.
+        V1_0::TagsTable::CreateManifestCoveringIndex(connection);
+        V1_0::CommandsTable::CreateManifestCoveringIndex(connection);
+
+        savepoint.Commit();
+
+        if (vacuum)
+        {
+            Vacuum(connection);
+        }
+    }
+
+    std::optional<SQLite::rowid_t> Interface::GetManifestIdByKey(const SQLite::Connection& connection, SQLite::rowid_t id, std::string_view version, std::string_view channel) const
+    {
+        // An empty version asks for the latest, which the precomputed pointer answers
+        // without reading and sorting every version of the package.
+        if (version.empty())
+        {
+            std::optional<SQLite::rowid_t> channelRowId = V1_0::ChannelTable::SelectIdByValue(connection, channel, true);
+            if (channelRowId)
+            {
+                std::optional<SQLite::rowid_t> latest = LatestVersionTable::GetLatestManifestId(connection, id, channelRowId.value());
+                if (latest)
+                {
+                    return latest;
+                }
+            }
+        }
+
+        return V1_7::Interface::GetManifestIdByKey(connection, id, version, channel);
+    }
+
+    std::vector<ISQLiteIndex::ChangeJournalEntry> Interface::GetChangesSince(const SQLite::Connection& connection, SQLite::rowid_t sequence) const
+    {
+        return ChangeJournalTable::GetChangesSince(connection, sequence);
+    }
+}
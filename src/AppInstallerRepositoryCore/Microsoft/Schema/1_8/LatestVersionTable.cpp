@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "LatestVersionTable.h"
+#include "SQLiteStatementBuilder.h"
+
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_8
+{
+    using namespace SQLite;
+
+    static constexpr std::string_view s_LatestVersionTable_Table_Name = "latestversions"sv;
+    static constexpr std::string_view s_LatestVersionTable_Id_Column = "id"sv;
+    static constexpr std::string_view s_LatestVersionTable_Channel_Column = "channel"sv;
+    static constexpr std::string_view s_LatestVersionTable_Manifest_Column = "manifest"sv;
+    static constexpr std::string_view s_LatestVersionTable_Index_Name = "latestversions_pkindex"sv;
+
+    std::string_view LatestVersionTable::TableName()
+    {
+        return s_LatestVersionTable_Table_Name;
+    }
+
+    void LatestVersionTable::Create(SQLite::Connection& connection)
+    {
+        using namespace Builder;
+
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "createlatestversions_v1_8");
+
+        StatementBuilder createTableBuilder;
+        createTableBuilder.CreateTable(s_LatestVersionTable_Table_Name).Columns({
+            ColumnBuilder(s_LatestVersionTable_Id_Column, Type::Int64).NotNull(),
+            ColumnBuilder(s_LatestVersionTable_Channel_Column, Type::Int64).NotNull(),
+            ColumnBuilder(s_LatestVersionTable_Manifest_Column, Type::Int64).NotNull()
+            });
+
+        createTableBuilder.Execute(connection);
+
+        StatementBuilder createIndexBuilder;
+        createIndexBuilder.CreateUniqueIndex(s_LatestVersionTable_Index_Name).On(s_LatestVersionTable_Table_Name).Columns({ s_LatestVersionTable_Id_Column, s_LatestVersionTable_Channel_Column });
+
+        createIndexBuilder.Execute(connection);
+
+        savepoint.Commit();
+    }
+
+    std::optional<SQLite::rowid_t> LatestVersionTable::GetLatestManifestId(const SQLite::Connection& connection, SQLite::rowid_t idRowId, SQLite::rowid_t channelRowId)
+    {
+        using namespace Builder;
+
+        StatementBuilder builder;
+        builder.Select(s_LatestVersionTable_Manifest_Column).From(s_LatestVersionTable_Table_Name).
+            Where(s_LatestVersionTable_Id_Column).Equals(idRowId).And(s_LatestVersionTable_Channel_Column).Equals(channelRowId);
+
+        SQLite::Statement select = builder.Prepare(connection);
+
+        if (select.Step())
+        {
+            return select.GetColumn<SQLite::rowid_t>(0);
+        }
+
+        return {};
+    }
+
+    void LatestVersionTable::SetLatestManifestId(SQLite::Connection& connection, SQLite::rowid_t idRowId, SQLite::rowid_t channelRowId, SQLite::rowid_t manifestRowId)
+    {
+        using namespace Builder;
+
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "setlatestversion_v1_8");
+
+        DeleteByIds(connection, idRowId, channelRowId);
+
+        StatementBuilder insertBuilder;
+        insertBuilder.InsertInto(s_LatestVersionTable_Table_Name).
+            Columns({ s_LatestVersionTable_Id_Column, s_LatestVersionTable_Channel_Column, s_LatestVersionTable_Manifest_Column }).
+            Values(idRowId, channelRowId, manifestRowId);
+
+        insertBuilder.Execute(connection);
+
+        savepoint.Commit();
+    }
+
+    void LatestVersionTable::DeleteByIds(SQLite::Connection& connection, SQLite::rowid_t idRowId, SQLite::rowid_t channelRowId)
+    {
+        using namespace Builder;
+
+        StatementBuilder builder;
+        builder.DeleteFrom(s_LatestVersionTable_Table_Name).
+            Where(s_LatestVersionTable_Id_Column).Equals(idRowId).And(s_LatestVersionTable_Channel_Column).Equals(channelRowId);
+
+        builder.Execute(connection);
+    }
+}
@@ -0,0 +1,32 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include "SQLiteWrapper.h"
+
+#include <optional>
+
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_8
+{
+    // A precomputed pointer to the latest version manifest of each { Id, Channel } pair.
+    // Selecting the latest version otherwise requires reading every version of the package
+    // and sorting them with Utility::Version at query time; maintaining the pointer at
+    // write time makes the common "no version given" lookup a single row read.
+    struct LatestVersionTable
+    {
+        // Get the table name.
+        static std::string_view TableName();
+
+        // Creates the table.
+        static void Create(SQLite::Connection& connection);
+
+        // Gets the latest version manifest for the given id and channel, if a pointer exists.
+        static std::optional<SQLite::rowid_t> GetLatestManifestId(const SQLite::Connection& connection, SQLite::rowid_t idRowId, SQLite::rowid_t channelRowId);
+
+        // Sets the latest version manifest for the given id and channel, replacing any existing pointer.
+        static void SetLatestManifestId(SQLite::Connection& connection, SQLite::rowid_t idRowId, SQLite::rowid_t channelRowId, SQLite::rowid_t manifestRowId);
+
+        // Removes the pointer for the given id and channel.
+        static void DeleteByIds(SQLite::Connection& connection, SQLite::rowid_t idRowId, SQLite::rowid_t channelRowId);
+    };
+}
@@ -0,0 +1,21 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include "Microsoft/Schema/ISQLiteIndex.h"
+#include "Microsoft/Schema/1_8/Interface.h"
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_9
+{
+    // Interface to this schema version exposed through ISQLiteIndex.
+    struct Interface : public V1_8::Interface
+    {
+        Interface(Utility::NormalizationVersion normVersion = Utility::NormalizationVersion::Initial);
+
+        // Version 1.0
+        Schema::Version GetVersion() const override;
+        void CreateTables(SQLite::Connection& connection, CreateOptions options) override;
+
+        // Version 1.1
+        void PrepareForPackaging(SQLite::Connection& connection, bool vacuum) override;
+    };
+}
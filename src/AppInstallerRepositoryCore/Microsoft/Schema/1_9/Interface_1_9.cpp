@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Microsoft/Schema/1_9/Interface.h"
+#include "Microsoft/Schema/1_9/InternedStringsTable.h"
+#include "Microsoft/Schema/1_0/IdTable.h"
+#include "Microsoft/Schema/1_0/NameTable.h"
+#include "Microsoft/Schema/1_0/MonikerTable.h"
+#include "Microsoft/Schema/1_0/VersionTable.h"
+#include "Microsoft/Schema/1_0/ChannelTable.h"
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_9
+{
+    namespace
+    {
+        // The 1:1 value tables whose string storage is shared. The one-to-many value
+        // tables (tags, commands) keep their own storage; their values rarely overlap
+        // these, so interning them would only add join depth to their reads.
+        std::vector<std::string_view> InternedTables()
+        {
+            return {
+                V1_0::IdTable::TableName(),
+                V1_0::NameTable::TableName(),
+                V1_0::MonikerTable::TableName(),
+                V1_0::VersionTable::TableName(),
+                V1_0::ChannelTable::TableName(),
+            };
+        }
+    }
+
+    Interface::Interface(Utility::NormalizationVersion normVersion) : V1_8::Interface(normVersion)
+    {
+    }
+
+    Schema::Version Interface::GetVersion() const
+    {
+        return { 1, 9 };
+    }
+
+    void Interface::CreateTables(SQLite::Connection& connection, CreateOptions options)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "createtables_v1_9");
+
+        V1_8::Interface::CreateTables(connection, options);
+
+        // Replace the freshly created (and thus empty) 1:1 value tables with views over
+        // shared string storage; every version string, for instance, otherwise appears
+        // once in its own table and again for each name or moniker that matches it.
+        InternedStringsTable::Create(connection);
+
+        InternedStringsTable::ConvertOneToOneTable(connection, V1_0::IdTable::TableName(), V1_0::IdTable::ValueName());
+        InternedStringsTable::ConvertOneToOneTable(connection, V1_0::NameTable::TableName(), V1_0::NameTable::ValueName());
+        InternedStringsTable::ConvertOneToOneTable(connection, V1_0::MonikerTable::TableName(), V1_0::MonikerTable::ValueName());
+        InternedStringsTable::ConvertOneToOneTable(connection, V1_0::VersionTable::TableName(), V1_0::VersionTable::ValueName());
+        InternedStringsTable::ConvertOneToOneTable(connection, V1_0::ChannelTable::TableName(), V1_0::ChannelTable::ValueName());
+
+        savepoint.Commit();
+    }
+
+    void Interface::PrepareForPackaging(SQLite::Connection& connection, bool vacuum)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "prepareforpackaging_v1_9");
+
+        V1_8::Interface::PrepareForPackaging(connection, false);
+
+        InternedStringsTable::PrepareForPackaging(connection, InternedTables());
+
+        savepoint.Commit();
+
+        if (vacuum)
+        {
+            Vacuum(connection);
+        }
+    }
+}
@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "InternedStringsTable.h"
+#include "SQLiteStatementBuilder.h"
+
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_9
+{
+    using namespace SQLite;
+
+    static constexpr std::string_view s_InternedStringsTable_Table_Name = "strings"sv;
+    static constexpr std::string_view s_InternedStringsTable_String_Column = "string"sv;
+    static constexpr std::string_view s_InternedStringsTable_Index_Suffix = "_pkindex"sv;
+
+    static constexpr std::string_view s_InternedStringsTable_Map_Suffix = "_interned"sv;
+
+    namespace
+    {
+        std::string BracketedName(std::string_view name)
+        {
+            std::string result = "[";
+            result += name;
+            result += ']';
+            return result;
+        }
+
+        std::string MapTableName(std::string_view tableName)
+        {
+            std::string result{ tableName };
+            result += s_InternedStringsTable_Map_Suffix;
+            return result;
+        }
+
+        void ExecuteRaw(SQLite::Connection& connection, const std::string& sql)
+        {
+            SQLite::Statement::Create(connection, sql).Execute();
+        }
+    }
+
+    std::string_view InternedStringsTable::TableName()
+    {
+        return s_InternedStringsTable_Table_Name;
+    }
+
+    void InternedStringsTable::Create(SQLite::Connection& connection)
+    {
+        using namespace Builder;
+
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "createinternedstrings_v1_9");
+
+        StatementBuilder createTableBuilder;
+        createTableBuilder.CreateTable(s_InternedStringsTable_Table_Name).Columns({
+            IntegerPrimaryKey(),
+            ColumnBuilder(s_InternedStringsTable_String_Column, Type::Text).NotNull()
+            });
+
+        createTableBuilder.Execute(connection);
+
+        StatementBuilder indexBuilder;
+        indexBuilder.CreateUniqueIndex({ s_InternedStringsTable_Table_Name, s_InternedStringsTable_Index_Suffix }).
+            On(s_InternedStringsTable_Table_Name).Columns(s_InternedStringsTable_String_Column);
+        indexBuilder.Execute(connection);
+
+        savepoint.Commit();
+    }
+
+    void InternedStringsTable::ConvertOneToOneTable(SQLite::Connection& connection, std::string_view tableName, std::string_view valueName)
+    {
+        using namespace Builder;
+
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, std::string{ tableName } + "_intern_v1_9");
+
+        std::string table = BracketedName(tableName);
+        std::string value = BracketedName(valueName);
+        std::string mapTable = BracketedName(MapTableName(tableName));
+        std::string strings = BracketedName(s_InternedStringsTable_Table_Name);
+        std::string stringColumn = BracketedName(s_InternedStringsTable_String_Column);
+
+        // The map table keeps the original rowids, so manifest references remain valid.
+        StatementBuilder createMapTableBuilder;
+        createMapTableBuilder.CreateTable({ tableName, s_InternedStringsTable_Map_Suffix }).Columns({
+            IntegerPrimaryKey(),
+            ColumnBuilder(s_InternedStringsTable_String_Column, Type::RowId).NotNull()
+            });
+
+        createMapTableBuilder.Execute(connection);
+
+        // Value lookups filter on the shared string first, then locate the reference here.
+        StatementBuilder indexBuilder;
+        indexBuilder.CreateUniqueIndex({ tableName, s_InternedStringsTable_Map_Suffix, s_InternedStringsTable_Index_Suffix }).
+            On({ tableName, s_InternedStringsTable_Map_Suffix }).Columns(s_InternedStringsTable_String_Column);
+        indexBuilder.Execute(connection);
+
+        // Migrate any existing rows before replacing the table.
+        ExecuteRaw(connection, "INSERT OR IGNORE INTO " + strings + "(" + stringColumn + ") SELECT " + value + " FROM " + table);
+        ExecuteRaw(connection,
+            "INSERT INTO " + mapTable + "([rowid]," + stringColumn + ") "
+            "SELECT [t].[rowid], [s].[rowid] FROM " + table + " AS [t] "
+            "JOIN " + strings + " AS [s] ON [s]." + stringColumn + " = [t]." + value);
+
+        StatementBuilder dropTableBuilder;
+        dropTableBuilder.DropTable(tableName);
+        dropTableBuilder.Execute(connection);
+
+        // The view exposes the original name and shape, including an explicit rowid column,
+        // so every existing select, join and order by statement works against it unchanged.
+        ExecuteRaw(connection,
+            "CREATE VIEW " + table + "([rowid]," + value + ") AS "
+            "SELECT [m].[rowid], [s]." + stringColumn + " FROM " + mapTable + " AS [m] "
+            "JOIN " + strings + " AS [s] ON [s].[rowid] = [m]." + stringColumn);
+
+        // The triggers keep the existing write statements working; a string orphaned by an
+        // update or delete is left behind and pruned by PrepareForPackaging.
+        ExecuteRaw(connection,
+            "CREATE TRIGGER " + BracketedName(std::string{ tableName } + "_insert_trigger") + " INSTEAD OF INSERT ON " + table + " BEGIN "
+            "INSERT OR IGNORE INTO " + strings + "(" + stringColumn + ") VALUES (NEW." + value + "); "
+            "INSERT INTO " + mapTable + "(" + stringColumn + ") SELECT [rowid] FROM " + strings + " WHERE " + stringColumn + " = NEW." + value + "; "
+            "END");
+        ExecuteRaw(connection,
+            "CREATE TRIGGER " + BracketedName(std::string{ tableName } + "_update_trigger") + " INSTEAD OF UPDATE OF " + value + " ON " + table + " BEGIN "
+            "INSERT OR IGNORE INTO " + strings + "(" + stringColumn + ") VALUES (NEW." + value + "); "
+            "UPDATE " + mapTable + " SET " + stringColumn + " = (SELECT [rowid] FROM " + strings + " WHERE " + stringColumn + " = NEW." + value + ") WHERE [rowid] = OLD.[rowid]; "
+            "END");
+        ExecuteRaw(connection,
+            "CREATE TRIGGER " + BracketedName(std::string{ tableName } + "_delete_trigger") + " INSTEAD OF DELETE ON " + table + " BEGIN "
+            "DELETE FROM " + mapTable + " WHERE [rowid] = OLD.[rowid]; "
+            "END");
+
+        savepoint.Commit();
+    }
+
+    void InternedStringsTable::PrepareForPackaging(SQLite::Connection& connection, const std::vector<std::string_view>& tableNames)
+    {
+        using namespace Builder;
+
+        // Remove strings that no converted table references any longer.
+        std::string prune = "DELETE FROM " + BracketedName(s_InternedStringsTable_Table_Name) + " WHERE [rowid] NOT IN (";
+        bool first = true;
+
+        for (std::string_view tableName : tableNames)
+        {
+            if (!first)
+            {
+                prune += " UNION ";
+            }
+            first = false;
+
+            prune += "SELECT " + BracketedName(s_InternedStringsTable_String_Column) + " FROM " + BracketedName(MapTableName(tableName));
+        }
+
+        prune += ")";
+        ExecuteRaw(connection, prune);
+
+        // The lookup indices only serve writes and exact value probes during creation;
+        // drop them to reduce the packaged size, as V1.1 does for the original tables.
+        StatementBuilder dropStringsIndexBuilder;
+        dropStringsIndexBuilder.DropIndex({ s_InternedStringsTable_Table_Name, s_InternedStringsTable_Index_Suffix });
+        dropStringsIndexBuilder.Execute(connection);
+
+        for (std::string_view tableName : tableNames)
+        {
+            StatementBuilder dropMapIndexBuilder;
+            dropMapIndexBuilder.DropIndex({ tableName, s_InternedStringsTable_Map_Suffix, s_InternedStringsTable_Index_Suffix });
+            dropMapIndexBuilder.Execute(connection);
+        }
+    }
+}
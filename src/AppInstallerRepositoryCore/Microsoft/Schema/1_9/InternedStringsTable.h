@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include "SQLiteWrapper.h"
+
+#include <string_view>
+#include <vector>
+
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_9
+{
+    // Shared storage for the value strings of the 1:1 lookup tables.
+    // Package identifiers, names, monikers, versions and channels repeat the same strings
+    // heavily across tables (and across packages); storing each distinct string once and
+    // referencing it by rowid removes that duplication from the packaged index.
+    // Each converted table is replaced by a view of the same name and shape, with
+    // INSTEAD OF triggers keeping all existing read and write statements working unchanged.
+    struct InternedStringsTable
+    {
+        // Get the table name.
+        static std::string_view TableName();
+
+        // Creates the shared strings table.
+        static void Create(SQLite::Connection& connection);
+
+        // Replaces the given 1:1 table with interned storage: a map table holding the
+        // original rowids against string references, and a view of the original name and
+        // shape over it. Existing rows are migrated, so their rowids remain valid.
+        static void ConvertOneToOneTable(SQLite::Connection& connection, std::string_view tableName, std::string_view valueName);
+
+        // Removes strings no longer referenced by any of the given converted tables and
+        // drops the lookup indices, which are only needed while the index is being written.
+        static void PrepareForPackaging(SQLite::Connection& connection, const std::vector<std::string_view>& tableNames);
+    };
+}
@@ -9,6 +9,7 @@
 #include <winget/NameNormalization.h>
 
 #include <filesystem>
+#include <map>
 #include <optional>
 
 
@@ -33,6 +34,29 @@ namespace AppInstaller::Repository::Microsoft::Schema
         // The non-version specific return value of GetMetadataByManifestId.
         using MetadataResult = std::vector<std::pair<PackageVersionMetadata, std::string>>;
 
+        // The non-version specific return value of GetPropertiesByManifestIds.
+        // One column per requested property, in request order; each column holds one value
+        // per requested manifest id, also in request order.
+        using PropertiesResult = std::vector<std::vector<std::optional<std::string>>>;
+
+        // A dependency declared by a manifest; the non-version specific value type of GetDependencyClosureByManifestRowIds.
+        struct DependencyEdge
+        {
+            // The package that is depended upon.
+            SQLite::rowid_t PackageRowId = 0;
+
+            // The identifier of the package that is depended upon.
+            Utility::NormalizedString PackageId;
+
+            // The minimum required version; empty when the dependency does not constrain the version.
+            Utility::NormalizedString MinVersion;
+        };
+
+        // The non-version specific return value of GetDependencyClosureByManifestRowIds.
+        // Maps each manifest in the closure (including the requested ones and manifests
+        // without dependencies) to the dependencies that it declares.
+        using DependencyClosureResult = std::map<SQLite::rowid_t, std::vector<DependencyEdge>>;
+
         // Version 1.0
 
         // Gets the schema version that this index interface is built for.
@@ -84,6 +108,11 @@ namespace AppInstaller::Repository::Microsoft::Schema
         // Gets the string values for the given property and manifest id, if present.
         virtual std::vector<std::string> GetMultiPropertyByManifestId(const SQLite::Connection& connection, SQLite::rowid_t manifestId, PackageVersionMultiProperty property) const = 0;
 
+        // Gets the strings for each of the given properties and manifest ids.
+        // Properties stored 1:1 with the manifest are retrieved for all of the ids with a single
+        // joined statement, rather than one statement per id and property.
+        virtual PropertiesResult GetPropertiesByManifestIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& manifestIds, const std::vector<PackageVersionProperty>& properties) const = 0;
+
         // Gets the manifest id for the given { id, version, channel }, if present.
         // If version is empty, gets the value for the 'latest' version.
         virtual std::optional<SQLite::rowid_t> GetManifestIdByKey(const SQLite::Connection& connection, SQLite::rowid_t id, std::string_view version, std::string_view channel) const = 0;
@@ -110,6 +139,39 @@ namespace AppInstaller::Repository::Microsoft::Schema
         virtual std::set<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependenciesByManifestRowId(const SQLite::Connection& connection, SQLite::rowid_t manifestRowId) const = 0;
 
         virtual std::vector<std::pair<SQLite::rowid_t, Utility::NormalizedString>> GetDependentsById(const SQLite::Connection& connection, AppInstaller::Manifest::string_t packageId) const = 0;
+
+        // Gets the transitive dependency closure of the given manifests with a single recursive statement.
+        // The closure is expanded through every manifest of each package that is depended upon, so it is a
+        // superset of the closure for any particular version selection made by the caller.
+        // Versions without dependency support return an empty result.
+        virtual DependencyClosureResult GetDependencyClosureByManifestRowIds(const SQLite::Connection& connection, const std::vector<SQLite::rowid_t>& manifestRowIds) const = 0;
+
+        // Version 1.8
+
+        // The type of change recorded in the change journal.
+        enum class ChangeType : int64_t
+        {
+            Add = 1,
+            Update = 2,
+            Remove = 3,
+        };
+
+        // A single entry in the change journal; the non-version specific return value of GetChangesSince.
+        // The { Id, Version, Channel } key is stored by value so that the entry remains usable
+        // after the manifest it refers to has been removed from the index.
+        struct ChangeJournalEntry
+        {
+            SQLite::rowid_t Sequence = 0;
+            ChangeType Change = ChangeType::Add;
+            std::string Id;
+            std::string Version;
+            std::string Channel;
+        };
+
+        // Gets the change journal entries recorded after the given sequence number, in increasing
+        // sequence order. Pass 0 to get the entire journal.
+        // Versions without a change journal return an empty result.
+        virtual std::vector<ChangeJournalEntry> GetChangesSince(const SQLite::Connection& connection, SQLite::rowid_t sequence) const = 0;
     };
 
     DEFINE_ENUM_FLAG_OPERATORS(ISQLiteIndex::CreateOptions);
@@ -110,6 +110,11 @@ namespace AppInstaller::Repository
         std::vector<ValidationError> dependenciesError;
         bool foundErrors = false;
 
+        // The dependency edges of everything reachable from a manifest are fetched with a single
+        // recursive query the first time that manifest is visited; the rest of the graph walk is
+        // then served from this map instead of issuing statements per node and per edge.
+        SQLiteIndex::DependencyClosureResult closureEdges;
+
         DependencyGraph graph
         {
             rootId,
@@ -137,17 +142,22 @@ namespace AppInstaller::Repository
                     return depList;
                 }
 
-                auto packageLatestDependencies = index->GetDependenciesByManifestRowId(packageLatest.value().first);
-                std::for_each(
-                    packageLatestDependencies.begin(),
-                    packageLatestDependencies.end(),
-                    [&](std::pair<SQLite::rowid_t, Utility::NormalizedString> row)
+                auto itr = closureEdges.find(packageLatest.value().first);
+                if (itr == closureEdges.end())
+                {
+                    auto closure = index->GetDependencyClosureByManifestRowIds({ packageLatest.value().first });
+                    closureEdges.insert(closure.begin(), closure.end());
+                    itr = closureEdges.find(packageLatest.value().first);
+                }
+
+                if (itr != closureEdges.end())
+                {
+                    for (const auto& edge : itr->second)
                     {
-                        auto manifestRowId = index->GetManifestIdByKey(row.first, "", "");
-                        auto packageId = index->GetPropertyByManifestId(manifestRowId.value(), PackageVersionProperty::Id);
-                        Dependency dep(DependencyType::Package, packageId.value(), row.second);
+                        Dependency dep(DependencyType::Package, edge.PackageId, edge.MinVersion);
                         depList.Add(dep);
-                    });
+                    }
+                }
 
                 return depList;
             }
@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "Public/winget/RepositorySearch.h"
 #include <winget/Filesystem.h>
+#include <winget/SharedThreadGlobals.h>
 
 using namespace AppInstaller::Settings;
 using namespace std::chrono_literals;
@@ -11,6 +12,9 @@ namespace AppInstaller::Repository
 {
     namespace
     {
+        // The maximum number of files hashed concurrently by an installed status check.
+        constexpr size_t s_CheckInstalledStatus_MaximumConcurrentHashes = 4;
+
         HRESULT CheckInstalledLocationStatus(const std::filesystem::path& installedLocation)
         {
             HRESULT installLocationStatus = WINGET_INSTALLED_STATUS_INSTALL_LOCATION_NOT_APPLICABLE;
@@ -144,34 +148,153 @@ namespace AppInstaller::Repository
             }
 
             auto manifest = availableVersion->GetManifest();
+
+            // First pass: determine each installer's applicability and resolve the locations its
+            // checks will probe, collecting the files whose hashes will be needed so that the
+            // disk bound hashing can run concurrently rather than file by file during the checks.
+            struct InstallerCheckContext
+            {
+                bool IsMatchingInstaller = false;
+                std::filesystem::path DefaultInstalledLocation;
+                HRESULT DefaultInstalledLocationStatus = WINGET_INSTALLED_STATUS_INSTALL_LOCATION_NOT_APPLICABLE;
+            };
+
+            std::vector<InstallerCheckContext> installerContexts;
+            installerContexts.reserve(manifest.Installers.size());
+            std::vector<std::filesystem::path> filesToHash;
+
             for (auto const& installer : manifest.Installers)
             {
+                InstallerCheckContext checkContext;
+
                 if (installer.InstallationMetadata.HasData())
                 {
-                    InstallerInstalledStatus installerStatus;
-                    installerStatus.Installer = installer;
-
-                    // ARP related checks
                     if (WI_IsAnyFlagSet(checkTypes, InstalledStatusType::AllAppsAndFeaturesEntryChecks))
                     {
-                        bool isMatchingInstaller =
+                        checkContext.IsMatchingInstaller =
                             installedVersion &&
                             IsInstallerTypeCompatible(installedType, installer.EffectiveInstallerType()) &&
                             (installedScope == ScopeEnum::Unknown || installer.Scope == ScopeEnum::Unknown || installedScope == installer.Scope) &&  // Treat unknown scope as compatible
                             (installedArchitecture == Utility::Architecture::Unknown || installer.Arch == Utility::Architecture::Neutral || installedArchitecture == installer.Arch) &&  // Treat unknown installed architecture as compatible
                             (installedLocale.empty() || installer.Locale.empty() || !Locale::IsWellFormedBcp47Tag(installedLocale) || Locale::GetDistanceOfLanguage(installedLocale, installer.Locale) >= Locale::MinimumDistanceScoreAsCompatibleMatch);  // Treat invalid locale as compatible
+                    }
+
+                    if (WI_IsAnyFlagSet(checkTypes, InstalledStatusType::AllDefaultInstallLocationChecks))
+                    {
+                        checkContext.DefaultInstalledLocation = Filesystem::GetExpandedPath(installer.InstallationMetadata.DefaultInstallLocation);
+                        checkContext.DefaultInstalledLocationStatus = CheckInstalledLocationStatus(checkContext.DefaultInstalledLocation);
+                    }
 
+                    if (checkFileHash)
+                    {
+                        auto collectFiles = [&](const std::filesystem::path& location)
+                        {
+                            for (auto const& file : installer.InstallationMetadata.Files)
+                            {
+                                if (!file.FileSha256.empty())
+                                {
+                                    std::filesystem::path filePath = location / Utility::ConvertToUTF16(file.RelativeFilePath);
+                                    if (std::find(filesToHash.begin(), filesToHash.end(), filePath) == filesToHash.end())
+                                    {
+                                        filesToHash.emplace_back(std::move(filePath));
+                                    }
+                                }
+                            }
+                        };
+
+                        if (checkContext.IsMatchingInstaller &&
+                            installedLocationStatus == WINGET_INSTALLED_STATUS_INSTALL_LOCATION_FOUND &&
+                            WI_IsFlagSet(checkTypes, InstalledStatusType::AppsAndFeaturesEntryInstallLocationFile))
+                        {
+                            collectFiles(installedLocation);
+                        }
+
+                        if (checkContext.DefaultInstalledLocationStatus == WINGET_INSTALLED_STATUS_INSTALL_LOCATION_FOUND &&
+                            WI_IsFlagSet(checkTypes, InstalledStatusType::DefaultInstallLocationFile))
+                        {
+                            collectFiles(checkContext.DefaultInstalledLocation);
+                        }
+                    }
+                }
+
+                installerContexts.emplace_back(std::move(checkContext));
+            }
+
+            // Hash the collected files concurrently; CheckInstalledFileStatus below then finds
+            // every hash already cached. Failures leave the file uncached so that the check
+            // classifies them itself.
+            size_t threadCount = std::min<size_t>({ s_CheckInstalledStatus_MaximumConcurrentHashes, filesToHash.size(), std::thread::hardware_concurrency() });
+            if (threadCount >= 2)
+            {
+                std::mutex hashesLock;
+                std::vector<std::thread> threads;
+                threads.reserve(threadCount);
+
+                ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+                for (size_t t = 0; t < threadCount; ++t)
+                {
+                    threads.emplace_back([&, t]()
+                        {
+                            // Adopt the caller's globals so that worker logging lands in the caller's log.
+                            std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                            if (callerGlobals)
+                            {
+                                previousGlobals = callerGlobals->SetForCurrentThread();
+                            }
+
+                            for (size_t i = t; i < filesToHash.size(); i += threadCount)
+                            {
+                                try
+                                {
+                                    const std::filesystem::path& filePath = filesToHash[i];
+                                    if (std::filesystem::exists(filePath) && std::filesystem::is_regular_file(filePath))
+                                    {
+                                        std::ifstream in{ filePath, std::ifstream::binary };
+                                        auto hash = Utility::SHA256::ComputeHash(in);
+
+                                        std::lock_guard<std::mutex> lock{ hashesLock };
+                                        fileHashes.emplace(filePath, std::move(hash));
+                                    }
+                                }
+                                catch (...)
+                                {
+                                    // Leave the file uncached; the status check will classify the failure.
+                                }
+                            }
+                        });
+                }
+
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+            }
+
+            for (size_t installerIndex = 0; installerIndex < manifest.Installers.size(); ++installerIndex)
+            {
+                auto const& installer = manifest.Installers[installerIndex];
+                const InstallerCheckContext& checkContext = installerContexts[installerIndex];
+
+                if (installer.InstallationMetadata.HasData())
+                {
+                    InstallerInstalledStatus installerStatus;
+                    installerStatus.Installer = installer;
+
+                    // ARP related checks
+                    if (WI_IsAnyFlagSet(checkTypes, InstalledStatusType::AllAppsAndFeaturesEntryChecks))
+                    {
                         // ARP entry status
                         if (WI_IsFlagSet(checkTypes, InstalledStatusType::AppsAndFeaturesEntry))
                         {
                             installerStatus.Status.emplace_back(
                                 InstalledStatusType::AppsAndFeaturesEntry,
                                 "",
-                                isMatchingInstaller ? WINGET_INSTALLED_STATUS_ARP_ENTRY_FOUND : WINGET_INSTALLED_STATUS_ARP_ENTRY_NOT_FOUND);
+                                checkContext.IsMatchingInstaller ? WINGET_INSTALLED_STATUS_ARP_ENTRY_FOUND : WINGET_INSTALLED_STATUS_ARP_ENTRY_NOT_FOUND);
                         }
 
                         // ARP install location status
-                        if (isMatchingInstaller && WI_IsFlagSet(checkTypes, InstalledStatusType::AppsAndFeaturesEntryInstallLocation))
+                        if (checkContext.IsMatchingInstaller && WI_IsFlagSet(checkTypes, InstalledStatusType::AppsAndFeaturesEntryInstallLocation))
                         {
                             installerStatus.Status.emplace_back(
                                 InstalledStatusType::AppsAndFeaturesEntryInstallLocation,
@@ -180,7 +303,7 @@ namespace AppInstaller::Repository
                         }
 
                         // ARP install location files
-                        if (isMatchingInstaller &&
+                        if (checkContext.IsMatchingInstaller &&
                             installedLocationStatus == WINGET_INSTALLED_STATUS_INSTALL_LOCATION_FOUND &&
                             WI_IsFlagSet(checkTypes, InstalledStatusType::AppsAndFeaturesEntryInstallLocationFile))
                         {
@@ -200,8 +323,8 @@ namespace AppInstaller::Repository
                     // Default install location related checks
                     if (WI_IsAnyFlagSet(checkTypes, InstalledStatusType::AllDefaultInstallLocationChecks))
                     {
-                        auto defaultInstalledLocation = Filesystem::GetExpandedPath(installer.InstallationMetadata.DefaultInstallLocation);
-                        HRESULT defaultInstalledLocationStatus = CheckInstalledLocationStatus(defaultInstalledLocation);
+                        const auto& defaultInstalledLocation = checkContext.DefaultInstalledLocation;
+                        HRESULT defaultInstalledLocationStatus = checkContext.DefaultInstalledLocationStatus;
 
                         // Default install location status
                         if (WI_IsFlagSet(checkTypes, InstalledStatusType::DefaultInstallLocation))
@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "winget/PackageTrackingCatalog.h"
 #include "PackageTrackingCatalogSourceFactory.h"
+#include "winget/NameNormalization.h"
 #include "winget/Pin.h"
 #include "winget/RepositorySource.h"
 #include "Microsoft/SQLiteIndexSource.h"
@@ -67,6 +68,12 @@ namespace AppInstaller::Repository
 
                 SQLiteIndex index = SQLiteIndex::Open(trackingDB.u8string(), SQLiteIndex::OpenDisposition::ReadWrite);
 
+                // The tracking writes sit on the tail of every install and uninstall, so run the
+                // catalog in write-ahead logging mode: each record is a sequential log append
+                // rather than a synchronous database rewrite, and checkpoints fold the log back
+                // into the database periodically.
+                index.EnableWriteAheadLogging();
+
                 // TODO: Check schema version and upgrade as necessary when there is a relevant new schema.
                 //       Could write this all now but it will be better tested when there is a new schema.
 
@@ -118,6 +125,18 @@ namespace AppInstaller::Repository
                     std::filesystem::remove(trackingDB);
                 }
 
+                // Remove the write-ahead log sidecar files as well, if present.
+                for (const auto* suffix : { "-wal", "-shm" })
+                {
+                    std::filesystem::path sidecar = trackingDB;
+                    sidecar += suffix;
+
+                    if (std::filesystem::exists(sidecar))
+                    {
+                        std::filesystem::remove(sidecar);
+                    }
+                }
+
                 return true;
             }
         };
@@ -218,6 +237,10 @@ namespace AppInstaller::Repository
 
         auto& index = m_implementation->Source->GetIndex();
 
+        // The manifest write and each metadata write commit individually; group the
+        // bookkeeping for one install into a single commit.
+        auto batch = index.BeginWriteBatch();
+
         // Check for an existing manifest that matches this one (could be reinstalling)
         auto manifestIdOpt = index.GetManifestIdByManifest(manifest);
 
@@ -249,6 +272,30 @@ namespace AppInstaller::Repository
             index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::InstalledLocale, installer.Locale);
         }
 
+        // Persist correlation-normalized name and publisher keys so that later correlation
+        // runs can read them rather than normalizing the same entry on every invocation.
+        Utility::NameNormalizer normalizer{ Utility::NormalizationVersion::InitialPreserveWhiteSpace };
+
+        if (manifest.DefaultLocalization.Contains(Manifest::Localization::PackageName))
+        {
+            std::string normalizedName = normalizer.NormalizeName(manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>()).Name();
+            if (!normalizedName.empty())
+            {
+                index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::NormalizedName, normalizedName);
+            }
+        }
+
+        if (manifest.DefaultLocalization.Contains(Manifest::Localization::Publisher))
+        {
+            std::string normalizedPublisher = normalizer.NormalizePublisher(manifest.DefaultLocalization.Get<Manifest::Localization::Publisher>());
+            if (!normalizedPublisher.empty())
+            {
+                index.SetMetadataByManifestId(manifestId, PackageVersionMetadata::NormalizedPublisher, normalizedPublisher);
+            }
+        }
+
+        batch.Commit();
+
         std::shared_ptr<Version::implementation> result = std::make_shared<Version::implementation>();
         result->Id = manifestId;
         return { *this, std::move(result) };
@@ -262,6 +309,9 @@ namespace AppInstaller::Repository
         idSearch.Filters.emplace_back(PackageMatchField::Id, MatchType::CaseInsensitive, packageIdentifier.get());
         auto searchResult = index.Search(idSearch);
 
+        // Group the removals so that a package with many versions pays a single commit.
+        auto batch = index.BeginWriteBatch();
+
         for (const auto& match : searchResult.Matches)
         {
             auto versions = index.GetVersionKeysById(match.first);
@@ -276,6 +326,8 @@ namespace AppInstaller::Repository
                 }
             }
         }
+
+        batch.Commit();
     }
 
     std::unique_ptr<ISourceFactory> PackageTrackingCatalogSourceFactory::Create()
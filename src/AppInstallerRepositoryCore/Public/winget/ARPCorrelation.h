@@ -109,6 +109,11 @@ namespace AppInstaller::Repository::Correlation
         virtual void Init(const AppInstaller::Manifest::Manifest& manifest) = 0;
         virtual double ComputeConfidence(const ARPEntry& arpEntry) const = 0;
 
+        // Computes the confidence for every entry in the given list.
+        // The default implementation scores each entry serially; implementations
+        // may override it to spread the scoring work across threads.
+        virtual std::vector<double> ComputeConfidence(const std::vector<ARPEntry>& arpEntries) const;
+
         // Returns an instance of the algorithm we will actually use.
         // We may use multiple instances/specializations for testing and experimentation.
         static IARPMatchConfidenceAlgorithm& Instance();
@@ -32,15 +32,27 @@ namespace AppInstaller::Repository::Correlation
             WordSequence Name;
             WordSequence Publisher;
             WordSequence NamePublisher;
+
+            // The name words in sorted order, enabling a linear merge to count the words
+            // two names share and skip scoring candidates that cannot reach the threshold.
+            WordSequence SortedNameWords;
         };
 
         void Init(const AppInstaller::Manifest::Manifest& manifest) override;
         double ComputeConfidence(const ARPEntry& arpEntry) const override;
 
+        // Reads the entry strings serially, then partitions the normalization and
+        // scoring work across threads. The name normalizer holds per-instance regex
+        // state, so each worker uses its own.
+        std::vector<double> ComputeConfidence(const std::vector<ARPEntry>& arpEntries) const override;
+
     private:
-        WordSequence PrepareString(std::string_view s) const;
-        WordSequence NormalizeAndPrepareName(std::string_view name) const;
-        WordSequence NormalizeAndPreparePublisher(std::string_view publisher) const;
+        static WordSequence PrepareString(std::string_view s);
+        static WordSequence NormalizeAndPrepareName(const Utility::NameNormalizer& normalizer, std::string_view name);
+        static WordSequence NormalizeAndPreparePublisher(const Utility::NameNormalizer& normalizer, std::string_view publisher);
+
+        // Computes the confidence for an ARP name and publisher that have already been normalized and prepared.
+        double ComputeConfidence(const NameAndPublisher& arpNameAndPublisher, bool isNewOrUpdated) const;
 
         AppInstaller::Utility::NameNormalizer m_normalizer{ AppInstaller::Utility::NormalizationVersion::InitialPreserveWhiteSpace };
         std::vector<NameAndPublisher> m_namesAndPublishers;
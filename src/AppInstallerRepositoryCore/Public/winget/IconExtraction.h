@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 #pragma once
+#include <future>
 #include <vector>
 #include <winget/Manifest.h>
 
@@ -27,4 +28,9 @@ namespace AppInstaller::Repository
     // This method returns empty if only default icons would be picked.
     // This method returns contents of .ico icons.
     std::vector<ExtractedIconInfo> ExtractIconFromArpEntry(const std::string& productCode, AppInstaller::Manifest::ScopeEnum scope = AppInstaller::Manifest::ScopeEnum::Unknown);
+
+    // Same as ExtractIconFromArpEntry, but performs the extraction on a background thread.
+    // Repeated requests for the same entry are served from a bounded on disk cache, so callers
+    // listing many packages do not serialize their first paint behind icon extraction.
+    std::future<std::vector<ExtractedIconInfo>> ExtractIconFromArpEntryAsync(std::string productCode, AppInstaller::Manifest::ScopeEnum scope = AppInstaller::Manifest::ScopeEnum::Unknown);
 }
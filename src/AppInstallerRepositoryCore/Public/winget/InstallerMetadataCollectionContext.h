@@ -11,6 +11,7 @@
 #include <winget/IconExtraction.h>
 
 #include <filesystem>
+#include <future>
 #include <map>
 #include <memory>
 #include <optional>
@@ -109,6 +110,13 @@ namespace AppInstaller::Repository::Metadata
         static std::unique_ptr<InstallerMetadataCollectionContext> FromURI(std::wstring_view uri, const std::filesystem::path& logFile);
         static std::unique_ptr<InstallerMetadataCollectionContext> FromJSON(const std::wstring& json, const std::filesystem::path& logFile);
 
+        // As the corresponding factories above, but perform input retrieval and parsing on a
+        // background thread. Complete waits for initialization and rethrows any failure,
+        // allowing many collections to be in flight concurrently within a single process.
+        static std::unique_ptr<InstallerMetadataCollectionContext> FromFileAsync(const std::filesystem::path& file, const std::filesystem::path& logFile);
+        static std::unique_ptr<InstallerMetadataCollectionContext> FromURIAsync(std::wstring_view uri, const std::filesystem::path& logFile);
+        static std::unique_ptr<InstallerMetadataCollectionContext> FromJSONAsync(const std::wstring& json, const std::filesystem::path& logFile);
+
         // Completes the collection, writing to the given location.
         void Complete(const std::filesystem::path& output);
 
@@ -122,6 +130,14 @@ namespace AppInstaller::Repository::Metadata
         static std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> InitializeLogging(ThreadLocalStorage::WingetThreadGlobals& threadGlobals, const std::filesystem::path& logFile);
         std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> InitializeLogging(const std::filesystem::path& logFile);
 
+        // The bodies of the From* factories; run on a background thread by the *Async variants.
+        void InitializeFromFile(const std::filesystem::path& file, const std::filesystem::path& logFile);
+        void InitializeFromURI(const std::wstring& uri, const std::filesystem::path& logFile);
+        void InitializeFromJSON(const std::wstring& json, const std::filesystem::path& logFile);
+
+        // Waits for any background initialization, rethrowing its failure.
+        void WaitForInitialization();
+
         // Sets the collection context input and the preinstall state.
         void InitializePreinstallState(const std::wstring& json);
 
@@ -183,5 +199,9 @@ namespace AppInstaller::Repository::Metadata
         // Error data storage
         HRESULT m_errorHR = S_OK;
         std::string m_errorText;
+
+        // Background initialization used by the *Async factories; declared last so that its
+        // destructor joins the worker before the members it uses are destroyed.
+        std::future<void> m_initialization;
     };
 }
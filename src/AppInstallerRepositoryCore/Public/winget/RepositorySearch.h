@@ -203,6 +203,12 @@ namespace AppInstaller::Repository
         UserIntentArchitecture,
         // The locale of user intent
         UserIntentLocale,
+        // The name of the package, normalized for correlation
+        // (Utility::NormalizationVersion::InitialPreserveWhiteSpace)
+        NormalizedName,
+        // The publisher of the package, normalized for correlation
+        // (Utility::NormalizationVersion::InitialPreserveWhiteSpace)
+        NormalizedPublisher,
     };
 
     // Convert a PackageVersionMetadata to a string.
@@ -218,6 +224,12 @@ namespace AppInstaller::Repository
         // Gets a property of this package version.
         virtual Utility::LocIndString GetProperty(PackageVersionProperty property) const = 0;
 
+        // Gets several properties of this package version in a single call, ordered to match
+        // the given properties. Display code reads a fixed set of columns for every row it
+        // renders; extracting them together costs one virtual dispatch per version rather
+        // than one per cell. The default forwards each property to GetProperty.
+        virtual std::vector<Utility::LocIndString> GetProperties(const std::vector<PackageVersionProperty>& properties) const;
+
         // Gets a property of this package version that can have multiple values.
         virtual std::vector<Utility::LocIndString> GetMultiProperty(PackageVersionMultiProperty property) const = 0;
 
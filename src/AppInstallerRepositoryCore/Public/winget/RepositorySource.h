@@ -125,6 +125,10 @@ namespace AppInstaller::Repository
         // This value is used as an alternative to the `Arg` value if it is failing to function properly.
         // The alternate location must point to identical data or inconsistencies may arise.
         std::string AlternateArg;
+
+        // Whether the source data is known to be out of date; set when an update that would
+        // have happened before the open was deferred to the background instead.
+        bool IsStale = false;
     };
 
     // Individual source agreement entry. Label will be highlighted in the display as the key of the agreement entry.
@@ -213,6 +217,14 @@ namespace AppInstaller::Repository
         // Returns true if the origin type can contain available packages.
         bool ContainsAvailablePackages() const;
 
+        // Returns true if the source data would be updated when the source is opened.
+        bool ShouldUpdateBeforeOpen() const;
+
+        // When set, a source that is due for an update is opened with its existing data
+        // immediately and the update runs on a background thread; the updated data is used
+        // by the next open. SourceDetails::IsStale indicates that this occurred.
+        void SetBackgroundUpdateDeferred(bool deferred);
+
         // Set custom header.
         bool SetCustomHeader(std::optional<std::string> header);
 
@@ -280,6 +292,7 @@ namespace AppInstaller::Repository
         std::shared_ptr<ISource> m_source;
         bool m_isSourceToBeAdded = false;
         bool m_isComposite = false;
+        bool m_backgroundUpdateDeferred = false;
         mutable PackageTrackingCatalog m_trackingCatalog;
     };
 }
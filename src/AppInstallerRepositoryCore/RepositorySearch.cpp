@@ -30,6 +30,19 @@ namespace AppInstaller::Repository
         }
     }
 
+    std::vector<Utility::LocIndString> IPackageVersion::GetProperties(const std::vector<PackageVersionProperty>& properties) const
+    {
+        std::vector<Utility::LocIndString> result;
+        result.reserve(properties.size());
+
+        for (PackageVersionProperty property : properties)
+        {
+            result.emplace_back(GetProperty(property));
+        }
+
+        return result;
+    }
+
     bool SearchRequest::IsForEverything() const
     {
         return (!Query.has_value() && Inclusions.empty() && Filters.empty());
@@ -88,6 +101,8 @@ namespace AppInstaller::Repository
         case PackageVersionMetadata::PinnedState: return "PinnedState"sv;
         case PackageVersionMetadata::UserIntentArchitecture: return "UserIntentArchitecture"sv;
         case PackageVersionMetadata::UserIntentLocale: return "UserIntentLocale"sv;
+        case PackageVersionMetadata::NormalizedName: return "NormalizedName"sv;
+        case PackageVersionMetadata::NormalizedPublisher: return "NormalizedPublisher"sv;
         default: return "Unknown"sv;
         }
     }
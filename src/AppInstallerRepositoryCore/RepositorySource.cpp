@@ -79,6 +79,42 @@ namespace AppInstaller::Repository
             return AddOrUpdateFromDetails(details, &ISourceFactory::BackgroundUpdate, progress);
         }
 
+        // Runs a deferred background update on its own thread; the source that deferred it
+        // continues serving its existing data and the next open picks up the updated data.
+        void StartDeferredBackgroundUpdate(SourceDetails details)
+        {
+            std::thread([details = std::move(details)]() mutable
+            {
+                try
+                {
+                    AICLI_LOG(Repo, Info, << "Starting deferred background update for source: " << details.Name);
+
+                    ProgressCallback progress;
+                    if (BackgroundUpdateSourceFromDetails(details, progress))
+                    {
+                        SourceList sourceList;
+                        auto detailsInternal = sourceList.GetSource(details.Name);
+                        if (detailsInternal)
+                        {
+                            detailsInternal->LastUpdateTime = details.LastUpdateTime;
+                            sourceList.SaveMetadata(*detailsInternal);
+                        }
+
+                        AICLI_LOG(Repo, Info, << "Deferred background update completed for source: " << details.Name);
+                    }
+                    else
+                    {
+                        AICLI_LOG(Repo, Warning, << "Deferred background update failed for source: " << details.Name);
+                    }
+                }
+                catch (...)
+                {
+                    LOG_CAUGHT_EXCEPTION();
+                    AICLI_LOG(Repo, Warning, << "Deferred background update failed for source: " << details.Name);
+                }
+            }).detach();
+        }
+
         bool RemoveSourceFromDetails(const SourceDetails& details, IProgressCallback& progress)
         {
             auto factory = ISourceFactory::GetForType(details.Type);
@@ -421,6 +457,30 @@ namespace AppInstaller::Repository
         return ContainsAvailablePackagesInternal(GetDetails().Origin);
     }
 
+    bool Source::ShouldUpdateBeforeOpen() const
+    {
+        if (m_source)
+        {
+            // Already opened.
+            return false;
+        }
+
+        for (const auto& sourceReference : m_sourceReferences)
+        {
+            if (Repository::ShouldUpdateBeforeOpen(sourceReference->GetDetails()))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void Source::SetBackgroundUpdateDeferred(bool deferred)
+    {
+        m_backgroundUpdateDeferred = deferred;
+    }
+
     bool Source::SetCustomHeader(std::optional<std::string> header)
     {
         THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_STATE), m_sourceReferences.size() != 1);
@@ -515,6 +575,7 @@ namespace AppInstaller::Repository
         if (!m_source)
         {
             std::unique_ptr<SourceList> sourceList;
+            std::vector<SourceDetailsInternal> updatedMetadata;
 
             // Check for updates before opening.
             for (auto& sourceReference : m_sourceReferences)
@@ -522,6 +583,15 @@ namespace AppInstaller::Repository
                 auto& details = sourceReference->GetDetails();
                 if (ShouldUpdateBeforeOpen(details))
                 {
+                    if (m_backgroundUpdateDeferred)
+                    {
+                        // Open the existing data immediately; surface the staleness and let the
+                        // update run without blocking this operation.
+                        details.IsStale = true;
+                        StartDeferredBackgroundUpdate(details);
+                        continue;
+                    }
+
                     try
                     {
                         // TODO: Consider adding a context callback to indicate we are doing the same action
@@ -535,7 +605,7 @@ namespace AppInstaller::Repository
 
                             auto detailsInternal = sourceList->GetSource(details.Name);
                             detailsInternal->LastUpdateTime = details.LastUpdateTime;
-                            sourceList->SaveMetadata(*detailsInternal);
+                            updatedMetadata.emplace_back(*detailsInternal);
                         }
                         else
                         {
@@ -552,6 +622,20 @@ namespace AppInstaller::Repository
                 }
             }
 
+            if (!updatedMetadata.empty())
+            {
+                try
+                {
+                    // Batch the metadata updates from this open into a single stream write.
+                    sourceList->SaveMetadata(updatedMetadata);
+                }
+                catch (...)
+                {
+                    LOG_CAUGHT_EXCEPTION();
+                    AICLI_LOG(Repo, Warning, << "Failed to save source metadata; the sources will be updated again next time.");
+                }
+            }
+
             if (m_sourceReferences.size() > 1)
             {
                 AICLI_LOG(Repo, Info, << "Multiple sources available, creating aggregated source.");
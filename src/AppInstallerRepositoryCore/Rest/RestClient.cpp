@@ -10,6 +10,9 @@
 #include "Rest/Schema/InformationResponseDeserializer.h"
 #include "Rest/Schema/CommonRestConstants.h"
 #include "Rest/Schema/RestHelper.h"
+#include <AppInstallerDateTime.h>
+#include <AppInstallerStrings.h>
+#include <winget/Settings.h>
 
 using namespace AppInstaller::Repository::Rest::Schema;
 using namespace AppInstaller::Repository::Rest::Schema::V1_0;
@@ -50,6 +53,116 @@ namespace AppInstaller::Repository::Rest
 
             return headers;
         }
+
+        // Envelope field names for an entry in the information cache.
+        const utility::string_t s_InformationCache_LastUpdate = L"lastUpdate";
+        const utility::string_t s_InformationCache_Information = L"information";
+
+        // How long a cached information response remains valid before the endpoint is probed again.
+        constexpr int64_t s_InformationCacheValidityInSeconds = 24ll * 60 * 60;
+
+        // Calls the information endpoint and returns the raw response.
+        web::json::value GetInformationResponse(
+            const utility::string_t& restApi, const std::unordered_map<utility::string_t, utility::string_t>& additionalHeaders, const HttpClientHelper& clientHelper)
+        {
+            utility::string_t endpoint = RestHelper::AppendPathToUri(restApi, JSON::GetUtilityString(InformationGetEndpoint));
+            std::optional<web::json::value> response = clientHelper.HandleGet(endpoint, additionalHeaders);
+
+            THROW_HR_IF(APPINSTALLER_CLI_ERROR_UNSUPPORTED_RESTSOURCE, !response);
+
+            return std::move(response).value();
+        }
+
+        // Best effort load of the cached information response for the endpoint; any failure
+        // or an entry past its validity window behaves as a cache miss.
+        std::optional<IRestClient::Information> TryGetCachedInformation(const utility::string_t& restEndpoint)
+        {
+            try
+            {
+                auto stream = Settings::Stream{ Settings::Stream::RestSourceInformationCache }.Get();
+                if (!stream)
+                {
+                    return std::nullopt;
+                }
+
+                web::json::value cache = web::json::value::parse(JSON::GetUtilityString(Utility::ReadEntireStream(*stream)));
+                if (!cache.is_object() || !cache.has_object_field(restEndpoint))
+                {
+                    return std::nullopt;
+                }
+
+                const web::json::value& entry = cache.at(restEndpoint);
+                if (!entry.has_integer_field(s_InformationCache_LastUpdate) || !entry.has_field(s_InformationCache_Information))
+                {
+                    return std::nullopt;
+                }
+
+                int64_t age = Utility::GetCurrentUnixEpoch() - entry.at(s_InformationCache_LastUpdate).as_number().to_int64();
+                if (age < 0 || age > s_InformationCacheValidityInSeconds)
+                {
+                    return std::nullopt;
+                }
+
+                InformationResponseDeserializer responseDeserializer;
+                IRestClient::Information information = responseDeserializer.Deserialize(entry.at(s_InformationCache_Information));
+
+                AICLI_LOG(Repo, Info, << "Using cached information response for rest source: " << utility::conversions::to_utf8string(restEndpoint));
+                return information;
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+                return std::nullopt;
+            }
+        }
+
+        // Best effort persistence of the information response for reuse by the next invocation.
+        // Entries past their validity window are dropped so that the cache decays rather than
+        // growing without bound.
+        void TrySaveCachedInformation(const utility::string_t& restEndpoint, const web::json::value& response)
+        {
+            try
+            {
+                Settings::Stream stream{ Settings::Stream::RestSourceInformationCache };
+
+                web::json::value cache = web::json::value::object();
+                auto existing = stream.Get();
+                if (existing)
+                {
+                    web::json::value parsed = web::json::value::parse(JSON::GetUtilityString(Utility::ReadEntireStream(*existing)));
+                    if (parsed.is_object())
+                    {
+                        int64_t now = Utility::GetCurrentUnixEpoch();
+                        for (const auto& pair : parsed.as_object())
+                        {
+                            if (pair.second.has_integer_field(s_InformationCache_LastUpdate))
+                            {
+                                int64_t age = now - pair.second.at(s_InformationCache_LastUpdate).as_number().to_int64();
+                                if (age >= 0 && age <= s_InformationCacheValidityInSeconds)
+                                {
+                                    cache[pair.first] = pair.second;
+                                }
+                            }
+                        }
+                    }
+                }
+
+                web::json::value entry = web::json::value::object();
+                entry[s_InformationCache_LastUpdate] = web::json::value::number(Utility::GetCurrentUnixEpoch());
+                entry[s_InformationCache_Information] = response;
+                cache[restEndpoint] = std::move(entry);
+
+                if (!stream.Set(utility::conversions::to_utf8string(cache.serialize())))
+                {
+                    AICLI_LOG(Repo, Warning, << "Rest source information cache changed concurrently; skipping update");
+                }
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+                AICLI_LOG(Repo, Warning, << "Failed to save rest source information cache entry");
+            }
+        }
     }
 
     RestClient::RestClient(std::unique_ptr<Schema::IRestClient> supportedInterface, std::string sourceIdentifier)
@@ -62,6 +175,11 @@ namespace AppInstaller::Repository::Rest
         return m_interface->GetManifestByVersion(packageId, version, channel);
     }
 
+    std::vector<std::vector<Manifest::Manifest>> RestClient::GetManifests(const std::vector<Schema::IRestClient::ManifestsRequest>& requests) const
+    {
+        return m_interface->GetManifests(requests);
+    }
+
     IRestClient::SearchResult RestClient::Search(const SearchRequest& request) const
     {
         return m_interface->Search(request);
@@ -81,13 +199,10 @@ namespace AppInstaller::Repository::Rest
         const utility::string_t& restApi, const std::unordered_map<utility::string_t, utility::string_t>& additionalHeaders, const HttpClientHelper& clientHelper)
     {
         // Call information endpoint
-        utility::string_t endpoint = RestHelper::AppendPathToUri(restApi, JSON::GetUtilityString(InformationGetEndpoint));
-        std::optional<web::json::value> response = clientHelper.HandleGet(endpoint, additionalHeaders);
-
-        THROW_HR_IF(APPINSTALLER_CLI_ERROR_UNSUPPORTED_RESTSOURCE, !response);
+        web::json::value response = GetInformationResponse(restApi, additionalHeaders, clientHelper);
 
         InformationResponseDeserializer responseDeserializer;
-        IRestClient::Information information = responseDeserializer.Deserialize(response.value());
+        IRestClient::Information information = responseDeserializer.Deserialize(response);
 
         return information;
     }
@@ -151,18 +266,39 @@ namespace AppInstaller::Repository::Rest
         THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_VERSION);
     }
 
-    RestClient RestClient::Create(const std::string& restApi, std::optional<std::string> customHeader, std::string_view caller, const HttpClientHelper& helper)
+    RestClient RestClient::Create(const std::string& restApi, std::optional<std::string> customHeader, std::string_view caller, const HttpClientHelper& helper, bool useInformationCache)
     {
         utility::string_t restEndpoint = RestHelper::GetRestAPIBaseUri(restApi);
         THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_URL, !RestHelper::IsValidUri(restEndpoint));
 
         auto headers = GetHeaders(customHeader, caller);
 
-        IRestClient::Information information = GetInformation(restEndpoint, headers, helper);
-        std::optional<Version> latestCommonVersion = GetLatestCommonVersion(information.ServerSupportedVersions, WingetSupportedContracts);
+        // A custom header can influence the information response, so only the plain probe is cached.
+        bool cacheUsable = useInformationCache && !customHeader;
+
+        std::optional<IRestClient::Information> information;
+        if (cacheUsable)
+        {
+            information = TryGetCachedInformation(restEndpoint);
+        }
+
+        if (!information)
+        {
+            web::json::value response = GetInformationResponse(restEndpoint, headers, helper);
+
+            InformationResponseDeserializer responseDeserializer;
+            information = responseDeserializer.Deserialize(response);
+
+            if (cacheUsable)
+            {
+                TrySaveCachedInformation(restEndpoint, response);
+            }
+        }
+
+        std::optional<Version> latestCommonVersion = GetLatestCommonVersion(information->ServerSupportedVersions, WingetSupportedContracts);
         THROW_HR_IF(APPINSTALLER_CLI_ERROR_UNSUPPORTED_RESTSOURCE, !latestCommonVersion);
 
-        std::unique_ptr<Schema::IRestClient> supportedInterface = GetSupportedInterface(utility::conversions::to_utf8string(restEndpoint), headers, information, latestCommonVersion.value());
-        return RestClient{ std::move(supportedInterface), information.SourceIdentifier };
+        std::unique_ptr<Schema::IRestClient> supportedInterface = GetSupportedInterface(utility::conversions::to_utf8string(restEndpoint), headers, information.value(), latestCommonVersion.value());
+        return RestClient{ std::move(supportedInterface), information->SourceIdentifier };
     }
 }
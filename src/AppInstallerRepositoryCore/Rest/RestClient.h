@@ -23,6 +23,9 @@ namespace AppInstaller::Repository::Rest
 
         std::optional<Manifest::Manifest> GetManifestByVersion(const std::string& packageId, const std::string& version, const std::string& channel) const;
 
+        // Gets the manifests for many packages with bounded request parallelism.
+        std::vector<std::vector<Manifest::Manifest>> GetManifests(const std::vector<Schema::IRestClient::ManifestsRequest>& requests) const;
+
         std::string GetSourceIdentifier() const;
 
         Schema::IRestClient::Information GetSourceInformation() const;
@@ -33,7 +36,10 @@ namespace AppInstaller::Repository::Rest
 
         static std::unique_ptr<Schema::IRestClient> GetSupportedInterface(const std::string& restApi, const std::unordered_map<utility::string_t, utility::string_t>& additionalHeaders, const Schema::IRestClient::Information& information, const AppInstaller::Utility::Version& version);
 
-        static RestClient Create(const std::string& restApi, std::optional<std::string> customHeader, std::string_view caller, const Schema::HttpClientHelper& helper = {});
+        // Creates a rest client for the given api endpoint.
+        // When useInformationCache is set and no custom header is in play, a recent information
+        // response persisted by a previous invocation is used instead of probing the endpoint.
+        static RestClient Create(const std::string& restApi, std::optional<std::string> customHeader, std::string_view caller, const Schema::HttpClientHelper& helper = {}, bool useInformationCache = false);
     private:
         RestClient(std::unique_ptr<Schema::IRestClient> supportedInterface, std::string sourceIdentifier);
 
@@ -23,6 +23,7 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
         IRestClient::SearchResult Search(const SearchRequest& request) const override;
         std::optional<Manifest::Manifest> GetManifestByVersion(const std::string& packageId, const std::string& version, const std::string& channel) const override;
         std::vector<Manifest::Manifest> GetManifests(const std::string& packageId, const std::map<std::string_view, std::string>& params = {}) const override;
+        std::vector<std::vector<Manifest::Manifest>> GetManifests(const std::vector<ManifestsRequest>& requests) const override;
 
     protected:
         bool MeetsOptimizedSearchCriteria(const SearchRequest& request) const;
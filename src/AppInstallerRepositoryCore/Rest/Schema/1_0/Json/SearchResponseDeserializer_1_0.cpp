@@ -11,15 +11,15 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
 {
     namespace
     {
-        // Search response constants
-        constexpr std::string_view PackageIdentifier = "PackageIdentifier"sv;
-        constexpr std::string_view PackageName = "PackageName"sv;
-        constexpr std::string_view Publisher = "Publisher"sv;
-        constexpr std::string_view PackageFamilyNames = "PackageFamilyNames"sv;
-        constexpr std::string_view ProductCodes = "ProductCodes"sv;
-        constexpr std::string_view Versions = "Versions"sv;
-        constexpr std::string_view PackageVersion = "PackageVersion"sv;
-        constexpr std::string_view Channel = "Channel"sv;
+        // Search response constants; converted to the json key type once rather than per node.
+        const utility::string_t PackageIdentifier = L"PackageIdentifier";
+        const utility::string_t PackageName = L"PackageName";
+        const utility::string_t Publisher = L"Publisher";
+        const utility::string_t PackageFamilyNames = L"PackageFamilyNames";
+        const utility::string_t ProductCodes = L"ProductCodes";
+        const utility::string_t Versions = L"Versions";
+        const utility::string_t PackageVersion = L"PackageVersion";
+        const utility::string_t Channel = L"Channel";
     }
 
     IRestClient::SearchResult SearchResponseDeserializer::Deserialize(const web::json::value& searchResponseObject) const
@@ -28,7 +28,7 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
 
         THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA, !response);
 
-        return response.value();
+        return std::move(response.value());
     }
 
     std::optional<IRestClient::SearchResult> SearchResponseDeserializer::DeserializeSearchResult(const web::json::value& searchResponseObject) const
@@ -52,9 +52,9 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
 
             for (auto& manifestItem : dataArray.value().get())
             {
-                std::optional<std::string> packageId = JSON::GetRawStringValueFromJsonNode(manifestItem, JSON::GetUtilityString(PackageIdentifier));
-                std::optional<std::string> packageName = JSON::GetRawStringValueFromJsonNode(manifestItem, JSON::GetUtilityString(PackageName));
-                std::optional<std::string> publisher = JSON::GetRawStringValueFromJsonNode(manifestItem, JSON::GetUtilityString(Publisher));
+                std::optional<std::string> packageId = JSON::GetRawStringValueFromJsonNode(manifestItem, PackageIdentifier);
+                std::optional<std::string> packageName = JSON::GetRawStringValueFromJsonNode(manifestItem, PackageName);
+                std::optional<std::string> publisher = JSON::GetRawStringValueFromJsonNode(manifestItem, Publisher);
 
                 if (!JSON::IsValidNonEmptyStringValue(packageId) || !JSON::IsValidNonEmptyStringValue(packageName) || !JSON::IsValidNonEmptyStringValue(publisher))
                 {
@@ -62,7 +62,7 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
                     return {};
                 }
 
-                std::optional<std::reference_wrapper<const web::json::array>> versionValue = JSON::GetRawJsonArrayFromJsonNode(manifestItem, JSON::GetUtilityString(Versions));
+                std::optional<std::reference_wrapper<const web::json::array>> versionValue = JSON::GetRawJsonArrayFromJsonNode(manifestItem, Versions);
                 std::vector<IRestClient::VersionInfo> versionList;
 
                 if (versionValue)
@@ -92,7 +92,7 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
                 result.Matches.emplace_back(std::move(package));
             }
 
-            return result;
+            return std::move(result);
         }
         catch (const std::exception& e)
         {
@@ -108,16 +108,16 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
 
     std::optional<IRestClient::VersionInfo> SearchResponseDeserializer::DeserializeVersionInfo(const web::json::value& versionInfoJsonObject) const
     {
-        std::optional<std::string> version = JSON::GetRawStringValueFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(PackageVersion));
+        std::optional<std::string> version = JSON::GetRawStringValueFromJsonNode(versionInfoJsonObject, PackageVersion);
         if (!JSON::IsValidNonEmptyStringValue(version))
         {
             AICLI_LOG(Repo, Error, << "Received incomplete package version");
             return {};
         }
 
-        std::string channel = JSON::GetRawStringValueFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(Channel)).value_or("");
-        std::vector<std::string> packageFamilyNames = RestHelper::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(PackageFamilyNames)));
-        std::vector<std::string> productCodes = RestHelper::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(ProductCodes)));
+        std::string channel = JSON::GetRawStringValueFromJsonNode(versionInfoJsonObject, Channel).value_or("");
+        std::vector<std::string> packageFamilyNames = RestHelper::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, PackageFamilyNames));
+        std::vector<std::string> productCodes = RestHelper::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, ProductCodes));
 
         return IRestClient::VersionInfo{
             AppInstaller::Utility::VersionAndChannel{std::move(version.value()), std::move(channel)},
@@ -11,6 +11,9 @@
 #include "winget/ManifestJSONParser.h"
 #include "Rest/Schema/SearchResponseParser.h"
 #include "Rest/Schema/SearchRequestComposer.h"
+#include <winget/SharedThreadGlobals.h>
+
+#include <future>
 
 using namespace std::string_view_literals;
 
@@ -72,42 +75,60 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
     IRestClient::SearchResult Interface::SearchInternal(const SearchRequest& request) const
     {
         SearchResult results;
-        utility::string_t continuationToken;
         std::unordered_map<utility::string_t, utility::string_t> searchHeaders = m_requiredRestApiHeaders;
-        do
+        web::json::value searchBody = GetValidatedSearchBody(request);
+
+        std::optional<web::json::value> jsonObject = m_httpClientHelper.HandlePost(m_searchEndpoint, searchBody, searchHeaders);
+
+        while (jsonObject)
         {
-            if (!continuationToken.empty())
+            utility::string_t continuationToken = RestHelper::GetContinuationToken(jsonObject.value()).value_or(L"");
+
+            // Begin retrieving the next page while the current one is parsed and inserted,
+            // unless the result limit has already been reached. The page being parsed may
+            // itself satisfy the limit, in which case the lookahead is discarded.
+            std::future<std::optional<web::json::value>> lookahead;
+            if (!continuationToken.empty() && (!request.MaximumResults || results.Matches.size() < request.MaximumResults))
             {
                 AICLI_LOG(Repo, Verbose, << "Received continuation token. Retrieving more results.");
                 searchHeaders.insert_or_assign(AppInstaller::JSON::GetUtilityString(ContinuationToken), continuationToken);
+
+                ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+                lookahead = std::async(std::launch::async, [this, callerGlobals, &searchBody, headers = searchHeaders]()
+                    {
+                        std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                        if (callerGlobals)
+                        {
+                            previousGlobals = callerGlobals->SetForCurrentThread();
+                        }
+
+                        return m_httpClientHelper.HandlePost(m_searchEndpoint, searchBody, headers);
+                    });
             }
 
-            std::optional<web::json::value> jsonObject = m_httpClientHelper.HandlePost(m_searchEndpoint, GetValidatedSearchBody(request), searchHeaders);
+            SearchResult currentResult = GetSearchResult(jsonObject.value());
 
-            utility::string_t ct;
-            if (jsonObject)
+            size_t insertElements = !request.MaximumResults ? currentResult.Matches.size() :
+                std::min(currentResult.Matches.size(), request.MaximumResults - results.Matches.size());
+
+            if (insertElements < currentResult.Matches.size())
             {
-                SearchResult currentResult = GetSearchResult(jsonObject.value());
+                results.Truncated = true;
+            }
 
-                size_t insertElements = !request.MaximumResults ? currentResult.Matches.size() :
-                    std::min(currentResult.Matches.size(), request.MaximumResults - results.Matches.size());
+            std::move(currentResult.Matches.begin(), std::next(currentResult.Matches.begin(), insertElements), std::inserter(results.Matches, results.Matches.end()));
 
-                if (insertElements < currentResult.Matches.size())
+            if (!lookahead.valid() || (request.MaximumResults && results.Matches.size() >= request.MaximumResults))
+            {
+                if (!continuationToken.empty())
                 {
                     results.Truncated = true;
                 }
 
-                std::move(currentResult.Matches.begin(), std::next(currentResult.Matches.begin(), insertElements), std::inserter(results.Matches, results.Matches.end()));
-                ct = RestHelper::GetContinuationToken(jsonObject.value()).value_or(L"");
+                break;
             }
 
-            continuationToken = ct;
-
-        } while (!continuationToken.empty() && (!request.MaximumResults || results.Matches.size() < request.MaximumResults));
-
-        if (!continuationToken.empty())
-        {
-            results.Truncated = true;
+            jsonObject = lookahead.get();
         }
 
         if (results.Matches.empty())
@@ -244,6 +265,60 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
         return results;
     }
 
+    std::vector<std::vector<Manifest::Manifest>> Interface::GetManifests(const std::vector<ManifestsRequest>& requests) const
+    {
+        std::vector<std::vector<Manifest::Manifest>> results(requests.size());
+
+        if (requests.empty())
+        {
+            return results;
+        }
+
+        // Bound the number of overlapped requests so a large batch does not flood the
+        // source; the pooled client multiplexes them over shared connections.
+        constexpr size_t maximumConcurrentRequests = 4;
+
+        ThreadLocalStorage::ThreadGlobals* callerGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+        auto getSingle = [&](size_t index)
+        {
+            std::unique_ptr<ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+            if (callerGlobals)
+            {
+                previousGlobals = callerGlobals->SetForCurrentThread();
+            }
+
+            results[index] = GetManifests(requests[index].PackageId, requests[index].Params);
+        };
+
+        for (size_t begin = 0; begin < requests.size(); begin += maximumConcurrentRequests)
+        {
+            size_t end = std::min(begin + maximumConcurrentRequests, requests.size());
+
+            if (end - begin == 1)
+            {
+                results[begin] = GetManifests(requests[begin].PackageId, requests[begin].Params);
+                continue;
+            }
+
+            std::vector<std::future<void>> futures;
+            futures.reserve(end - begin);
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                futures.emplace_back(std::async(std::launch::async, getSingle, i));
+            }
+
+            // get() propagates the first failure in request order.
+            for (std::future<void>& future : futures)
+            {
+                future.get();
+            }
+        }
+
+        return results;
+    }
+
     std::map<std::string_view, std::string> Interface::GetValidatedQueryParams(const std::map<std::string_view, std::string>& params) const
     {
         return params;
@@ -9,9 +9,9 @@ namespace AppInstaller::Repository::Rest::Schema::V1_4::Json
 {
     namespace
     {
-        // Search response constants
-        constexpr std::string_view UpgradeCodes = "UpgradeCodes"sv;
-        constexpr std::string_view AppsAndFeaturesEntryVersions = "AppsAndFeaturesEntryVersions"sv;
+        // Search response constants; converted to the json key type once rather than per node.
+        const utility::string_t UpgradeCodes = L"UpgradeCodes";
+        const utility::string_t AppsAndFeaturesEntryVersions = L"AppsAndFeaturesEntryVersions";
     }
 
     std::optional<IRestClient::VersionInfo> SearchResponseDeserializer::DeserializeVersionInfo(const web::json::value& versionInfoJsonObject) const
@@ -19,8 +19,8 @@ namespace AppInstaller::Repository::Rest::Schema::V1_4::Json
         auto result = V1_0::Json::SearchResponseDeserializer::DeserializeVersionInfo(versionInfoJsonObject);
         if (result.has_value())
         {
-            result->UpgradeCodes = RestHelper::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(UpgradeCodes)));
-            auto arpVersions = RestHelper::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(AppsAndFeaturesEntryVersions)));
+            result->UpgradeCodes = RestHelper::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, UpgradeCodes));
+            auto arpVersions = RestHelper::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, AppsAndFeaturesEntryVersions));
             for (auto const& version : arpVersions)
             {
                 result->ArpVersions.emplace_back(Utility::Version{ version });
@@ -3,10 +3,102 @@
 #include "pch.h"
 #include "HttpClientHelper.h"
 
+#include <iterator>
+
+using namespace std::string_view_literals;
+
 namespace AppInstaller::Repository::Rest::Schema
 {
     namespace
     {
+        constexpr std::string_view s_RestResponseCacheDirectory = "restCache"sv;
+
+        // Envelope field names for the cached response file.
+        const utility::string_t s_CacheField_ETag = L"eTag";
+        const utility::string_t s_CacheField_LastModified = L"lastModified";
+        const utility::string_t s_CacheField_Response = L"response";
+
+        // A previously stored response and the validators needed to revalidate it.
+        struct CachedResponse
+        {
+            utility::string_t ETag;
+            utility::string_t LastModified;
+            web::json::value Response;
+        };
+
+        // Gets the cache file path for the given request identity.
+        std::filesystem::path GetCacheFilePath(const std::string& cacheIdentity)
+        {
+            return Runtime::GetPathTo(Runtime::PathName::LocalState) / s_RestResponseCacheDirectory /
+                (Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(cacheIdentity)) + ".json");
+        }
+
+        // Best effort load of a cached response; any failure behaves as a cache miss.
+        std::optional<CachedResponse> TryLoadCachedResponse(const std::filesystem::path& cachePath)
+        {
+            try
+            {
+                if (cachePath.empty() || !std::filesystem::exists(cachePath))
+                {
+                    return std::nullopt;
+                }
+
+                std::ifstream stream{ cachePath, std::ios_base::binary };
+                std::string contents{ std::istreambuf_iterator<char>{ stream }, std::istreambuf_iterator<char>{} };
+
+                web::json::value envelope = web::json::value::parse(utility::conversions::to_string_t(contents));
+                if (!envelope.is_object() || !envelope.has_field(s_CacheField_Response))
+                {
+                    return std::nullopt;
+                }
+
+                CachedResponse result;
+                if (envelope.has_string_field(s_CacheField_ETag))
+                {
+                    result.ETag = envelope.at(s_CacheField_ETag).as_string();
+                }
+                if (envelope.has_string_field(s_CacheField_LastModified))
+                {
+                    result.LastModified = envelope.at(s_CacheField_LastModified).as_string();
+                }
+                result.Response = envelope.at(s_CacheField_Response);
+
+                return result;
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+                return std::nullopt;
+            }
+        }
+
+        // Best effort persistence of a validated response for reuse by the next invocation.
+        void TrySaveCachedResponse(const std::filesystem::path& cachePath, const utility::string_t& eTag, const utility::string_t& lastModified, const web::json::value& response)
+        {
+            try
+            {
+                if (cachePath.empty())
+                {
+                    return;
+                }
+
+                std::filesystem::create_directories(cachePath.parent_path());
+
+                web::json::value envelope = web::json::value::object();
+                envelope[s_CacheField_ETag] = web::json::value::string(eTag);
+                envelope[s_CacheField_LastModified] = web::json::value::string(lastModified);
+                envelope[s_CacheField_Response] = response;
+
+                std::ofstream stream{ cachePath, std::ios_base::binary | std::ios_base::trunc };
+                stream << utility::conversions::to_utf8string(envelope.serialize());
+            }
+            catch (...)
+            {
+                LOG_CAUGHT_EXCEPTION();
+                AICLI_LOG(Repo, Warning, << "Failed to save rest response cache entry");
+            }
+        }
+
         // If the caller does not pass in a user agent header, put the default one on the request.
         void EnsureDefaultUserAgent(web::http::http_request& request)
         {
@@ -31,14 +123,25 @@ namespace AppInstaller::Repository::Rest::Schema
         }
     }
 
-    HttpClientHelper::HttpClientHelper(std::shared_ptr<web::http::http_pipeline_stage> stage) : m_defaultRequestHandlerStage(std::move(stage)) {}
+    HttpClientHelper::HttpClientHelper(std::shared_ptr<web::http::http_pipeline_stage> stage) : m_defaultRequestHandlerStage(std::move(stage))
+    {
+        // Best effort opt-in to HTTP/2 so that concurrent requests to the same source can
+        // multiplex over one connection; servers without support negotiate down to 1.1.
+        m_clientConfig.set_nativehandle_options([](web::http::client::native_handle handle)
+            {
+                DWORD protocols = WINHTTP_PROTOCOL_FLAG_HTTP2;
+                LOG_IF_WIN32_BOOL_FALSE(WinHttpSetOption(reinterpret_cast<HINTERNET>(handle), WINHTTP_OPTION_ENABLE_HTTP_PROTOCOL, &protocols, sizeof(protocols)));
+            });
+    }
 
     pplx::task<web::http::http_response> HttpClientHelper::Post(
         const utility::string_t& uri, const web::json::value& body, const std::unordered_map<utility::string_t, utility::string_t>& headers) const
     {
         AICLI_LOG(Repo, Info, << "Sending http POST request to: " << utility::conversions::to_utf8string(uri));
-        web::http::client::http_client client = GetClient(uri);
+        web::uri fullUri{ uri };
+        web::http::client::http_client client = GetClient(fullUri);
         web::http::http_request request{ web::http::methods::POST };
+        request.set_request_uri(fullUri.resource());
         request.headers().set_content_type(web::http::details::mime_types::application_json);
         request.set_body(body.serialize());
 
@@ -57,21 +160,22 @@ namespace AppInstaller::Repository::Rest::Schema
     std::optional<web::json::value> HttpClientHelper::HandlePost(
         const utility::string_t& uri, const web::json::value& body, const std::unordered_map<utility::string_t, utility::string_t>& headers) const
     {
-        web::http::http_response httpResponse;
-        HttpClientHelper::Post(uri, body, headers).then([&httpResponse](const web::http::http_response& response)
-            {
-                httpResponse = response;
-            }).wait();
+        std::string cacheIdentity = "POST|" + utility::conversions::to_utf8string(uri) + '|' + utility::conversions::to_utf8string(body.serialize());
 
-        return ValidateAndExtractResponse(httpResponse);
+        return SendWithCache(cacheIdentity, headers, [&](const std::unordered_map<utility::string_t, utility::string_t>& requestHeaders)
+            {
+                return Post(uri, body, requestHeaders);
+            });
     }
 
     pplx::task<web::http::http_response> HttpClientHelper::Get(
         const utility::string_t& uri, const std::unordered_map<utility::string_t, utility::string_t>& headers) const
     {
         AICLI_LOG(Repo, Info, << "Sending http GET request to: " << utility::conversions::to_utf8string(uri));
-        web::http::client::http_client client = GetClient(uri);
+        web::uri fullUri{ uri };
+        web::http::client::http_client client = GetClient(fullUri);
         web::http::http_request request{ web::http::methods::GET };
+        request.set_request_uri(fullUri.resource());
         request.headers().set_content_type(web::http::details::mime_types::application_json);
 
         // Add headers
@@ -89,13 +193,87 @@ namespace AppInstaller::Repository::Rest::Schema
     std::optional<web::json::value> HttpClientHelper::HandleGet(
         const utility::string_t& uri, const std::unordered_map<utility::string_t, utility::string_t>& headers) const
     {
+        std::string cacheIdentity = "GET|" + utility::conversions::to_utf8string(uri);
+
+        return SendWithCache(cacheIdentity, headers, [&](const std::unordered_map<utility::string_t, utility::string_t>& requestHeaders)
+            {
+                return Get(uri, requestHeaders);
+            });
+    }
+
+    std::optional<web::json::value> HttpClientHelper::SendWithCache(
+        const std::string& cacheIdentity,
+        const std::unordered_map<utility::string_t, utility::string_t>& headers,
+        const std::function<pplx::task<web::http::http_response>(const std::unordered_map<utility::string_t, utility::string_t>&)>& send) const
+    {
+        // The contract headers are part of the request identity.
+        std::string fullIdentity = cacheIdentity;
+        {
+            std::map<utility::string_t, utility::string_t> orderedHeaders{ headers.begin(), headers.end() };
+            for (const auto& pair : orderedHeaders)
+            {
+                fullIdentity += '|';
+                fullIdentity += utility::conversions::to_utf8string(pair.first);
+                fullIdentity += ':';
+                fullIdentity += utility::conversions::to_utf8string(pair.second);
+            }
+        }
+
+        std::filesystem::path cachePath;
+        std::optional<CachedResponse> cached;
+
+        try
+        {
+            cachePath = GetCacheFilePath(fullIdentity);
+            cached = TryLoadCachedResponse(cachePath);
+        }
+        catch (...)
+        {
+            LOG_CAUGHT_EXCEPTION();
+        }
+
+        std::unordered_map<utility::string_t, utility::string_t> requestHeaders = headers;
+        if (cached)
+        {
+            if (!cached->ETag.empty())
+            {
+                requestHeaders.emplace(web::http::header_names::if_none_match, cached->ETag);
+            }
+            if (!cached->LastModified.empty())
+            {
+                requestHeaders.emplace(web::http::header_names::if_modified_since, cached->LastModified);
+            }
+        }
+
         web::http::http_response httpResponse;
-        Get(uri, headers).then([&httpResponse](const web::http::http_response& response)
+        send(requestHeaders).then([&httpResponse](const web::http::http_response& response)
             {
                 httpResponse = response;
             }).wait();
 
-        return ValidateAndExtractResponse(httpResponse);
+        if (cached && httpResponse.status_code() == web::http::status_codes::NotModified)
+        {
+            AICLI_LOG(Repo, Info, << "Server validated cached response; serving from disk");
+            return std::move(cached->Response);
+        }
+
+        std::optional<web::json::value> result = ValidateAndExtractResponse(httpResponse);
+
+        if (result && httpResponse.status_code() == web::http::status_codes::OK)
+        {
+            utility::string_t eTag;
+            utility::string_t lastModified;
+            httpResponse.headers().match(web::http::header_names::etag, eTag);
+            httpResponse.headers().match(web::http::header_names::last_modified, lastModified);
+
+            // Only responses the server can later revalidate are worth storing.
+            if (!eTag.empty() || !lastModified.empty())
+            {
+                TrySaveCachedResponse(cachePath, eTag, lastModified, result.value());
+            }
+        }
+
+        return result;
     }
 
     void HttpClientHelper::SetPinningConfiguration(const Certificates::PinningConfiguration& configuration)
@@ -104,11 +282,25 @@ namespace AppInstaller::Repository::Rest::Schema
             {
                 NativeHandleServerCertificateValidation(handle, pinConfig);
             });
+
+        // Pooled clients captured the previous configuration; start a new pool so the
+        // pinning applies to all subsequent requests.
+        m_clientPool = std::make_shared<ClientPool>();
     }
 
-    web::http::client::http_client HttpClientHelper::GetClient(const utility::string_t& uri) const
+    web::http::client::http_client HttpClientHelper::GetClient(const web::uri& uri) const
     {
-        web::http::client::http_client client{ uri, m_clientConfig };
+        utility::string_t authority = uri.authority().to_string();
+
+        std::lock_guard<std::mutex> lock{ m_clientPool->Lock };
+
+        auto itr = m_clientPool->Clients.find(authority);
+        if (itr != m_clientPool->Clients.end())
+        {
+            return itr->second;
+        }
+
+        web::http::client::http_client client{ web::uri{ authority }, m_clientConfig };
 
         // Add default custom handlers if any.
         if (m_defaultRequestHandlerStage)
@@ -116,7 +308,7 @@ namespace AppInstaller::Repository::Rest::Schema
             client.add_handler(m_defaultRequestHandlerStage);
         }
 
-        return client;
+        return m_clientPool->Clients.emplace(std::move(authority), std::move(client)).first->second;
     }
 
     std::optional<web::json::value> HttpClientHelper::ValidateAndExtractResponse(const web::http::http_response& response) const
@@ -6,6 +6,10 @@
 #include <cpprest/http_client.h>
 #include <cpprest/json.h>
 
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <vector>
 
@@ -25,14 +29,33 @@ namespace AppInstaller::Repository::Rest::Schema
 
         void SetPinningConfiguration(const Certificates::PinningConfiguration& configuration);
     protected:
+        // Sends the request with conditional headers when a cached response exists for the
+        // identity, serving the cached body on 304 Not Modified and storing validated 200
+        // responses that carry ETag or Last-Modified for the next invocation.
+        std::optional<web::json::value> SendWithCache(
+            const std::string& cacheIdentity,
+            const std::unordered_map<utility::string_t, utility::string_t>& headers,
+            const std::function<pplx::task<web::http::http_response>(const std::unordered_map<utility::string_t, utility::string_t>&)>& send) const;
+
         std::optional<web::json::value> ValidateAndExtractResponse(const web::http::http_response& response) const;
 
         std::optional<web::json::value> ExtractJsonResponse(const web::http::http_response& response) const;
 
     private:
-        web::http::client::http_client GetClient(const utility::string_t& uri) const;
+        // Gets a client for the given request uri.
+        // Clients are pooled by scheme and authority so that repeated requests to the
+        // same source reuse connections (and HTTP/2 streams) instead of renegotiating
+        // TLS per call. Copies of a helper share the same pool.
+        web::http::client::http_client GetClient(const web::uri& uri) const;
+
+        struct ClientPool
+        {
+            std::mutex Lock;
+            std::map<utility::string_t, web::http::client::http_client> Clients;
+        };
 
         std::shared_ptr<web::http::http_pipeline_stage> m_defaultRequestHandlerStage;
         web::http::client::http_client_config m_clientConfig;
+        std::shared_ptr<ClientPool> m_clientPool = std::make_shared<ClientPool>();
     };
 }
@@ -93,5 +93,16 @@ namespace AppInstaller::Repository::Rest::Schema
     
     // Gets the manifests for given query parameters
     virtual std::vector<Manifest::Manifest> GetManifests(const std::string& packageId, const std::map<std::string_view, std::string>& params = {}) const = 0;
+
+    // A request for one package's manifests within a batched retrieval.
+    struct ManifestsRequest
+    {
+        std::string PackageId;
+        std::map<std::string_view, std::string> Params;
+    };
+
+    // Gets the manifests for many packages, overlapping the underlying requests with
+    // bounded parallelism. Results are in the same order as the requests.
+    virtual std::vector<std::vector<Manifest::Manifest>> GetManifests(const std::vector<ManifestsRequest>& requests) const = 0;
     };
 }
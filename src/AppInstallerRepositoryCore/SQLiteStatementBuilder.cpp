@@ -386,6 +386,12 @@ namespace AppInstaller::Repository::SQLite::Builder
         return *this;
     }
 
+    StatementBuilder& StatementBuilder::Union()
+    {
+        m_stream << " UNION";
+        return *this;
+    }
+
     StatementBuilder& StatementBuilder::In(size_t count)
     {
         m_stream << " IN (";
@@ -746,6 +752,24 @@ namespace AppInstaller::Repository::SQLite::Builder
         return *this;
     }
 
+    StatementBuilder& StatementBuilder::DropIndexIfExists(std::string_view index)
+    {
+        OutputOperationAndTable(m_stream, "DROP INDEX IF EXISTS", index);
+        return *this;
+    }
+
+    StatementBuilder& StatementBuilder::DropIndexIfExists(QualifiedTable index)
+    {
+        OutputOperationAndTable(m_stream, "DROP INDEX IF EXISTS", index);
+        return *this;
+    }
+
+    StatementBuilder& StatementBuilder::DropIndexIfExists(std::initializer_list<std::string_view> index)
+    {
+        OutputOperationAndTable(m_stream, "DROP INDEX IF EXISTS", index);
+        return *this;
+    }
+
     StatementBuilder& StatementBuilder::On(std::string_view table)
     {
         OutputOperationAndTable(m_stream, " ON", table);
@@ -840,6 +864,21 @@ namespace AppInstaller::Repository::SQLite::Builder
         Prepare(connection).Execute();
     }
 
+    CachedStatement StatementBuilder::PrepareCached(const Connection& connection)
+    {
+        CachedStatement result = connection.GetCachedStatement(m_stream.str());
+        for (const auto& f : m_binders)
+        {
+            f(result);
+        }
+        return result;
+    }
+
+    void StatementBuilder::ExecuteCached(const Connection& connection)
+    {
+        PrepareCached(connection).Execute();
+    }
+
     int StatementBuilder::AppendOpAndBinder(Op op)
     {
         switch (op)
@@ -258,10 +258,13 @@ namespace AppInstaller::Repository::SQLite::Builder
 
         StatementBuilder& Not();
         StatementBuilder& In();
-        
+
         //Appends a set of value binders for the In clause.
         StatementBuilder& In(size_t count);
 
+        // Combines select statements into a compound select; duplicate rows are removed.
+        StatementBuilder& Union();
+
         // IsNull(true) means the value is null; IsNull(false) means the value is not null.
         StatementBuilder& IsNull(bool isNull = true);
         StatementBuilder& IsNotNull() { return IsNull(false); }
@@ -378,6 +381,12 @@ namespace AppInstaller::Repository::SQLite::Builder
         StatementBuilder& DropIndex(QualifiedTable index);
         StatementBuilder& DropIndex(std::initializer_list<std::string_view> index);
 
+        // Begin an index deletion statement that tolerates the index not existing.
+        // The initializer_list form enables the table name to be constructed from multiple parts.
+        StatementBuilder& DropIndexIfExists(std::string_view index);
+        StatementBuilder& DropIndexIfExists(QualifiedTable index);
+        StatementBuilder& DropIndexIfExists(std::initializer_list<std::string_view> index);
+
         // Set index target table.
         StatementBuilder& On(std::string_view table);
         StatementBuilder& On(std::initializer_list<std::string_view> table);
@@ -417,6 +426,14 @@ namespace AppInstaller::Repository::SQLite::Builder
         // A convenience function that prepares, binds, and then executes a statement that does not return rows.
         void Execute(const Connection& connection);
 
+        // Prepares the statement through the connection's prepared statement cache, applying any
+        // bindings that were requested. Use for statements whose shape is executed repeatedly.
+        CachedStatement PrepareCached(const Connection& connection);
+
+        // A convenience function that prepares through the statement cache, binds, and then
+        // executes a statement that does not return rows.
+        void ExecuteCached(const Connection& connection);
+
     private:
         enum class Op
         {
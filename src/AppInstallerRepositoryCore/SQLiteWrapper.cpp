@@ -11,9 +11,7 @@ using namespace std::string_view_literals;
 // Enable this to have all Statement constructions output the associated query plan.
 #define WINGET_SQLITE_EXPLAIN_QUERY_PLAN_ENABLED 0
 
-#if WINGET_SQLITE_EXPLAIN_QUERY_PLAN_ENABLED
 #include <stack>
-#endif
 
 #define THROW_SQLITE(_error_,_connection_) \
     do { \
@@ -48,6 +46,64 @@ namespace AppInstaller::Repository::SQLite
             static std::atomic_size_t statementId(0);
             return ++statementId;
         }
+
+        std::atomic_bool s_statementInstrumentationEnabled{ false };
+        std::atomic<int64_t> s_slowQueryThresholdMs{ 0 };
+
+        // Logs the EXPLAIN QUERY PLAN output for the given SQL on the given connection.
+        // Best effort; instrumentation never fails the statement being instrumented.
+        void LogQueryPlan(sqlite3* connection, const char* sql)
+        {
+            std::string explainSQL = "EXPLAIN QUERY PLAN ";
+            explainSQL.append(sql);
+
+            sqlite3_stmt* plan = nullptr;
+            if (sqlite3_prepare_v2(connection, explainSQL.c_str(), static_cast<int>(explainSQL.size() + 1), &plan, nullptr) != SQLITE_OK)
+            {
+                return;
+            }
+            auto finalizePlan = wil::scope_exit([&]() { sqlite3_finalize(plan); });
+
+            std::stack<int> parents;
+            while (sqlite3_step(plan) == SQLITE_ROW)
+            {
+                int id = sqlite3_column_int(plan, 0);
+                int parent = sqlite3_column_int(plan, 1);
+
+                while (!parents.empty() && parents.top() != parent)
+                {
+                    parents.pop();
+                }
+
+                const unsigned char* detail = sqlite3_column_text(plan, 3);
+                AICLI_LOG(SQL, Info, << "|-" << std::string(parents.size() * 2, '-') << ' ' << (detail ? reinterpret_cast<const char*>(detail) : ""));
+
+                parents.push(id);
+            }
+        }
+
+        // Logs the summary for a completed instrumented statement, including a slow query
+        // report with the query plan when the statement ran at or above the threshold.
+        void ReportStatementCompletion(sqlite3_stmt* stmt, size_t connectionId, size_t id, int64_t rowCount, std::chrono::nanoseconds elapsed)
+        {
+            auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+            AICLI_LOG(SQL, Info, << "Statement #" << connectionId << '-' << id << " completed: " << rowCount << " rows in " << elapsedMs << " ms");
+
+            if (elapsedMs >= s_slowQueryThresholdMs.load(std::memory_order_relaxed))
+            {
+                try
+                {
+                    const char* sql = sqlite3_sql(stmt);
+                    AICLI_LOG(SQL, Warning, << "Slow query [" << elapsedMs << " ms, " << rowCount << " rows]: " << (sql ? sql : "<unavailable>"));
+
+                    if (sql)
+                    {
+                        LogQueryPlan(sqlite3_db_handle(stmt), sql);
+                    }
+                }
+                catch (...) {}
+            }
+        }
     }
 
     namespace details
@@ -152,8 +208,14 @@ namespace AppInstaller::Repository::SQLite
         // Always force connection serialization until we determine that there are situations where it is not needed
         int resultingFlags = static_cast<int>(disposition) | static_cast<int>(flags) | SQLITE_OPEN_FULLMUTEX;
         THROW_IF_SQLITE_FAILED(sqlite3_open_v2(target.c_str(), &m_dbconn, resultingFlags, nullptr), nullptr);
+        m_statementCache = std::make_unique<details::StatementCacheState>();
+        m_valueIdCache = std::make_unique<details::ValueIdCacheState>();
     }
 
+    Connection::Connection(Connection&& other) noexcept = default;
+    Connection& Connection::operator=(Connection&& other) noexcept = default;
+    Connection::~Connection() = default;
+
     Connection Connection::Create(const std::string& target, OpenDisposition disposition, OpenFlags flags)
     {
         Connection result{ target, disposition, flags };
@@ -169,6 +231,101 @@ namespace AppInstaller::Repository::SQLite
         THROW_IF_SQLITE_FAILED(sqlite3IcuInit(m_dbconn.get()), m_dbconn.get());
     }
 
+    void Connection::SetMemoryMapSize(int64_t maximumBytes)
+    {
+        AICLI_LOG(SQL, Verbose, << "Setting memory map size for connection #" << m_id << " to " << maximumBytes);
+        std::string pragma = "PRAGMA mmap_size = ";
+        pragma += std::to_string(maximumBytes);
+        Statement statement = Statement::Create(*this, pragma);
+        // The pragma outputs the resulting value as a row.
+        statement.Step();
+    }
+
+    void Connection::ConfigureLookaside(uint32_t slotSizeBytes, uint32_t slotCount)
+    {
+        AICLI_LOG(SQL, Verbose, << "Configuring lookaside for connection #" << m_id << " to " << slotCount << " slots of " << slotSizeBytes << " bytes");
+        m_lookasideBuffer = std::make_unique<uint8_t[]>(static_cast<size_t>(slotSizeBytes) * slotCount);
+        THROW_IF_SQLITE_FAILED(sqlite3_db_config(m_dbconn.get(), SQLITE_DBCONFIG_LOOKASIDE, m_lookasideBuffer.get(), static_cast<int>(slotSizeBytes), static_cast<int>(slotCount)), m_dbconn.get());
+    }
+
+    void Connection::EnableWriteAheadLogging()
+    {
+        AICLI_LOG(SQL, Verbose, << "Enabling write-ahead logging for connection #" << m_id);
+        {
+            Statement statement = Statement::Create(*this, "PRAGMA journal_mode = WAL");
+            // The pragma outputs the resulting mode as a row.
+            statement.Step();
+        }
+        {
+            Statement statement = Statement::Create(*this, "PRAGMA synchronous = NORMAL");
+            statement.Execute();
+        }
+    }
+
+    CachedStatement Connection::GetCachedStatement(std::string_view sql) const
+    {
+        {
+            std::lock_guard<std::mutex> lock{ m_statementCache->Lock };
+            auto itr = m_statementCache->Statements.find(sql);
+            if (itr != m_statementCache->Statements.end())
+            {
+                auto node = m_statementCache->Statements.extract(itr);
+                return { std::move(node.mapped()), m_statementCache.get(), std::move(node.key()) };
+            }
+        }
+
+        std::string sqlCopy{ sql };
+        Statement statement = Statement::Create(*this, sqlCopy);
+        return { std::move(statement), m_statementCache.get(), std::move(sqlCopy) };
+    }
+
+    std::optional<rowid_t> Connection::GetInternedValueId(std::string_view tableName, std::string_view value) const
+    {
+        std::lock_guard<std::mutex> lock{ m_valueIdCache->Lock };
+
+        auto tableItr = m_valueIdCache->Tables.find(tableName);
+        if (tableItr != m_valueIdCache->Tables.end())
+        {
+            auto valueItr = tableItr->second.find(value);
+            if (valueItr != tableItr->second.end())
+            {
+                return valueItr->second;
+            }
+        }
+
+        return {};
+    }
+
+    void Connection::InternValueId(std::string_view tableName, std::string_view value, rowid_t id) const
+    {
+        std::lock_guard<std::mutex> lock{ m_valueIdCache->Lock };
+
+        auto tableItr = m_valueIdCache->Tables.find(tableName);
+        if (tableItr == m_valueIdCache->Tables.end())
+        {
+            tableItr = m_valueIdCache->Tables.emplace(std::string{ tableName }, std::map<std::string, rowid_t, std::less<>>{}).first;
+        }
+
+        tableItr->second.emplace(std::string{ value }, id);
+    }
+
+    void Connection::InvalidateInternedValues(std::string_view tableName) const
+    {
+        std::lock_guard<std::mutex> lock{ m_valueIdCache->Lock };
+
+        auto tableItr = m_valueIdCache->Tables.find(tableName);
+        if (tableItr != m_valueIdCache->Tables.end())
+        {
+            m_valueIdCache->Tables.erase(tableItr);
+        }
+    }
+
+    void Connection::InvalidateAllInternedValues() const
+    {
+        std::lock_guard<std::mutex> lock{ m_valueIdCache->Lock };
+        m_valueIdCache->Tables.clear();
+    }
+
     rowid_t Connection::GetLastInsertRowID()
     {
         return sqlite3_last_insert_rowid(m_dbconn.get());
@@ -255,18 +412,39 @@ namespace AppInstaller::Repository::SQLite
     bool Statement::Step(bool failFastOnError)
     {
         AICLI_LOG(SQL, Verbose, << "Stepping statement #" << m_connectionId << '-' << m_id);
+
+        bool instrumented = s_statementInstrumentationEnabled.load(std::memory_order_relaxed);
+        std::chrono::steady_clock::time_point stepStart;
+        if (instrumented)
+        {
+            stepStart = std::chrono::steady_clock::now();
+        }
+
         int result = sqlite3_step(m_stmt.get());
 
+        if (instrumented)
+        {
+            m_elapsed += std::chrono::steady_clock::now() - stepStart;
+        }
+
         if (result == SQLITE_ROW)
         {
             AICLI_LOG(SQL, Verbose, << "Statement #" << m_connectionId << '-' << m_id << " has data");
             m_state = State::HasRow;
+            if (instrumented)
+            {
+                m_rowCount++;
+            }
             return true;
         }
         else if (result == SQLITE_DONE)
         {
             AICLI_LOG(SQL, Verbose, << "Statement #" << m_connectionId << '-' << m_id << " has completed");
             m_state = State::Completed;
+            if (instrumented)
+            {
+                ReportStatementCompletion(m_stmt.get(), m_connectionId, m_id, m_rowCount, m_elapsed);
+            }
             return false;
         }
         else
@@ -294,16 +472,84 @@ namespace AppInstaller::Repository::SQLite
         return type == SQLITE_NULL;
     }
 
+    std::string_view Statement::GetColumnView(int column)
+    {
+        THROW_HR_IF(E_BOUNDS, m_state != State::HasRow);
+        const char* text = reinterpret_cast<const char*>(sqlite3_column_text(m_stmt.get(), column));
+        if (!text)
+        {
+            return {};
+        }
+        return { text, static_cast<size_t>(sqlite3_column_bytes(m_stmt.get(), column)) };
+    }
+
+    blob_view_t Statement::GetColumnBlobView(int column)
+    {
+        THROW_HR_IF(E_BOUNDS, m_state != State::HasRow);
+        const blob_view_t::value_type* blobPtr = reinterpret_cast<const blob_view_t::value_type*>(sqlite3_column_blob(m_stmt.get(), column));
+        if (!blobPtr)
+        {
+            return {};
+        }
+        return { blobPtr, static_cast<size_t>(sqlite3_column_bytes(m_stmt.get(), column)) };
+    }
+
     void Statement::Reset()
     {
         AICLI_LOG(SQL, Verbose, << "Reset statement #" << m_connectionId << '-' << m_id);
         // Ignore return value from reset, as if it is an error, it was the error from the last call to step.
         sqlite3_reset(m_stmt.get());
         m_state = State::Prepared;
+        m_elapsed = {};
+        m_rowCount = 0;
+    }
+
+    void Statement::ClearBindings()
+    {
+        AICLI_LOG(SQL, Verbose, << "Clear bindings for statement #" << m_connectionId << '-' << m_id);
+        THROW_IF_SQLITE_FAILED(sqlite3_clear_bindings(m_stmt.get()), sqlite3_db_handle(m_stmt.get()));
+    }
+
+    CachedStatement::CachedStatement(Statement&& statement, details::StatementCacheState* cache, std::string&& sql) :
+        Statement(std::move(statement)), m_cache(cache), m_sql(std::move(sql))
+    {}
+
+    CachedStatement::CachedStatement(CachedStatement&& other) noexcept :
+        Statement(std::move(other)), m_cache(std::exchange(other.m_cache, nullptr)), m_sql(std::move(other.m_sql))
+    {}
+
+    CachedStatement& CachedStatement::operator=(CachedStatement&& other) noexcept
+    {
+        ReturnToCache();
+        Statement::operator=(std::move(other));
+        m_cache = std::exchange(other.m_cache, nullptr);
+        m_sql = std::move(other.m_sql);
+        return *this;
+    }
+
+    CachedStatement::~CachedStatement()
+    {
+        ReturnToCache();
+    }
+
+    void CachedStatement::ReturnToCache()
+    {
+        if (m_cache && static_cast<bool>(*this))
+        {
+            // Make the statement inert before pooling it for the next user.
+            Reset();
+            ClearBindings();
+
+            std::lock_guard<std::mutex> lock{ m_cache->Lock };
+            // If an identical statement was already returned, this one is simply dropped.
+            m_cache->Statements.emplace(std::move(m_sql), std::move(static_cast<Statement&>(*this)));
+        }
+
+        m_cache = nullptr;
     }
 
     Savepoint::Savepoint(Connection& connection, std::string&& name) :
-        m_name(std::move(name))
+        m_name(std::move(name)), m_connection(&connection)
     {
         using namespace std::string_literals;
 
@@ -336,6 +582,9 @@ namespace AppInstaller::Repository::SQLite
             // this should have the effect of 'committing' nothing.
             m_release.Step(true);
             m_inProgress = false;
+            // Any value ids interned within the rolled back savepoint may refer to rows
+            // that no longer exist.
+            m_connection->InvalidateAllInternedValues();
         }
     }
 
@@ -349,6 +598,38 @@ namespace AppInstaller::Repository::SQLite
         }
     }
 
+    void EnableStatementInstrumentation(std::chrono::milliseconds slowQueryThreshold)
+    {
+        s_slowQueryThresholdMs.store(slowQueryThreshold.count(), std::memory_order_relaxed);
+        s_statementInstrumentationEnabled.store(true, std::memory_order_relaxed);
+        AICLI_LOG(SQL, Info, << "Statement instrumentation enabled with slow query threshold of " << slowQueryThreshold.count() << " ms");
+    }
+
+    void DisableStatementInstrumentation()
+    {
+        s_statementInstrumentationEnabled.store(false, std::memory_order_relaxed);
+    }
+
+    void Backup(Connection& destination, const Connection& source)
+    {
+        AICLI_LOG(SQL, Info, << "Backing up connection #" << source.GetID() << " to connection #" << destination.GetID());
+
+        sqlite3_backup* backup = sqlite3_backup_init(destination, "main", source, "main");
+        if (!backup)
+        {
+            THROW_SQLITE(sqlite3_errcode(destination), destination);
+        }
+
+        // Copy all pages in a single pass; both connections are local.
+        int result = sqlite3_backup_step(backup, -1);
+        sqlite3_backup_finish(backup);
+
+        if (result != SQLITE_DONE)
+        {
+            THROW_SQLITE(result, destination);
+        }
+    }
+
     std::string_view EscapeCharForLike = "'"sv;
 
     std::string EscapeStringForLike(std::string_view value)
@@ -8,6 +8,11 @@
 #include <AppInstallerLogging.h>
 #include <AppInstallerLanguageUtilities.h>
 
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -30,6 +35,9 @@ namespace AppInstaller::Repository::SQLite
     // The type to use for blob data.
     using blob_t = std::vector<uint8_t>;
 
+    // The type to use to view blob data in place.
+    using blob_view_t = std::basic_string_view<uint8_t>;
+
     namespace details
     {
         template<typename>
@@ -133,6 +141,14 @@ namespace AppInstaller::Repository::SQLite
         SQLiteException(int error) : wil::ResultException(MAKE_HRESULT(SEVERITY_ERROR, FACILITY_SQLITE, error)) {}
     };
 
+    struct CachedStatement;
+
+    namespace details
+    {
+        struct StatementCacheState;
+        struct ValueIdCacheState;
+    }
+
     // The connection to a database.
     struct Connection
     {
@@ -154,6 +170,8 @@ namespace AppInstaller::Repository::SQLite
             None = 0,
             // Indicate that the target can be a URI.
             Uri = SQLITE_OPEN_URI,
+            // Use the shared cache so that connections within the process share pages.
+            SharedCache = SQLITE_OPEN_SHAREDCACHE,
         };
 
         static Connection Create(const std::string& target, OpenDisposition disposition, OpenFlags flags = OpenFlags::None);
@@ -163,14 +181,51 @@ namespace AppInstaller::Repository::SQLite
         Connection(const Connection&) = delete;
         Connection& operator=(const Connection&) = delete;
 
-        Connection(Connection&& other) = default;
-        Connection& operator=(Connection&& other) = default;
+        Connection(Connection&& other) noexcept;
+        Connection& operator=(Connection&& other) noexcept;
 
-        ~Connection() = default;
+        ~Connection();
 
         // Enables the ICU integrations on this connection.
         void EnableICU();
 
+        // Sets the maximum number of bytes of the database file that will be accessed using memory-mapped I/O.
+        // Reads within the mapped region avoid copying pages through the connection's buffer pool.
+        void SetMemoryMapSize(int64_t maximumBytes);
+
+        // Points the connection's lookaside allocator at a preallocated arena of
+        // slotCount slots of slotSizeBytes each, so that the small transient allocations
+        // of statement preparation and execution stop round tripping the general
+        // allocator. Must be called before any statement runs on the connection.
+        void ConfigureLookaside(uint32_t slotSizeBytes, uint32_t slotCount);
+
+        // Switches the database to write-ahead logging, making each commit a sequential
+        // append to the log that is folded back into the database by periodic checkpoints.
+        // Synchronous mode is relaxed to NORMAL, which is safe under WAL: commits no longer
+        // wait on an fsync and the log still protects consistency across a power loss.
+        void EnableWriteAheadLogging();
+
+        // Gets a statement for the given SQL from the connection's prepared statement cache,
+        // preparing a new one if no identical statement is available.
+        // The statement is returned to the cache when the holder is destroyed.
+        CachedStatement GetCachedStatement(std::string_view sql) const;
+
+        // Looks up the interned rowid for the value in the given table; see InternValueId.
+        std::optional<rowid_t> GetInternedValueId(std::string_view tableName, std::string_view value) const;
+
+        // Records the rowid of a value row so that later writes of the same value skip the
+        // table probe. Each distinct value is stored once, so the heavily repeated values
+        // seen during an index build share a single allocation rather than re-querying.
+        void InternValueId(std::string_view tableName, std::string_view value, rowid_t id) const;
+
+        // Drops the interned values for the given table; must be called when rows of the
+        // table may have been removed or rewritten outside of InternValueId.
+        void InvalidateInternedValues(std::string_view tableName) const;
+
+        // Drops all interned values; called when a transaction rolls back, as any ids
+        // recorded within it no longer refer to live rows.
+        void InvalidateAllInternedValues() const;
+
         // Gets the last inserted rowid to the database.
         rowid_t GetLastInsertRowID();
 
@@ -186,7 +241,11 @@ namespace AppInstaller::Repository::SQLite
         Connection(const std::string& target, OpenDisposition disposition, OpenFlags flags);
 
         size_t m_id = 0;
+        // Declared before the connection so that it outlives the close of the connection.
+        std::unique_ptr<uint8_t[]> m_lookasideBuffer;
         wil::unique_any<sqlite3*, decltype(sqlite3_close_v2), sqlite3_close_v2> m_dbconn;
+        std::unique_ptr<details::StatementCacheState> m_statementCache;
+        std::unique_ptr<details::ValueIdCacheState> m_valueIdCache;
     };
 
     // A SQL statement.
@@ -252,6 +311,17 @@ namespace AppInstaller::Repository::SQLite
             return details::ParameterSpecifics<Value>::GetColumn(m_stmt.get(), column);
         }
 
+        // Gets the value of the specified text column as a view over the statement's own
+        // row buffer, avoiding the copy that GetColumn<std::string> makes. The view is
+        // only valid until the statement is stepped, reset, or destroyed.
+        // The index is 0 based.
+        std::string_view GetColumnView(int column);
+
+        // Gets the value of the specified blob column as a view over the statement's own
+        // row buffer; the same lifetime constraints as GetColumnView apply.
+        // The index is 0 based.
+        blob_view_t GetColumnBlobView(int column);
+
         // Gets the entire row of values from the current row.
         // The values requested *must* be those available starting from the first column, but trailing columns can be omitted.
         template <typename... Values>
@@ -264,6 +334,9 @@ namespace AppInstaller::Repository::SQLite
         // Note that this does not clear data bindings.
         void Reset();
 
+        // Clears all parameter bindings, returning them to null.
+        void ClearBindings();
+
         // Determines if the statement owns an underlying object.
         operator bool() const { return static_cast<bool>(m_stmt); }
 
@@ -286,6 +359,55 @@ namespace AppInstaller::Repository::SQLite
         size_t m_id = 0;
         wil::unique_any<sqlite3_stmt*, decltype(sqlite3_finalize), sqlite3_finalize> m_stmt;
         State m_state = State::Prepared;
+
+        // Instrumentation data; only maintained while statement instrumentation is enabled.
+        std::chrono::nanoseconds m_elapsed{ 0 };
+        int64_t m_rowCount = 0;
+    };
+
+    namespace details
+    {
+        // The state behind a connection's prepared statement cache.
+        struct StatementCacheState
+        {
+            std::mutex Lock;
+            std::map<std::string, Statement, std::less<>> Statements;
+        };
+
+        // The state behind a connection's interned value id cache.
+        struct ValueIdCacheState
+        {
+            std::mutex Lock;
+            std::map<std::string, std::map<std::string, rowid_t, std::less<>>, std::less<>> Tables;
+        };
+    }
+
+    // A statement retrieved from a connection's prepared statement cache.
+    // The underlying prepared statement is returned to the cache on destruction (after being
+    // reset and having its bindings cleared) so that later users of the same SQL avoid paying
+    // to prepare it again.
+    struct CachedStatement : public Statement
+    {
+        CachedStatement() = default;
+
+        CachedStatement(const CachedStatement&) = delete;
+        CachedStatement& operator=(const CachedStatement&) = delete;
+
+        CachedStatement(CachedStatement&& other) noexcept;
+        CachedStatement& operator=(CachedStatement&& other) noexcept;
+
+        ~CachedStatement();
+
+    private:
+        friend Connection;
+
+        CachedStatement(Statement&& statement, details::StatementCacheState* cache, std::string&& sql);
+
+        // Returns the statement to the cache it came from, if any.
+        void ReturnToCache();
+
+        details::StatementCacheState* m_cache = nullptr;
+        std::string m_sql;
     };
 
     // A SQLite savepoint.
@@ -312,11 +434,25 @@ namespace AppInstaller::Repository::SQLite
         Savepoint(Connection& connection, std::string&& name);
 
         std::string m_name;
+        Connection* m_connection = nullptr;
         DestructionToken m_inProgress = true;
         Statement m_rollbackTo;
         Statement m_release;
     };
 
+    // Enables instrumentation of all statements: each completed statement logs its row count
+    // and wall time to the diagnostic log, and statements running at or above the given
+    // threshold additionally log their EXPLAIN QUERY PLAN output as a slow query report.
+    // Intended for diagnosing pathological search shapes against an index; off by default.
+    void EnableStatementInstrumentation(std::chrono::milliseconds slowQueryThreshold);
+
+    // Disables statement instrumentation.
+    void DisableStatementInstrumentation();
+
+    // Copies the entire contents of the source database over the destination database
+    // using the SQLite backup API; the copy is transactionally consistent.
+    void Backup(Connection& destination, const Connection& source);
+
     // The escape character used in the EscapeStringForLike function.
     extern std::string_view EscapeCharForLike;
 
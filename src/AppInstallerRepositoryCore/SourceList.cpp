@@ -10,6 +10,8 @@
 #include <winget/Certificates.h>
 #include <CertificateResources.h>
 
+#include <mutex>
+
 using namespace AppInstaller::Settings;
 using namespace std::string_view_literals;
 
@@ -70,13 +72,12 @@ namespace AppInstaller::Repository
         // Results are all or nothing; if any failures occur, no details are returned.
         bool TryReadSourceDetails(
             std::string_view settingName,
-            std::istream& stream,
+            const std::string& settingValue,
             std::string_view rootName,
             std::function<bool(SourceDetailsInternal&, const std::string&, const YAML::Node&)> parse,
             std::vector<SourceDetailsInternal>& sourceDetails)
         {
             std::vector<SourceDetailsInternal> result;
-            std::string settingValue = Utility::ReadEntireStream(stream);
 
             YAML::Node document;
             try
@@ -131,22 +132,101 @@ namespace AppInstaller::Repository
             return true;
         }
 
+        // A process lifetime cache of parsed source details, keyed per stream by the
+        // hash of the contents that produced them. Multiple components construct a
+        // SourceList within a single command; the streams rarely change within the
+        // process, so every construction after the first skips the YAML parse. The
+        // hash acts as the change token: any write to the stream (from this or
+        // another process) produces different contents and thus a cache miss.
+        // Policy filtering of the parsed details intentionally stays outside of the
+        // cache so that it always reflects the current policy state.
+        struct ParsedSourcesCache
+        {
+            static std::optional<std::vector<SourceDetailsInternal>> TryGet(std::string_view streamName, const Utility::SHA256::HashBuffer& token)
+            {
+                ParsedSourcesCache& instance = Instance();
+                std::lock_guard<std::mutex> lock{ instance.m_lock };
+
+                auto itr = instance.m_entries.find(streamName);
+                if (itr != instance.m_entries.end() && Utility::SHA256::AreEqual(itr->second.Token, token))
+                {
+                    return itr->second.Details;
+                }
+
+                return {};
+            }
+
+            static void Store(std::string_view streamName, Utility::SHA256::HashBuffer token, const std::vector<SourceDetailsInternal>& details)
+            {
+                ParsedSourcesCache& instance = Instance();
+                std::lock_guard<std::mutex> lock{ instance.m_lock };
+
+                auto itr = instance.m_entries.find(streamName);
+                if (itr == instance.m_entries.end())
+                {
+                    itr = instance.m_entries.emplace(std::string{ streamName }, Entry{}).first;
+                }
+
+                itr->second.Token = std::move(token);
+                itr->second.Details = details;
+            }
+
+        private:
+            struct Entry
+            {
+                Utility::SHA256::HashBuffer Token;
+                std::vector<SourceDetailsInternal> Details;
+            };
+
+            static ParsedSourcesCache& Instance()
+            {
+                static ParsedSourcesCache s_instance;
+                return s_instance;
+            }
+
+            std::mutex m_lock;
+            std::map<std::string, Entry, std::less<>> m_entries;
+        };
+
         // Gets the source details from a particular setting, or an empty optional if no setting exists.
+        // If rawValue is provided, it receives the serialized setting value that was read.
         std::optional<std::vector<SourceDetailsInternal>> TryGetSourcesFromSetting(
             Settings::Stream& setting,
             std::string_view rootName,
-            std::function<bool(SourceDetailsInternal&, const std::string&, const YAML::Node&)> parse)
+            std::function<bool(SourceDetailsInternal&, const std::string&, const YAML::Node&)> parse,
+            std::string* rawValue = nullptr)
         {
             auto sourcesStream = setting.Get();
             if (!sourcesStream)
             {
+                if (rawValue)
+                {
+                    rawValue->clear();
+                }
+
                 // Note that this case is different than the one in which all sources have been removed.
                 return {};
             }
             else
             {
+                std::string settingValue = Utility::ReadEntireStream(*sourcesStream);
+                Utility::SHA256::HashBuffer token = Utility::SHA256::ComputeHash(settingValue);
+
+                if (rawValue)
+                {
+                    *rawValue = settingValue;
+                }
+
+                auto cached = ParsedSourcesCache::TryGet(setting.GetName(), token);
+                if (cached)
+                {
+                    return cached;
+                }
+
                 std::vector<SourceDetailsInternal> result;
-                THROW_HR_IF(APPINSTALLER_CLI_ERROR_SOURCES_INVALID, !TryReadSourceDetails(setting.GetName(), *sourcesStream, rootName, parse, result));
+                THROW_HR_IF(APPINSTALLER_CLI_ERROR_SOURCES_INVALID, !TryReadSourceDetails(setting.GetName(), settingValue, rootName, parse, result));
+
+                ParsedSourcesCache::Store(setting.GetName(), std::move(token), result);
                 return result;
             }
         }
@@ -155,9 +235,10 @@ namespace AppInstaller::Repository
         std::vector<SourceDetailsInternal> GetSourcesFromSetting(
             Settings::Stream& setting,
             std::string_view rootName,
-            std::function<bool(SourceDetailsInternal&, const std::string&, const YAML::Node&)> parse)
+            std::function<bool(SourceDetailsInternal&, const std::string&, const YAML::Node&)> parse,
+            std::string* rawValue = nullptr)
         {
-            return TryGetSourcesFromSetting(setting, rootName, parse).value_or(std::vector<SourceDetailsInternal>{});
+            return TryGetSourcesFromSetting(setting, rootName, parse, rawValue).value_or(std::vector<SourceDetailsInternal>{});
         }
 
         // Sets the sources for a particular setting, from a particular origin.
@@ -499,6 +580,16 @@ namespace AppInstaller::Repository
         SaveMetadataInternal(details);
     }
 
+    void SourceList::SaveMetadata(const std::vector<SourceDetailsInternal>& details)
+    {
+        if (details.empty())
+        {
+            return;
+        }
+
+        SaveMetadataInternal(details);
+    }
+
     bool SourceList::CheckSourceAgreements(std::string_view sourceName, std::string_view agreementsIdentifier, ImplicitAgreementFieldEnum agreementFields)
     {
         if (agreementFields == ImplicitAgreementFieldEnum::None && agreementsIdentifier.empty())
@@ -533,6 +624,13 @@ namespace AppInstaller::Repository
             return;
         }
 
+        if (detailsInternal->AcceptedAgreementFields == static_cast<int>(agreementFields) &&
+            detailsInternal->AcceptedAgreementsIdentifier == agreementsIdentifier)
+        {
+            // The agreements information is already recorded; avoid rewriting the metadata stream.
+            return;
+        }
+
         detailsInternal->AcceptedAgreementFields = static_cast<int>(agreementFields);
         detailsInternal->AcceptedAgreementsIdentifier = agreementsIdentifier;
 
@@ -716,7 +814,8 @@ namespace AppInstaller::Repository
                 TryReadScalar(name, settingValue, source, s_MetadataYaml_Source_AcceptedAgreementsIdentifier, details.AcceptedAgreementsIdentifier, false);
                 TryReadScalar(name, settingValue, source, s_MetadataYaml_Source_AcceptedAgreementFields, details.AcceptedAgreementFields, false);
                 return true;
-            });
+            },
+            &m_lastMetadataValue);
     }
 
     bool SourceList::SetMetadata(const std::vector<SourceDetailsInternal>& sources)
@@ -739,14 +838,34 @@ namespace AppInstaller::Repository
         out << YAML::EndSeq;
         out << YAML::EndMap;
 
-        return m_metadataStream.Set(out.str());
+        std::string serialized = out.str();
+
+        if (serialized == m_lastMetadataValue)
+        {
+            // The save produces no effective change; skip rewriting the stream.
+            return true;
+        }
+
+        bool result = m_metadataStream.Set(serialized);
+
+        if (result)
+        {
+            m_lastMetadataValue = std::move(serialized);
+        }
+
+        return result;
     }
 
     void SourceList::SaveMetadataInternal(const SourceDetailsInternal& detailsRef, bool remove)
+    {
+        SaveMetadataInternal(std::vector<SourceDetailsInternal>{ detailsRef }, remove);
+    }
+
+    void SourceList::SaveMetadataInternal(const std::vector<SourceDetailsInternal>& detailsRefs, bool remove)
     {
         // Copy the incoming details because we might overwrite the metadata
         // when reloading the source details from settings.
-        SourceDetailsInternal details = detailsRef;
+        std::vector<SourceDetailsInternal> details = detailsRefs;
         bool metadataSet = false;
 
         for (size_t i = 0; !metadataSet && i < 10; ++i)
@@ -757,23 +876,36 @@ namespace AppInstaller::Repository
             {
                 OverwriteMetadata();
 
-                auto target = FindSource(details.Name, true);
-                if (target == m_sourceList.end())
-                {
-                    // Didn't find the metadata, so we consider this a success
-                    return;
-                }
+                bool anyFound = false;
 
-                if (remove)
+                for (auto& detail : details)
                 {
-                    // The remove will have removed the source but not the metadata.
-                    // Remove it again here.
-                    m_sourceList.erase(target);
+                    auto target = FindSource(detail.Name, true);
+                    if (target == m_sourceList.end())
+                    {
+                        // Didn't find the metadata, so we consider this one a success
+                        continue;
+                    }
+
+                    anyFound = true;
+
+                    if (remove)
+                    {
+                        // The remove will have removed the source but not the metadata.
+                        // Remove it again here.
+                        m_sourceList.erase(target);
+                    }
+                    else
+                    {
+                        // Update the freshly read metadata with the update that was requested.
+                        detail.CopyMetadataFieldsTo(*target);
+                    }
                 }
-                else
+
+                if (!anyFound)
                 {
-                    // Update the freshly read metadata with the update that was requested.
-                    details.CopyMetadataFieldsTo(*target);
+                    // None of the metadata was found, so we consider this a success
+                    return;
                 }
             }
         }
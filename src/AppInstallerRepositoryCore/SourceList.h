@@ -60,6 +60,10 @@ namespace AppInstaller::Repository
         // The given source must already be in the internal source list.
         void SaveMetadata(const SourceDetailsInternal& details);
 
+        // Save source metadata for multiple sources with a single write to the metadata stream.
+        // The given sources must already be in the internal source list.
+        void SaveMetadata(const std::vector<SourceDetailsInternal>& details);
+
         // Checks the source agreements and returns if agreements are satisfied.
         bool CheckSourceAgreements(std::string_view sourceName, std::string_view agreementsIdentifier, ImplicitAgreementFieldEnum agreementFields);
 
@@ -91,8 +95,16 @@ namespace AppInstaller::Repository
         // If remove is true, the given source is being removed.
         void SaveMetadataInternal(const SourceDetailsInternal& details, bool remove = false);
 
+        // Save source metadata; the sources with metadata updates are given.
+        // If remove is true, the given sources are being removed.
+        void SaveMetadataInternal(const std::vector<SourceDetailsInternal>& details, bool remove = false);
+
         std::vector<SourceDetailsInternal> m_sourceList;
         Settings::Stream m_userSourcesStream;
         Settings::Stream m_metadataStream;
+
+        // The serialized metadata last read or written through this instance;
+        // used to skip rewriting the stream when a save produces no effective change.
+        std::string m_lastMetadataValue;
     };
 }
@@ -87,6 +87,14 @@ namespace AppInstaller::Logging
         m_loggers.clear();
     }
 
+    void DiagnosticLogger::BeginShutdown() noexcept
+    {
+        for (auto& logger : m_loggers)
+        {
+            logger->BeginShutdown();
+        }
+    }
+
     void DiagnosticLogger::EnableChannel(Channel channel)
     {
         m_enabledChannels |= ConvertChannelToBitmask(channel);
@@ -6,6 +6,12 @@
 #include "Public/AppInstallerLogging.h"
 #include "Public/AppInstallerSHA256.h"
 
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <emmintrin.h>
+#endif
+
 namespace AppInstaller::Utility
 {
     // Same as std::isspace(char)
@@ -31,21 +37,46 @@ namespace AppInstaller::Utility
                     THROW_HR(APPINSTALLER_CLI_ERROR_ICU_BREAK_ITERATOR_ERROR);
                 }
 
-                m_brk.reset(ubrk_open(type, nullptr, nullptr, 0, &err));
-                if (U_FAILURE(err))
+                // Opening a break iterator compiles its break rules; all current callers use
+                // character breaks, so keep one such iterator per thread and re-bind it to each
+                // input rather than rebuilding the rules on every call. The type is not shared
+                // across concurrent iterators, but no caller holds two at once.
+                if (type == UBRK_CHARACTER)
                 {
-                    AICLI_LOG(Core, Error, << "ubrk_open returned " << err);
-                    THROW_HR(APPINSTALLER_CLI_ERROR_ICU_BREAK_ITERATOR_ERROR);
+                    thread_local wil::unique_any<UBreakIterator*, decltype(ubrk_close), &ubrk_close> characterIterator;
+
+                    if (!characterIterator)
+                    {
+                        characterIterator.reset(ubrk_open(type, nullptr, nullptr, 0, &err));
+                        if (U_FAILURE(err))
+                        {
+                            AICLI_LOG(Core, Error, << "ubrk_open returned " << err);
+                            THROW_HR(APPINSTALLER_CLI_ERROR_ICU_BREAK_ITERATOR_ERROR);
+                        }
+                    }
+
+                    m_brk = characterIterator.get();
+                }
+                else
+                {
+                    m_ownedBrk.reset(ubrk_open(type, nullptr, nullptr, 0, &err));
+                    if (U_FAILURE(err))
+                    {
+                        AICLI_LOG(Core, Error, << "ubrk_open returned " << err);
+                        THROW_HR(APPINSTALLER_CLI_ERROR_ICU_BREAK_ITERATOR_ERROR);
+                    }
+
+                    m_brk = m_ownedBrk.get();
                 }
 
-                ubrk_setUText(m_brk.get(), m_text.get(), &err);
+                ubrk_setUText(m_brk, m_text.get(), &err);
                 if (U_FAILURE(err))
                 {
                     AICLI_LOG(Core, Error, << "ubrk_setUText returned " << err);
                     THROW_HR(APPINSTALLER_CLI_ERROR_ICU_BREAK_ITERATOR_ERROR);
                 }
 
-                int32_t i = ubrk_first(m_brk.get());
+                int32_t i = ubrk_first(m_brk);
                 if (i != 0)
                 {
                     AICLI_LOG(Core, Error, << "ubrk_first returned " << i);
@@ -66,7 +97,7 @@ namespace AppInstaller::Utility
             // Returns the byte offset of the next break in the string
             int32_t Next()
             {
-                m_currentBrk = ubrk_next(m_brk.get());
+                m_currentBrk = ubrk_next(m_brk);
                 return m_currentBrk;
             }
 
@@ -89,19 +120,93 @@ namespace AppInstaller::Utility
             // Returns the status from the break rule that determined the most recently break position.
             int32_t CurrentRuleStatus()
             {
-                return ubrk_getRuleStatus(m_brk.get());
+                return ubrk_getRuleStatus(m_brk);
             }
 
         private:
             wil::unique_any<UText*, decltype(utext_close), &utext_close> m_text;
-            wil::unique_any<UBreakIterator*, decltype(ubrk_close), &ubrk_close> m_brk;
+            wil::unique_any<UBreakIterator*, decltype(ubrk_close), &ubrk_close> m_ownedBrk;
+            UBreakIterator* m_brk = nullptr;
             int32_t m_currentBrk = 0;
         };
+
+        // Determines whether every byte of the input is ASCII, scanning a chunk at a time.
+        // ASCII-only strings (package ids, monikers, most search filters) can skip ICU.
+        bool IsAllAscii(std::string_view input)
+        {
+            const char* data = input.data();
+            size_t size = input.size();
+            size_t i = 0;
+
+#if defined(_M_X64) || defined(_M_IX86)
+            // SSE2 is part of the baseline for these architectures; the sign mask is
+            // non-zero if any byte in the chunk has its high bit set.
+            for (; i + 16 <= size; i += 16)
+            {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                if (_mm_movemask_epi8(chunk) != 0)
+                {
+                    return false;
+                }
+            }
+#else
+            for (; i + 8 <= size; i += 8)
+            {
+                uint64_t chunk;
+                memcpy(&chunk, data + i, sizeof(chunk));
+                if (chunk & 0x8080808080808080ull)
+                {
+                    return false;
+                }
+            }
+#endif
+
+            for (; i < size; ++i)
+            {
+                if (static_cast<unsigned char>(data[i]) & 0x80)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // Determines whether every character of the UTF-16 input is ASCII.
+        bool IsAllAscii(std::wstring_view input)
+        {
+            const wchar_t* data = input.data();
+            size_t size = input.size();
+            size_t i = 0;
+
+            for (; i + 4 <= size; i += 4)
+            {
+                uint64_t chunk;
+                memcpy(&chunk, data + i, sizeof(chunk));
+                if (chunk & 0xFF80FF80FF80FF80ull)
+                {
+                    return false;
+                }
+            }
+
+            for (; i < size; ++i)
+            {
+                if (data[i] > 0x7F)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
     }
 
     bool CaseInsensitiveEquals(std::string_view a, std::string_view b)
     {
-        return ToLower(a) == ToLower(b);
+        // ToLower is ASCII only, so the strings can be compared in place rather than allocating lowered copies.
+        return a.length() == b.length() &&
+            std::equal(a.begin(), a.end(), b.begin(),
+                [](unsigned char x, unsigned char y) { return std::tolower(x) == std::tolower(y); });
     }
 
     bool CaseInsensitiveContains(const std::vector<std::string_view>& a, std::string_view b)
@@ -127,6 +232,12 @@ namespace AppInstaller::Utility
 
     bool ICUCaseInsensitiveEquals(std::string_view a, std::string_view b)
     {
+        // ASCII case folding is plain lowercasing, so the non-allocating compare matches it.
+        if (IsAllAscii(a) && IsAllAscii(b))
+        {
+            return CaseInsensitiveEquals(a, b);
+        }
+
         return FoldCase(a) == FoldCase(b);
     }
 
@@ -142,6 +253,15 @@ namespace AppInstaller::Utility
             return {};
         }
 
+        // ASCII converts by a plain narrowing copy, skipping the two WideCharToMultiByte
+        // calls (length probe plus conversion) that dominate the cost of short strings.
+        if (IsAllAscii(input))
+        {
+            std::string result(input.size(), '\0');
+            std::transform(input.begin(), input.end(), result.begin(), [](wchar_t c) { return static_cast<char>(c); });
+            return result;
+        }
+
         int utf8ByteCount = WideCharToMultiByte(CP_UTF8, 0, input.data(), wil::safe_cast<int>(input.length()), nullptr, 0, nullptr, nullptr);
         THROW_LAST_ERROR_IF(utf8ByteCount == 0);
 
@@ -162,6 +282,16 @@ namespace AppInstaller::Utility
             return {};
         }
 
+        // ASCII converts by a plain widening copy, skipping the two MultiByteToWideChar
+        // calls (length probe plus conversion) that dominate the cost of short strings.
+        // Restricted to UTF-8 input, as not every code page maps the ASCII range verbatim.
+        if (codePage == CP_UTF8 && IsAllAscii(input))
+        {
+            std::wstring result(input.size(), L'\0');
+            std::copy(input.begin(), input.end(), result.begin());
+            return result;
+        }
+
         int utf16CharCount = MultiByteToWideChar(codePage, 0, input.data(), wil::safe_cast<int>(input.length()), nullptr, 0);
         THROW_LAST_ERROR_IF(utf16CharCount == 0);
 
@@ -182,6 +312,14 @@ namespace AppInstaller::Utility
             return std::wstring{};
         }
 
+        // Same ASCII fast path as ConvertToUTF16.
+        if (codePage == CP_UTF8 && IsAllAscii(input))
+        {
+            std::wstring result(input.size(), L'\0');
+            std::copy(input.begin(), input.end(), result.begin());
+            return std::optional{ std::move(result) };
+        }
+
         int utf16CharCount = MultiByteToWideChar(codePage, 0, input.data(), wil::safe_cast<int>(input.length()), nullptr, 0);
         if (utf16CharCount == 0)
         {
@@ -408,16 +546,40 @@ namespace AppInstaller::Utility
             return {};
         }
 
-        wil::unique_any<UCaseMap*, decltype(ucasemap_close), &ucasemap_close> caseMap;
-        UErrorCode errorCode = UErrorCode::U_ZERO_ERROR;
-        caseMap.reset(ucasemap_open(nullptr, U_FOLD_CASE_DEFAULT, &errorCode));
+        // Full case folding maps ASCII to plain lowercase with no expansions, so ASCII-only
+        // inputs can be folded with a bitwise OR instead of going through ICU.
+        if (IsAllAscii(input))
+        {
+            std::string result(input);
 
-        if (U_FAILURE(errorCode))
+            for (char& c : result)
+            {
+                if (c >= 'A' && c <= 'Z')
+                {
+                    c |= 0x20;
+                }
+            }
+
+            return result;
+        }
+
+        // The case map is expensive to open and not mutated by folding, so each thread keeps one.
+        thread_local wil::unique_any<UCaseMap*, decltype(ucasemap_close), &ucasemap_close> caseMap;
+
+        if (!caseMap)
         {
-            AICLI_LOG(Core, Error, << "ucasemap_open returned " << errorCode);
-            THROW_HR(APPINSTALLER_CLI_ERROR_ICU_CASEMAP_ERROR);
+            UErrorCode openErrorCode = UErrorCode::U_ZERO_ERROR;
+            caseMap.reset(ucasemap_open(nullptr, U_FOLD_CASE_DEFAULT, &openErrorCode));
+
+            if (U_FAILURE(openErrorCode))
+            {
+                AICLI_LOG(Core, Error, << "ucasemap_open returned " << openErrorCode);
+                THROW_HR(APPINSTALLER_CLI_ERROR_ICU_CASEMAP_ERROR);
+            }
         }
 
+        UErrorCode errorCode = UErrorCode::U_ZERO_ERROR;
+
         int32_t cch = ucasemap_utf8FoldCase(caseMap.get(), nullptr, 0, input.data(), static_cast<int32_t>(input.size()), &errorCode);
         if (errorCode != U_BUFFER_OVERFLOW_ERROR)
         {
@@ -810,13 +972,31 @@ namespace AppInstaller::Utility
             THROW_HR_MSG(E_INVALIDARG, "ParseFromHexString: Invalid value size");
         }
 
-        const char* valuePtr = value.c_str();
+        // Maps each character to its hex digit value; non hex digit characters parse as zero,
+        // matching the lenient behavior of the previous sscanf based implementation.
+        static constexpr std::array<uint8_t, 256> hexDigitValues = []()
+        {
+            std::array<uint8_t, 256> values{};
+            for (uint8_t i = 0; i < 10; ++i)
+            {
+                values[static_cast<size_t>('0') + i] = i;
+            }
+            for (uint8_t i = 0; i < 6; ++i)
+            {
+                values[static_cast<size_t>('a') + i] = static_cast<uint8_t>(10 + i);
+                values[static_cast<size_t>('A') + i] = static_cast<uint8_t>(10 + i);
+            }
+            return values;
+        }();
+
         std::vector<uint8_t> result;
         result.resize(value.size() / 2);
 
         for (size_t i = 0; i < result.size(); i++)
         {
-            sscanf_s(valuePtr + 2 * i, "%02hhx", &result[i]);
+            uint8_t high = hexDigitValues[static_cast<uint8_t>(value[2 * i])];
+            uint8_t low = hexDigitValues[static_cast<uint8_t>(value[2 * i + 1])];
+            result[i] = static_cast<uint8_t>((high << 4) | low);
         }
 
         return result;
@@ -222,6 +222,10 @@ namespace AppInstaller
                 return "One or more queries did not return exactly one match";
             case APPINSTALLER_CLI_ERROR_PACKAGE_IS_PINNED:
                 return "The package has a pin that prevents upgrade.";
+            case APPINSTALLER_CLI_ERROR_SOURCE_SEARCH_TIMED_OUT:
+                return "The source did not respond within the allotted time.";
+            case APPINSTALLER_CLI_ERROR_SOURCE_DEGRADED:
+                return "The source was skipped because it repeatedly failed to respond.";
 
             // Install errors
             case APPINSTALLER_CLI_ERROR_INSTALL_PACKAGE_IN_USE:
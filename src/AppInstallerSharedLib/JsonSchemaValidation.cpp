@@ -33,6 +33,25 @@ namespace AppInstaller::JsonSchema
         schemaParser.populateSchema(jsonSchemaAdapter, schema);
     }
 
+    const valijson::Schema& GetCompiledSchema(std::string_view key, const std::function<Json::Value()>& loadSchemaDoc)
+    {
+        static std::mutex schemaRegistryLock;
+        static std::map<std::string, std::unique_ptr<valijson::Schema>, std::less<>> schemaRegistry;
+
+        std::lock_guard<std::mutex> lock{ schemaRegistryLock };
+
+        auto itr = schemaRegistry.find(key);
+        if (itr == schemaRegistry.end())
+        {
+            // Copy constructor of valijson::Schema is private, so the registry holds pointers.
+            auto schema = std::make_unique<valijson::Schema>();
+            PopulateSchema(loadSchemaDoc(), *schema);
+            itr = schemaRegistry.emplace(std::string{ key }, std::move(schema)).first;
+        }
+
+        return *itr->second;
+    }
+
     bool Validate(const valijson::Schema& schema, const Json::Value& json, valijson::ValidationResults& results)
     {
         valijson::Validator schemaValidator;
@@ -117,6 +117,8 @@
 #define APPINSTALLER_CLI_ERROR_MULTIPLE_UNINSTALL_FAILED        ((HRESULT)0x8A150066)
 #define APPINSTALLER_CLI_ERROR_NOT_ALL_QUERIES_FOUND_SINGLE     ((HRESULT)0x8A150067)
 #define APPINSTALLER_CLI_ERROR_PACKAGE_IS_PINNED                ((HRESULT)0x8A150068)
+#define APPINSTALLER_CLI_ERROR_SOURCE_SEARCH_TIMED_OUT          ((HRESULT)0x8A150069)
+#define APPINSTALLER_CLI_ERROR_SOURCE_DEGRADED                  ((HRESULT)0x8A15006A)
 
 // Install errors.
 #define APPINSTALLER_CLI_ERROR_INSTALL_PACKAGE_IN_USE           ((HRESULT)0x8A150101)
@@ -2,10 +2,13 @@
 // Licensed under the MIT License.
 #pragma once
 
+#include <array>
 #include <chrono>
 #include <filesystem>
 #include <memory>
+#include <ostream>
 #include <sstream>
+#include <streambuf>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -86,6 +89,12 @@ namespace AppInstaller::Logging
 
         // Informs the logger of the given log with the intention that no buffering occurs (in winget code).
         virtual void WriteDirect(Channel channel, Level level, std::string_view message) noexcept = 0;
+
+        // Asks the logger to flush buffered data and begin winding down any background work,
+        // so that destruction at process teardown has nothing left to write.
+        // Writes arriving after this call must still be accepted, although they may be handled
+        // synchronously.
+        virtual void BeginShutdown() noexcept {}
     };
 
     // This type contains the set of loggers that diagnostic logging will be sent to.
@@ -124,6 +133,9 @@ namespace AppInstaller::Logging
         // Removes all loggers.
         void RemoveAllLoggers();
 
+        // Begins shutdown on all loggers; see ILogger::BeginShutdown.
+        void BeginShutdown() noexcept;
+
         // Enables the given channel.
         void EnableChannel(Channel channel);
 
@@ -161,8 +173,12 @@ namespace AppInstaller::Logging
     std::ostream& SetHRFormat(std::ostream& out);
 
     // This type allows us to override the default behavior of output operators for logging.
+    // The message is formatted into a stack buffer; only a message that outgrows it
+    // causes an allocation.
     struct LoggingStream
     {
+        LoggingStream() : m_out(&m_buffer) {}
+
         // Force use of the UTF-8 string from a file path.
         // This should not be necessary when we move to C++20 and convert to using u8string.
         friend AppInstaller::Logging::LoggingStream& operator<<(AppInstaller::Logging::LoggingStream& out, const std::filesystem::path& path)
@@ -180,10 +196,48 @@ namespace AppInstaller::Logging
             return out;
         }
 
-        std::string str() const { return m_out.str(); }
+        // The view is valid until the stream is next written to or destroyed.
+        std::string_view str() { return m_buffer.str(); }
 
     private:
-        std::stringstream m_out;
+        // A put area over a stack buffer that spills into a string only on overflow.
+        struct Buffer : std::streambuf
+        {
+            Buffer() { setp(m_stack.data(), m_stack.data() + m_stack.size()); }
+
+            std::string_view str()
+            {
+                if (m_overflow.empty())
+                {
+                    return { pbase(), static_cast<size_t>(pptr() - pbase()) };
+                }
+
+                m_overflow.append(pbase(), static_cast<size_t>(pptr() - pbase()));
+                setp(m_stack.data(), m_stack.data() + m_stack.size());
+                return m_overflow;
+            }
+
+        protected:
+            int_type overflow(int_type ch) override
+            {
+                m_overflow.append(pbase(), static_cast<size_t>(pptr() - pbase()));
+                setp(m_stack.data(), m_stack.data() + m_stack.size());
+
+                if (!traits_type::eq_int_type(ch, traits_type::eof()))
+                {
+                    m_overflow.push_back(traits_type::to_char_type(ch));
+                }
+
+                return traits_type::not_eof(ch);
+            }
+
+        private:
+            std::array<char, 2048> m_stack{};
+            std::string m_overflow;
+        };
+
+        Buffer m_buffer;
+        std::ostream m_out;
     };
 }
 
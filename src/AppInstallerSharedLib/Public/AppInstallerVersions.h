@@ -84,7 +84,7 @@ namespace AppInstaller::Utility
         {
             Part() = default;
             Part(uint64_t integer) : Integer(integer) {}
-            Part(const std::string& part);
+            Part(std::string_view part);
             Part(uint64_t integer, std::string other);
 
             bool operator<(const Part& other) const;
@@ -3,6 +3,8 @@
 #pragma once
 #include <json/json.h>
 
+#include <functional>
+
 namespace AppInstaller::JsonSchema
 {
     // Load schema as parsed json doc
@@ -14,6 +16,11 @@ namespace AppInstaller::JsonSchema
     // Populate a valijson Schema object from a json value
     void PopulateSchema(const Json::Value& schemaJson, valijson::Schema& schema);
 
+    // Returns a process-lifetime compiled schema for the given key, invoking loadSchemaDoc
+    // to produce the schema document on first use. The key must uniquely identify the schema
+    // document; compiled schemas are immutable and safe to validate against concurrently.
+    const valijson::Schema& GetCompiledSchema(std::string_view key, const std::function<Json::Value()>& loadSchemaDoc);
+
     // Validate a json doc with a schema
     // Returns whether it was successful and fills the results object
     bool Validate(const valijson::Schema& schema, const Json::Value& json, valijson::ValidationResults& results);
@@ -62,6 +62,24 @@ namespace AppInstaller::YAML
         YAML::Mark m_mark;
     };
 
+    // A bump allocated arena retaining the scalar bytes of a parsed document.
+    // Scalars are written here once as the parse events arrive, and the nodes hold only
+    // spans over the blocks, which never move; the arena is shared by the node tree and
+    // freed with it. This keeps a node tree to a single copy of each scalar, rather than
+    // an owned string allocation per node.
+    struct ScalarArena
+    {
+        // Copies the given bytes into the arena, returning a view that remains valid
+        // for the lifetime of the arena.
+        std::string_view Intern(std::string_view value);
+
+    private:
+        // Large enough that a typical manifest needs only one block.
+        static constexpr size_t s_MinimumBlockSize = 1 << 14;
+
+        std::vector<std::vector<char>> m_blocks;
+    };
+
     // A YAML node.
     struct Node
     {
@@ -96,6 +114,10 @@ namespace AppInstaller::YAML
         void SetScalar(std::string value);
         void SetScalar(std::string value, bool isQuoted);
 
+        // Sets the scalar to a span over memory retained by the given arena,
+        // avoiding an owned copy of the value in the node.
+        void SetScalar(std::string_view value, bool isQuoted, std::shared_ptr<const ScalarArena> arena);
+
         // Adds a child node to the sequence.
         template <typename... Args>
         Node& AddSequenceNode(Args&&... args)
@@ -113,7 +135,7 @@ namespace AppInstaller::YAML
         }
 
         bool IsDefined() const { return m_type != Type::Invalid; }
-        bool IsNull() const { return m_type == Type::Invalid || m_type == Type::None || (m_type == Type::Scalar && m_scalar.empty()); }
+        bool IsNull() const { return m_type == Type::Invalid || m_type == Type::None || (m_type == Type::Scalar && ScalarView().empty()); }
         bool IsScalar() const { return m_type == Type::Scalar; }
         bool IsSequence() const { return m_type == Type::Sequence; }
         bool IsMap() const { return m_type == Type::Mapping; }
@@ -171,7 +193,17 @@ namespace AppInstaller::YAML
         // Require certain node types to; throwing if the requirement is not met.
         void Require(Type type) const;
 
+        // Gets the scalar bytes, wherever they are stored.
+        std::string_view ScalarView() const { return m_arena ? m_scalarView : std::string_view{ m_scalar }; }
+
+        // Applies the tag resolution behavior of the composer to an untagged scalar.
+        void ResolveUnquotedScalarTag(bool isQuoted);
+
         // The workers for the as function.
+        // The string_view result remains valid only while the node (or its tree) is alive.
+        std::string_view as_dispatch(std::string_view*) const;
+        std::optional<std::string_view> try_as_dispatch(std::string_view*) const;
+
         std::string as_dispatch(std::string*) const;
         std::optional<std::string> try_as_dispatch(std::string*) const;
 
@@ -192,6 +224,9 @@ namespace AppInstaller::YAML
         TagType m_tagType;
         YAML::Mark m_mark;
         std::string m_scalar;
+        // When set, the scalar is a span over arena memory rather than m_scalar.
+        std::string_view m_scalarView;
+        std::shared_ptr<const ScalarArena> m_arena;
         std::optional<std::vector<Node>> m_sequence;
         std::optional<std::multimap<Node, Node>> m_mapping;
     };
@@ -77,17 +77,42 @@ namespace AppInstaller
                     return {};
                 }
 
+                // Output heavy commands resolve the same keys repeatedly (table headers and the
+                // like); the MRT lookup and UTF8 conversion are paid once per key per process.
+                // The language cannot change within the process, so entries never go stale.
+                {
+                    std::lock_guard<std::mutex> lock{ m_cacheLock };
+                    auto itr = m_cache.find(resKey);
+                    if (itr != m_cache.end())
+                    {
+                        return itr->second;
+                    }
+                }
+
+                std::string result;
+
                 if (m_wingetLoader)
                 {
-                    return Utility::ConvertToUTF8(m_wingetLoader.GetString(resKey));
+                    result = Utility::ConvertToUTF8(m_wingetLoader.GetString(resKey));
+                }
+                else
+                {
+                    // Loader failed to load resource file, print the resource key instead.
+                    result = Utility::ConvertToUTF8(resKey);
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock{ m_cacheLock };
+                    m_cache.emplace(std::wstring{ resKey }, result);
                 }
 
-                // Loader failed to load resource file, print the resource key instead.
-                return Utility::ConvertToUTF8(resKey);
+                return result;
             }
 
         private:
             winrt::Windows::ApplicationModel::Resources::ResourceLoader m_wingetLoader;
+            mutable std::mutex m_cacheLock;
+            mutable std::map<std::wstring, std::string, std::less<>> m_cache;
 
             Loader() : m_wingetLoader(nullptr)
             {
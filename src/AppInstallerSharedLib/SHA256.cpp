@@ -7,6 +7,9 @@
 #include "Public/AppInstallerErrors.h"
 #include "Public/AppInstallerStrings.h"
 
+#include <condition_variable>
+#include <thread>
+
 namespace AppInstaller::Utility {
 
     struct SHA256Context
@@ -148,10 +151,137 @@ namespace AppInstaller::Utility {
 
     SHA256::HashBuffer SHA256::ComputeHashFromFile(const std::filesystem::path& path)
     {
+        constexpr uintmax_t pipelineMinimumFileSize = 4 << 20;
+        constexpr size_t bufferSize = 1024 * 1024; // 1MB
+
+        std::error_code error;
+        uintmax_t fileSize = std::filesystem::file_size(path, error);
+
         std::ifstream inStream{ path, std::ifstream::binary };
-        const Utility::SHA256::HashBuffer& targetFileHash = Utility::SHA256::ComputeHash(inStream);
-        inStream.close();
-        return targetFileHash;
+
+        // Small files are not worth a thread; hash them inline.
+        if (error || fileSize < pipelineMinimumFileSize)
+        {
+            return ComputeHash(inStream);
+        }
+
+        // Hash on a background thread while this thread reads the next chunk, so that the
+        // disk and the hash engine run concurrently instead of back to back.
+        auto excState = inStream.exceptions();
+        auto revertExcState = wil::scope_exit([excState, &inStream]() { inStream.exceptions(excState); });
+        inStream.exceptions(std::ios_base::badbit);
+
+        SHA256 hasher;
+
+        struct Chunk
+        {
+            std::unique_ptr<uint8_t[]> Data;
+            size_t Size = 0;
+        };
+
+        std::mutex lock;
+        std::condition_variable signal;
+        std::optional<Chunk> pending;
+        std::vector<std::unique_ptr<uint8_t[]>> freeBuffers;
+        bool done = false;
+        std::exception_ptr hashException;
+
+        freeBuffers.emplace_back(std::make_unique<uint8_t[]>(bufferSize));
+        freeBuffers.emplace_back(std::make_unique<uint8_t[]>(bufferSize));
+
+        std::thread hashThread([&]()
+            {
+                try
+                {
+                    for (;;)
+                    {
+                        Chunk chunk;
+                        {
+                            std::unique_lock<std::mutex> lockScope(lock);
+                            signal.wait(lockScope, [&]() { return pending.has_value() || done; });
+                            if (!pending)
+                            {
+                                return;
+                            }
+                            chunk = std::move(pending.value());
+                            pending.reset();
+                        }
+                        signal.notify_all();
+
+                        hasher.Add(chunk.Data.get(), chunk.Size);
+
+                        {
+                            std::lock_guard<std::mutex> lockScope(lock);
+                            freeBuffers.emplace_back(std::move(chunk.Data));
+                        }
+                        signal.notify_all();
+                    }
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lockScope(lock);
+                    hashException = std::current_exception();
+                    signal.notify_all();
+                }
+            });
+
+        auto joinHashThread = [&]()
+            {
+                {
+                    std::lock_guard<std::mutex> lockScope(lock);
+                    done = true;
+                }
+                signal.notify_all();
+                hashThread.join();
+            };
+
+        try
+        {
+            while (inStream.good())
+            {
+                std::unique_ptr<uint8_t[]> buffer;
+                {
+                    std::unique_lock<std::mutex> lockScope(lock);
+                    signal.wait(lockScope, [&]() { return !freeBuffers.empty() || hashException; });
+                    if (hashException)
+                    {
+                        break;
+                    }
+                    buffer = std::move(freeBuffers.back());
+                    freeBuffers.pop_back();
+                }
+
+                inStream.read(reinterpret_cast<char*>(buffer.get()), bufferSize);
+                size_t read = static_cast<size_t>(inStream.gcount());
+                if (read)
+                {
+                    std::unique_lock<std::mutex> lockScope(lock);
+                    signal.wait(lockScope, [&]() { return !pending.has_value() || hashException; });
+                    if (hashException)
+                    {
+                        break;
+                    }
+                    pending = Chunk{ std::move(buffer), read };
+                    signal.notify_all();
+                }
+            }
+        }
+        catch (...)
+        {
+            joinHashThread();
+            throw;
+        }
+
+        joinHashThread();
+
+        if (hashException)
+        {
+            std::rethrow_exception(hashException);
+        }
+
+        THROW_HR_IF(APPINSTALLER_CLI_ERROR_STREAM_READ_FAILURE, !inStream.eof());
+
+        return hasher.Get();
     }
 
     void SHA256::SHA256ContextDeleter::operator()(SHA256Context* context)
@@ -44,26 +44,29 @@ namespace AppInstaller::Utility
         m_version = std::move(version);
 
         // Process approximate comparator if applicable
-        std::string baseVersion = m_version;
+        std::string_view baseVersion = m_version;
         if (CaseInsensitiveStartsWith(m_version, s_Approximate_Less_Than))
         {
             m_approximateComparator = ApproximateComparator::LessThan;
-            baseVersion = m_version.substr(s_Approximate_Less_Than.length(), m_version.length() - s_Approximate_Less_Than.length());
+            baseVersion.remove_prefix(s_Approximate_Less_Than.length());
         }
         else if (CaseInsensitiveStartsWith(m_version, s_Approximate_Greater_Than))
         {
             m_approximateComparator = ApproximateComparator::GreaterThan;
-            baseVersion = m_version.substr(s_Approximate_Greater_Than.length(), m_version.length() - s_Approximate_Greater_Than.length());
+            baseVersion.remove_prefix(s_Approximate_Greater_Than.length());
         }
 
         // Then parse the base version
+        m_parts.reserve(static_cast<size_t>(std::count_if(baseVersion.begin(), baseVersion.end(),
+            [&](char c) { return splitChars.find(c) != std::string_view::npos; })) + 1);
+
         size_t pos = 0;
 
         while (pos < baseVersion.length())
         {
             size_t newPos = baseVersion.find_first_of(splitChars, pos);
 
-            size_t length = (newPos == std::string::npos ? baseVersion.length() : newPos) - pos;
+            size_t length = (newPos == std::string_view::npos ? baseVersion.length() : newPos) - pos;
             m_parts.emplace_back(baseVersion.substr(pos, length));
 
             pos += length + 1;
@@ -279,21 +282,22 @@ namespace AppInstaller::Utility
             (m_approximateComparator == ApproximateComparator::None && other.m_approximateComparator == ApproximateComparator::GreaterThan);
     }
 
-    Version::Part::Part(const std::string& part)
+    Version::Part::Part(std::string_view part)
     {
-        const char* begin = part.c_str();
-        char* end = nullptr;
-        errno = 0;
-        Integer = strtoull(begin, &end, 10);
+        // Taking the part as a view allows version strings to be split without
+        // allocating a copy of each piece; only non-integer remainders allocate.
+        const char* begin = part.data();
+        const char* end = part.data() + part.length();
+        auto result = std::from_chars(begin, end, Integer, 10);
 
-        if (errno == ERANGE)
+        if (result.ec == std::errc::result_out_of_range)
         {
             Integer = 0;
             Other = part;
         }
-        else if (static_cast<size_t>(end - begin) != part.length())
+        else if (result.ptr != end)
         {
-            Other = end;
+            Other.assign(result.ptr, end);
         }
     }
 
@@ -179,6 +179,22 @@ namespace AppInstaller::YAML
         return m_mark;
     }
 
+    std::string_view ScalarArena::Intern(std::string_view value)
+    {
+        if (m_blocks.empty() || m_blocks.back().capacity() - m_blocks.back().size() < value.size())
+        {
+            std::vector<char> block;
+            block.reserve(std::max(s_MinimumBlockSize, value.size()));
+            m_blocks.emplace_back(std::move(block));
+        }
+
+        // Blocks are never resized beyond their reservation, so the bytes stay put.
+        std::vector<char>& block = m_blocks.back();
+        size_t offset = block.size();
+        block.insert(block.end(), value.begin(), value.end());
+        return { block.data() + offset, value.size() };
+    }
+
     Node::Node(Type type, std::string tag, const YAML::Mark& mark) :
         m_type(type), m_tag(std::move(tag)), m_mark(mark)
     {
@@ -198,12 +214,27 @@ namespace AppInstaller::YAML
     {
         Require(Type::Scalar);
         m_scalar = std::move(value);
+        // The owned string now holds the value; drop any span over arena memory.
+        m_scalarView = {};
+        m_arena.reset();
     }
 
     void Node::SetScalar(std::string value, bool isQuoted)
     {
         this->SetScalar(value);
+        ResolveUnquotedScalarTag(isQuoted);
+    }
+
+    void Node::SetScalar(std::string_view value, bool isQuoted, std::shared_ptr<const ScalarArena> arena)
+    {
+        Require(Type::Scalar);
+        m_scalarView = value;
+        m_arena = std::move(arena);
+        ResolveUnquotedScalarTag(isQuoted);
+    }
 
+    void Node::ResolveUnquotedScalarTag(bool isQuoted)
+    {
         // For untagged scalar nodes, libyaml always assigns the generic string
         // tag. Here we just try our best and assume that if the value is unquoted
         // then is not necessarily a string.
@@ -232,7 +263,7 @@ namespace AppInstaller::YAML
     {
         Require(Type::Scalar);
         other.Require(Type::Scalar);
-        return this->m_scalar < other.m_scalar;
+        return this->ScalarView() < other.ScalarView();
     }
 
     Node& Node::operator[](std::string_view key)
@@ -315,36 +346,46 @@ namespace AppInstaller::YAML
         THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_INVALID_OPERATION, m_type != type);
     }
 
+    std::string_view Node::as_dispatch(std::string_view*) const
+    {
+        return ScalarView();
+    }
+
+    std::optional<std::string_view> Node::try_as_dispatch(std::string_view*) const
+    {
+        return std::optional{ ScalarView() };
+    }
+
     std::string Node::as_dispatch(std::string*) const
     {
-        return m_scalar;
+        return std::string{ ScalarView() };
     }
 
     std::optional<std::string> Node::try_as_dispatch(std::string*) const
     {
-        return std::optional{ m_scalar };
+        return std::optional{ std::string{ ScalarView() } };
     }
 
     std::wstring Node::as_dispatch(std::wstring*) const
     {
-        return Utility::ConvertToUTF16(m_scalar);
+        return Utility::ConvertToUTF16(ScalarView());
     }
 
     std::optional<std::wstring> Node::try_as_dispatch(std::wstring*) const
     {
-        return Utility::TryConvertToUTF16(m_scalar);
+        return Utility::TryConvertToUTF16(ScalarView());
     }
 
     int64_t Node::as_dispatch(int64_t*) const
     {
-        return std::stoll(m_scalar);
+        return std::stoll(std::string{ ScalarView() });
     }
 
     std::optional<int64_t> Node::try_as_dispatch(int64_t*) const
     {
         try
         {
-            return std::optional{ std::stoll(m_scalar) };
+            return std::optional{ std::stoll(std::string{ ScalarView() }) };
         }
         catch(...)
         {
@@ -355,14 +396,14 @@ namespace AppInstaller::YAML
     int Node::as_dispatch(int*) const
     {
         // To allow HResult representation
-        return static_cast<int>(std::stoll(m_scalar, 0, 0));
+        return static_cast<int>(std::stoll(std::string{ ScalarView() }, 0, 0));
     }
 
     std::optional<int> Node::try_as_dispatch(int*) const
     {
         try
         {
-            return std::optional{ static_cast<int>(std::stoll(m_scalar, 0, 0)) };
+            return std::optional{ static_cast<int>(std::stoll(std::string{ ScalarView() }, 0, 0)) };
         }
         catch (...)
         {
@@ -386,11 +427,11 @@ namespace AppInstaller::YAML
 
     std::optional<bool> Node::try_as_dispatch(bool*) const
     {
-        if (Utility::CaseInsensitiveEquals(m_scalar, "true"))
+        if (Utility::CaseInsensitiveEquals(ScalarView(), "true"))
         {
             return std::optional{ true };
         }
-        else if (Utility::CaseInsensitiveEquals(m_scalar, "false"))
+        else if (Utility::CaseInsensitiveEquals(ScalarView(), "false"))
         {
             return std::optional{ false };
         }
@@ -401,16 +442,7 @@ namespace AppInstaller::YAML
     Node Load(std::string_view input)
     {
         Wrapper::Parser parser(input);
-        Wrapper::Document document = parser.Load();
-
-        if (document.HasRoot())
-        {
-            return document.GetRoot();
-        }
-        else
-        {
-            return {};
-        }
+        return parser.LoadAsNode();
     }
 
     Node Load(const std::string& input)
@@ -421,16 +453,7 @@ namespace AppInstaller::YAML
     Node Load(std::istream& input, Utility::SHA256::HashBuffer* hashOut)
     {
         Wrapper::Parser parser(input, hashOut);
-        Wrapper::Document document = parser.Load();
-
-        if (document.HasRoot())
-        {
-            return document.GetRoot();
-        }
-        else
-        {
-            return {};
-        }
+        return parser.LoadAsNode();
     }
 
     Node Load(const std::filesystem::path& input, Utility::SHA256::HashBuffer* hashOut)
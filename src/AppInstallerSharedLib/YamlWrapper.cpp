@@ -278,24 +278,180 @@ namespace AppInstaller::YAML::Wrapper
 
         if (!yaml_parser_load(&m_parser, &result))
         {
-            Exception::Type type = ConvertErrorType(m_parser.error);
+            ThrowParserError();
+        }
 
-            switch (type)
+        return result;
+    }
+
+    Node Parser::LoadAsNode()
+    {
+        // An open container node and the anchor to record for it upon completion.
+        struct OpenNode
+        {
+            OpenNode(YAML::Node* n, std::string&& a) : node(n), anchor(std::move(a)) {}
+
+            YAML::Node* node = nullptr;
+            std::string anchor;
+            // The key awaiting its value, when the node is a mapping.
+            std::optional<YAML::Node> pendingKey;
+        };
+
+        Node root;
+        std::vector<OpenNode> openNodes;
+        std::map<std::string, Node> anchors;
+
+        // All scalar bytes for the document are interned here; the nodes keep spans over
+        // it and share ownership, so a single copy of each scalar backs the entire tree.
+        auto arena = std::make_shared<ScalarArena>();
+
+        auto convertAnchor = [](yaml_char_t* anchor) { return anchor ? ConvertYamlString(anchor) : std::string{}; };
+
+        // Places a completed node into the enclosing container (or the root), recording its anchor if present.
+        auto attach = [&](Node&& node, std::string&& anchor)
+        {
+            if (!anchor.empty())
+            {
+                anchors.insert_or_assign(std::move(anchor), node);
+            }
+
+            if (openNodes.empty())
+            {
+                root = std::move(node);
+                return static_cast<Node*>(nullptr);
+            }
+
+            OpenNode& parent = openNodes.back();
+
+            if (parent.node->IsSequence())
+            {
+                return &parent.node->AddSequenceNode(std::move(node));
+            }
+            else
+            {
+                if (!parent.pendingKey)
+                {
+                    THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_INVALID_MAPPING_KEY, !node.IsScalar());
+                    parent.pendingKey = std::move(node);
+                    return static_cast<Node*>(nullptr);
+                }
+                else
+                {
+                    Node key = std::move(parent.pendingKey).value();
+                    parent.pendingKey.reset();
+                    return &parent.node->AddMappingNode(std::move(key), std::move(node));
+                }
+            }
+        };
+
+        bool done = false;
+
+        while (!done)
+        {
+            yaml_event_t event;
+            if (!yaml_parser_parse(&m_parser, &event))
+            {
+                ThrowParserError();
+            }
+
+            auto deleteEvent = wil::scope_exit([&event]() { yaml_event_delete(&event); });
+
+            switch (event.type)
+            {
+            case YAML_STREAM_START_EVENT:
+            case YAML_DOCUMENT_START_EVENT:
+                break;
+            case YAML_DOCUMENT_END_EVENT:
+            case YAML_STREAM_END_EVENT:
+                done = true;
+                break;
+            case YAML_SCALAR_EVENT:
+            {
+                // The composer resolves untagged scalars to the default (string) tag; do the same here.
+                Node scalar(
+                    Node::Type::Scalar,
+                    event.data.scalar.tag ? ConvertYamlString(event.data.scalar.tag) : std::string{ YAML_DEFAULT_SCALAR_TAG },
+                    ConvertMark(event.start_mark));
+                scalar.SetScalar(
+                    arena->Intern({ reinterpret_cast<const char*>(event.data.scalar.value), event.data.scalar.length }),
+                    event.data.scalar.style == YAML_SINGLE_QUOTED_SCALAR_STYLE ||
+                    event.data.scalar.style == YAML_DOUBLE_QUOTED_SCALAR_STYLE,
+                    arena);
+                attach(std::move(scalar), convertAnchor(event.data.scalar.anchor));
+                break;
+            }
+            case YAML_ALIAS_EVENT:
+            {
+                auto itr = anchors.find(ConvertYamlString(event.data.alias.anchor));
+                THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_DOC_BUILD_FAILED, itr == anchors.end());
+                attach(Node{ itr->second }, {});
+                break;
+            }
+            case YAML_SEQUENCE_START_EVENT:
+            case YAML_MAPPING_START_EVENT:
+            {
+                bool isSequence = (event.type == YAML_SEQUENCE_START_EVENT);
+                yaml_char_t* tag = (isSequence ? event.data.sequence_start.tag : event.data.mapping_start.tag);
+                yaml_char_t* anchor = (isSequence ? event.data.sequence_start.anchor : event.data.mapping_start.anchor);
+
+                Node container(
+                    isSequence ? Node::Type::Sequence : Node::Type::Mapping,
+                    tag ? ConvertYamlString(tag) : std::string{ isSequence ? YAML_DEFAULT_SEQUENCE_TAG : YAML_DEFAULT_MAPPING_TAG },
+                    ConvertMark(event.start_mark));
+
+                std::string anchorString = convertAnchor(anchor);
+
+                if (openNodes.empty())
+                {
+                    root = std::move(container);
+                    openNodes.emplace_back(&root, std::move(anchorString));
+                }
+                else
+                {
+                    // A container cannot be a mapping key; attach throws for that case.
+                    Node* placed = attach(std::move(container), {});
+                    openNodes.emplace_back(placed, std::move(anchorString));
+                }
+                break;
+            }
+            case YAML_SEQUENCE_END_EVENT:
+            case YAML_MAPPING_END_EVENT:
             {
-            case Exception::Type::Memory:
-                THROW_EXCEPTION(Exception(type));
-            case Exception::Type::Reader:
-                THROW_EXCEPTION(Exception(type, m_parser.problem, m_parser.problem_offset, m_parser.problem_value));
-            case Exception::Type::Scanner:
-            case Exception::Type::Parser:
-            case Exception::Type::Composer:
-                THROW_EXCEPTION(Exception(type, m_parser.problem, ConvertMark(m_parser.problem_mark), m_parser.context, ConvertMark(m_parser.context_mark)));
-            default:
-                THROW_EXCEPTION(Exception(type, "An unexpected error type occurred in Parser::Load"));
+                THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_DOC_BUILD_FAILED, openNodes.empty());
+                OpenNode completed = std::move(openNodes.back());
+                openNodes.pop_back();
+
+                if (!completed.anchor.empty())
+                {
+                    anchors.insert_or_assign(std::move(completed.anchor), *completed.node);
+                }
+                break;
+            }
+            case YAML_NO_EVENT:
+                break;
             }
         }
 
-        return result;
+        return root;
+    }
+
+    void Parser::ThrowParserError()
+    {
+        Exception::Type type = ConvertErrorType(m_parser.error);
+
+        switch (type)
+        {
+        case Exception::Type::Memory:
+            THROW_EXCEPTION(Exception(type));
+        case Exception::Type::Reader:
+            THROW_EXCEPTION(Exception(type, m_parser.problem, m_parser.problem_offset, m_parser.problem_value));
+        case Exception::Type::Scanner:
+        case Exception::Type::Parser:
+        case Exception::Type::Composer:
+            THROW_EXCEPTION(Exception(type, m_parser.problem, ConvertMark(m_parser.problem_mark), m_parser.context, ConvertMark(m_parser.context_mark)));
+        default:
+            THROW_EXCEPTION(Exception(type, "An unexpected error type occurred in Parser::Load"));
+        }
     }
 
     void Parser::PrepareInput()
@@ -83,10 +83,18 @@ namespace AppInstaller::YAML::Wrapper
         // Loads the next document from the input, if one exists.
         Document Load();
 
+        // Loads the next document from the input directly into a node tree built from
+        // parse events, skipping materialization of the intermediate libyaml document.
+        // Returns an invalid node if no document exists.
+        Node LoadAsNode();
+
     private:
         // Determines the type of encoding in use, transforming the input as necessary.
         void PrepareInput();
 
+        // Throws the appropriate exception for the current parser error state.
+        [[noreturn]] void ThrowParserError();
+
         DestructionToken m_token;
         yaml_parser_t m_parser;
         std::string m_input;
@@ -22,6 +22,7 @@
 #pragma warning( pop )
 
 #include <algorithm>
+#include <charconv>
 #include <chrono>
 #include <cwctype>
 #include <filesystem>
@@ -29,6 +30,7 @@
 #include <functional>
 #include <iomanip>
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -0,0 +1,108 @@
+﻿// -----------------------------------------------------------------------------
+// <copyright file="DscResourceInfoCache.cs" company="Microsoft Corporation">
+//     Copyright (c) Microsoft Corporation. Licensed under the MIT License.
+// </copyright>
+// -----------------------------------------------------------------------------
+
+namespace Microsoft.Management.Configuration.Processor.Helpers
+{
+    using System;
+    using System.Collections.Concurrent;
+    using System.IO;
+    using Microsoft.Management.Configuration.Processor.DscResourcesInfo;
+    using Microsoft.PowerShell.Commands;
+
+    /// <summary>
+    /// Caches discovered DSC resources for the lifetime of the process. Get-DscResource walks
+    /// the entire PSModulePath on every call, which dominates apply time on machines where the
+    /// modules are already installed. Entries are keyed by resource name and module specification
+    /// and are dropped when the module file they were discovered from changes on disk, so module
+    /// installs and updates are picked up by the next lookup.
+    /// </summary>
+    internal static class DscResourceInfoCache
+    {
+        private static readonly ConcurrentDictionary<string, CacheEntry> Cache = new ConcurrentDictionary<string, CacheEntry>();
+
+        /// <summary>
+        /// Looks for a cached DSC resource matching the given resource name and module specification.
+        /// </summary>
+        /// <param name="resourceName">DSC resource name.</param>
+        /// <param name="moduleSpecification">Optional module specification.</param>
+        /// <returns>DscResourceInfoInternal. Null if not cached or no longer valid.</returns>
+        public static DscResourceInfoInternal? TryGet(string resourceName, ModuleSpecification? moduleSpecification)
+        {
+            string key = CreateKey(resourceName, moduleSpecification);
+
+            if (Cache.TryGetValue(key, out CacheEntry? entry))
+            {
+                if (entry.IsStillValid())
+                {
+                    return entry.Resource;
+                }
+
+                Cache.TryRemove(key, out _);
+            }
+
+            return null;
+        }
+
+        /// <summary>
+        /// Stores a discovered DSC resource. Resources without a backing file are not cached,
+        /// as there is nothing to invalidate the entry against.
+        /// </summary>
+        /// <param name="resourceName">DSC resource name used for the discovery.</param>
+        /// <param name="moduleSpecification">Optional module specification used for the discovery.</param>
+        /// <param name="resource">The discovered resource.</param>
+        public static void Store(string resourceName, ModuleSpecification? moduleSpecification, DscResourceInfoInternal resource)
+        {
+            string? filePath = resource.Path ?? resource.ParentPath;
+            if (string.IsNullOrEmpty(filePath) || !File.Exists(filePath))
+            {
+                return;
+            }
+
+            string key = CreateKey(resourceName, moduleSpecification);
+            Cache[key] = new CacheEntry(resource, filePath, File.GetLastWriteTimeUtc(filePath));
+        }
+
+        /// <summary>
+        /// Removes all cached resources.
+        /// </summary>
+        public static void Clear()
+        {
+            Cache.Clear();
+        }
+
+        private static string CreateKey(string resourceName, ModuleSpecification? moduleSpecification)
+        {
+            return string.Join(
+                '|',
+                StringHelpers.Normalize(resourceName),
+                moduleSpecification?.Name is null ? string.Empty : StringHelpers.Normalize(moduleSpecification.Name),
+                moduleSpecification?.RequiredVersion?.ToString() ?? string.Empty,
+                moduleSpecification?.Version?.ToString() ?? string.Empty,
+                moduleSpecification?.MaximumVersion?.ToString() ?? string.Empty);
+        }
+
+        private sealed class CacheEntry
+        {
+            public CacheEntry(DscResourceInfoInternal resource, string filePath, DateTime lastWriteTimeUtc)
+            {
+                this.Resource = resource;
+                this.FilePath = filePath;
+                this.LastWriteTimeUtc = lastWriteTimeUtc;
+            }
+
+            public DscResourceInfoInternal Resource { get; }
+
+            private string FilePath { get; }
+
+            private DateTime LastWriteTimeUtc { get; }
+
+            public bool IsStillValid()
+            {
+                return File.Exists(this.FilePath) && File.GetLastWriteTimeUtc(this.FilePath) == this.LastWriteTimeUtc;
+            }
+        }
+    }
+}
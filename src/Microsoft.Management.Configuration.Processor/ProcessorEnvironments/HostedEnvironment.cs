@@ -32,6 +32,8 @@ namespace Microsoft.Management.Configuration.Processor.Runspaces
     {
         private readonly ConfigurationProcessorType type;
 
+        private bool disposed;
+
         /// <summary>
         /// Initializes a new instance of the <see cref="HostedEnvironment"/> class.
         /// </summary>
@@ -58,6 +60,30 @@ namespace Microsoft.Management.Configuration.Processor.Runspaces
         /// </summary>
         internal ConfigurationSetProcessorFactory? SetProcessorFactory { get; init; }
 
+        /// <summary>
+        /// Gets or initializes the key to return the runspace to the <see cref="RunspacePool"/>
+        /// with on dispose. When null, the runspace is disposed instead of pooled.
+        /// </summary>
+        internal string? RunspacePoolKey { get; init; }
+
+        /// <inheritdoc/>
+        public void Dispose()
+        {
+            if (!this.disposed)
+            {
+                this.disposed = true;
+
+                if (this.RunspacePoolKey is not null)
+                {
+                    RunspacePool.Return(this.RunspacePoolKey, this.Runspace);
+                }
+                else
+                {
+                    this.Runspace.Dispose();
+                }
+            }
+        }
+
         /// <inheritdoc/>
         public void ValidateRunspace()
         {
@@ -120,9 +146,22 @@ namespace Microsoft.Management.Configuration.Processor.Runspaces
         /// <inheritdoc/>
         public DscResourceInfoInternal? GetDscResource(ConfigurationUnitInternal unitInternal)
         {
+            var cachedResult = DscResourceInfoCache.TryGet(unitInternal.Unit.UnitName, unitInternal.Module);
+            if (cachedResult is not null)
+            {
+                this.OnDiagnostics(DiagnosticLevel.Verbose, $"Using cached DSC resource info for {unitInternal.Unit.UnitName}");
+                return cachedResult;
+            }
+
             using PowerShell pwsh = PowerShell.Create(this.Runspace);
             var result = this.DscModule.GetDscResource(pwsh, unitInternal.Unit.UnitName, unitInternal.Module);
             this.OnDiagnostics(DiagnosticLevel.Verbose, pwsh);
+
+            if (result is not null)
+            {
+                DscResourceInfoCache.Store(unitInternal.Unit.UnitName, unitInternal.Module, result);
+            }
+
             return result;
         }
 
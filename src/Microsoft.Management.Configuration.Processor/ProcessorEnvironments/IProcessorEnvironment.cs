@@ -6,6 +6,7 @@
 
 namespace Microsoft.Management.Configuration.Processor.ProcessorEnvironments
 {
+    using System;
     using System.Collections.Generic;
     using System.Management.Automation;
     using Microsoft.Management.Configuration.Processor.DscResourcesInfo;
@@ -16,8 +17,10 @@ namespace Microsoft.Management.Configuration.Processor.ProcessorEnvironments
 
     /// <summary>
     /// IProcessorEnvironment. Provides interaction with PowerShell.
+    /// Disposing the environment releases the runspace, which may return it to a pool
+    /// for reuse; the environment must not be used afterwards.
     /// </summary>
-    internal interface IProcessorEnvironment
+    internal interface IProcessorEnvironment : IDisposable
     {
         /// <summary>
         /// Gets the runspace.
@@ -61,19 +61,28 @@ namespace Microsoft.Management.Configuration.Processor.ProcessorEnvironments
             if (this.type == ConfigurationProcessorType.Hosted ||
                 this.type == ConfigurationProcessorType.Default)
             {
-                var initialSessionState = this.CreateInitialSessionState(
-                    executionPolicy,
-                    new List<ModuleSpecification>
-                    {
-                        dscModule.ModuleSpecification,
-                    });
+                var modules = new List<ModuleSpecification>
+                {
+                    dscModule.ModuleSpecification,
+                };
+
+                // Opening a runspace is expensive; reuse a pooled one from a previous environment
+                // with the same execution policy and module set when available.
+                string poolKey = RunspacePool.CreateKey(executionPolicy, modules);
+                var runspace = RunspacePool.TryTake(poolKey);
+
+                if (runspace is null)
+                {
+                    var initialSessionState = this.CreateInitialSessionState(executionPolicy, modules);
 
-                var runspace = RunspaceFactory.CreateRunspace(initialSessionState);
-                runspace.Open();
+                    runspace = RunspaceFactory.CreateRunspace(initialSessionState);
+                    runspace.Open();
+                }
 
                 return new HostedEnvironment(runspace, this.type, dscModule)
                 {
                     SetProcessorFactory = setProcessorFactory,
+                    RunspacePoolKey = poolKey,
                 };
             }
 
@@ -0,0 +1,113 @@
+﻿// -----------------------------------------------------------------------------
+// <copyright file="RunspacePool.cs" company="Microsoft Corporation">
+//     Copyright (c) Microsoft Corporation. Licensed under the MIT License.
+// </copyright>
+// -----------------------------------------------------------------------------
+
+namespace Microsoft.Management.Configuration.Processor.ProcessorEnvironments
+{
+    using System.Collections.Generic;
+    using System.Linq;
+    using System.Management.Automation.Runspaces;
+    using Microsoft.PowerShell;
+    using Microsoft.PowerShell.Commands;
+
+    /// <summary>
+    /// Process wide cache of opened runspaces. Opening a runspace takes hundreds of milliseconds,
+    /// so reusing a warm one is a significant win when many set processors are created in sequence.
+    /// Runspaces are only shared between environments created with the same execution policy and
+    /// initial module set; the variable table is reset on return, while modules imported during use
+    /// intentionally stay loaded so they do not have to be imported again.
+    /// </summary>
+    internal static class RunspacePool
+    {
+        private const int MaxPooledRunspacesPerKey = 4;
+
+        private static readonly object PoolLock = new object();
+        private static readonly Dictionary<string, List<Runspace>> Pool = new Dictionary<string, List<Runspace>>();
+
+        /// <summary>
+        /// Creates the pool key for the given initial runspace configuration.
+        /// </summary>
+        /// <param name="policy">Execution policy.</param>
+        /// <param name="modules">Modules imported by the initial session state.</param>
+        /// <returns>The pool key.</returns>
+        public static string CreateKey(ExecutionPolicy policy, IReadOnlyList<ModuleSpecification> modules)
+        {
+            return $"{policy}|{string.Join("|", modules.Select(m => m.ToString()))}";
+        }
+
+        /// <summary>
+        /// Takes a pooled runspace for the given key, if one is available.
+        /// </summary>
+        /// <param name="key">The pool key the runspace was created for.</param>
+        /// <returns>An opened runspace, or null when the pool has none.</returns>
+        public static Runspace? TryTake(string key)
+        {
+            lock (PoolLock)
+            {
+                if (Pool.TryGetValue(key, out var runspaces))
+                {
+                    while (runspaces.Count > 0)
+                    {
+                        Runspace runspace = runspaces[runspaces.Count - 1];
+                        runspaces.RemoveAt(runspaces.Count - 1);
+
+                        if (runspace.RunspaceStateInfo.State == RunspaceState.Opened)
+                        {
+                            return runspace;
+                        }
+
+                        // The runspace broke or was closed while pooled; drop it.
+                        runspace.Dispose();
+                    }
+                }
+            }
+
+            return null;
+        }
+
+        /// <summary>
+        /// Returns a runspace to the pool, resetting its state for the next user.
+        /// The caller must not use the runspace afterwards.
+        /// </summary>
+        /// <param name="key">The pool key the runspace was created for.</param>
+        /// <param name="runspace">The runspace to return.</param>
+        public static void Return(string key, Runspace runspace)
+        {
+            if (runspace.RunspaceStateInfo.State == RunspaceState.Opened)
+            {
+                try
+                {
+                    // Resets the variable table back to the initial session state; imported
+                    // modules are deliberately kept warm.
+                    runspace.ResetRunspaceState();
+                }
+                catch
+                {
+                    // A runspace that cannot be reset (e.g. a pipeline is still running) is
+                    // not safe to hand to the next user.
+                    runspace.Dispose();
+                    return;
+                }
+
+                lock (PoolLock)
+                {
+                    if (!Pool.TryGetValue(key, out var runspaces))
+                    {
+                        runspaces = new List<Runspace>();
+                        Pool.Add(key, runspaces);
+                    }
+
+                    if (runspaces.Count < MaxPooledRunspacesPerKey)
+                    {
+                        runspaces.Add(runspace);
+                        return;
+                    }
+                }
+            }
+
+            runspace.Dispose();
+        }
+    }
+}
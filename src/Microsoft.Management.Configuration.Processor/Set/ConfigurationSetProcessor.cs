@@ -20,10 +20,12 @@ namespace Microsoft.Management.Configuration.Processor.Set
     /// <summary>
     /// Configuration set processor.
     /// </summary>
-    internal sealed class ConfigurationSetProcessor : IConfigurationSetProcessor
+    internal sealed class ConfigurationSetProcessor : IConfigurationSetProcessor, IDisposable
     {
         private readonly ConfigurationSet configurationSet;
 
+        private bool disposed;
+
         /// <summary>
         /// Initializes a new instance of the <see cref="ConfigurationSetProcessor"/> class.
         /// </summary>
@@ -45,6 +47,20 @@ namespace Microsoft.Management.Configuration.Processor.Set
         /// </summary>
         internal IProcessorEnvironment ProcessorEnvironment { get; }
 
+        /// <summary>
+        /// Releases the processor environment, allowing its runspace to be reused by the
+        /// next set processor. Unit processors created by this set processor share the
+        /// environment and must not be used after the set processor is disposed.
+        /// </summary>
+        public void Dispose()
+        {
+            if (!this.disposed)
+            {
+                this.disposed = true;
+                this.ProcessorEnvironment.Dispose();
+            }
+        }
+
         /// <summary>
         /// Creates a configuration unit processor for the given unit.
         /// </summary>
@@ -239,6 +239,60 @@ namespace Microsoft.Management.Configuration.UnitTests.Tests
             this.VerifySummaryEvent(configurationSet, result, ConfigurationUnitResultSource.None);
         }
 
+        /// <summary>
+        /// Applying with the parallel flag still respects dependencies while running independent units.
+        /// </summary>
+        [Fact]
+        public void ApplySet_ParallelUnits()
+        {
+            ConfigurationSet configurationSet = new ConfigurationSet();
+            ConfigurationUnit apply1 = new ConfigurationUnit() { Intent = ConfigurationUnitIntent.Apply, Identifier = "Apply1" };
+            ConfigurationUnit apply2 = new ConfigurationUnit() { Intent = ConfigurationUnitIntent.Apply, Identifier = "Apply2", Dependencies = new string[] { apply1.Identifier } };
+            ConfigurationUnit apply3 = new ConfigurationUnit() { Intent = ConfigurationUnitIntent.Apply, Identifier = "Apply3" };
+            configurationSet.ConfigurationUnits = new ConfigurationUnit[] { apply2, apply1, apply3 };
+
+            TestConfigurationProcessorFactory factory = new TestConfigurationProcessorFactory();
+            TestConfigurationSetProcessor setProcessor = factory.CreateTestProcessor(configurationSet);
+
+            object applyOrderLock = new object();
+            List<string> applyOrder = new List<string>();
+
+            foreach (ConfigurationUnit unit in configurationSet.ConfigurationUnits)
+            {
+                TestConfigurationUnitProcessor unitProcessor = setProcessor.CreateTestProcessor(unit);
+                string identifier = unit.Identifier;
+                unitProcessor.TestSettingsDelegate = () => new TestSettingsResult { TestResult = ConfigurationTestResult.Negative };
+                unitProcessor.ApplySettingsDelegate = () =>
+                {
+                    lock (applyOrderLock)
+                    {
+                        applyOrder.Add(identifier);
+                    }
+
+                    return new ApplySettingsResult();
+                };
+            }
+
+            ConfigurationProcessor processor = this.CreateConfigurationProcessorWithDiagnostics(factory);
+
+            ApplyConfigurationSetResult result = processor.ApplySet(configurationSet, ApplyConfigurationSetFlags.ApplyUnitsInParallel);
+            Assert.NotNull(result);
+            Assert.Null(result.ResultCode);
+            Assert.Equal(3, result.UnitResults.Count);
+
+            foreach (var unitResult in result.UnitResults)
+            {
+                Assert.NotNull(unitResult);
+                Assert.NotNull(unitResult.ResultInformation);
+                Assert.Null(unitResult.ResultInformation.ResultCode);
+            }
+
+            Assert.Equal(3, applyOrder.Count);
+            Assert.True(applyOrder.IndexOf(apply1.Identifier) < applyOrder.IndexOf(apply2.Identifier));
+
+            this.VerifySummaryEvent(configurationSet, result, ConfigurationUnitResultSource.None);
+        }
+
         /// <summary>
         /// An assertion fails to run.
         /// </summary>
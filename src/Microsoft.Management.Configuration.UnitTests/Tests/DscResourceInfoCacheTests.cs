@@ -0,0 +1,87 @@
+﻿// -----------------------------------------------------------------------------
+// <copyright file="DscResourceInfoCacheTests.cs" company="Microsoft Corporation">
+//     Copyright (c) Microsoft Corporation. Licensed under the MIT License.
+// </copyright>
+// -----------------------------------------------------------------------------
+
+namespace Microsoft.Management.Configuration.UnitTests.Tests
+{
+    using System;
+    using System.IO;
+    using Microsoft.Management.Configuration.Processor.DscResourcesInfo;
+    using Microsoft.Management.Configuration.Processor.Helpers;
+    using Microsoft.Management.Configuration.UnitTests.Fixtures;
+    using Xunit;
+    using Xunit.Abstractions;
+
+    /// <summary>
+    /// DSC resource info cache tests.
+    /// </summary>
+    [Collection("UnitTestCollection")]
+    public class DscResourceInfoCacheTests
+    {
+        private readonly UnitTestFixture fixture;
+        private readonly ITestOutputHelper log;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="DscResourceInfoCacheTests"/> class.
+        /// </summary>
+        /// <param name="fixture">Unit test fixture.</param>
+        /// <param name="log">Log helper.</param>
+        public DscResourceInfoCacheTests(UnitTestFixture fixture, ITestOutputHelper log)
+        {
+            this.fixture = fixture;
+            this.log = log;
+        }
+
+        /// <summary>
+        /// A stored resource is returned until its backing file changes.
+        /// </summary>
+        [Fact]
+        public void DscResourceInfoCache_FileInvalidation()
+        {
+            DscResourceInfoCache.Clear();
+
+            string modulePath = Path.Combine(Path.GetTempPath(), Guid.NewGuid().ToString() + ".psm1");
+            File.WriteAllText(modulePath, "# test module");
+
+            try
+            {
+                var resource = new DscResourceInfoInternal("xResource", "xModule", new Version(1, 0));
+                resource.Path = modulePath;
+
+                DscResourceInfoCache.Store("xResource", null, resource);
+
+                var cached = DscResourceInfoCache.TryGet("xResource", null);
+                Assert.NotNull(cached);
+                Assert.Equal("xModule", cached!.ModuleName);
+
+                // A different resource name misses.
+                Assert.Null(DscResourceInfoCache.TryGet("otherResource", null));
+
+                // Changing the backing file drops the entry.
+                File.SetLastWriteTimeUtc(modulePath, DateTime.UtcNow + TimeSpan.FromSeconds(5));
+                Assert.Null(DscResourceInfoCache.TryGet("xResource", null));
+            }
+            finally
+            {
+                File.Delete(modulePath);
+                DscResourceInfoCache.Clear();
+            }
+        }
+
+        /// <summary>
+        /// A resource without a backing file is not cached.
+        /// </summary>
+        [Fact]
+        public void DscResourceInfoCache_NoFileNotCached()
+        {
+            DscResourceInfoCache.Clear();
+
+            var resource = new DscResourceInfoInternal("noFileResource", "xModule", new Version(1, 0));
+            DscResourceInfoCache.Store("noFileResource", null, resource);
+
+            Assert.Null(DscResourceInfoCache.TryGet("noFileResource", null));
+        }
+    }
+}
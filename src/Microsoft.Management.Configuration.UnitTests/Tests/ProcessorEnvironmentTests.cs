@@ -10,6 +10,7 @@ namespace Microsoft.Management.Configuration.UnitTests.Tests
     using System.Collections.Generic;
     using System.Linq;
     using System.Management.Automation;
+    using Microsoft.Management.Configuration.Processor;
     using Microsoft.Management.Configuration.Processor.ProcessorEnvironments;
     using Microsoft.Management.Configuration.UnitTests.Fixtures;
     using Moq;
@@ -216,5 +217,33 @@ namespace Microsoft.Management.Configuration.UnitTests.Tests
             psModulePath = processorEnv.GetVariable<string>(Variables.PSModulePath);
             Assert.Equal(psModulePathExpected, psModulePath);
         }
+
+        /// <summary>
+        /// Tests that disposing an environment returns its runspace to the pool and that the
+        /// next environment with the same configuration reuses it with reset state.
+        /// </summary>
+        [Fact]
+        public void HostedEnvironment_RunspaceReuse()
+        {
+            var factory = new ProcessorEnvironmentFactory(ConfigurationProcessorType.Hosted);
+
+            var processorEnv = factory.CreateEnvironment(null, ConfigurationProcessorPolicy.Unrestricted);
+            var runspace = processorEnv.Runspace;
+
+            string varName = "pooledRunspaceTestVar";
+            processorEnv.SetVariable(varName, "this should not survive the reset");
+            processorEnv.Dispose();
+
+            var reusedEnv = factory.CreateEnvironment(null, ConfigurationProcessorPolicy.Unrestricted);
+            try
+            {
+                Assert.Same(runspace, reusedEnv.Runspace);
+                Assert.Null(reusedEnv.GetVariable<object>(varName));
+            }
+            finally
+            {
+                reusedEnv.Dispose();
+            }
+        }
     }
 }
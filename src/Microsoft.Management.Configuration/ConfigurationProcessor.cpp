@@ -394,12 +394,11 @@ namespace winrt::Microsoft::Management::Configuration::implementation
         ApplyConfigurationSetFlags flags,
         AppInstaller::WinRT::AsyncProgress<ApplyConfigurationSetResult, ConfigurationSetChangeData> progress)
     {
-        // TODO: Not needed until we have history implemented
-        UNREFERENCED_PARAMETER(flags);
+        // TODO: DoNotOverwriteMatchingOriginSet is not needed until we have history implemented
 
         auto threadGlobals = m_threadGlobals.SetForCurrentThread();
 
-        ConfigurationSetApplyProcessor applyProcessor{ configurationSet, m_threadGlobals.GetTelemetryLogger(), m_factory.CreateSetProcessor(configurationSet), std::move(progress) };
+        ConfigurationSetApplyProcessor applyProcessor{ configurationSet, m_threadGlobals, m_factory.CreateSetProcessor(configurationSet), flags, std::move(progress) };
         applyProcessor.Process();
 
         return applyProcessor.Result();
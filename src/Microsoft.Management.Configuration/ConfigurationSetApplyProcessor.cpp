@@ -9,6 +9,9 @@
 #include <AppInstallerLogging.h>
 #include <AppInstallerStrings.h>
 
+#include <algorithm>
+#include <thread>
+
 namespace winrt::Microsoft::Management::Configuration::implementation
 {
     namespace
@@ -22,14 +25,17 @@ namespace winrt::Microsoft::Management::Configuration::implementation
 
     ConfigurationSetApplyProcessor::ConfigurationSetApplyProcessor(
         const Configuration::ConfigurationSet& configurationSet,
-        const TelemetryTraceLogger& telemetry,
+        ConfigThreadGlobals& threadGlobals,
         IConfigurationSetProcessor&& setProcessor,
+        ApplyConfigurationSetFlags flags,
         AppInstaller::WinRT::AsyncProgress<ApplyConfigurationSetResult, ConfigurationSetChangeData>&& progress) :
             m_configurationSet(configurationSet),
             m_setProcessor(std::move(setProcessor)),
-            m_telemetry(telemetry),
+            m_threadGlobals(threadGlobals),
+            m_telemetry(threadGlobals.GetTelemetryLogger()),
             m_result(make_self<wil::details::module_count_wrapper<implementation::ApplyConfigurationSetResult>>()),
-            m_progress(std::move(progress))
+            m_progress(std::move(progress)),
+            m_runUnitsInParallel((static_cast<uint32_t>(flags) & static_cast<uint32_t>(ApplyConfigurationSetFlags::ApplyUnitsInParallel)) != 0)
     {
         // Create a copy of the set of configuration units
         auto unitsView = configurationSet.ConfigurationUnits();
@@ -243,25 +249,62 @@ namespace winrt::Microsoft::Management::Configuration::implementation
         hresult errorForFailures,
         bool sendProgress)
     {
-        // Always process the first item in the list that is available to be processed
-        bool hasProcessed = true;
         bool hasFailure = false;
-        while (hasProcessed)
+
+        // Only the actual processing pass runs in parallel; the preprocessing pass is cheap
+        // and exists to detect dependency cycles.
+        if (m_runUnitsInParallel && sendProgress)
         {
-            hasProcessed = false;
-            for (auto itr = unitsToProcess.begin(), end = unitsToProcess.end(); itr != end; ++itr)
+            // Repeatedly gather every unit whose dependencies are satisfied and run that wave
+            // concurrently; each wave unblocks the units that depend on its members.
+            for (;;)
             {
-                UnitInfo& unitInfo = m_unitInfo[*itr];
-                if (HasIntentAndSatisfiedDependencies(unitInfo, intent, checkDependencyFunction))
+                std::vector<size_t> readyUnits;
+                for (size_t index : unitsToProcess)
                 {
-                    if (!(this->*processUnitFunction)(unitInfo))
+                    if (HasIntentAndSatisfiedDependencies(m_unitInfo[index], intent, checkDependencyFunction))
                     {
-                        hasFailure = true;
+                        readyUnits.emplace_back(index);
                     }
-                    unitsToProcess.erase(itr);
-                    hasProcessed = true;
+                }
+
+                if (readyUnits.empty())
+                {
                     break;
                 }
+
+                if (!ProcessUnitsInParallel(readyUnits, processUnitFunction))
+                {
+                    hasFailure = true;
+                }
+
+                unitsToProcess.erase(
+                    std::remove_if(unitsToProcess.begin(), unitsToProcess.end(),
+                        [&](size_t index) { return std::find(readyUnits.begin(), readyUnits.end(), index) != readyUnits.end(); }),
+                    unitsToProcess.end());
+            }
+        }
+        else
+        {
+            // Always process the first item in the list that is available to be processed
+            bool hasProcessed = true;
+            while (hasProcessed)
+            {
+                hasProcessed = false;
+                for (auto itr = unitsToProcess.begin(), end = unitsToProcess.end(); itr != end; ++itr)
+                {
+                    UnitInfo& unitInfo = m_unitInfo[*itr];
+                    if (HasIntentAndSatisfiedDependencies(unitInfo, intent, checkDependencyFunction))
+                    {
+                        if (!(this->*processUnitFunction)(unitInfo))
+                        {
+                            hasFailure = true;
+                        }
+                        unitsToProcess.erase(itr);
+                        hasProcessed = true;
+                        break;
+                    }
+                }
             }
         }
 
@@ -311,6 +354,85 @@ namespace winrt::Microsoft::Management::Configuration::implementation
         return true;
     }
 
+    bool ConfigurationSetApplyProcessor::ProcessUnitsInParallel(const std::vector<size_t>& readyUnits, ProcessUnitPtr processUnitFunction)
+    {
+        size_t threadCount = std::min<size_t>(readyUnits.size(), std::max<size_t>(std::thread::hardware_concurrency(), 1));
+
+        if (threadCount < 2)
+        {
+            bool result = true;
+            for (size_t index : readyUnits)
+            {
+                if (!(this->*processUnitFunction)(m_unitInfo[index]))
+                {
+                    result = false;
+                }
+            }
+            return result;
+        }
+
+        std::atomic_size_t nextUnit{ 0 };
+        std::atomic_bool anyFailure{ false };
+        std::mutex exceptionLock;
+        std::exception_ptr firstException;
+
+        auto worker = [&]()
+        {
+            // Worker threads need the thread globals so that their diagnostics and telemetry
+            // land in the same place as the thread that initiated the apply.
+            auto previousGlobals = m_threadGlobals.SetForCurrentThread();
+
+            for (;;)
+            {
+                size_t i = nextUnit.fetch_add(1);
+                if (i >= readyUnits.size())
+                {
+                    break;
+                }
+
+                try
+                {
+                    if (!(this->*processUnitFunction)(m_unitInfo[readyUnits[i]]))
+                    {
+                        anyFailure = true;
+                    }
+                }
+                catch (...)
+                {
+                    // Cancellation (and anything else thrown) ends the run; keep the first
+                    // exception and stop taking new units.
+                    std::lock_guard<std::mutex> lock{ exceptionLock };
+                    if (!firstException)
+                    {
+                        firstException = std::current_exception();
+                    }
+                    nextUnit = readyUnits.size();
+                    break;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < threadCount; ++i)
+        {
+            threads.emplace_back(worker);
+        }
+
+        worker();
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        if (firstException)
+        {
+            std::rethrow_exception(firstException);
+        }
+
+        return !anyFailure;
+    }
+
     bool ConfigurationSetApplyProcessor::HasIntentAndSatisfiedDependencies(
         const UnitInfo& unitInfo,
         ConfigurationUnitIntent intent,
@@ -486,6 +608,8 @@ namespace winrt::Microsoft::Management::Configuration::implementation
 
     void ConfigurationSetApplyProcessor::SendProgress(ConfigurationSetState state)
     {
+        std::lock_guard<std::mutex> lock{ m_progressLock };
+
         try
         {
             m_progress.Progress(implementation::ConfigurationSetChangeData::Create(state));
@@ -495,6 +619,9 @@ namespace winrt::Microsoft::Management::Configuration::implementation
 
     void ConfigurationSetApplyProcessor::SendProgress(ConfigurationUnitState state, const UnitInfo& unitInfo)
     {
+        // Concurrently running units all report through the one progress stream.
+        std::lock_guard<std::mutex> lock{ m_progressLock };
+
         unitInfo.Result->State(state);
 
         try
@@ -6,10 +6,12 @@
 #include "ApplyConfigurationSetResult.h"
 #include "ApplyConfigurationUnitResult.h"
 #include "ConfigurationUnitResultInformation.h"
+#include "ConfigThreadGlobals.h"
 #include "Telemetry/Telemetry.h"
 #include <winget/AsyncTokens.h>
 
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -26,7 +28,7 @@ namespace winrt::Microsoft::Management::Configuration::implementation
 
         using result_type = decltype(make_self<wil::details::module_count_wrapper<implementation::ApplyConfigurationSetResult>>());
 
-        ConfigurationSetApplyProcessor(const ConfigurationSet& configurationSet, const TelemetryTraceLogger& telemetry, IConfigurationSetProcessor&& setProcessor, AppInstaller::WinRT::AsyncProgress<ApplyConfigurationSetResult, ConfigurationSetChangeData>&& progress);
+        ConfigurationSetApplyProcessor(const ConfigurationSet& configurationSet, ConfigThreadGlobals& threadGlobals, IConfigurationSetProcessor&& setProcessor, ApplyConfigurationSetFlags flags, AppInstaller::WinRT::AsyncProgress<ApplyConfigurationSetResult, ConfigurationSetChangeData>&& progress);
 
         // Processes the apply for the configuration set.
         void Process();
@@ -73,6 +75,10 @@ namespace winrt::Microsoft::Management::Configuration::implementation
             hresult errorForFailures,
             bool sendProgress);
 
+        // Processes all of the given units, spreading them across worker threads.
+        // Returns true if every unit was successful, false if not.
+        bool ProcessUnitsInParallel(const std::vector<size_t>& readyUnits, ProcessUnitPtr processUnitFunction);
+
         // Determines if the given unit has the given intent and all of its dependencies are satisfied
         bool HasIntentAndSatisfiedDependencies(
             const UnitInfo& unitInfo,
@@ -102,11 +108,15 @@ namespace winrt::Microsoft::Management::Configuration::implementation
 
         ConfigurationSet m_configurationSet;
         IConfigurationSetProcessor m_setProcessor;
+        ConfigThreadGlobals& m_threadGlobals;
         const TelemetryTraceLogger& m_telemetry;
         result_type m_result;
         AppInstaller::WinRT::AsyncProgress<ApplyConfigurationSetResult, ConfigurationSetChangeData> m_progress;
         std::vector<UnitInfo> m_unitInfo;
         std::map<std::string, size_t> m_idToUnitInfoIndex;
         hresult m_resultCode;
+        bool m_runUnitsInParallel = false;
+        // Progress for concurrently running units is multiplexed into the single progress stream.
+        std::mutex m_progressLock;
     };
 }
@@ -102,6 +102,10 @@ namespace winrt::Microsoft::Management::Deployment::implementation
     Windows::Foundation::IAsyncOperation<winrt::Microsoft::Management::Deployment::CheckInstalledStatusResult> CatalogPackage::CheckInstalledStatusAsync(
         Microsoft::Management::Deployment::InstalledStatusType checkTypes)
     {
+        // Hold a strong reference across the suspension and move the blocking check to the
+        // thread pool so that the caller's thread is not consumed for the duration.
+        auto strong = get_strong();
+        co_await winrt::resume_background();
         co_return CheckInstalledStatus(checkTypes);
     }
     Microsoft::Management::Deployment::CheckInstalledStatusResult CatalogPackage::CheckInstalledStatus(
@@ -137,7 +141,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
     }
     winrt::Windows::Foundation::IAsyncOperation<winrt::Microsoft::Management::Deployment::CheckInstalledStatusResult> CatalogPackage::CheckInstalledStatusAsync()
     {
-        co_return CheckInstalledStatus(InstalledStatusType::AllChecks);
+        co_return co_await CheckInstalledStatusAsync(InstalledStatusType::AllChecks);
     }
     winrt::Microsoft::Management::Deployment::CheckInstalledStatusResult CatalogPackage::CheckInstalledStatus()
     {
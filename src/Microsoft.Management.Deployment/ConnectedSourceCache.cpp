@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ConnectedSourceCache.h"
+
+namespace winrt::Microsoft::Management::Deployment::implementation
+{
+    namespace
+    {
+        std::string GetCacheKey(const ::AppInstaller::Repository::SourceDetails& details)
+        {
+            // The name is unique within the source list, but include the type and arg so that
+            // removing and re-adding a source with different settings can never alias an entry.
+            return details.Name + '|' + details.Type + '|' + details.Arg;
+        }
+    }
+
+    ConnectedSourceCache& ConnectedSourceCache::Instance()
+    {
+        static ConnectedSourceCache instance;
+        return instance;
+    }
+
+    ::AppInstaller::Repository::Source ConnectedSourceCache::GetOpenedSource(
+        const ::AppInstaller::Repository::Source& sourceReference,
+        ::AppInstaller::IProgressCallback& progress)
+    {
+        if (!sourceReference.ContainsAvailablePackages())
+        {
+            // The data of these sources must reflect the current system state on every connect.
+            ::AppInstaller::Repository::Source source = sourceReference;
+            source.Open(progress);
+            return source;
+        }
+
+        auto details = sourceReference.GetDetails();
+        std::string key = GetCacheKey(details);
+
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+
+            auto itr = m_cache.find(key);
+            if (itr != m_cache.end())
+            {
+                // A newer update time in the source metadata means that another process updated
+                // the source since it was cached; a fresh open would also update it once past
+                // the auto update interval. In both cases the cached data is stale.
+                if (itr->second.LastUpdateTime == details.LastUpdateTime && !sourceReference.ShouldUpdateBeforeOpen())
+                {
+                    return itr->second.OpenedSource;
+                }
+
+                m_cache.erase(itr);
+            }
+        }
+
+        // Open outside of the lock; a slow open or update of one source should not block
+        // connections to other catalogs. Concurrent misses for the same catalog may open it
+        // more than once, with the last one remaining cached.
+        ::AppInstaller::Repository::Source source = sourceReference;
+        source.Open(progress);
+
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+            m_cache.insert_or_assign(std::move(key), Entry{ source, source.GetDetails().LastUpdateTime });
+        }
+
+        return source;
+    }
+}
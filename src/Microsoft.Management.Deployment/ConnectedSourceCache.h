@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <winget/RepositorySource.h>
+#include <AppInstallerProgress.h>
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace winrt::Microsoft::Management::Deployment::implementation
+{
+    // A server-wide cache of opened sources, so that concurrent callers connecting to the same
+    // catalog share a single opened source rather than each paying the open cost and holding
+    // their own copy of its in-memory data.
+    struct ConnectedSourceCache
+    {
+        static ConnectedSourceCache& Instance();
+
+        // Gets an opened source for the given source reference, opening and caching one if no
+        // usable opened source exists. A cached source is dropped when the source has been
+        // updated since it was opened, or when opening it anew would update its data.
+        // Sources that do not contain available packages (notably the installed source) are
+        // never cached, as their data must reflect the current system state.
+        ::AppInstaller::Repository::Source GetOpenedSource(
+            const ::AppInstaller::Repository::Source& sourceReference,
+            ::AppInstaller::IProgressCallback& progress);
+
+    private:
+        ConnectedSourceCache() = default;
+
+        struct Entry
+        {
+            ::AppInstaller::Repository::Source OpenedSource;
+            std::chrono::system_clock::time_point LastUpdateTime;
+        };
+
+        std::mutex m_lock;
+        std::map<std::string, Entry> m_cache;
+    };
+}
@@ -13,8 +13,14 @@ namespace winrt::Microsoft::Management::Deployment::implementation
 #if !defined(INCLUDE_ONLY_INTERFACE_METHODS)
         void Initialize(
             winrt::Microsoft::Management::Deployment::FindPackagesResultStatus status,
-            bool wasLimitExceeded, 
+            bool wasLimitExceeded,
             Windows::Foundation::Collections::IVector<winrt::Microsoft::Management::Deployment::MatchResult> matches);
+
+        // Initializes with an already constructed view, which may produce its matches lazily.
+        void Initialize(
+            winrt::Microsoft::Management::Deployment::FindPackagesResultStatus status,
+            bool wasLimitExceeded,
+            Windows::Foundation::Collections::IVectorView<winrt::Microsoft::Management::Deployment::MatchResult> matches);
 #endif
 
         winrt::Microsoft::Management::Deployment::FindPackagesResultStatus Status();
@@ -24,8 +30,9 @@ namespace winrt::Microsoft::Management::Deployment::implementation
 #if !defined(INCLUDE_ONLY_INTERFACE_METHODS)
     private:
         winrt::Microsoft::Management::Deployment::FindPackagesResultStatus m_status = winrt::Microsoft::Management::Deployment::FindPackagesResultStatus::Ok;
-        Windows::Foundation::Collections::IVector<winrt::Microsoft::Management::Deployment::MatchResult> m_matches{ 
+        Windows::Foundation::Collections::IVector<winrt::Microsoft::Management::Deployment::MatchResult> m_matches{
             winrt::single_threaded_vector<winrt::Microsoft::Management::Deployment::MatchResult>() };
+        Windows::Foundation::Collections::IVectorView<winrt::Microsoft::Management::Deployment::MatchResult> m_matchesView{ nullptr };
         bool m_wasLimitExceeded = false;
 #endif
     };
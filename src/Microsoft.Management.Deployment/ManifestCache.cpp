@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ManifestCache.h"
+
+namespace winrt::Microsoft::Management::Deployment::implementation
+{
+    namespace
+    {
+        std::string GetCacheKey(::AppInstaller::Repository::IPackageVersion& packageVersion)
+        {
+            using Property = ::AppInstaller::Repository::PackageVersionProperty;
+
+            // A manifest is identified by its version within its package within its source;
+            // the channel separates flights of the same version.
+            return packageVersion.GetProperty(Property::SourceIdentifier).get() + '|' +
+                packageVersion.GetProperty(Property::Id).get() + '|' +
+                packageVersion.GetProperty(Property::Version).get() + '|' +
+                packageVersion.GetProperty(Property::Channel).get();
+        }
+    }
+
+    ManifestCache& ManifestCache::Instance()
+    {
+        static ManifestCache instance;
+        return instance;
+    }
+
+    std::shared_ptr<const ::AppInstaller::Manifest::Manifest> ManifestCache::GetManifest(::AppInstaller::Repository::IPackageVersion& packageVersion)
+    {
+        std::string key = GetCacheKey(packageVersion);
+
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+
+            for (auto itr = m_cache.begin(); itr != m_cache.end(); ++itr)
+            {
+                if (itr->first == key)
+                {
+                    m_cache.splice(m_cache.begin(), m_cache, itr);
+                    return m_cache.front().second;
+                }
+            }
+        }
+
+        // Parse outside of the lock; a slow manifest retrieval (a REST source may need a
+        // network call) should not block cache hits for other packages. Concurrent misses
+        // for the same manifest may parse it more than once, with one remaining cached.
+        auto manifest = std::make_shared<const ::AppInstaller::Manifest::Manifest>(packageVersion.GetManifest());
+
+        {
+            std::lock_guard<std::mutex> lock{ m_lock };
+
+            m_cache.emplace_front(std::move(key), manifest);
+
+            if (m_cache.size() > s_MaximumEntries)
+            {
+                m_cache.pop_back();
+            }
+        }
+
+        return manifest;
+    }
+}
@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <winget/Manifest.h>
+#include <winget/RepositorySearch.h>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace winrt::Microsoft::Management::Deployment::implementation
+{
+    // A server-wide cache of parsed manifests, so that a client driving a typical detail
+    // pane flow (FindPackages, then CatalogPackageMetadata, then installer selection) does
+    // not pay for parsing the same manifest on every call. The cached instances are shared
+    // and immutable; callers that need to mutate one (to apply a locale) copy it first.
+    struct ManifestCache
+    {
+        static ManifestCache& Instance();
+
+        // Gets the manifest of the given package version, parsing and caching it on a miss.
+        std::shared_ptr<const ::AppInstaller::Manifest::Manifest> GetManifest(::AppInstaller::Repository::IPackageVersion& packageVersion);
+
+    private:
+        ManifestCache() = default;
+
+        // Bounds the number of retained manifests; the least recently used entry is evicted.
+        static constexpr size_t s_MaximumEntries = 16;
+
+        std::mutex m_lock;
+        // Most recently used entries at the front.
+        std::list<std::pair<std::string, std::shared_ptr<const ::AppInstaller::Manifest::Manifest>>> m_cache;
+    };
+}
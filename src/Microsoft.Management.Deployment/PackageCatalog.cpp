@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 #include "pch.h"
+#include <deque>
+#include <map>
 #include <mutex>
 #include <winget/RepositorySource.h>
 #include "Workflows/WorkflowBase.h"
@@ -8,6 +10,7 @@
 #include "PackageCatalog.h"
 #include "PackageCatalog.g.cpp"
 #include "PackageCatalogInfo.h"
+#include "PackageCatalogSearchSession.h"
 #include "FindPackagesResult.h"
 #include "MatchResult.h"
 #include "CatalogPackage.h"
@@ -47,9 +50,21 @@ namespace winrt::Microsoft::Management::Deployment::implementation
     }
     winrt::Windows::Foundation::IAsyncOperation<winrt::Microsoft::Management::Deployment::FindPackagesResult> PackageCatalog::FindPackagesAsync(winrt::Microsoft::Management::Deployment::FindPackagesOptions options)
     {
+        // Hold a strong reference across the suspension and move the blocking search to the
+        // thread pool so that callers can multiplex many operations without dedicating threads.
+        auto strong = get_strong();
+        co_await winrt::resume_background();
         co_return FindPackages(options);
     }
 
+    winrt::Microsoft::Management::Deployment::PackageCatalogSearchSession PackageCatalog::CreateSearchSession(winrt::Microsoft::Management::Deployment::FindPackagesOptions const& options)
+    {
+        auto searchSession = winrt::make_self<wil::details::module_count_wrapper<
+            winrt::Microsoft::Management::Deployment::implementation::PackageCatalogSearchSession>>();
+        searchSession->Initialize(m_source, options);
+        return *searchSession;
+    }
+
     HRESULT PopulateSearchRequestFromVector(
         ::AppInstaller::Repository::SearchRequest* searchRequest,
         Windows::Foundation::Collections::IVector<Microsoft::Management::Deployment::PackageMatchFilter> vector,
@@ -109,6 +124,162 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         return S_OK;
     }
 
+    namespace
+    {
+        // The maximum number of created COM match results the view keeps alive. Results
+        // beyond the ceiling are dropped in creation order and recreated from the raw
+        // match if requested again, so an unbounded query iterated by a client does not
+        // accumulate a wrapper (and its package data) for every row in the server.
+        constexpr size_t s_LazyMatchResultView_MaximumCachedResults = 1024;
+
+        // A view over the raw search result that creates the COM match objects only when they
+        // are requested, so that a large result is delivered incrementally to the caller
+        // instead of being materialized in full before the search returns.
+        struct LazyMatchResultView :
+            winrt::implements<LazyMatchResultView,
+                Windows::Foundation::Collections::IVectorView<Microsoft::Management::Deployment::MatchResult>,
+                Windows::Foundation::Collections::IIterable<Microsoft::Management::Deployment::MatchResult>>
+        {
+            void Initialize(::AppInstaller::Repository::Source source, ::AppInstaller::Repository::SearchResult searchResult)
+            {
+                m_source = std::move(source);
+                m_searchResult = std::move(searchResult);
+            }
+
+            uint32_t Size()
+            {
+                return static_cast<uint32_t>(m_searchResult.Matches.size());
+            }
+
+            Microsoft::Management::Deployment::MatchResult GetAt(uint32_t index)
+            {
+                if (index >= Size())
+                {
+                    throw winrt::hresult_out_of_bounds();
+                }
+
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                auto itr = m_created.find(index);
+                if (itr != m_created.end())
+                {
+                    return itr->second;
+                }
+
+                auto& match = m_searchResult.Matches[index];
+
+                auto catalogPackage = winrt::make_self<wil::details::module_count_wrapper<
+                    winrt::Microsoft::Management::Deployment::implementation::CatalogPackage>>();
+                catalogPackage->Initialize(m_source, match.Package);
+
+                auto packageMatchFilter = winrt::make_self<wil::details::module_count_wrapper<
+                    winrt::Microsoft::Management::Deployment::implementation::PackageMatchFilter>>();
+                packageMatchFilter->Initialize(match.MatchCriteria);
+
+                auto matchResult = winrt::make_self<wil::details::module_count_wrapper<
+                    winrt::Microsoft::Management::Deployment::implementation::MatchResult>>();
+                matchResult->Initialize(*catalogPackage, *packageMatchFilter);
+
+                if (m_created.size() >= s_LazyMatchResultView_MaximumCachedResults)
+                {
+                    // Drop the oldest created wrapper; the raw match remains, so a later
+                    // request for the same index simply recreates it.
+                    m_created.erase(m_createdOrder.front());
+                    m_createdOrder.pop_front();
+                }
+
+                m_createdOrder.push_back(index);
+                return m_created.emplace(index, *matchResult).first->second;
+            }
+
+            bool IndexOf(Microsoft::Management::Deployment::MatchResult const& value, uint32_t& index)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                // Only results still held by the view can be found; a result dropped by the
+                // cache ceiling is a different object from any later recreation of its index.
+                for (const auto& created : m_created)
+                {
+                    if (created.second == value)
+                    {
+                        index = created.first;
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            uint32_t GetMany(uint32_t startIndex, winrt::array_view<Microsoft::Management::Deployment::MatchResult> items)
+            {
+                uint32_t count = 0;
+                while (startIndex + count < Size() && count < items.size())
+                {
+                    items[count] = GetAt(startIndex + count);
+                    ++count;
+                }
+
+                return count;
+            }
+
+            Windows::Foundation::Collections::IIterator<Microsoft::Management::Deployment::MatchResult> First();
+
+        private:
+            ::AppInstaller::Repository::Source m_source;
+            ::AppInstaller::Repository::SearchResult m_searchResult;
+            std::mutex m_lock;
+            std::map<uint32_t, Microsoft::Management::Deployment::MatchResult> m_created;
+            std::deque<uint32_t> m_createdOrder;
+        };
+
+        struct LazyMatchResultIterator :
+            winrt::implements<LazyMatchResultIterator, Windows::Foundation::Collections::IIterator<Microsoft::Management::Deployment::MatchResult>>
+        {
+            void Initialize(winrt::com_ptr<LazyMatchResultView> view)
+            {
+                m_view = std::move(view);
+            }
+
+            Microsoft::Management::Deployment::MatchResult Current()
+            {
+                return m_view->GetAt(m_index);
+            }
+
+            bool HasCurrent()
+            {
+                return m_index < m_view->Size();
+            }
+
+            bool MoveNext()
+            {
+                if (m_index < m_view->Size())
+                {
+                    ++m_index;
+                }
+
+                return HasCurrent();
+            }
+
+            uint32_t GetMany(winrt::array_view<Microsoft::Management::Deployment::MatchResult> items)
+            {
+                uint32_t count = m_view->GetMany(m_index, items);
+                m_index += count;
+                return count;
+            }
+
+        private:
+            winrt::com_ptr<LazyMatchResultView> m_view;
+            uint32_t m_index = 0;
+        };
+
+        Windows::Foundation::Collections::IIterator<Microsoft::Management::Deployment::MatchResult> LazyMatchResultView::First()
+        {
+            auto iterator = winrt::make_self<wil::details::module_count_wrapper<LazyMatchResultIterator>>();
+            iterator->Initialize(get_strong());
+            return iterator.as<Windows::Foundation::Collections::IIterator<Microsoft::Management::Deployment::MatchResult>>();
+        }
+    }
+
     winrt::Microsoft::Management::Deployment::FindPackagesResult GetFindPackagesResult(HRESULT hr, bool isTruncated, Windows::Foundation::Collections::IVector<Microsoft::Management::Deployment::MatchResult> matches)
     {
         auto findPackagesResult = winrt::make_self<wil::details::module_count_wrapper<
@@ -146,25 +317,21 @@ namespace winrt::Microsoft::Management::Deployment::implementation
                 std::rethrow_exception(searchResult.Failures[0].Exception);
             }
 
-            // Build the result object from the searchResult
-            for (size_t i = 0; i < searchResult.Matches.size(); ++i)
-            {
-                auto match = searchResult.Matches[i];
-                auto catalogPackage = winrt::make_self<wil::details::module_count_wrapper<
-                    winrt::Microsoft::Management::Deployment::implementation::CatalogPackage>>();
-                catalogPackage->Initialize(m_source, match.Package);
+            isTruncated = searchResult.Truncated;
 
-                auto packageMatchFilter = winrt::make_self<wil::details::module_count_wrapper<
-                    winrt::Microsoft::Management::Deployment::implementation::PackageMatchFilter>>();
-                packageMatchFilter->Initialize(match.MatchCriteria);
+            // Hand the raw matches to a view that creates the COM objects only as they are
+            // requested, so the caller starts receiving packages immediately and the full
+            // set of match objects is never materialized at once.
+            auto matchesView = winrt::make_self<wil::details::module_count_wrapper<LazyMatchResultView>>();
+            matchesView->Initialize(m_source, std::move(searchResult));
 
-                auto matchResult = winrt::make_self<wil::details::module_count_wrapper<
-                    winrt::Microsoft::Management::Deployment::implementation::MatchResult>>();
-                matchResult->Initialize(*catalogPackage, *packageMatchFilter);
-
-                matches.Append(*matchResult);
-            }
-            isTruncated = searchResult.Truncated;
+            auto findPackagesResult = winrt::make_self<wil::details::module_count_wrapper<
+                winrt::Microsoft::Management::Deployment::implementation::FindPackagesResult>>();
+            findPackagesResult->Initialize(
+                FindPackagesResultStatus(hr),
+                isTruncated,
+                matchesView.as<Windows::Foundation::Collections::IVectorView<Microsoft::Management::Deployment::MatchResult>>());
+            return *findPackagesResult;
         }
         WINGET_CATCH_STORE(hr, APPINSTALLER_CLI_ERROR_COMMAND_FAILED);
 
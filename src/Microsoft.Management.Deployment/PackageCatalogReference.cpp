@@ -7,6 +7,7 @@
 #include "PackageCatalogInfo.h"
 #include "PackageCatalog.h"
 #include "SourceAgreement.h"
+#include "ConnectedSourceCache.h"
 #include "ConnectResult.h"
 #include "Workflows/WorkflowBase.h"
 #include "Converters.h"
@@ -65,6 +66,10 @@ namespace winrt::Microsoft::Management::Deployment::implementation
     }
     winrt::Windows::Foundation::IAsyncOperation<winrt::Microsoft::Management::Deployment::ConnectResult> PackageCatalogReference::ConnectAsync()
     {
+        // Hold a strong reference across the suspension and move the blocking connect to the
+        // thread pool so that the caller's thread is not consumed for the duration.
+        auto strong = get_strong();
+        co_await winrt::resume_background();
         co_return Connect();
     }
     winrt::Microsoft::Management::Deployment::ConnectResult GetConnectCatalogErrorResult()
@@ -106,7 +111,16 @@ namespace winrt::Microsoft::Management::Deployment::implementation
                     winrt::Microsoft::Management::Deployment::implementation::PackageCatalogReference* catalogImpl = get_self<winrt::Microsoft::Management::Deployment::implementation::PackageCatalogReference>(catalog);
                     auto copy = catalogImpl->m_sourceReference;
                     copy.SetCaller(GetCallerName());
-                    copy.Open(progress);
+                    if (catalogImpl->m_additionalPackageCatalogArguments.has_value())
+                    {
+                        // A custom header can change what the source returns, so such a
+                        // connection cannot share the server-wide opened source.
+                        copy.Open(progress);
+                    }
+                    else
+                    {
+                        copy = ConnectedSourceCache::Instance().GetOpenedSource(copy, progress);
+                    }
                     remoteSources.emplace_back(std::move(copy));
                 }
 
@@ -142,7 +156,16 @@ namespace winrt::Microsoft::Management::Deployment::implementation
             {
                 source = m_sourceReference;
                 source.SetCaller(GetCallerName());
-                source.Open(progress);
+                if (m_additionalPackageCatalogArguments.has_value())
+                {
+                    // A custom header can change what the source returns, so this connection
+                    // cannot share the server-wide opened source.
+                    source.Open(progress);
+                }
+                else
+                {
+                    source = ConnectedSourceCache::Instance().GetOpenedSource(source, progress);
+                }
             }
 
             if (!source)
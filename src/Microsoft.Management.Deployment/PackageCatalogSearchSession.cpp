@@ -0,0 +1,154 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include <winget/RepositorySource.h>
+#include <AppInstallerStrings.h>
+#include <AppInstallerErrors.h>
+#include "Converters.h"
+#include "ExecutionContext.h"
+#include "PackageCatalogSearchSession.h"
+#include "PackageCatalogSearchSession.g.cpp"
+#include "FindPackagesResult.h"
+#include "MatchResult.h"
+#include "CatalogPackage.h"
+#pragma warning( push )
+#pragma warning ( disable : 4467 6388)
+// 6388 Allow CreateInstance.
+#include <wil\cppwinrt_wrl.h>
+// 4467 Allow use of uuid attribute for com object creation.
+#include "PackageMatchFilter.h"
+#pragma warning( pop )
+
+namespace winrt::Microsoft::Management::Deployment::implementation
+{
+    // Defined in PackageCatalog.cpp.
+    HRESULT PopulateSearchRequest(
+        ::AppInstaller::Repository::SearchRequest* searchRequest,
+        winrt::Microsoft::Management::Deployment::FindPackagesOptions const& options);
+
+    namespace
+    {
+        // Determines whether the package matches the query; the local mirror of the
+        // Id and Name substring inclusions that SearchCatalog issues, so that narrowing
+        // a retained result agrees with searching the catalog directly.
+        bool PackageMatchesQuery(::AppInstaller::Repository::IPackage& package, const std::string& foldedQuery)
+        {
+            for (auto property : { ::AppInstaller::Repository::PackageProperty::Id, ::AppInstaller::Repository::PackageProperty::Name })
+            {
+                std::string foldedValue = ::AppInstaller::Utility::FoldCase(static_cast<std::string_view>(package.GetProperty(property)));
+                if (foldedValue.find(foldedQuery) != std::string::npos)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    }
+
+    void PackageCatalogSearchSession::Initialize(
+        ::AppInstaller::Repository::Source source,
+        winrt::Microsoft::Management::Deployment::FindPackagesOptions options)
+    {
+        m_source = std::move(source);
+        m_options = options;
+    }
+
+    ::AppInstaller::Repository::SearchResult PackageCatalogSearchSession::SearchCatalog(std::string query)
+    {
+        ::AppInstaller::Repository::SearchRequest searchRequest;
+        THROW_IF_FAILED(PopulateSearchRequest(&searchRequest, m_options));
+
+        // The session query replaces any CatalogDefault selector from the options.
+        searchRequest.Query.reset();
+        if (!query.empty())
+        {
+            searchRequest.Inclusions.emplace_back(::AppInstaller::Repository::PackageMatchField::Id, ::AppInstaller::Repository::MatchType::Substring, query);
+            searchRequest.Inclusions.emplace_back(::AppInstaller::Repository::PackageMatchField::Name, ::AppInstaller::Repository::MatchType::Substring, std::move(query));
+        }
+
+        searchRequest.MaximumResults = m_options.ResultLimit();
+        auto searchResult = m_source.Search(searchRequest);
+
+        // Handle failures by just rethrowing the first one, as FindPackages does.
+        if (!searchResult.Failures.empty())
+        {
+            std::rethrow_exception(searchResult.Failures[0].Exception);
+        }
+
+        return searchResult;
+    }
+
+    winrt::Microsoft::Management::Deployment::FindPackagesResult PackageCatalogSearchSession::Search(hstring const& query)
+    {
+        Windows::Foundation::Collections::IVector<Microsoft::Management::Deployment::MatchResult> matches{ winrt::single_threaded_vector<Microsoft::Management::Deployment::MatchResult>() };
+        bool isTruncated = false;
+
+        HRESULT hr = S_OK;
+        try
+        {
+            std::string queryUtf8 = winrt::to_string(query);
+            std::string foldedQuery = ::AppInstaller::Utility::FoldCase(std::string_view{ queryUtf8 });
+
+            std::lock_guard<std::mutex> lock{ m_lock };
+
+            // Drop retained generations whose query does not lead up to this one; the
+            // remaining newest generation is the longest retained prefix of the query.
+            while (!m_generations.empty() && foldedQuery.compare(0, m_generations.back().Query.size(), m_generations.back().Query) != 0)
+            {
+                m_generations.pop_back();
+            }
+
+            if (m_generations.empty() || m_generations.back().Query != foldedQuery)
+            {
+                ::AppInstaller::Repository::SearchResult current;
+
+                // A truncated result cannot be narrowed, as the packages cut off by the
+                // result limit may match the longer query.
+                if (!m_generations.empty() && !m_generations.back().Result.Truncated)
+                {
+                    const auto& baseResult = m_generations.back().Result;
+                    for (const auto& match : baseResult.Matches)
+                    {
+                        if (PackageMatchesQuery(*match.Package, foldedQuery))
+                        {
+                            current.Matches.emplace_back(match);
+                        }
+                    }
+                }
+                else
+                {
+                    current = SearchCatalog(std::move(queryUtf8));
+                }
+
+                m_generations.push_back({ std::move(foldedQuery), std::move(current) });
+            }
+
+            const auto& searchResult = m_generations.back().Result;
+            isTruncated = searchResult.Truncated;
+
+            for (const auto& match : searchResult.Matches)
+            {
+                auto catalogPackage = winrt::make_self<wil::details::module_count_wrapper<
+                    winrt::Microsoft::Management::Deployment::implementation::CatalogPackage>>();
+                catalogPackage->Initialize(m_source, match.Package);
+
+                auto packageMatchFilter = winrt::make_self<wil::details::module_count_wrapper<
+                    winrt::Microsoft::Management::Deployment::implementation::PackageMatchFilter>>();
+                packageMatchFilter->Initialize(match.MatchCriteria);
+
+                auto matchResult = winrt::make_self<wil::details::module_count_wrapper<
+                    winrt::Microsoft::Management::Deployment::implementation::MatchResult>>();
+                matchResult->Initialize(*catalogPackage, *packageMatchFilter);
+
+                matches.Append(*matchResult);
+            }
+        }
+        WINGET_CATCH_STORE(hr, APPINSTALLER_CLI_ERROR_COMMAND_FAILED);
+
+        auto findPackagesResult = winrt::make_self<wil::details::module_count_wrapper<
+            winrt::Microsoft::Management::Deployment::implementation::FindPackagesResult>>();
+        findPackagesResult->Initialize(FindPackagesResultStatus(hr), isTruncated, matches);
+        return *findPackagesResult;
+    }
+}
@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include "PackageCatalogSearchSession.g.h"
+
+namespace winrt::Microsoft::Management::Deployment::implementation
+{
+    struct PackageCatalogSearchSession : PackageCatalogSearchSessionT<PackageCatalogSearchSession>
+    {
+        PackageCatalogSearchSession() = default;
+
+#if !defined(INCLUDE_ONLY_INTERFACE_METHODS)
+        void Initialize(
+            ::AppInstaller::Repository::Source source,
+            winrt::Microsoft::Management::Deployment::FindPackagesOptions options);
+#endif
+
+        winrt::Microsoft::Management::Deployment::FindPackagesResult Search(hstring const& query);
+
+#if !defined(INCLUDE_ONLY_INTERFACE_METHODS)
+    private:
+        // A retained query result; Query holds the case folded query that produced Result.
+        struct Generation
+        {
+            std::string Query;
+            ::AppInstaller::Repository::SearchResult Result;
+        };
+
+        // Searches the catalog with the session's options and the given query.
+        ::AppInstaller::Repository::SearchResult SearchCatalog(std::string query);
+
+        ::AppInstaller::Repository::Source m_source;
+        winrt::Microsoft::Management::Deployment::FindPackagesOptions m_options{ nullptr };
+        std::mutex m_lock;
+        std::vector<Generation> m_generations;
+#endif
+    };
+}
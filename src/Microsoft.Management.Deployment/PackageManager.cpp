@@ -31,6 +31,7 @@
 #include "Converters.h"
 #include "Helpers.h"
 #include "ContextOrchestrator.h"
+#include "ManifestCache.h"
 
 using namespace std::literals::chrono_literals;
 using namespace ::AppInstaller::CLI;
@@ -123,7 +124,9 @@ namespace winrt::Microsoft::Management::Deployment::implementation
     {
         winrt::Microsoft::Management::Deployment::implementation::PackageVersionInfo* packageVersionInfoImpl = get_self<winrt::Microsoft::Management::Deployment::implementation::PackageVersionInfo>(packageVersionInfo);
         std::shared_ptr<::AppInstaller::Repository::IPackageVersion> internalPackageVersion = packageVersionInfoImpl->GetRepositoryPackageVersion();
-        ::AppInstaller::Manifest::Manifest manifest = internalPackageVersion->GetManifest();
+
+        // A locale is applied below, so work on a copy of the cached manifest.
+        ::AppInstaller::Manifest::Manifest manifest = *ManifestCache::Instance().GetManifest(*internalPackageVersion);
 
         std::string targetLocale;
         if (context->Args.Contains(::AppInstaller::CLI::Execution::Args::Type::Locale))
@@ -659,6 +662,14 @@ namespace winrt::Microsoft::Management::Deployment::implementation
                     }
                 });
 
+            // Progress callbacks can arrive far faster than the cross-process callback to the
+            // client can usefully consume them. Reports are paced to this interval, with the
+            // atomic snapshot above coalescing every tick in between, so the client receives
+            // the latest state at the configured cadence rather than a call per tick.
+            const DWORD progressReportIntervalMilliseconds =
+                static_cast<DWORD>(::AppInstaller::Settings::User().Get<::AppInstaller::Settings::Setting::InstallProgressUpdateIntervalInMilliseconds>().count());
+            ULONGLONG lastProgressReportTime = 0;
+
             // Wait for completion or progress events.
             // Waiting for both on the same thread ensures that progress is never reported after the async operation itself has completed.
             bool completionEventFired = false;
@@ -677,13 +688,31 @@ namespace winrt::Microsoft::Management::Deployment::implementation
                 {
                     // operationEvents[0] was signaled, progress
                 case WAIT_OBJECT_0 + 0:
+                {
+                    ULONGLONG timeSinceLastReport = GetTickCount64() - lastProgressReportTime;
+                    if (timeSinceLastReport < progressReportIntervalMilliseconds)
+                    {
+                        // Wait out the remainder of the pacing interval, coalescing any further
+                        // progress into the snapshot, unless the operation completes first.
+                        DWORD pacingWait = WaitForSingleObject(
+                            operationEvents[1], progressReportIntervalMilliseconds - static_cast<DWORD>(timeSinceLastReport));
+                        if (pacingWait == WAIT_OBJECT_0)
+                        {
+                            completionEventFired = true;
+                            break;
+                        }
+                        THROW_LAST_ERROR_IF(pacingWait != WAIT_TIMEOUT);
+                    }
+
                     // The report_progress call will hang when making callbacks to suspended processes so it's important that this is now on a background thread.
-                    // Progress events are not queued - some will be missed if multiple progress events are fired from the ComContext to the callback 
+                    // Progress events are not queued - some will be missed if multiple progress events are fired from the ComContext to the callback
                     // while the report_progress call is hung\in progress.
                     // Duplicate progress events can be fired if another progress event comes from the ComContext to the callback after the listener
                     // has been awaked, but before it has gotten the installProgress.
+                    lastProgressReportTime = GetTickCount64();
                     report_progress(operationProgress);
                     break;
+                }
 
                     // operationEvents[1] was signaled, operation completed
                 case WAIT_OBJECT_0 + 1:
@@ -11,6 +11,7 @@
 #include "CatalogPackage.h"
 #include "CatalogPackageMetadata.h"
 #include "ComContext.h"
+#include "ManifestCache.h"
 #include "Workflows/WorkflowBase.h"
 #include "Workflows/ManifestComparator.h"
 #include "winget/RepositorySearch.h"
@@ -137,8 +138,8 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         PopulateContextFromInstallOptions(&context, options);
         AppInstaller::Repository::IPackageVersion::Metadata installationMetadata;
         AppInstaller::CLI::Workflow::ManifestComparator manifestComparator{ context, installationMetadata };
-        AppInstaller::Manifest::Manifest manifest = m_packageVersion->GetManifest();
-        auto result = manifestComparator.GetPreferredInstaller(manifest);
+        auto manifest = ManifestCache::Instance().GetManifest(*m_packageVersion);
+        auto result = manifestComparator.GetPreferredInstaller(*manifest);
         return result.installer.has_value();
     }
     winrt::Microsoft::Management::Deployment::PackageInstallerInfo PackageVersionInfo::GetApplicableInstaller(InstallOptions options)
@@ -147,8 +148,8 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         PopulateContextFromInstallOptions(&context, options);
         AppInstaller::Repository::IPackageVersion::Metadata installationMetadata;
         AppInstaller::CLI::Workflow::ManifestComparator manifestComparator{ context, installationMetadata };
-        AppInstaller::Manifest::Manifest manifest = m_packageVersion->GetManifest();
-        auto result = manifestComparator.GetPreferredInstaller(manifest);
+        auto manifest = ManifestCache::Instance().GetManifest(*m_packageVersion);
+        auto result = manifestComparator.GetPreferredInstaller(*manifest);
 
         if (result.installer.has_value())
         {
@@ -166,7 +167,8 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         auto catalogPackageMetadata = winrt::make_self<wil::details::module_count_wrapper<winrt::Microsoft::Management::Deployment::implementation::CatalogPackageMetadata>>();
         if (m_packageVersion)
         {
-            auto manifest = m_packageVersion->GetManifest();
+            // Applying a locale mutates the manifest, so work on a copy of the cached one.
+            AppInstaller::Manifest::Manifest manifest = *ManifestCache::Instance().GetManifest(*m_packageVersion);
             manifest.ApplyLocale();
             catalogPackageMetadata->Initialize(manifest.CurrentLocalization);
         }
@@ -184,7 +186,7 @@ namespace winrt::Microsoft::Management::Deployment::implementation
         auto catalogPackageMetadata = winrt::make_self<wil::details::module_count_wrapper<winrt::Microsoft::Management::Deployment::implementation::CatalogPackageMetadata>>();
         if (m_packageVersion)
         {
-            auto manifest = m_packageVersion->GetManifest();
+            AppInstaller::Manifest::Manifest manifest = *ManifestCache::Instance().GetManifest(*m_packageVersion);
             manifest.ApplyLocale(localeString);
             catalogPackageMetadata->Initialize(manifest.CurrentLocalization);
         }
@@ -121,11 +121,29 @@ int __stdcall wWinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPWSTR cmdLine,
     RETURN_LAST_ERROR_IF(!argv);
 
     bool manualActivation = false;
+    ULONG keepAliveSeconds = 0;
 
     // If command line gets more complicated, consider more complex parsing
-    if (argc == 1 && std::wstring_view{ L"--manualActivation" } == argv[0])
+    for (int i = 0; i < argc; ++i)
     {
-        manualActivation = true;
+        if (std::wstring_view{ L"--manualActivation" } == argv[i])
+        {
+            manualActivation = true;
+        }
+        else if (std::wstring_view{ L"--keepAlive" } == argv[i] && i + 1 < argc)
+        {
+            // Keep the server process alive for this long after the last client disconnects,
+            // so that closely spaced invocations reuse the warm process rather than each
+            // paying full server startup.
+            keepAliveSeconds = wcstoul(argv[++i], nullptr, 10);
+
+            // An arbitrary limit to prevent an idle server from lingering indefinitely.
+            constexpr ULONG maximumKeepAliveSeconds = 3600;
+            if (keepAliveSeconds > maximumKeepAliveSeconds)
+            {
+                keepAliveSeconds = maximumKeepAliveSeconds;
+            }
+        }
     }
 
     _comServerExitEvent.create();
@@ -159,7 +177,27 @@ int __stdcall wWinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPWSTR cmdLine,
 
         manualResetEvent.SetEvent();
 
-        _comServerExitEvent.wait();
+        // Wait until COM reports that the last object has been released. When a keep alive
+        // window was requested, stay registered for that long afterward; a client arriving
+        // during the window finds the warm server (parsed settings, opened sources) and we
+        // go back to waiting for the module to run down again.
+        for (;;)
+        {
+            _comServerExitEvent.wait();
+
+            if (keepAliveSeconds == 0)
+            {
+                break;
+            }
+
+            _comServerExitEvent.ResetEvent();
+            Sleep(keepAliveSeconds * 1000);
+
+            if (WindowsPackageManagerServerModuleGetObjectCount() == 0)
+            {
+                break;
+            }
+        }
 
         manualResetEvent.reset();
         RETURN_IF_FAILED(WindowsPackageManagerServerModuleUnregister());
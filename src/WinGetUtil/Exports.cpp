@@ -9,6 +9,7 @@
 #include <AppInstallerStrings.h>
 #include <AppInstallerTelemetry.h>
 #include <Microsoft/SQLiteIndex.h>
+#include <winget/ManifestSchemaValidation.h>
 #include <winget/ManifestYamlParser.h>
 #include <winget/ThreadGlobals.h>
 #include <winget/InstallerMetadataCollectionContext.h>
@@ -28,6 +29,162 @@ namespace
     {
         return potentiallyNullPath ? std::filesystem::path{ potentiallyNullPath } : std::filesystem::path{};
     }
+
+    // Memoizes successful manifest validations by a hash of the manifest content and the
+    // validation option. Only unqualified successes are recorded; failures and warnings are
+    // revalidated so that their messages are regenerated.
+    struct ValidationResultCache
+    {
+        ValidationResultCache(std::filesystem::path path) : m_path(std::move(path))
+        {
+            std::ifstream stream{ m_path };
+            if (!stream)
+            {
+                return;
+            }
+
+            std::string line;
+            if (!std::getline(stream, line) || line != s_formatVersion)
+            {
+                // The cache was written by a different format version; start over.
+                return;
+            }
+
+            while (std::getline(stream, line))
+            {
+                if (!line.empty())
+                {
+                    m_successes.emplace(std::move(line));
+                }
+            }
+        }
+
+        // Computes the cache key for a manifest input; a directory input hashes each
+        // contained file in name order, matching the multi file manifest form that
+        // YamlParser::CreateFromPath accepts.
+        static std::string ComputeKey(const std::filesystem::path& inputPath, WinGetValidateManifestOption option)
+        {
+            SHA256 hash;
+
+            if (std::filesystem::is_directory(inputPath))
+            {
+                std::vector<std::filesystem::path> files;
+                for (const auto& entry : std::filesystem::directory_iterator{ inputPath })
+                {
+                    files.emplace_back(entry.path());
+                }
+                std::sort(files.begin(), files.end());
+
+                for (const auto& file : files)
+                {
+                    std::string fileName = file.filename().u8string();
+                    hash.Add(reinterpret_cast<const uint8_t*>(fileName.data()), fileName.size());
+                    hash.Add(SHA256::ComputeHashFromFile(file));
+                }
+            }
+            else
+            {
+                hash.Add(SHA256::ComputeHashFromFile(inputPath));
+            }
+
+            uint32_t optionValue = static_cast<uint32_t>(option);
+            hash.Add(reinterpret_cast<const uint8_t*>(&optionValue), sizeof(optionValue));
+
+            return SHA256::ConvertToString(hash.Get());
+        }
+
+        bool IsKnownSuccess(const std::string& key) const
+        {
+            return m_successes.count(key) != 0;
+        }
+
+        void RecordSuccess(std::string key)
+        {
+            if (m_successes.emplace(std::move(key)).second)
+            {
+                m_dirty = true;
+            }
+        }
+
+        void Save()
+        {
+            if (!m_dirty)
+            {
+                return;
+            }
+
+            std::filesystem::path parent = m_path.parent_path();
+            if (!parent.empty())
+            {
+                std::filesystem::create_directories(parent);
+            }
+
+            std::ofstream stream{ m_path, std::ofstream::trunc };
+            stream << s_formatVersion << '\n';
+            for (const std::string& success : m_successes)
+            {
+                stream << success << '\n';
+            }
+        }
+
+    private:
+        // Written as the first line of the cache file; bump to discard older caches.
+        constexpr static std::string_view s_formatVersion = "1";
+
+        std::filesystem::path m_path;
+        std::set<std::string> m_successes;
+        bool m_dirty = false;
+    };
+
+    // Holds the state that a caller validating many manifests in one process reuses across
+    // calls: an optionally opened index for dependency and ARP version validation and an
+    // optional validation result cache. Creation also warms process wide validation state
+    // (compiled schemas, ICU tables) so that the first validation through the session costs
+    // the same as the rest.
+    struct ValidationSession
+    {
+        ValidationSession(const std::filesystem::path& indexPath, const std::filesystem::path& resultCachePath)
+        {
+            if (!indexPath.empty())
+            {
+                m_index = std::make_unique<SQLiteIndex>(SQLiteIndex::Open(indexPath.u8string(), SQLiteIndex::OpenDisposition::Read));
+            }
+
+            if (!resultCachePath.empty())
+            {
+                m_resultCache = std::make_unique<ValidationResultCache>(resultCachePath);
+            }
+
+            // Touch the ICU backed case folding and normalization paths so that their tables are loaded.
+            (void)FoldCase(std::string_view{ "warmup" });
+            (void)NormalizedString{ std::string_view{ "warmup" } };
+
+            // Compile the schemas for the latest manifest version; compiled schemas are cached for
+            // the process, so doing it here moves the cost out of the first validation. Only the
+            // compilation that the call forces matters; the validation result does not.
+            for (ManifestTypeEnum manifestType : { ManifestTypeEnum::Singleton, ManifestTypeEnum::Version, ManifestTypeEnum::Installer, ManifestTypeEnum::DefaultLocale, ManifestTypeEnum::Locale })
+            {
+                try
+                {
+                    std::vector<YamlParser::YamlManifestInfo> manifestList(1);
+                    manifestList[0].Root = YAML::Load("ManifestVersion: warmup");
+                    manifestList[0].ManifestType = manifestType;
+                    (void)YamlParser::ValidateAgainstSchema(manifestList, ManifestVer{ s_ManifestVersionV1_5 });
+                }
+                catch (...)
+                {
+                    // Warmup is best effort.
+                }
+            }
+        }
+
+        SQLiteIndex* Index() { return m_index.get(); }
+        ValidationResultCache* ResultCache() { return m_resultCache.get(); }
+
+    private:
+        std::unique_ptr<SQLiteIndex> m_index;
+        std::unique_ptr<ValidationResultCache> m_resultCache;
+    };
 }
 
 extern "C"
@@ -195,6 +352,50 @@ extern "C"
     }
     CATCH_RETURN()
 
+    WINGET_UTIL_API WinGetSQLiteIndexGetChangesSince(
+        WINGET_SQLITE_INDEX_HANDLE index,
+        UINT64 sequence,
+        WINGET_STRING_OUT* changes,
+        UINT64* lastSequence) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !index);
+        THROW_HR_IF(E_INVALIDARG, !changes);
+
+        auto entries = reinterpret_cast<SQLiteIndex*>(index)->GetChangesSince(static_cast<AppInstaller::SQLite::rowid_t>(sequence));
+
+        std::wostringstream stream;
+        for (const auto& entry : entries)
+        {
+            std::wstring_view change;
+            switch (entry.Change)
+            {
+            case SQLiteIndex::ChangeType::Add:
+                change = L"add";
+                break;
+            case SQLiteIndex::ChangeType::Update:
+                change = L"update";
+                break;
+            case SQLiteIndex::ChangeType::Remove:
+                change = L"remove";
+                break;
+            }
+
+            stream << entry.Sequence << L'\t' << change << L'\t' <<
+                ConvertToUTF16(entry.Id) << L'\t' << ConvertToUTF16(entry.Version) << L'\t' << ConvertToUTF16(entry.Channel) << L'\n';
+        }
+
+        *changes = ::SysAllocString(stream.str().c_str());
+        THROW_IF_NULL_ALLOC(*changes);
+
+        if (lastSequence)
+        {
+            *lastSequence = (entries.empty() ? sequence : static_cast<UINT64>(entries.back().Sequence));
+        }
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
     WINGET_UTIL_API WinGetValidateManifest(
         WINGET_STRING manifestPath,
         BOOL* succeeded,
@@ -262,6 +463,348 @@ extern "C"
     }
     CATCH_RETURN()
 
+    WINGET_UTIL_API WinGetValidateManifestBatch(
+        WINGET_STRING inputPath,
+        UINT32 maximumThreads,
+        BOOL* succeeded,
+        WINGET_STRING_OUT* message,
+        WinGetValidateManifestOption option) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !inputPath);
+        THROW_HR_IF(E_INVALIDARG, !succeeded);
+
+        std::filesystem::path rootPath = inputPath;
+        THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_PATH_NOT_FOUND), !std::filesystem::is_directory(rootPath));
+
+        ManifestValidateOption validateOption;
+        validateOption.FullValidation = true;
+        validateOption.ThrowOnWarning = true;
+        validateOption.SchemaValidationOnly = WI_IsFlagSet(option, WinGetValidateManifestOption::SchemaValidationOnly);
+        validateOption.ErrorOnVerifiedPublisherFields = WI_IsFlagSet(option, WinGetValidateManifestOption::ErrorOnVerifiedPublisherFields);
+        validateOption.InstallerValidation = WI_IsFlagSet(option, WinGetValidateManifestOption::InstallerValidations);
+
+        // Each directory that contains only files is one manifest input, matching what
+        // YamlParser::CreateFromPath accepts for multi file manifests.
+        std::vector<std::filesystem::path> manifestPaths;
+
+        auto considerDirectory = [&](const std::filesystem::path& directory)
+        {
+            bool hasFiles = false;
+            for (const auto& entry : std::filesystem::directory_iterator{ directory })
+            {
+                if (entry.is_directory())
+                {
+                    return;
+                }
+                hasFiles = true;
+            }
+
+            if (hasFiles)
+            {
+                manifestPaths.emplace_back(directory);
+            }
+        };
+
+        considerDirectory(rootPath);
+        for (const auto& entry : std::filesystem::recursive_directory_iterator{ rootPath })
+        {
+            if (entry.is_directory())
+            {
+                considerDirectory(entry.path());
+            }
+        }
+
+        struct ManifestResult
+        {
+            bool Succeeded = false;
+            std::string Message;
+        };
+
+        std::vector<ManifestResult> results(manifestPaths.size());
+
+        auto validateManifest = [&](size_t manifestIndex)
+        {
+            ManifestResult& result = results[manifestIndex];
+            try
+            {
+                (void)YamlParser::CreateFromPath(manifestPaths[manifestIndex], validateOption);
+                result.Succeeded = true;
+            }
+            catch (const ManifestException& e)
+            {
+                result.Succeeded = e.IsWarningOnly();
+                result.Message = e.GetManifestErrorMessage();
+            }
+        };
+
+        if (!manifestPaths.empty())
+        {
+            size_t threadCount = maximumThreads ? maximumThreads : std::thread::hardware_concurrency();
+            threadCount = std::max<size_t>(std::min(threadCount, manifestPaths.size()), 1);
+
+            if (threadCount == 1)
+            {
+                for (size_t i = 0; i < manifestPaths.size(); ++i)
+                {
+                    validateManifest(i);
+                }
+            }
+            else
+            {
+                std::atomic_size_t nextManifest{ 0 };
+                std::vector<std::exception_ptr> exceptions(threadCount);
+                std::vector<std::thread> threads;
+                threads.reserve(threadCount);
+
+                AppInstaller::ThreadLocalStorage::ThreadGlobals* callerGlobals = AppInstaller::ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+
+                for (size_t t = 0; t < threadCount; ++t)
+                {
+                    threads.emplace_back([&, t]()
+                        {
+                            // Adopt the caller's globals so that worker logging lands in the caller's log.
+                            std::unique_ptr<AppInstaller::ThreadLocalStorage::PreviousThreadGlobals> previousGlobals;
+                            if (callerGlobals)
+                            {
+                                previousGlobals = callerGlobals->SetForCurrentThread();
+                            }
+
+                            try
+                            {
+                                for (size_t i = nextManifest++; i < manifestPaths.size(); i = nextManifest++)
+                                {
+                                    validateManifest(i);
+                                }
+                            }
+                            catch (...)
+                            {
+                                exceptions[t] = std::current_exception();
+                            }
+                        });
+                }
+
+                for (std::thread& thread : threads)
+                {
+                    thread.join();
+                }
+
+                for (const std::exception_ptr& exception : exceptions)
+                {
+                    if (exception)
+                    {
+                        std::rethrow_exception(exception);
+                    }
+                }
+            }
+        }
+
+        bool allSucceeded = true;
+        std::string validationMessage;
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            allSucceeded = allSucceeded && results[i].Succeeded;
+            if (!results[i].Message.empty())
+            {
+                validationMessage += manifestPaths[i].u8string();
+                validationMessage += ": ";
+                validationMessage += results[i].Message;
+                validationMessage += '\n';
+            }
+        }
+
+        *succeeded = (allSucceeded ? TRUE : FALSE);
+        if (message)
+        {
+            *message = ::SysAllocString(ConvertToUTF16(validationMessage).c_str());
+        }
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
+    WINGET_UTIL_API WinGetValidationResultCacheOpen(
+        WINGET_STRING cacheFilePath,
+        WINGET_VALIDATION_RESULT_CACHE_HANDLE* cache) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !cacheFilePath);
+        THROW_HR_IF(E_INVALIDARG, !cache);
+        THROW_HR_IF(E_INVALIDARG, !!*cache);
+
+        std::unique_ptr<ValidationResultCache> result = std::make_unique<ValidationResultCache>(std::filesystem::path{ cacheFilePath });
+
+        *cache = static_cast<WINGET_VALIDATION_RESULT_CACHE_HANDLE>(result.release());
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
+    WINGET_UTIL_API WinGetValidationResultCacheClose(
+        WINGET_VALIDATION_RESULT_CACHE_HANDLE cache) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !cache);
+
+        std::unique_ptr<ValidationResultCache> toClose{ reinterpret_cast<ValidationResultCache*>(cache) };
+        toClose->Save();
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
+    WINGET_UTIL_API WinGetValidateManifestV2Cached(
+        WINGET_STRING inputPath,
+        BOOL* succeeded,
+        WINGET_STRING_OUT* message,
+        WINGET_STRING mergedManifestPath,
+        WinGetValidateManifestOption option,
+        WINGET_VALIDATION_RESULT_CACHE_HANDLE cache) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !inputPath);
+        THROW_HR_IF(E_INVALIDARG, !succeeded);
+
+        ValidationResultCache* cachePtr = reinterpret_cast<ValidationResultCache*>(cache);
+
+        // A cache hit does not produce the merged manifest, so the cache is only
+        // consulted when one was not requested.
+        std::string cacheKey;
+        if (cachePtr && !mergedManifestPath)
+        {
+            cacheKey = ValidationResultCache::ComputeKey(inputPath, option);
+            if (cachePtr->IsKnownSuccess(cacheKey))
+            {
+                *succeeded = TRUE;
+                return S_OK;
+            }
+        }
+
+        try
+        {
+            ManifestValidateOption validateOption;
+            validateOption.FullValidation = true;
+            validateOption.ThrowOnWarning = true;
+            validateOption.SchemaValidationOnly = WI_IsFlagSet(option, WinGetValidateManifestOption::SchemaValidationOnly);
+            validateOption.ErrorOnVerifiedPublisherFields = WI_IsFlagSet(option, WinGetValidateManifestOption::ErrorOnVerifiedPublisherFields);
+            validateOption.InstallerValidation = WI_IsFlagSet(option, WinGetValidateManifestOption::InstallerValidations);
+
+            (void)YamlParser::CreateFromPath(inputPath, validateOption, mergedManifestPath ? mergedManifestPath : L"");
+
+            *succeeded = TRUE;
+
+            if (!cacheKey.empty())
+            {
+                cachePtr->RecordSuccess(std::move(cacheKey));
+            }
+        }
+        catch (const ManifestException& e)
+        {
+            *succeeded = e.IsWarningOnly();
+            if (message)
+            {
+                *message = ::SysAllocString(ConvertToUTF16(e.GetManifestErrorMessage()).c_str());
+            }
+        }
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
+    WINGET_UTIL_API WinGetValidationSessionCreate(
+        WINGET_STRING indexPath,
+        WINGET_STRING resultCachePath,
+        WINGET_VALIDATION_SESSION_HANDLE* session) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !session);
+        THROW_HR_IF(E_INVALIDARG, !!*session);
+
+        std::unique_ptr<ValidationSession> result = std::make_unique<ValidationSession>(GetPathOrEmpty(indexPath), GetPathOrEmpty(resultCachePath));
+
+        *session = static_cast<WINGET_VALIDATION_SESSION_HANDLE>(result.release());
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
+    WINGET_UTIL_API WinGetValidationSessionValidateManifest(
+        WINGET_VALIDATION_SESSION_HANDLE session,
+        WINGET_STRING inputPath,
+        BOOL* succeeded,
+        WINGET_STRING_OUT* message,
+        WINGET_STRING mergedManifestPath,
+        WinGetValidateManifestOption option) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !session);
+        THROW_HR_IF(E_INVALIDARG, !inputPath);
+        THROW_HR_IF(E_INVALIDARG, !succeeded);
+
+        ValidationSession& sessionRef = *reinterpret_cast<ValidationSession*>(session);
+
+        // A cache hit does not produce the merged manifest, so the cache is only consulted
+        // when one was not requested. The key does not cover the index contents, so the
+        // cache is also bypassed when index backed validations are in play.
+        std::string cacheKey;
+        if (sessionRef.ResultCache() && !sessionRef.Index() && !mergedManifestPath)
+        {
+            cacheKey = ValidationResultCache::ComputeKey(inputPath, option);
+            if (sessionRef.ResultCache()->IsKnownSuccess(cacheKey))
+            {
+                *succeeded = TRUE;
+                return S_OK;
+            }
+        }
+
+        try
+        {
+            ManifestValidateOption validateOption;
+            validateOption.FullValidation = true;
+            validateOption.ThrowOnWarning = true;
+            validateOption.SchemaValidationOnly = WI_IsFlagSet(option, WinGetValidateManifestOption::SchemaValidationOnly);
+            validateOption.ErrorOnVerifiedPublisherFields = WI_IsFlagSet(option, WinGetValidateManifestOption::ErrorOnVerifiedPublisherFields);
+            validateOption.InstallerValidation = WI_IsFlagSet(option, WinGetValidateManifestOption::InstallerValidations);
+
+            Manifest manifest = YamlParser::CreateFromPath(inputPath, validateOption, mergedManifestPath ? mergedManifestPath : L"");
+
+            // When the session holds an index, also validate dependencies and ARP versions against it.
+            if (sessionRef.Index())
+            {
+                PackageDependenciesValidation::ValidateManifestDependencies(sessionRef.Index(), manifest);
+                ValidateManifestArpVersion(sessionRef.Index(), manifest);
+            }
+
+            *succeeded = TRUE;
+
+            if (!cacheKey.empty())
+            {
+                sessionRef.ResultCache()->RecordSuccess(std::move(cacheKey));
+            }
+        }
+        catch (const ManifestException& e)
+        {
+            *succeeded = e.IsWarningOnly();
+            if (message)
+            {
+                *message = ::SysAllocString(ConvertToUTF16(e.GetManifestErrorMessage()).c_str());
+            }
+        }
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
+    WINGET_UTIL_API WinGetValidationSessionClose(
+        WINGET_VALIDATION_SESSION_HANDLE session) try
+    {
+        THROW_HR_IF(E_INVALIDARG, !session);
+
+        std::unique_ptr<ValidationSession> toClose{ reinterpret_cast<ValidationSession*>(session) };
+        if (toClose->ResultCache())
+        {
+            toClose->ResultCache()->Save();
+        }
+
+        return S_OK;
+    }
+    CATCH_RETURN()
+
     WINGET_UTIL_API WinGetCreateManifest(
         WINGET_STRING inputPath,
         BOOL* succeeded,
@@ -526,18 +1069,25 @@ extern "C"
             WinGetBeginInstallerMetadataCollectionOption_InputIsFilePath | WinGetBeginInstallerMetadataCollectionOption_InputIsURI));
 
         std::unique_ptr<InstallerMetadataCollectionContext> result;
+        bool asynchronous = WI_IsFlagSet(options, WinGetBeginInstallerMetadataCollectionOption_AsynchronousInitialization);
 
         if (WI_IsFlagSet(options, WinGetBeginInstallerMetadataCollectionOption_InputIsFilePath))
         {
-            result = InstallerMetadataCollectionContext::FromFile(inputJSON, GetPathOrEmpty(logFilePath));
+            result = asynchronous ?
+                InstallerMetadataCollectionContext::FromFileAsync(inputJSON, GetPathOrEmpty(logFilePath)) :
+                InstallerMetadataCollectionContext::FromFile(inputJSON, GetPathOrEmpty(logFilePath));
         }
         else if (WI_IsFlagSet(options, WinGetBeginInstallerMetadataCollectionOption_InputIsURI))
         {
-            result = InstallerMetadataCollectionContext::FromURI(inputJSON, GetPathOrEmpty(logFilePath));
+            result = asynchronous ?
+                InstallerMetadataCollectionContext::FromURIAsync(inputJSON, GetPathOrEmpty(logFilePath)) :
+                InstallerMetadataCollectionContext::FromURI(inputJSON, GetPathOrEmpty(logFilePath));
         }
         else
         {
-            result = InstallerMetadataCollectionContext::FromJSON(inputJSON, GetPathOrEmpty(logFilePath));
+            result = asynchronous ?
+                InstallerMetadataCollectionContext::FromJSONAsync(inputJSON, GetPathOrEmpty(logFilePath)) :
+                InstallerMetadataCollectionContext::FromJSON(inputJSON, GetPathOrEmpty(logFilePath));
         }
 
         *collectionHandle = static_cast<WINGET_INSTALLER_METADATA_COLLECTION_HANDLE>(result.release());
@@ -10,6 +10,12 @@ extern "C"
     // A handle to the manifest.
     typedef void* WINGET_MANIFEST_HANDLE;
 
+    // A handle to a validation result cache.
+    typedef void* WINGET_VALIDATION_RESULT_CACHE_HANDLE;
+
+    // A handle to a validation session.
+    typedef void* WINGET_VALIDATION_SESSION_HANDLE;
+
     // A string taken in by the utility; in UTF16.
     typedef wchar_t const* const WINGET_STRING;
 
@@ -154,6 +160,18 @@ extern "C"
         WINGET_SQLITE_INDEX_HANDLE index,
         BOOL* succeeded);
 
+    // Gets the change journal entries recorded after the given sequence number, in increasing
+    // sequence order. Pass 0 to get the entire journal. The changes string contains one line
+    // per entry with tab separated fields: sequence, change (add, update or remove), id,
+    // version, channel. If lastSequence is provided, it receives the sequence number of the
+    // last returned entry (or the input sequence when there are none), so a caller can resume
+    // from where it left off. Indices without a change journal return an empty string.
+    WINGET_UTIL_API WinGetSQLiteIndexGetChangesSince(
+        WINGET_SQLITE_INDEX_HANDLE index,
+        UINT64 sequence,
+        WINGET_STRING_OUT* changes,
+        UINT64* lastSequence);
+
     // Validates a given manifest. Returns a bool for validation result and
     // a string representing validation errors if validation failed.
     WINGET_UTIL_API WinGetValidateManifest(
@@ -172,6 +190,69 @@ extern "C"
         WINGET_STRING mergedManifestPath,
         WinGetValidateManifestOption option);
 
+    // Validates all manifests found under inputPath, spreading the work across multiple threads.
+    // Each directory that contains only files is validated as one manifest, so both merged single
+    // file manifests and multi file manifest directories are supported.
+    // maximumThreads limits the number of worker threads; 0 selects a count based on the machine.
+    // Returns TRUE in succeeded only when every manifest validated successfully; message aggregates
+    // the validation messages of the individual manifests, each prefixed with its path.
+    WINGET_UTIL_API WinGetValidateManifestBatch(
+        WINGET_STRING inputPath,
+        UINT32 maximumThreads,
+        BOOL* succeeded,
+        WINGET_STRING_OUT* message,
+        WinGetValidateManifestOption option);
+
+    // Opens the validation result cache at cacheFilePath, creating an empty cache if the
+    // file does not exist. The cache memoizes successful validations by a hash of the
+    // manifest content and the validation option, so revalidating unchanged manifests
+    // becomes proportional to the changed set.
+    WINGET_UTIL_API WinGetValidationResultCacheOpen(
+        WINGET_STRING cacheFilePath,
+        WINGET_VALIDATION_RESULT_CACHE_HANDLE* cache);
+
+    // Writes any newly recorded validations back to the cache file and closes the cache.
+    WINGET_UTIL_API WinGetValidationResultCacheClose(
+        WINGET_VALIDATION_RESULT_CACHE_HANDLE cache);
+
+    // Same as WinGetValidateManifestV2, but consults the given validation result cache first;
+    // a manifest whose content and option hash has a recorded successful validation is not
+    // validated again. Only fully successful validations (no warnings) are recorded, so
+    // failure and warning messages are always regenerated. The cache is bypassed when
+    // mergedManifestPath is provided, as a cache hit would not produce the merged manifest.
+    WINGET_UTIL_API WinGetValidateManifestV2Cached(
+        WINGET_STRING inputPath,
+        BOOL* succeeded,
+        WINGET_STRING_OUT* message,
+        WINGET_STRING mergedManifestPath,
+        WinGetValidateManifestOption option,
+        WINGET_VALIDATION_RESULT_CACHE_HANDLE cache);
+
+    // Creates a validation session for callers that validate many manifests in one process.
+    // The session optionally opens the given index for dependency and ARP version validation
+    // and the given validation result cache, and warms process wide validation state
+    // (compiled schemas, ICU tables) so that the first validation costs the same as the rest.
+    // Both paths may be null.
+    WINGET_UTIL_API WinGetValidationSessionCreate(
+        WINGET_STRING indexPath,
+        WINGET_STRING resultCachePath,
+        WINGET_VALIDATION_SESSION_HANDLE* session);
+
+    // Validates a manifest using the session's state. Behaves like WinGetValidateManifestV2;
+    // when the session holds an index, dependencies and ARP versions are also validated
+    // against it, and the result cache is bypassed as its key does not cover index contents.
+    WINGET_UTIL_API WinGetValidationSessionValidateManifest(
+        WINGET_VALIDATION_SESSION_HANDLE session,
+        WINGET_STRING inputPath,
+        BOOL* succeeded,
+        WINGET_STRING_OUT* message,
+        WINGET_STRING mergedManifestPath,
+        WinGetValidateManifestOption option);
+
+    // Closes the validation session, saving the result cache if one is in use.
+    WINGET_UTIL_API WinGetValidationSessionClose(
+        WINGET_VALIDATION_SESSION_HANDLE session);
+
     // Creates a given manifest with optional validation. Returns a bool for operation result and
     // a string representing validation errors if validation failed.
     // If mergedManifestPath is provided, this method will write a merged manifest
@@ -235,6 +316,10 @@ extern "C"
         WinGetBeginInstallerMetadataCollectionOption_InputIsFilePath = 0x1,
         // The inputJSON is a remote URI, not a JSON string.
         WinGetBeginInstallerMetadataCollectionOption_InputIsURI = 0x2,
+        // Retrieve and parse the input on a background thread; WinGetCompleteInstallerMetadataCollection
+        // waits for initialization and reports any failure from it. Enables a single process to run
+        // many collections concurrently.
+        WinGetBeginInstallerMetadataCollectionOption_AsynchronousInitialization = 0x4,
     };
 
     DEFINE_ENUM_FLAG_OPERATORS(WinGetBeginInstallerMetadataCollectionOptions);
@@ -12,7 +12,13 @@
 #pragma warning( pop )
 
 #include <algorithm>
+#include <atomic>
 #include <filesystem>
+#include <fstream>
 #include <memory>
 #include <mutex>
+#include <set>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
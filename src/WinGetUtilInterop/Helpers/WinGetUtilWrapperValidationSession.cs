@@ -0,0 +1,111 @@
+﻿// -----------------------------------------------------------------------
+// <copyright file="WinGetUtilWrapperValidationSession.cs" company="Microsoft Corporation">
+//     Copyright (c) Microsoft Corporation. Licensed under the MIT License.
+// </copyright>
+// -----------------------------------------------------------------------
+
+namespace Microsoft.WinGetUtil.Helpers
+{
+    using System;
+    using System.Runtime.InteropServices;
+
+    /// <summary>
+    /// Wrapper class around the WinGetUtil validation session native implementation.
+    /// A session holds reusable validation state (open index, result cache, warmed
+    /// schemas) so callers validating many manifests in one process, such as a
+    /// manifest repository CI, do not pay the per call warmup.
+    /// For dll entry points are defined here:
+    ///     https://github.com/microsoft/winget-cli/blob/master/src/WinGetUtil/WinGetUtil.h.
+    /// </summary>
+    public sealed class WinGetUtilWrapperValidationSession : IDisposable
+    {
+        private readonly IntPtr sessionHandle;
+        private bool disposed;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="WinGetUtilWrapperValidationSession"/> class.
+        /// </summary>
+        /// <param name="indexPath">Optional path to an index used for dependency and ARP version validation.</param>
+        /// <param name="resultCachePath">Optional path to a validation result cache file.</param>
+        public WinGetUtilWrapperValidationSession(string indexPath = null, string resultCachePath = null)
+        {
+            WinGetValidationSessionCreate(indexPath, resultCachePath, out this.sessionHandle);
+        }
+
+        /// <summary>
+        /// Validates the manifest is compliant using the session's state.
+        /// </summary>
+        /// <param name="manifestPath">Manifest path.</param>
+        /// <param name="mergedManifestPath">Merged manifest output path.</param>
+        /// <param name="option">Desired validate manifest option.</param>
+        /// <returns>Message from manifest validation.</returns>
+        public (bool isValid, string message) ValidateManifest(
+            string manifestPath,
+            string mergedManifestPath = null,
+            WinGetUtilWrapperManifest.ValidateManifestOption option = WinGetUtilWrapperManifest.ValidateManifestOption.Default)
+        {
+            WinGetValidationSessionValidateManifest(
+                this.sessionHandle,
+                manifestPath,
+                out bool succeeded,
+                out string failureOrWarningMessage,
+                mergedManifestPath,
+                option);
+
+            return (succeeded, failureOrWarningMessage);
+        }
+
+        /// <summary>
+        /// Closes the session, saving the result cache if one is in use.
+        /// </summary>
+        public void Dispose()
+        {
+            if (!this.disposed)
+            {
+                WinGetValidationSessionClose(this.sessionHandle);
+                this.disposed = true;
+            }
+        }
+
+        /// <summary>
+        /// Creates a validation session.
+        /// </summary>
+        /// <param name="indexPath">Optional path to an index; null for none.</param>
+        /// <param name="resultCachePath">Optional path to a result cache file; null for none.</param>
+        /// <param name="session">Out session handle.</param>
+        /// <returns>HRESULT.</returns>
+        [DllImport("WinGetUtil.dll", CallingConvention = CallingConvention.StdCall, CharSet = CharSet.Unicode, PreserveSig = false)]
+        private static extern IntPtr WinGetValidationSessionCreate(
+            string indexPath,
+            string resultCachePath,
+            out IntPtr session);
+
+        /// <summary>
+        /// Validates a given manifest using the session's state.
+        /// </summary>
+        /// <param name="session">Session handle.</param>
+        /// <param name="manifestPath">Path to manifest file.</param>
+        /// <param name="succeeded">Out bool is validation succeeded.</param>
+        /// <param name="failureMessage">Out string failure message, if any.</param>
+        /// <param name="mergedManifestPath">Path to merged manifest file. Null means no merged manifest needed.</param>
+        /// <param name="option">Validate manifest option.</param>
+        /// <returns>HRESULT.</returns>
+        [DllImport("WinGetUtil.dll", CallingConvention = CallingConvention.StdCall, CharSet = CharSet.Unicode, PreserveSig = false)]
+        private static extern IntPtr WinGetValidationSessionValidateManifest(
+            IntPtr session,
+            string manifestPath,
+            [MarshalAs(UnmanagedType.U1)] out bool succeeded,
+            [MarshalAs(UnmanagedType.BStr)] out string failureMessage,
+            string mergedManifestPath,
+            WinGetUtilWrapperManifest.ValidateManifestOption option);
+
+        /// <summary>
+        /// Closes the validation session.
+        /// </summary>
+        /// <param name="session">Session handle.</param>
+        /// <returns>HRESULT.</returns>
+        [DllImport("WinGetUtil.dll", CallingConvention = CallingConvention.StdCall, CharSet = CharSet.Unicode, PreserveSig = false)]
+        private static extern IntPtr WinGetValidationSessionClose(
+            IntPtr session);
+    }
+}
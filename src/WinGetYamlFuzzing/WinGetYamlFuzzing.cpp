@@ -19,9 +19,147 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t * data, size_t size)
 
 #ifndef WINGET_DISABLE_FOR_FUZZING
 
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string_view>
+#include <thread>
+#include <vector>
 #include <AppInstallerStrings.h>
 
+// Count every allocation so parser changes that trade speed for memory churn show up
+// in the throughput report alongside MB/s. Only present in the standalone build; the
+// fuzzing configuration never reaches this code.
+static std::atomic<uint64_t> g_allocationCount{ 0 };
+
+void* operator new(std::size_t size)
+{
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* result = std::malloc(size))
+    {
+        return result;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* result = std::malloc(size))
+    {
+        return result;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace
+{
+    // Reads the corpus file or directory into memory up front, so that the replay
+    // measures the parser rather than the disk.
+    std::vector<std::string> LoadCorpus(const std::filesystem::path& corpus)
+    {
+        std::vector<std::string> result;
+
+        if (std::filesystem::is_directory(corpus))
+        {
+            for (auto& file : std::filesystem::directory_iterator{ corpus })
+            {
+                if (!file.is_directory())
+                {
+                    std::ifstream stream{ file.path(), std::ios_base::in | std::ios_base::binary };
+                    result.emplace_back(AppInstaller::Utility::ReadEntireStream(stream));
+                }
+            }
+        }
+        else
+        {
+            std::ifstream stream{ corpus, std::ios_base::in | std::ios_base::binary };
+            result.emplace_back(AppInstaller::Utility::ReadEntireStream(stream));
+        }
+
+        return result;
+    }
+
+    // Replays the corpus through the parser on the requested number of threads for the
+    // given duration, then reports throughput and allocation counts.
+    int RunThroughputHarness(const std::filesystem::path& corpus, size_t threadCount, std::chrono::seconds duration)
+    {
+        std::vector<std::string> manifests = LoadCorpus(corpus);
+
+        if (manifests.empty())
+        {
+            std::cout << "No corpus files found at " << corpus << std::endl;
+            return 1;
+        }
+
+        std::atomic<bool> stop{ false };
+        std::atomic<uint64_t> bytesParsed{ 0 };
+        std::atomic<uint64_t> parseCount{ 0 };
+
+        uint64_t allocationsBefore = g_allocationCount.load();
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&, t]()
+                {
+                    uint64_t bytes = 0;
+                    uint64_t parses = 0;
+
+                    // Stagger the starting points so the threads are not in lock step.
+                    for (size_t i = t; !stop.load(std::memory_order_relaxed); ++i)
+                    {
+                        const std::string& input = manifests[i % manifests.size()];
+
+                        try
+                        {
+                            AppInstaller::Manifest::Manifest manifest = AppInstaller::Manifest::YamlParser::Create(input);
+                        }
+                        catch (...) {}
+
+                        bytes += input.size();
+                        ++parses;
+                    }
+
+                    bytesParsed += bytes;
+                    parseCount += parses;
+                });
+        }
+
+        std::this_thread::sleep_for(duration);
+        stop = true;
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start);
+        uint64_t allocations = g_allocationCount.load() - allocationsBefore;
+        uint64_t parses = parseCount.load();
+
+        std::cout << "Corpus files:       " << manifests.size() << '\n';
+        std::cout << "Threads:            " << threadCount << '\n';
+        std::cout << "Elapsed seconds:    " << elapsed.count() << '\n';
+        std::cout << "Manifests parsed:   " << parses << '\n';
+        std::cout << "Throughput MB/s:    " << (bytesParsed.load() / (1024.0 * 1024.0)) / elapsed.count() << '\n';
+        std::cout << "Allocations:        " << allocations << '\n';
+        std::cout << "Allocations/parse:  " << (parses ? allocations / parses : 0) << std::endl;
+
+        return 0;
+    }
+}
+
 // Emulate libFuzzer main by just sending all files in the corpus (last arg) to the fuzzer.
 int main(int argc, char** argv)
 {
@@ -32,6 +170,29 @@ int main(int argc, char** argv)
 
     std::filesystem::path corpus = argv[argc - 1];
 
+    // Throughput harness mode: -throughput[=N] <corpus>; N defaults to the hardware concurrency.
+    for (int i = 1; i < argc - 1; ++i)
+    {
+        std::string_view arg = argv[i];
+
+        if (arg.substr(0, 11) == "-throughput")
+        {
+            size_t threadCount = std::thread::hardware_concurrency();
+
+            if (arg.size() > 12 && arg[11] == '=')
+            {
+                threadCount = static_cast<size_t>(std::strtoul(arg.data() + 12, nullptr, 10));
+            }
+
+            if (!threadCount)
+            {
+                threadCount = 1;
+            }
+
+            return RunThroughputHarness(corpus, threadCount, std::chrono::seconds{ 10 });
+        }
+    }
+
     if (std::filesystem::is_directory(corpus))
     {
         for (auto& file : std::filesystem::directory_iterator{ corpus })
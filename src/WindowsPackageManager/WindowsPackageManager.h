@@ -28,6 +28,9 @@ extern "C"
     // Unregisters the server module class factories.
     WINDOWS_PACKAGE_MANAGER_API WindowsPackageManagerServerModuleUnregister();
 
+    // Gets the current count of objects in the server module.
+    UINT32 WINDOWS_PACKAGE_MANAGER_API_CALLING_CONVENTION WindowsPackageManagerServerModuleGetObjectCount();
+
     // Callback for logging the WIL result reported from the server.
     void WINDOWS_PACKAGE_MANAGER_API_CALLING_CONVENTION WindowsPackageManagerServerWilResultLoggingCallback(const wil::FailureInfo& info) noexcept;
 
@@ -61,6 +61,11 @@ extern "C"
     }
     CATCH_RETURN();
 
+    UINT32 WINDOWS_PACKAGE_MANAGER_API_CALLING_CONVENTION WindowsPackageManagerServerModuleGetObjectCount()
+    {
+        return static_cast<UINT32>(::Microsoft::WRL::Module<::Microsoft::WRL::ModuleType::OutOfProc>::GetModule().GetObjectCount());
+    }
+
     void WINDOWS_PACKAGE_MANAGER_API_CALLING_CONVENTION WindowsPackageManagerServerWilResultLoggingCallback(const wil::FailureInfo& failure) noexcept try
     {
         AppInstaller::Logging::Telemetry().LogFailure(failure);